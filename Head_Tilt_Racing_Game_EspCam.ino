@@ -1,7 +1,27 @@
+#include "esp32/rom/tjpgd.h"
 #include "esp_camera.h"
-#include "web_index.h" // Contains the HTML game code
+#include "esp_timer.h"
+#include "frame_arena.h"
+#include "frame_headers.h"
+#include "img_converters.h"
+#include "jpeg_bands.h"
+#include "latency_histogram.h"
+#include "latest_frame.h"
+#include "motion_gate.h"
+#include "quality_controller.h"
+#include "session_log.h"
+#include "synthetic_camera.h"
+#include "tilt_estimator.h"
+#include "tilt_filter.h"
+#include "tilt_kernels.h"
+#include "tilt_message.h"
+#include "web_assets.h" // Gzipped game page, generated by tools/embed_web.py
 #include <WebServer.h>
+#include <WebSocketsServer.h>
 #include <WiFi.h>
+#include <atomic>
+#include <lwip/sockets.h>
+#include <stdarg.h>
 
 // ==========================================
 // CONFIGURATION
@@ -11,6 +31,23 @@
 #define CAMERA_MODEL_AI_THINKER
 #include "camera_pins.h"
 
+// Tracking pipeline: uncomment to capture raw grayscale at QVGA (QQVGA
+// without PSRAM) and track on it directly, skipping the JPEG decode.
+// Viewers still get JPEG, encoded on demand.
+// #define PIPELINE_GRAYSCALE
+
+// Bench mode: uncomment to replace the sensor with synthetic grayscale
+// frames (a face rolling through a known sweep, see synthetic_camera.h).
+// Every run gets the same input, so tools/load_test.py numbers are
+// repeatable, and /tilt also reports the true angle. Runs without a sensor.
+// #define CAMERA_SYNTHETIC
+
+// Reported by /time, so latency reports from different builds can be told
+// apart. Override with -DFIRMWARE_BUILD=\"...\" for a readable name.
+#ifndef FIRMWARE_BUILD
+#define FIRMWARE_BUILD __DATE__ " " __TIME__
+#endif
+
 // WIFI CREDENTIALS (EDIT THESE!)
 const char *ssid = "JOYRC";
 const char *password = "joyrc000";
@@ -18,11 +55,412 @@ const char *password = "joyrc000";
 // Web Server on port 80
 WebServer server(80);
 
+// WebSocket control channel on port 81: binary tilt/lane updates pushed as
+// soon as each frame is tracked (format in tilt_message.h)
+WebSocketsServer webSocket(81);
+TiltConfig tiltConfig;
+uint32_t lastBroadcastSeq = 0;
+TiltLaneLatch broadcastLane;
+// The broadcast tilt is extrapolated this far past the time it is sent:
+// delivery to the page plus about one game frame
+#define TILT_DISPLAY_LEAD_MS 30
+
+// Newest driver buffer, published by captureTask and pinned by the HTTP
+// handlers. Needs one slot per buffer the driver can hand out (fb_count).
+// The JPEG pipeline sends to viewers straight from driver buffers, so every
+// viewer still sending a superseded frame holds one; with the one being
+// filled, the newest and trackTask's, MAX_VIEWERS + 3 buffers keep a slow
+// viewer from holding up captureTask (tools/viewer_check.cpp).
+#define FRAME_SLOTS 9
+// Grayscale frames are encoded into a private copy for viewers, so only
+// trackTask keeps a superseded buffer
+#define GRAY_FRAME_BUFFERS 3
+#ifdef CAMERA_SYNTHETIC
+camera_fb_t *syntheticFbGet();
+void syntheticFbReturn(camera_fb_t *fb);
+#define CAMERA_FB_GET syntheticFbGet
+#define CAMERA_FB_RETURN syntheticFbReturn
+#else
+#define CAMERA_FB_GET esp_camera_fb_get
+#define CAMERA_FB_RETURN esp_camera_fb_return
+#endif
+LatestFrame<camera_fb_t, FRAME_SLOTS> latestFrame(CAMERA_FB_RETURN);
+
+// On-device head tracking: frames are decoded at reduced scale to this size
+// (or smaller) in grayscale before looking for the eyes.
+#define TRACK_MAX_WIDTH 200
+#define TRACK_MAX_HEIGHT 150
+uint8_t *trackGray = NULL; // fastArena
+
+// Frame arena (frame_arena.h): every buffer the frame path uses is carved
+// out at boot, so streaming and tracking in steady state do not allocate
+// and the heap does not fragment over a long session. fastArena is
+// internal RAM, for what the CPU reads most; bulkArena is PSRAM when there
+// is some. The camera driver allocates its own frame buffers once, in
+// esp_camera_init().
+#define ENCODE_SLOT_BYTES_PSRAM (48 * 1024) // one viewer's JPEG (grayscale or crop)
+#define ENCODE_SLOT_BYTES_DRAM (8 * 1024)
+#define ENCODE_SLOTS_DRAM 2
+#define ROI_CROP_BYTES_PSRAM (320 * 240 * 3) // bigger crops go out uncropped
+#define ROI_CROP_BYTES_DRAM (16 * 1024)
+#define METRICS_BYTES 6144
+FrameArena fastArena;
+FrameArena bulkArena;
+SlotPool encodeSlots; // JPEGs encoded for viewers; httpTask only
+uint8_t *roiCrop = NULL; // httpTask only
+size_t roiCropBytes = 0;
+char *metricsText = NULL; // httpTask only
+// /metrics text, built in metricsText; lines that do not fit are dropped
+struct MetricsText {
+  char *buf;
+  size_t size;
+  size_t len;
+};
+
+// JPEG decoding with a work area per task (see decodeJpeg)
+#define JPEG_WORK_BYTES 3100
+#define JPEG_WORK_TRACK 0  // trackTask
+#define JPEG_WORK_HELPER 1 // decodeHelperTask
+#define JPEG_WORK_HTTP 2   // httpTask, /roi crops
+#define JPEG_WORKS 3
+uint8_t *jpegWork[JPEG_WORKS] = {};
+// What decodeJpeg() hands the decoder as its device
+struct JpegSource {
+  size_t len;
+  size_t index;
+  jpg_reader_cb reader;
+  jpg_writer_cb writer;
+  void *arg;
+};
+TiltEstimator tiltEstimator;
+
+// Frames with restart markers are decoded in two bands, the bottom one on
+// the PRO core (jpeg_bands.h); 1 decodes every frame on the tracking core
+#define DECODE_BANDS 2
+static_assert(DECODE_BANDS == 1 || DECODE_BANDS == 2, "one band per core");
+QueueHandle_t decodeHelperQueue = NULL; // bottom-band jobs for decodeHelperTask
+SemaphoreHandle_t decodeHelperDone = NULL;
+// One decode to tracking size, whole or one band (decodeGray())
+struct GrayDecodeJob {
+  const uint8_t *jpeg;
+  uint8_t *gray;
+  uint8_t *work; // the decoding task's jpegWork
+  uint16_t width;
+  uint16_t height;
+  // Set when decoding one band: its rows start `top` rows into gray
+  const JpegLayout *layout;
+  const JpegBand *band;
+  uint16_t top;
+  jpg_scale_t scale;
+  bool ok;
+  bool banded; // decodeGray() split the frame
+};
+
+// /decode: the tracking task decodes one camera frame DECODE_BENCH_RUNS
+// times at full size, at tracking size and at tracking size in bands
+#define DECODE_BENCH_RUNS 20
+#define DECODE_BENCH_TIMEOUT_MS 10000 // for trackTask to pick the run up
+#define DECODE_BENCH_IDLE 0
+#define DECODE_BENCH_REQUESTED 1
+#define DECODE_BENCH_RUNNING 2
+#define DECODE_BENCH_DONE 3
+#define DECODE_BENCH_FAILED 4 // not a JPEG frame
+std::atomic<uint8_t> decodeBenchState{DECODE_BENCH_IDLE};
+LatencyHistogram decodeBenchMicros[3]; // full, scaled, banded
+JpegLayout decodeBenchLayout = {};
+uint32_t decodeBenchBytes = 0;
+uint16_t decodeBenchWidth = 0; // tracking size
+bool decodeBenchBanded = false;
+uint32_t decodeBenchStartMs = 0; // httpTask only
+bool decodeBenchTimedOut = false; // httpTask only
+
+// /profile?bench: captureTask stops publishing and times consecutive
+// CAMERA_FB_GET() calls, handing every buffer straight back
+#define CAPTURE_BENCH_WARMUP 3 // frames skipped after a profile change
+#define CAPTURE_BENCH_FRAMES 30
+#define CAPTURE_BENCH_MAX_FRAMES 200
+#define CAPTURE_BENCH_TIMEOUT_MS 10000 // per profile
+std::atomic<uint8_t> captureBenchState{DECODE_BENCH_IDLE}; // same states as /decode
+uint16_t captureBenchFrames = CAPTURE_BENCH_FRAMES;
+LatencyHistogram captureBenchMicros; // between consecutive frames
+uint32_t captureBenchTotalMicros = 0;
+uint32_t captureBenchBytes = 0; // mean frame size
+
+// Latest tracking result, written by trackTask and read by /tilt
+struct TiltReport {
+  TiltResult tilt;
+  uint32_t seq;
+  uint16_t width;
+  uint16_t height;
+  uint32_t micros; // decode + estimate time
+  uint32_t captureMs; // when the frame was captured, millis() clock
+  TiltFilter filter; // smoothed tilt up to this frame (tilt_filter.h)
+#ifdef CAMERA_SYNTHETIC
+  float truth; // angle the frame was rendered with
+#endif
+};
+TiltReport tiltReport = {};
+portMUX_TYPE tiltMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Motion gate: trackTask compares every tracked frame with the last one
+// that changed (motion_gate.h); viewers skip frames while nothing moved and
+// still get one at least every GATE_KEYFRAME_MS. Set the threshold (mean
+// gray-level difference) to 0 to send every frame.
+#define GATE_THRESHOLD 6
+#define GATE_KEYFRAME_MS 1000
+#define GATE_MAX_LAG 3 // frames; a tracker further behind is not trusted
+MotionGate motionGate(GATE_THRESHOLD);
+std::atomic<uint32_t> gateSeq{0};    // last frame the gate looked at
+std::atomic<uint32_t> changedSeq{0}; // last frame that counted as changed
+
+// Session recording (session_log.h): /record?start records tracked frames
+// and every tilt measurement until the buffer is full or /record?stop, and
+// /session downloads the recording. trackTask appends under sessionLock and
+// skips a frame rather than wait for it; the handlers hold it to reset the
+// buffer, and the download to copy out one chunk at a time. Without PSRAM
+// only tilt is recorded.
+#define SESSION_BYTES_PSRAM (2 * 1024 * 1024)
+#define SESSION_BYTES_DRAM (32 * 1024)
+uint8_t *sessionBuf = NULL;
+size_t sessionCapacity = 0;
+SessionWriter session;
+SemaphoreHandle_t sessionLock = NULL;
+std::atomic<bool> sessionRecording{false};
+uint32_t sessionFrameEvery = 1; // record every Nth tracked frame, 0 = none
+uint32_t sessionFrames = 0;     // trackTask only
+TiltLaneLatch sessionLane;      // trackTask only
+
+// /session in progress: httpTask sends it a chunk at a time without
+// blocking, like a viewer, so a 2 MB recording on a slow link holds up
+// neither the other clients nor trackTask's recording
+#define SESSION_CHUNK 1436         // one TCP segment per send()
+#define SESSION_STALL_MS 5000      // no progress this long drops the download
+struct SessionDownload {
+  bool active;
+  WiFiClient client;
+  size_t length; // the recording's size when it was requested
+  size_t offset; // bytes of it sent
+  uint8_t chunk[SESSION_CHUNK]; // copied out under sessionLock
+  size_t chunkLen;
+  size_t chunkSent;
+  uint32_t progressMs; // last send that went through
+};
+SessionDownload sessionDownload; // httpTask only
+
+// Region of interest for /roi: where the face is, from trackTask's eyes or
+// a box the page posts back over the WebSocket. Guarded by tiltMux.
+#define ROI_BOX_MAX_AGE_MS 1000 // older boxes are not trusted
+#define ROI_FULL_EVERY_MS 2000  // full frame this often, to re-acquire the face
+#define ROI_MARGIN 4            // the box grows by 1/ROI_MARGIN on each side
+FaceBox faceBox = {};
+uint32_t faceBoxAtMs = 0;
+uint32_t pageBoxAtMs = 0; // the page's box wins while it keeps sending
+uint32_t lastFullRoiMs = 0; // httpTask only
+
+// Adaptive stream quality: cheapest level first, the top level matches
+// what setupCamera() starts with (the driver sized its buffers for it).
+static const QualityLevel QUALITY_LADDER_PSRAM[] = {
+    {FRAMESIZE_QVGA, 15}, {FRAMESIZE_CIF, 14}, {FRAMESIZE_HVGA, 12},
+    {FRAMESIZE_VGA, 14},  {FRAMESIZE_VGA, 10},
+};
+static const QualityLevel QUALITY_LADDER_DRAM[] = {
+    {FRAMESIZE_QQVGA, 14}, {FRAMESIZE_HQVGA, 12}, {FRAMESIZE_QVGA, 12},
+};
+// JPEG pipeline only. Fed, updated and read only from httpTask.
+QualityController *qualityController = NULL;
+
+// Sensor profiles for /profile (see SENSOR PROFILES). The OV2640 reads its
+// array out in one of three modes and its DSP scales that down to the frame
+// size: the UXGA readout is the sharpest and the slowest, CIF the fastest.
+// A lower XCLK slows every readout down but allows longer exposures.
+#define OV2640_READOUT_UXGA 0 // 1600x1200
+#define OV2640_READOUT_SVGA 1 // 800x600
+#define OV2640_READOUT_CIF 2  // 400x300
+#define READOUT_DEFAULT 0xff  // whatever set_framesize() picks
+
+struct SensorProfile {
+  const char *name; // for /profile?name=
+  const char *label;
+  bool adaptive;         // frame size and quality from qualityController
+  framesize_t frameSize; // capped at what setupCamera() started with
+  int quality;
+  uint8_t readout; // OV2640_READOUT_*, whole array
+  uint8_t xclkMhz;
+  bool aec2; // exposure in the DSP: finer steps, slower to settle
+  int8_t aeLevel;
+  gainceiling_t gainCeiling;
+};
+static const SensorProfile SENSOR_PROFILES[] = {
+    // What setupCamera() starts with; the quality controller steps it
+    {"adaptive", "Adaptive", true, FRAMESIZE_INVALID, 0, READOUT_DEFAULT, 20, false, 0,
+     GAINCEILING_2X},
+    // Small, fast frames for the tracker; gain rather than long exposures
+    {"tracking", "Low-latency tracking", false, FRAMESIZE_QVGA, 14, OV2640_READOUT_CIF, 20,
+     false, 0, GAINCEILING_8X},
+    // The whole sensor scaled down to the frame: sharpest, about half the rate
+    {"spectator", "Spectator quality", false, FRAMESIZE_VGA, 10, OV2640_READOUT_UXGA, 20, true,
+     0, GAINCEILING_2X},
+    // Half the clock doubles the longest exposure; brighter, more gain
+    {"lowlight", "Low light", false, FRAMESIZE_VGA, 12, OV2640_READOUT_SVGA, 10, true, 1,
+     GAINCEILING_32X},
+};
+#define SENSOR_PROFILE_COUNT (sizeof(SENSOR_PROFILES) / sizeof(SENSOR_PROFILES[0]))
+// Last /profile?bench result of a profile; fps 0 = not measured
+struct ProfileBench {
+  float fps;
+  uint32_t bytes; // mean frame size
+  uint32_t p50Micros, maxMicros; // between frames
+};
+// A /profile?bench run, stepped by serviceProfileBench() from httpTask's
+// loop so the stream, WebSocket and other requests keep being served
+struct ProfileBenchRun {
+  bool active;
+  int only;       // profile to time, -1 = every profile
+  size_t current; // profile being timed
+  size_t restore; // profile to end on
+  uint16_t frames;
+  uint32_t startMs; // when the current profile's frames were requested
+};
+// httpTask only
+size_t activeProfile = 0;
+ProfileBench profileBench[SENSOR_PROFILE_COUNT] = {};
+ProfileBenchRun profileBenchRun = {};
+framesize_t bootFrameSize = FRAMESIZE_VGA;   // set by setupCamera()
+int bootQuality = 12;
+
+// Frame viewers: /stream clients (player + spectators, one multipart part
+// per frame) and /capture clients (one response). httpTask sends to all of
+// them without blocking, straight from the frame buffer, a socket-sized
+// chunk at a time; a viewer that cannot keep up skips frames.
+#define MAX_VIEWERS 6
+#define VIEWER_CHUNK 1436   // one TCP segment per send()
+#define VIEWER_BURST 4      // chunks per viewer per pass, so viewers interleave
+#define VIEWER_STALL_MS 1000 // holding a superseded buffer longer drops the viewer
+static_assert(FRAME_SLOTS >= MAX_VIEWERS + 3, "a slow viewer would hold up captureTask");
+
+struct Viewer {
+  bool active;
+  bool stream;     // multipart /stream, else a one-shot /capture
+  bool headerSent; // stream: HTTP response header already went out
+  WiFiClient client;
+  const PinnedFrame<camera_fb_t> *pinned; // buffer being sent, if still pinned
+  const uint8_t *jpg;
+  size_t jpgLen;
+  bool encoded; // jpg was encoded for this viewer into one of encodeSlots
+  bool sending;
+  bool gated;   // frames were held back as unchanged since the last send
+  bool roi;     // /roi: crop to the face
+  bool roiFull; // /roi?full=1: send the whole frame this time
+  uint16_t roiX, roiY, roiW, roiH; // crop actually sent
+  uint16_t frameW, frameH;
+  uint32_t seq; // frame being sent, or last sent
+  uint32_t captureMs; // capture time of that frame, millis() clock
+  char header[FRAME_HEADER_MAX];
+  size_t headerLen;
+  size_t offset; // bytes of header + jpg + trailer already sent
+  uint32_t startUs;
+  uint32_t headerDoneUs;
+  uint32_t startMs;
+};
+Viewer viewers[MAX_VIEWERS];
+
+// Send times for the quality controller, per frame: the slowest stream
+// viewer that completed it
+uint32_t qualitySeq = 0;
+uint32_t qualityBytes = 0;
+uint32_t qualityMicros = 0;
+
+// Per-stage timings (microseconds, from the CPU cycle counter) and counters
+// served by /metrics. Recording is a few atomic adds, so it stays on.
+LatencyHistogram grabMicros;   // CAMERA_FB_GET()
+LatencyHistogram frameBytes;   // JPEG size sent to viewers
+LatencyHistogram headerMicros; // response / stream part header send
+LatencyHistogram bodyMicros;   // JPEG body send
+LatencyHistogram returnMicros; // release, including CAMERA_FB_RETURN()
+LatencyHistogram trackMicros;  // decode + tilt estimate
+LatencyHistogram decodeMicros; // JPEG decode to tracking size
+LatencyHistogram sendAgeMicros;  // capture -> frame starts going out to a viewer
+LatencyHistogram trackAgeMicros; // capture -> tilt result ready
+std::atomic<uint32_t> framesCaptured{0};
+std::atomic<uint32_t> framesSent{0};
+std::atomic<uint32_t> framesDropped{0}; // no free slot, skipped or failed by a viewer
+std::atomic<uint32_t> captureFailures{0};
+std::atomic<uint32_t> framesUnchanged{0}; // held back by the motion gate
+std::atomic<uint32_t> bytesSaved{0};      // estimated from the viewer's last frame
+std::atomic<uint32_t> framesBanded{0};    // decoded on both cores
+uint32_t cpuMHz = 240;
+
 // ==========================================
 // CAMERA SETUP
 // ==========================================
 
+// The driver stamps each buffer from esp_timer (time since boot), the same
+// clock as millis() and micros()
+static uint32_t captureMs(const camera_fb_t *fb) {
+  return fb->timestamp.tv_sec * 1000 + fb->timestamp.tv_usec / 1000;
+}
+
+static uint32_t captureMicros(const camera_fb_t *fb) {
+  return fb->timestamp.tv_sec * 1000000 + fb->timestamp.tv_usec;
+}
+
+#ifdef CAMERA_SYNTHETIC
+#define SYNTHETIC_FPS 25
+camera_fb_t syntheticFrames[GRAY_FRAME_BUFFERS];
+float syntheticTruth[GRAY_FRAME_BUFFERS]; // angle each buffer was last rendered with
+QueueHandle_t syntheticFree = NULL;
+uint32_t syntheticCount = 0;
+
+// Same buffer count and size the grayscale pipeline asks the driver for
+void setupSyntheticCamera() {
+  bool psram = psramFound();
+  size_t width = psram ? 320 : 160;
+  size_t height = psram ? 240 : 120;
+  syntheticFree = xQueueCreate(GRAY_FRAME_BUFFERS, sizeof(camera_fb_t *));
+  for (int i = 0; i < GRAY_FRAME_BUFFERS; i++) {
+    camera_fb_t *fb = &syntheticFrames[i];
+    fb->buf = (uint8_t *)(psram ? ps_malloc(width * height) : malloc(width * height));
+    if (!fb->buf) {
+      Serial.println("Synthetic frame allocation failed");
+      break;
+    }
+    fb->len = width * height;
+    fb->width = width;
+    fb->height = height;
+    fb->format = PIXFORMAT_GRAYSCALE;
+    xQueueSend(syntheticFree, &fb, 0);
+  }
+}
+
+// Paced like the sensor, and blocks like the driver while every buffer is
+// still held downstream
+camera_fb_t *syntheticFbGet() {
+  static TickType_t lastFrame = xTaskGetTickCount();
+  vTaskDelayUntil(&lastFrame, pdMS_TO_TICKS(1000 / SYNTHETIC_FPS));
+
+  camera_fb_t *fb;
+  if (xQueueReceive(syntheticFree, &fb, portMAX_DELAY) != pdTRUE) {
+    return NULL;
+  }
+  float angle = syntheticAngle(syntheticCount++);
+  renderSyntheticFace(fb->buf, fb->width, fb->height, angle);
+  syntheticTruth[fb - syntheticFrames] = angle;
+  int64_t now = esp_timer_get_time();
+  fb->timestamp.tv_sec = now / 1000000;
+  fb->timestamp.tv_usec = now % 1000000;
+  return fb;
+}
+
+void syntheticFbReturn(camera_fb_t *fb) {
+  xQueueSend(syntheticFree, &fb, 0);
+}
+#endif
+
 void setupCamera() {
+#ifdef CAMERA_SYNTHETIC
+  setupSyntheticCamera();
+  return;
+#endif
   camera_config_t config;
   config.ledc_channel = LEDC_CHANNEL_0;
   config.ledc_timer = LEDC_TIMER_0;
@@ -43,7 +481,11 @@ void setupCamera() {
   config.pin_pwdn = PWDN_GPIO_NUM;
   config.pin_reset = RESET_GPIO_NUM;
   config.xclk_freq_hz = 20000000;
+#ifdef PIPELINE_GRAYSCALE
+  config.pixel_format = PIXFORMAT_GRAYSCALE;
+#else
   config.pixel_format = PIXFORMAT_JPEG;
+#endif
 
   // Frame size: VGA (640x480) is good for the game.
   config.frame_size = FRAMESIZE_VGA;
@@ -53,15 +495,27 @@ void setupCamera() {
   if (config.pixel_format == PIXFORMAT_JPEG) {
     if (psramFound()) {
       config.jpeg_quality = 10;
-      config.fb_count = 2;
+      // One being filled, the newest, trackTask's and one per viewer
+      config.fb_count = FRAME_SLOTS;
       config.grab_mode = CAMERA_GRAB_LATEST;
     } else {
-      config.frame_size = FRAMESIZE_SVGA;
+      // latestFrame always holds one buffer, so the driver needs a second
+      // one to keep capturing; keep both small enough for DRAM.
+      config.frame_size = FRAMESIZE_QVGA;
+      config.fb_count = 2;
       config.fb_location = CAMERA_FB_IN_DRAM;
     }
   } else {
-    config.frame_size = FRAMESIZE_240X240;
-    config.fb_location = CAMERA_FB_IN_DRAM;
+    // Grayscale tracking pipeline: coarse geometry is all the tracker needs
+    config.grab_mode = CAMERA_GRAB_LATEST;
+    if (psramFound()) {
+      config.frame_size = FRAMESIZE_QVGA;
+      config.fb_count = GRAY_FRAME_BUFFERS;
+    } else {
+      config.frame_size = FRAMESIZE_QQVGA;
+      config.fb_count = 2;
+      config.fb_location = CAMERA_FB_IN_DRAM;
+    }
   }
 
   esp_err_t err = esp_camera_init(&config);
@@ -69,34 +523,1639 @@ void setupCamera() {
     Serial.printf("Camera init failed with error 0x%x", err);
     return;
   }
+  bootFrameSize = config.frame_size;
+  bootQuality = config.jpeg_quality;
+
+  if (config.pixel_format == PIXFORMAT_JPEG) {
+    if (psramFound()) {
+      size_t count = sizeof(QUALITY_LADDER_PSRAM) / sizeof(QUALITY_LADDER_PSRAM[0]);
+      qualityController = new QualityController(QUALITY_LADDER_PSRAM, count, count - 1);
+    } else {
+      size_t count = sizeof(QUALITY_LADDER_DRAM) / sizeof(QUALITY_LADDER_DRAM[0]);
+      qualityController = new QualityController(QUALITY_LADDER_DRAM, count, count - 1);
+    }
+  }
+}
+
+// Cycle counter is per core; only time stages that stay on one task
+static inline uint32_t cyclesToMicros(uint32_t startCycles) {
+  return (ESP.getCycleCount() - startCycles) / cpuMHz;
+}
+
+// Times captureBenchFrames frames after CAPTURE_BENCH_WARMUP, at the rate
+// the sensor delivers them: nothing downstream holds them up. The newest
+// published frame stays pinned meanwhile, as it would in normal running.
+static void runCaptureBench() {
+  captureBenchMicros.reset();
+  uint64_t bytes = 0;
+  uint32_t first = 0;
+  uint32_t last = 0;
+  for (int i = 0; i < CAPTURE_BENCH_WARMUP + captureBenchFrames; i++) {
+    camera_fb_t *fb = CAMERA_FB_GET();
+    if (!fb) {
+      captureFailures++;
+      captureBenchState.store(DECODE_BENCH_FAILED);
+      return;
+    }
+    uint32_t now = micros();
+    if (i == CAPTURE_BENCH_WARMUP - 1) {
+      first = now;
+    } else if (i >= CAPTURE_BENCH_WARMUP) {
+      captureBenchMicros.record(now - last);
+      bytes += fb->len;
+    }
+    last = now;
+    CAMERA_FB_RETURN(fb);
+  }
+  captureBenchTotalMicros = last - first;
+  captureBenchBytes = bytes / captureBenchFrames;
+  captureBenchState.store(DECODE_BENCH_DONE);
+}
+
+// Producer: runs on its own core and publishes every driver buffer as the
+// newest frame, so HTTP handlers never wait on the sensor.
+void captureTask(void *arg) {
+  for (;;) {
+    uint8_t benchRequested = DECODE_BENCH_REQUESTED;
+    if (captureBenchState.compare_exchange_strong(benchRequested, DECODE_BENCH_RUNNING)) {
+      runCaptureBench();
+    }
+
+    uint32_t start = ESP.getCycleCount();
+    camera_fb_t *fb = CAMERA_FB_GET();
+    if (!fb) {
+      captureFailures++;
+      Serial.println("Camera capture failed");
+      vTaskDelay(pdMS_TO_TICKS(100));
+      continue;
+    }
+    grabMicros.record(cyclesToMicros(start));
+    framesCaptured++;
+
+    // Ownership passes to latestFrame; the buffer goes back to the driver
+    // once it is superseded and the last viewer has released it.
+    if (!latestFrame.publish(fb)) {
+      framesDropped++;
+    }
+  }
+}
+
+// ==========================================
+// SENSOR PROFILES
+// ==========================================
+
+// The driver sized its buffers for bootFrameSize in esp_camera_init(), so
+// bigger frame sizes are capped to it, and raw grayscale frames stay
+// exactly that size
+static framesize_t profileFrameSize(const SensorProfile &p) {
+  if (p.adaptive) {
+    return qualityController ? (framesize_t)qualityController->current().frameSize
+                             : bootFrameSize;
+  }
+#ifdef PIPELINE_GRAYSCALE
+  return bootFrameSize;
+#else
+  return p.frameSize < bootFrameSize ? p.frameSize : bootFrameSize;
+#endif
+}
+
+// Applies SENSOR_PROFILES[index] through sensor_t; the camera keeps
+// running. The driver's grab mode and buffer count stay as esp_camera_init()
+// set them. httpTask only, like updateQuality().
+static bool applyProfile(size_t index) {
+  sensor_t *s = esp_camera_sensor_get();
+  if (!s || index >= SENSOR_PROFILE_COUNT) {
+    return false;
+  }
+  const SensorProfile &p = SENSOR_PROFILES[index];
+  framesize_t size = profileFrameSize(p);
+  int quality = p.quality;
+  if (p.adaptive) {
+    quality = qualityController ? qualityController->current().quality : bootQuality;
+  }
+
+  s->set_xclk(s, LEDC_TIMER_0, p.xclkMhz);
+  // Also resets the window to the default readout for this size
+  s->set_framesize(s, size);
+  bool windowed = false;
+  if (p.readout != READOUT_DEFAULT && s->id.PID == OV2640_PID) {
+    // OV2640: startX is the readout mode, the window is in that mode's
+    // pixels, and the DSP can only scale down; the other arguments are
+    // unused
+    int width = 1600 >> p.readout;
+    int height = 1200 >> p.readout;
+    int outWidth = resolution[size].width;
+    int outHeight = resolution[size].height;
+    if (outWidth <= width && outHeight <= height) {
+      windowed = s->set_res_raw(s, p.readout, 0, 0, 0, 0, 0, width, height, outWidth, outHeight,
+                                false, false) == 0;
+    }
+  }
+  s->set_quality(s, quality);
+  s->set_exposure_ctrl(s, 1);
+  s->set_gain_ctrl(s, 1);
+  s->set_aec2(s, p.aec2);
+  s->set_ae_level(s, p.aeLevel);
+  s->set_gainceiling(s, p.gainCeiling);
+
+  activeProfile = index;
+  // Its window would mix frames from before the change
+  if (qualityController) {
+    qualityController->restartWindow(millis());
+  }
+  Serial.printf("Sensor profile: %s, %ux%u q%d, %u MHz%s\n", p.label, resolution[size].width,
+                resolution[size].height, quality, p.xclkMhz, windowed ? ", windowed" : "");
+  return true;
+}
+
+// Switches to the next profile of the run and has captureTask time it;
+// ends the run after the last one
+static void nextProfileBench(ProfileBenchRun &run, size_t from) {
+  for (size_t i = from; i < SENSOR_PROFILE_COUNT; i++) {
+    if (run.only >= 0 && (int)i != run.only) {
+      continue;
+    }
+    applyProfile(i);
+    run.current = i;
+    run.startMs = millis();
+    captureBenchFrames = run.frames;
+    captureBenchState.store(DECODE_BENCH_REQUESTED);
+    return;
+  }
+  applyProfile(run.restore);
+  run.active = false;
+}
+
+static bool startProfileBench(int only, uint16_t frames) {
+  ProfileBenchRun &run = profileBenchRun;
+  // A timed-out run may still have captureTask busy
+  uint8_t state = captureBenchState.load();
+  if (run.active || state == DECODE_BENCH_REQUESTED || state == DECODE_BENCH_RUNNING) {
+    return false;
+  }
+  run.active = true;
+  run.only = only;
+  run.restore = only >= 0 ? only : activeProfile;
+  run.frames = frames;
+  nextProfileBench(run, 0);
+  return true;
+}
+
+// From httpTask's loop: collects the current profile's result once
+// captureTask has it and moves on. The camera stream pauses while a
+// profile is timed; nothing else waits for it.
+void serviceProfileBench() {
+  ProfileBenchRun &run = profileBenchRun;
+  if (!run.active) {
+    return;
+  }
+  uint8_t state = captureBenchState.load();
+  bool busy = state == DECODE_BENCH_REQUESTED || state == DECODE_BENCH_RUNNING;
+  if (busy && millis() - run.startMs < CAPTURE_BENCH_TIMEOUT_MS) {
+    return;
+  }
+
+  const SensorProfile &p = SENSOR_PROFILES[run.current];
+  ProfileBench result = {};
+  if (state == DECODE_BENCH_DONE && captureBenchTotalMicros != 0) {
+    result.fps = run.frames * 1000000.0f / captureBenchTotalMicros;
+    result.bytes = captureBenchBytes;
+    result.p50Micros = captureBenchMicros.percentile(0.5f);
+    result.maxMicros = captureBenchMicros.max();
+    Serial.printf("Profile %s: %.1f fps, %u bytes/frame\n", p.name, result.fps,
+                  (unsigned)result.bytes);
+  } else {
+    Serial.printf("Profile %s: no frames in time\n", p.name);
+  }
+  profileBench[run.current] = result;
+  if (qualityController) {
+    qualityController->restartWindow(millis());
+  }
+
+  if (busy) {
+    // captureTask is still at it; the rest of the run would read its result
+    applyProfile(run.restore);
+    run.active = false;
+    return;
+  }
+  captureBenchState.store(DECODE_BENCH_IDLE);
+  nextProfileBench(run, run.current + 1);
+}
+
+// ==========================================
+// JPEG DECODING
+// ==========================================
+
+// esp_jpg_decode() has one static work area, which trackTask, the decode
+// helper and /roi crops in httpTask would all share. decodeJpeg() is the
+// same decoder (TJpgDec, in ROM) with the same callbacks and scales, but
+// each task passes its own work area from the arena.
+static UINT jpegInput(JDEC *dec, BYTE *buf, UINT len) {
+  JpegSource *src = (JpegSource *)dec->device;
+  if (len > src->len - src->index) {
+    len = src->len - src->index;
+  }
+  if (len) {
+    len = src->reader(src->arg, src->index, buf, len); // buf NULL: skip
+    src->index += len;
+  }
+  return len;
+}
+
+static UINT jpegOutput(JDEC *dec, void *bitmap, JRECT *rect) {
+  JpegSource *src = (JpegSource *)dec->device;
+  return src->writer(src->arg, rect->left, rect->top, rect->right + 1 - rect->left,
+                     rect->bottom + 1 - rect->top, (uint8_t *)bitmap);
+}
+
+static bool decodeJpeg(uint8_t *work, size_t len, jpg_scale_t scale, jpg_reader_cb reader,
+                       jpg_writer_cb writer, void *arg) {
+  JpegSource src = {len, 0, reader, writer, arg};
+  JDEC dec;
+  if (!work || jd_prepare(&dec, jpegInput, work, JPEG_WORK_BYTES, &src) != JDR_OK) {
+    return false;
+  }
+  // Start and end calls with no data, as esp_jpg_decode() makes them
+  uint16_t width = dec.width >> scale;
+  uint16_t height = dec.height >> scale;
+  writer(arg, 0, 0, width, height, NULL);
+  bool ok = jd_decomp(&dec, jpegOutput, scale) == JDR_OK;
+  writer(arg, width, height, width, height, NULL);
+  return ok;
+}
+
+// ==========================================
+// ON-DEVICE TRACKING
+// ==========================================
+
+static size_t grayDecodeRead(void *arg, size_t index, uint8_t *buf, size_t len) {
+  GrayDecodeJob *job = (GrayDecodeJob *)arg;
+  if (job->band) {
+    return readJpegBand(job->jpeg, *job->layout, *job->band, index, buf, len);
+  }
+  if (buf) {
+    memcpy(buf, job->jpeg + index, len);
+  }
+  return len;
+}
+
+static bool grayDecodeWrite(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                            uint8_t *data) {
+  GrayDecodeJob *job = (GrayDecodeJob *)arg;
+  if (!data) {
+    // Start (x = y = 0, w/h = output size) or end of the image
+    if (x == 0 && y == 0) {
+      job->width = w;
+      job->height = h;
+    }
+    return true;
+  }
+  // The start callback's return value is ignored, so guard every block
+  if (job->width > TRACK_MAX_WIDTH || job->top + job->height > TRACK_MAX_HEIGHT) {
+    return false;
+  }
+
+  // Block of RGB888 pixels; (r + 2g + b) / 4 is close enough to luma
+  for (uint16_t row = 0; row < h; row++) {
+    uint8_t *out = job->gray + (size_t)(job->top + y + row) * job->width + x;
+    for (uint16_t col = 0; col < w; col++, data += 3) {
+      out[col] = (data[0] + 2 * data[1] + data[2]) >> 2;
+    }
+  }
+  return true;
+}
+
+static bool decodeGrayJob(GrayDecodeJob *job, size_t len) {
+  size_t size = job->band ? jpegBandSize(*job->layout, *job->band) : len;
+  job->ok = decodeJpeg(job->work, size, job->scale, grayDecodeRead, grayDecodeWrite, job);
+  return job->ok;
+}
+
+// Decodes the bottom band of a frame for decodeGray(), on the PRO core
+void decodeHelperTask(void *arg) {
+  for (;;) {
+    GrayDecodeJob *job;
+    xQueueReceive((QueueHandle_t)arg, &job, portMAX_DELAY);
+    decodeGrayJob(job, 0);
+    xSemaphoreGive(decodeHelperDone);
+  }
+}
+
+// Decode straight to a reduced size, picking the smallest JPEG scale that
+// still fits the tracking buffer. With bands > 1 and restart markers in
+// the frame, the two halves are decoded on both cores at once.
+static bool decodeGray(const camera_fb_t *fb, GrayDecodeJob *job, uint8_t *gray, int bands) {
+  jpg_scale_t scale = JPG_SCALE_NONE;
+  size_t width = fb->width;
+  while (width > TRACK_MAX_WIDTH && scale < JPG_SCALE_8X) {
+    scale = (jpg_scale_t)(scale + 1);
+    width /= 2;
+  }
+  *job = {};
+  job->jpeg = fb->buf;
+  job->gray = gray;
+  job->work = jpegWork[JPEG_WORK_TRACK];
+  job->scale = scale;
+
+  JpegLayout layout;
+  JpegBand split[2];
+  if (bands < 2 || !decodeHelperQueue || !parseJpegLayout(fb->buf, fb->len, &layout) ||
+      splitJpegBands(fb->buf, layout, split, 2) < 2) {
+    return decodeGrayJob(job, fb->len);
+  }
+  GrayDecodeJob bottom = *job;
+  bottom.work = jpegWork[JPEG_WORK_HELPER];
+  bottom.layout = job->layout = &layout;
+  job->band = &split[0];
+  bottom.band = &split[1];
+  bottom.top = split[1].y >> scale;
+  GrayDecodeJob *post = &bottom;
+  xQueueSend(decodeHelperQueue, &post, portMAX_DELAY);
+  decodeGrayJob(job, 0);
+  xSemaphoreTake(decodeHelperDone, portMAX_DELAY);
+  job->height += bottom.height;
+  job->banded = true;
+  job->band = NULL;
+  job->layout = NULL;
+  job->ok = job->ok && bottom.ok && bottom.width == job->width;
+  return job->ok;
+}
+
+// Full-size decodes only count the time: no buffer holds a VGA gray frame
+static bool discardDecodeWrite(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                               uint8_t *data) {
+  return true;
+}
+
+static void runDecodeBench(const camera_fb_t *fb) {
+  if (fb->format != PIXFORMAT_JPEG || !parseJpegLayout(fb->buf, fb->len, &decodeBenchLayout)) {
+    decodeBenchState.store(DECODE_BENCH_FAILED);
+    return;
+  }
+  decodeBenchBytes = fb->len;
+  GrayDecodeJob job = {};
+  job.jpeg = fb->buf;
+  for (LatencyHistogram &h : decodeBenchMicros) {
+    h.reset();
+  }
+  for (int i = 0; i < DECODE_BENCH_RUNS; i++) {
+    uint32_t start = micros();
+    decodeJpeg(jpegWork[JPEG_WORK_TRACK], fb->len, JPG_SCALE_NONE, grayDecodeRead,
+               discardDecodeWrite, &job);
+    decodeBenchMicros[0].record(micros() - start);
+
+    start = micros();
+    decodeGray(fb, &job, trackGray, 1);
+    decodeBenchMicros[1].record(micros() - start);
+
+    start = micros();
+    decodeGray(fb, &job, trackGray, 2);
+    decodeBenchMicros[2].record(micros() - start);
+  }
+  decodeBenchWidth = job.width;
+  decodeBenchBanded = job.banded;
+  decodeBenchState.store(DECODE_BENCH_DONE);
+}
+
+// Rough face extent from the eyes: about 2.4 eye distances wide, from one
+// above the eyes to 1.6 below. `scale` maps tracking to frame pixels.
+static FaceBox faceBoxFromEyes(const TiltResult &tilt, float scale) {
+  float dx = tilt.rightX - tilt.leftX;
+  float dy = tilt.rightY - tilt.leftY;
+  float d = sqrtf(dx * dx + dy * dy) * scale;
+  float cx = (tilt.leftX + tilt.rightX) * 0.5f * scale;
+  float cy = (tilt.leftY + tilt.rightY) * 0.5f * scale;
+  float x = cx - 1.2f * d;
+  float y = cy - d;
+  FaceBox box = {};
+  box.x = x < 0 ? 0 : (uint16_t)x;
+  box.y = y < 0 ? 0 : (uint16_t)y;
+  box.width = (uint16_t)(2.4f * d);
+  box.height = (uint16_t)(2.6f * d);
+  return box;
+}
+
+// Every sessionFrameEvery-th tracked frame, as captured (JPEG or raw gray)
+static void recordSessionFrame(const camera_fb_t *fb, uint32_t seq, uint32_t capturedMs) {
+  if (sessionFrameEvery == 0 || sessionFrames++ % sessionFrameEvery != 0) {
+    return;
+  }
+  if (xSemaphoreTake(sessionLock, 0) != pdTRUE) {
+    return;
+  }
+  SessionFrame frame = {seq,
+                        (uint16_t)fb->width,
+                        (uint16_t)fb->height,
+                        (uint8_t)(fb->format == PIXFORMAT_JPEG ? SESSION_FORMAT_JPEG
+                                                               : SESSION_FORMAT_GRAY),
+                        fb->buf,
+                        fb->len};
+  session.frame(capturedMs, frame);
+  xSemaphoreGive(sessionLock);
+}
+
+// The measured angle, and the lane the broadcast rule would pick for it
+// (filtered, extrapolated TILT_DISPLAY_LEAD_MS past the capture time), so
+// tools/session_replay.cpp can check it makes the same choice
+static void recordSessionTilt(const TiltResult &tilt, const TiltFilter &filter, uint32_t seq,
+                              uint32_t capturedMs) {
+  TiltConfig config = tiltConfig;
+  if (tilt.found) {
+    float angle = filter.predict(capturedMs + TILT_DISPLAY_LEAD_MS);
+    sessionLane.update(config.invert ? -angle : angle, config.threshold);
+  }
+  if (xSemaphoreTake(sessionLock, 0) != pdTRUE) {
+    return;
+  }
+  SessionTilt record = {seq, tilt.angle, tilt.confidence, tilt.found, sessionLane.lane(), 0};
+  session.tilt(capturedMs, record);
+  xSemaphoreGive(sessionLock);
+}
+
+// Consumer: estimates the tilt of every new frame, at whatever rate the
+// decoder allows, at lower priority than the capture task.
+void trackTask(void *arg) {
+  uint32_t lastSeq = 0;
+  TiltFilter filter;
+  for (;;) {
+    if (latestFrame.latestSeq() == lastSeq) {
+      vTaskDelay(pdMS_TO_TICKS(5));
+      continue;
+    }
+
+    // latestSeq() is only a hint: the frame may be the one already tracked
+    const PinnedFrame<camera_fb_t> *pinned = latestFrame.acquire();
+    if (!pinned || pinned->seq == lastSeq) {
+      if (pinned) {
+        latestFrame.release(pinned);
+      }
+      vTaskDelay(1);
+      continue;
+    }
+    lastSeq = pinned->seq;
+
+    uint8_t benchRequested = DECODE_BENCH_REQUESTED;
+    if (decodeBenchState.compare_exchange_strong(benchRequested, DECODE_BENCH_RUNNING)) {
+      runDecodeBench(pinned->frame);
+    }
+
+    uint32_t start = micros();
+    const camera_fb_t *fb = pinned->frame;
+    uint32_t capturedMs = captureMs(fb);
+    uint32_t capturedUs = captureMicros(fb);
+#ifdef CAMERA_SYNTHETIC
+    float truth = syntheticTruth[fb - syntheticFrames];
+#endif
+    TiltResult tilt;
+    const uint8_t *gray = trackGray;
+    int width;
+    int height;
+    bool ok = true;
+    if (fb->format == PIXFORMAT_GRAYSCALE) {
+      // Raw grayscale: track in place, halving QVGA down to QQVGA first
+      if (fb->width > TRACK_MAX_WIDTH) {
+        width = fb->width / 2;
+        height = fb->height / 2;
+        downscale2x(fb->buf, fb->width, fb->height, fb->width, trackGray, width);
+        tilt = tiltEstimator.estimate(trackGray, width, height, width);
+      } else {
+        gray = fb->buf;
+        width = fb->width;
+        height = fb->height;
+        tilt = tiltEstimator.estimate(gray, width, height, width);
+      }
+    } else {
+      GrayDecodeJob job;
+      uint32_t decodeStart = micros();
+      ok = decodeGray(fb, &job, trackGray, DECODE_BANDS);
+      decodeMicros.record(micros() - decodeStart);
+      if (job.banded) {
+        framesBanded++;
+      }
+      width = job.width;
+      height = job.height;
+      if (ok) {
+        tilt = tiltEstimator.estimate(trackGray, width, height, width);
+      }
+    }
+    if (ok && GATE_THRESHOLD > 0) {
+      if (motionGate.update(gray, width, height, width, tilt)) {
+        changedSeq.store(lastSeq);
+      }
+      gateSeq.store(lastSeq);
+    }
+    if (ok && sessionRecording.load()) {
+      recordSessionFrame(fb, lastSeq, capturedMs);
+    }
+    if (ok && tilt.found) {
+      FaceBox box = faceBoxFromEyes(tilt, fb->width / (float)width);
+      box.frameWidth = fb->width;
+      box.frameHeight = fb->height;
+      uint32_t now = millis();
+      portENTER_CRITICAL(&tiltMux);
+      if (now - pageBoxAtMs > ROI_BOX_MAX_AGE_MS) {
+        faceBox = box;
+        faceBoxAtMs = now;
+      }
+      portEXIT_CRITICAL(&tiltMux);
+    }
+    latestFrame.release(pinned);
+    if (!ok) {
+      continue;
+    }
+    uint32_t elapsed = micros() - start;
+    trackMicros.record(elapsed);
+    trackAgeMicros.record(micros() - capturedUs);
+    if (tilt.found) {
+      filter.update(tilt.angle, capturedMs);
+    }
+    if (sessionRecording.load()) {
+      recordSessionTilt(tilt, filter, lastSeq, capturedMs);
+    }
+
+    portENTER_CRITICAL(&tiltMux);
+    tiltReport.tilt = tilt;
+    tiltReport.filter = filter;
+    tiltReport.seq = lastSeq;
+    tiltReport.width = width;
+    tiltReport.height = height;
+    tiltReport.micros = elapsed;
+    tiltReport.captureMs = capturedMs;
+#ifdef CAMERA_SYNTHETIC
+    tiltReport.truth = truth;
+#endif
+    portEXIT_CRITICAL(&tiltMux);
+  }
 }
 
 // ==========================================
 // WEB SERVER HANDLERS
 // ==========================================
 
-void handleRoot() {
-  // Serve the embedded HTML game
-  server.send(200, "text/html", html_page);
+// Encodes into a free slot of encodeSlots; false when none is free or the
+// JPEG does not fit. encodeSlots.release() gives the slot back.
+static bool encodeToSlot(const uint8_t **jpg, size_t *len, uint8_t *src, size_t srcLen,
+                         uint16_t width, uint16_t height, pixformat_t format) {
+  uint8_t *slot = encodeSlots.acquire();
+  if (!slot) {
+    return false;
+  }
+  SlotWriter out = {slot, encodeSlots.slotSize(), 0, false};
+  if (!fmt2jpg_cb(src, srcLen, width, height, format, 80, slotWrite, &out) || out.overflow) {
+    encodeSlots.release(slot);
+    return false;
+  }
+  *jpg = slot;
+  *len = out.length;
+  return true;
+}
+
+// Viewers always get JPEG. Grayscale frames are encoded on demand into an
+// encode slot (*encoded set).
+static bool viewerJpeg(const camera_fb_t *fb, const uint8_t **jpg, size_t *len,
+                       bool *encoded) {
+  *encoded = false;
+  if (fb->format == PIXFORMAT_JPEG) {
+    *jpg = fb->buf;
+    *len = fb->len;
+    return true;
+  }
+  *encoded = encodeToSlot(jpg, len, fb->buf, fb->len, fb->width, fb->height, fb->format);
+  return *encoded;
+}
+
+// Serve an embedded asset (the game page, vendored scripts) gzipped, straight
+// from flash. The data is memory-mapped, so it is written in segment-sized
+// chunks without a RAM copy.
+#define ASSET_CHUNK 1436
+
+void handleAsset(const WebAsset &asset) {
+  server.sendHeader("ETag", asset.etag);
+  // Revalidate on every load; a reflash with a new page changes the ETag
+  server.sendHeader("Cache-Control", "no-cache");
+  if (server.header("If-None-Match") == asset.etag) {
+    server.send(304);
+    return;
+  }
+
+  server.sendHeader("Content-Encoding", "gzip");
+  server.setContentLength(asset.length);
+  server.send(200, asset.contentType, "");
+  for (size_t off = 0; off < asset.length; off += ASSET_CHUNK) {
+    size_t n = asset.length - off < ASSET_CHUNK ? asset.length - off : ASSET_CHUNK;
+    server.sendContent((const char *)asset.data + off, n);
+  }
+}
+
+// ==========================================
+// REGION OF INTEREST
+// ==========================================
+
+// Picks the /roi crop: the face box plus a margin, snapped to the 16-pixel
+// JPEG block grid. The whole frame when there is no recent box, a refresh
+// is due, or the page asked for one.
+static void chooseRoi(Viewer &v, const camera_fb_t *fb) {
+  v.frameW = fb->width;
+  v.frameH = fb->height;
+  v.roiX = 0;
+  v.roiY = 0;
+  v.roiW = fb->width;
+  v.roiH = fb->height;
+
+  portENTER_CRITICAL(&tiltMux);
+  FaceBox box = faceBox;
+  uint32_t boxAge = millis() - faceBoxAtMs;
+  portEXIT_CRITICAL(&tiltMux);
+  if (v.roiFull || box.width == 0 || boxAge > ROI_BOX_MAX_AGE_MS ||
+      millis() - lastFullRoiMs > ROI_FULL_EVERY_MS) {
+    lastFullRoiMs = millis();
+    return;
+  }
+
+  // The frame size may have changed since the box was measured
+  float sx = (float)fb->width / box.frameWidth;
+  float sy = (float)fb->height / box.frameHeight;
+  int marginX = box.width / ROI_MARGIN;
+  int marginY = box.height / ROI_MARGIN;
+  int x0 = (int)((box.x - marginX) * sx) & ~15;
+  int y0 = (int)((box.y - marginY) * sy) & ~15;
+  int x1 = ((int)((box.x + box.width + marginX) * sx) + 15) & ~15;
+  int y1 = ((int)((box.y + box.height + marginY) * sy) + 15) & ~15;
+  x0 = x0 < 0 ? 0 : x0;
+  y0 = y0 < 0 ? 0 : y0;
+  x1 = x1 > (int)fb->width ? fb->width : x1;
+  y1 = y1 > (int)fb->height ? fb->height : y1;
+  if (x1 - x0 < 32 || y1 - y0 < 32) {
+    lastFullRoiMs = millis();
+    return;
+  }
+  // Crops that do not fit roiCrop go out whole, which needs no re-encode
+  size_t pixelBytes = fb->format == PIXFORMAT_GRAYSCALE ? 1 : 3;
+  if ((size_t)(x1 - x0) * (y1 - y0) * pixelBytes > roiCropBytes) {
+    return;
+  }
+  v.roiX = x0;
+  v.roiY = y0;
+  v.roiW = x1 - x0;
+  v.roiH = y1 - y0;
+}
+
+struct RoiDecodeJob {
+  const uint8_t *jpeg;
+  uint8_t *rgb; // BGR888, as fmt2jpg expects
+  int x, y, w, h;
+};
+
+static size_t roiDecodeRead(void *arg, size_t index, uint8_t *buf, size_t len) {
+  RoiDecodeJob *job = (RoiDecodeJob *)arg;
+  if (buf) {
+    memcpy(buf, job->jpeg + index, len);
+  }
+  return len;
+}
+
+// Keeps only the part of each decoded block that falls inside the crop
+static bool roiDecodeWrite(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                           uint8_t *data) {
+  RoiDecodeJob *job = (RoiDecodeJob *)arg;
+  if (!data) {
+    return true;
+  }
+  int x0 = x > job->x ? x : job->x;
+  int y0 = y > job->y ? y : job->y;
+  int x1 = x + w < job->x + job->w ? x + w : job->x + job->w;
+  int y1 = y + h < job->y + job->h ? y + h : job->y + job->h;
+  for (int row = y0; row < y1; row++) {
+    const uint8_t *in = data + ((size_t)(row - y) * w + (x0 - x)) * 3;
+    uint8_t *out = job->rgb + ((size_t)(row - job->y) * job->w + (x0 - job->x)) * 3;
+    for (int col = x0; col < x1; col++, in += 3, out += 3) {
+      out[0] = in[2];
+      out[1] = in[1];
+      out[2] = in[0];
+    }
+  }
+  return true;
+}
+
+// Crops v's ROI out of the frame into roiCrop and encodes it. JPEG frames
+// are decoded at full size for this, grayscale frames are cropped in place.
+static bool roiJpeg(Viewer &v, const camera_fb_t *fb) {
+  bool gray = fb->format == PIXFORMAT_GRAYSCALE;
+  size_t bytes = (size_t)v.roiW * v.roiH * (gray ? 1 : 3);
+  uint8_t *crop = roiCrop;
+  if (!crop || bytes > roiCropBytes) {
+    return false;
+  }
+
+  bool ok = true;
+  if (gray) {
+    for (int row = 0; row < v.roiH; row++) {
+      memcpy(crop + (size_t)row * v.roiW, fb->buf + (size_t)(v.roiY + row) * fb->width + v.roiX,
+             v.roiW);
+    }
+  } else {
+    RoiDecodeJob job = {fb->buf, crop, v.roiX, v.roiY, v.roiW, v.roiH};
+    ok = decodeJpeg(jpegWork[JPEG_WORK_HTTP], fb->len, JPG_SCALE_NONE, roiDecodeRead,
+                    roiDecodeWrite, &job);
+  }
+  v.encoded = ok && encodeToSlot(&v.jpg, &v.jpgLen, crop, bytes, v.roiW, v.roiH,
+                                 gray ? PIXFORMAT_GRAYSCALE : PIXFORMAT_RGB888);
+  return v.encoded;
+}
+
+// ==========================================
+// FRAME VIEWERS
+// ==========================================
+
+// Whether anything moved after frame `seq`. Without a recent answer from
+// the gate (tracker behind or off) everything counts as changed.
+static bool frameChangedSince(uint32_t seq, uint32_t latestSeq) {
+  if (GATE_THRESHOLD == 0 || changedSeq.load() > seq) {
+    return true;
+  }
+  return latestSeq - gateSeq.load() > GATE_MAX_LAG;
+}
+
+static Viewer *freeViewer() {
+  for (int i = 0; i < MAX_VIEWERS; i++) {
+    if (!viewers[i].active) {
+      return &viewers[i];
+    }
+  }
+  return NULL;
+}
+
+static void releaseViewerFrame(Viewer &v) {
+  if (v.encoded) {
+    encodeSlots.release(v.jpg);
+    v.encoded = false;
+  }
+  if (v.pinned) {
+    uint32_t start = ESP.getCycleCount();
+    latestFrame.release(v.pinned);
+    returnMicros.record(cyclesToMicros(start));
+    v.pinned = NULL;
+  }
+  v.sending = false;
+}
+
+static void closeViewer(Viewer &v) {
+  releaseViewerFrame(v);
+  v.client.stop();
+  v.client = WiFiClient();
+  v.active = false;
+}
+
+// Takes over the pin. Grayscale frames are encoded into a private copy, so
+// their buffer goes back to the driver straight away.
+static bool startViewerFrame(Viewer &v, const PinnedFrame<camera_fb_t> *pinned) {
+  bool cropped = false;
+  if (v.roi) {
+    chooseRoi(v, pinned->frame);
+    cropped = v.roiW != v.frameW || v.roiH != v.frameH;
+  }
+  bool ok = cropped ? roiJpeg(v, pinned->frame)
+                    : viewerJpeg(pinned->frame, &v.jpg, &v.jpgLen, &v.encoded);
+  if (!ok) {
+    latestFrame.release(pinned);
+    return false;
+  }
+  v.seq = pinned->seq;
+  v.captureMs = captureMs(pinned->frame);
+  sendAgeMicros.record(micros() - captureMicros(pinned->frame));
+  v.pinned = pinned;
+  if (v.encoded) {
+    latestFrame.release(pinned);
+    v.pinned = NULL;
+  }
+
+  // A body without its header would corrupt the response: a header that
+  // does not fit closes the viewer instead
+  size_t headerLen = 0;
+  bool headerOk;
+  if (v.stream) {
+    size_t response = v.headerSent ? 0 : streamResponseHeader(v.header, sizeof(v.header));
+    size_t part = streamPartHeader(v.header + response, sizeof(v.header) - response, v.jpgLen,
+                                   v.seq, v.captureMs);
+    headerOk = (v.headerSent || response != 0) && part != 0;
+    headerLen = response + part;
+  } else {
+    RoiRect roi = {v.roiX, v.roiY, v.roiW, v.roiH, v.frameW, v.frameH};
+    headerLen = captureResponseHeader(v.header, sizeof(v.header), v.jpgLen, v.seq, v.captureMs,
+                                      v.roi ? &roi : NULL);
+    headerOk = headerLen != 0;
+  }
+  if (!headerOk || headerLen == 0 || headerLen >= sizeof(v.header)) {
+    Serial.println("Frame header did not fit");
+    if (v.active) {
+      closeViewer(v);
+    } else {
+      releaseViewerFrame(v);
+    }
+    return false;
+  }
+  v.headerLen = headerLen;
+  if (v.stream) {
+    v.headerSent = true;
+  }
+  v.offset = 0;
+  v.sending = true;
+  v.startUs = micros();
+  v.headerDoneUs = 0;
+  v.startMs = millis();
+  frameBytes.record(v.jpgLen);
+  return true;
+}
+
+static void finishViewerFrame(Viewer &v) {
+  uint32_t now = micros();
+  bodyMicros.record(now - v.headerDoneUs);
+  framesSent++;
+
+  if (v.stream) {
+    uint32_t elapsed = now - v.startUs;
+    if (v.seq != qualitySeq) {
+      if (qualityController && qualitySeq != 0) {
+        qualityController->onFrameSent(qualityBytes, qualityMicros);
+      }
+      qualitySeq = v.seq;
+      qualityBytes = v.jpgLen;
+      qualityMicros = 0;
+    }
+    if (elapsed > qualityMicros) {
+      qualityMicros = elapsed;
+    }
+  }
+
+  releaseViewerFrame(v);
+  if (!v.stream) {
+    closeViewer(v);
+  }
+}
+
+// Sends up to VIEWER_BURST chunks without blocking. The stack copies each
+// chunk into its own segments, so the buffer is held until the last chunk
+// has been handed over. Returns false if the viewer went away.
+static bool pumpViewer(Viewer &v) {
+  size_t trailerLen = v.stream ? 2 : 0;
+  size_t total = v.headerLen + v.jpgLen + trailerLen;
+  int fd = v.client.fd();
+
+  for (int burst = 0; burst < VIEWER_BURST && v.offset < total; burst++) {
+    const uint8_t *data;
+    size_t left;
+    if (v.offset < v.headerLen) {
+      data = (const uint8_t *)v.header + v.offset;
+      left = v.headerLen - v.offset;
+    } else if (v.offset < v.headerLen + v.jpgLen) {
+      data = v.jpg + (v.offset - v.headerLen);
+      left = v.headerLen + v.jpgLen - v.offset;
+    } else {
+      data = (const uint8_t *)"\r\n" + (v.offset - v.headerLen - v.jpgLen);
+      left = total - v.offset;
+    }
+
+    int sent = send(fd, data, left < VIEWER_CHUNK ? left : VIEWER_CHUNK, MSG_DONTWAIT);
+    if (sent < 0) {
+      return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+    v.offset += sent;
+    if (v.headerDoneUs == 0 && v.offset >= v.headerLen) {
+      v.headerDoneUs = micros();
+      headerMicros.record(v.headerDoneUs - v.startUs);
+    }
+  }
+
+  if (v.offset >= total) {
+    finishViewerFrame(v);
+  }
+  return true;
+}
+
+// One pass over all viewers from httpTask: give idle stream viewers the
+// newest frame, push a few chunks to everyone, drop the dead and the stuck.
+void serviceViewers() {
+  uint32_t latestSeq = latestFrame.latestSeq();
+  for (int i = 0; i < MAX_VIEWERS; i++) {
+    Viewer &v = viewers[i];
+    if (!v.active) {
+      continue;
+    }
+    if (!v.client.connected()) {
+      if (v.sending) {
+        framesDropped++;
+      }
+      closeViewer(v);
+      continue;
+    }
+
+    if (!v.sending) {
+      if (!v.stream || latestSeq == v.seq) {
+        continue;
+      }
+      if (!frameChangedSince(v.seq, latestSeq) && millis() - v.startMs < GATE_KEYFRAME_MS) {
+        v.gated = true;
+        // Or the controller would take the missing frames for a slow link
+        if (qualityController) {
+          qualityController->onFrameHeld(millis());
+        }
+        continue;
+      }
+      const PinnedFrame<camera_fb_t> *pinned = latestFrame.acquire();
+      if (!pinned || pinned->seq == v.seq) {
+        if (pinned) {
+          latestFrame.release(pinned);
+        }
+        continue;
+      }
+      // Frames published while this viewer was busy (or held back as
+      // unchanged) are skipped for it only
+      if (v.seq != 0 && pinned->seq > v.seq + 1) {
+        uint32_t skipped = pinned->seq - v.seq - 1;
+        if (v.gated) {
+          framesUnchanged += skipped;
+          bytesSaved += skipped * v.jpgLen;
+        } else {
+          framesDropped += skipped;
+        }
+      }
+      v.gated = false;
+      if (!startViewerFrame(v, pinned)) {
+        continue;
+      }
+    }
+
+    // A viewer this slow would keep a driver buffer from the camera
+    if (v.pinned && v.seq != latestSeq && millis() - v.startMs > VIEWER_STALL_MS) {
+      framesDropped++;
+      closeViewer(v);
+      continue;
+    }
+    if (!pumpViewer(v)) {
+      framesDropped++;
+      closeViewer(v);
+    }
+  }
+}
+
+// Hands the connection to serviceViewers(); the response goes out from
+// there without holding up other requests. A client that sends back the
+// ETag of its last frame gets 304 (with the current tilt in headers)
+// while the motion gate sees no change; that is written straight to the
+// socket too, rather than through sendHeader()'s Strings.
+static void startCapture(bool roi, bool roiFull) {
+  // By index, the first of KEEP_HEADERS: a short ETag fits in the String
+  // itself, where a header name would not
+  String etag = server.header(0);
+  if (etag.length() > 2) {
+    uint32_t seq = strtoul(etag.c_str() + 1, NULL, 10);
+    uint32_t latestSeq = latestFrame.latestSeq();
+    if (seq != 0 && seq <= latestSeq && !frameChangedSince(seq, latestSeq)) {
+      portENTER_CRITICAL(&tiltMux);
+      TiltResult tilt = tiltReport.tilt;
+      portEXIT_CRITICAL(&tiltMux);
+
+      char header[FRAME_HEADER_MAX];
+      size_t len = notModifiedHeader(header, sizeof(header), seq, tilt.angle, tilt.found);
+      WiFiClient client = server.client();
+      client.write((const uint8_t *)header, len);
+      client.stop();
+      framesUnchanged++;
+      return;
+    }
+  }
+
+  const PinnedFrame<camera_fb_t> *pinned = latestFrame.acquire();
+  if (!pinned) {
+    server.send(503, "text/plain", "No frame captured yet");
+    return;
+  }
+  Viewer *v = freeViewer();
+  if (!v) {
+    latestFrame.release(pinned);
+    server.send(503, "text/plain", "Too many viewers");
+    return;
+  }
+
+  v->stream = false;
+  v->roi = roi;
+  v->roiFull = roiFull;
+  if (!startViewerFrame(*v, pinned)) {
+    server.send(500, "text/plain", "Frame could not be prepared");
+    return;
+  }
+  v->client = server.client();
+  v->active = true;
 }
 
 void handleCapture() {
-  camera_fb_t *fb = NULL;
-  fb = esp_camera_fb_get();
-  if (!fb) {
-    Serial.println("Camera capture failed");
-    server.send(500, "text/plain", "Camera capture failed");
+  startCapture(false, false);
+}
+
+// Like /capture, but cropped to the face (see chooseRoi). X-ROI gives the
+// crop as x,y,w,h and X-Frame-Size the full frame it was cut from.
+void handleRoi() {
+  startCapture(true, server.hasArg("full"));
+}
+
+void handleTilt() {
+  portENTER_CRITICAL(&tiltMux);
+  TiltReport report = tiltReport;
+  portEXIT_CRITICAL(&tiltMux);
+
+  // "filtered" is the smoothed angle extrapolated to now (tilt_filter.h)
+  uint32_t now = millis();
+  char json[320];
+  int len = snprintf(json, sizeof(json),
+                     "{\"seq\":%u,\"found\":%s,\"angle\":%.1f,\"confidence\":%.2f,"
+                     "\"left\":[%d,%d],\"right\":[%d,%d],\"width\":%u,\"height\":%u,"
+                     "\"ms\":%.1f,\"captureMs\":%u,\"filtered\":%.1f,\"velocity\":%.1f,"
+                     "\"filterConfidence\":%.2f",
+                     (unsigned)report.seq, report.tilt.found ? "true" : "false",
+                     report.tilt.angle, report.tilt.confidence, report.tilt.leftX,
+                     report.tilt.leftY, report.tilt.rightX, report.tilt.rightY, report.width,
+                     report.height, report.micros / 1000.0f, (unsigned)report.captureMs,
+                     report.filter.predict(now),
+                     report.filter.velocity(), report.filter.confidence(now));
+#ifdef CAMERA_SYNTHETIC
+  len += snprintf(json + len, sizeof(json) - len, ",\"truth\":%.1f", report.truth);
+#endif
+  snprintf(json + len, sizeof(json) - len, "}");
+
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  server.send(200, "application/json", json);
+}
+
+// Times JPEG decoding on this board: the next frame is decoded at full
+// size, at tracking size, and at tracking size split over both cores
+// (DECODE_BANDS), DECODE_BENCH_RUNS times each.
+// /decode?run asks trackTask to time its next frame and returns at once;
+// /decode reports the state ("running" until then) and the last result.
+// Waiting here would stop httpTask serving viewers for the whole run.
+void handleDecodeBench() {
+  if (!trackGray) {
+    server.send(503, "text/plain", "Tracking is not running");
     return;
   }
+  uint8_t state = decodeBenchState.load();
+  bool busy = state == DECODE_BENCH_REQUESTED || state == DECODE_BENCH_RUNNING;
+  if (server.hasArg("run")) {
+    if (busy) {
+      server.send(409, "text/plain", "A decode benchmark is already running");
+      return;
+    }
+    decodeBenchTimedOut = false;
+    decodeBenchStartMs = millis();
+    decodeBenchState.store(DECODE_BENCH_REQUESTED);
+    state = DECODE_BENCH_REQUESTED;
+    busy = true;
+  }
 
-  // Allow CORS (useful if developing locally)
+  const char *name = busy                            ? "running"
+                     : state == DECODE_BENCH_DONE    ? "done"
+                     : state == DECODE_BENCH_FAILED  ? "failed"
+                     : decodeBenchTimedOut           ? "timeout"
+                                                     : "idle";
+  char json[448];
+  int len = snprintf(json, sizeof(json), "{\"state\":\"%s\"", name);
+  if (state == DECODE_BENCH_FAILED) {
+    len += snprintf(json + len, sizeof(json) - len,
+                    ",\"error\":\"Needs JPEG frames (not PIPELINE_GRAYSCALE)\"");
+  } else if (state == DECODE_BENCH_DONE) {
+    static const char *MODES[] = {"full", "scaled", "banded"};
+    len += snprintf(json + len, sizeof(json) - len,
+                    ",\"width\":%u,\"height\":%u,\"bytes\":%u,\"restartInterval\":%u,"
+                    "\"trackWidth\":%u,\"banded\":%s,\"runs\":%d",
+                    decodeBenchLayout.width, decodeBenchLayout.height,
+                    (unsigned)decodeBenchBytes, decodeBenchLayout.restartInterval,
+                    decodeBenchWidth, decodeBenchBanded ? "true" : "false", DECODE_BENCH_RUNS);
+    for (int i = 0; i < 3; i++) {
+      len += snprintf(json + len, sizeof(json) - len, ",\"%s\":{\"p50\":%u,\"max\":%u}",
+                      MODES[i], (unsigned)decodeBenchMicros[i].percentile(0.5f),
+                      (unsigned)decodeBenchMicros[i].max());
+    }
+  }
+  snprintf(json + len, sizeof(json) - len, "}");
   server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.sendHeader("Access-Control-Allow-Methods", "GET");
   server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  server.send(200, "application/json", json);
+}
+
+// From httpTask's loop: gives up on a /decode run trackTask never took
+// (no frames coming). One it took always finishes.
+void serviceDecodeBench() {
+  uint8_t requested = DECODE_BENCH_REQUESTED;
+  if (millis() - decodeBenchStartMs >= DECODE_BENCH_TIMEOUT_MS &&
+      decodeBenchState.compare_exchange_strong(requested, DECODE_BENCH_IDLE)) {
+    decodeBenchTimedOut = true;
+  }
+}
 
-  server.send_P(200, "image/jpeg", (const char *)fb->buf, fb->len);
+// Clock sync for latency measurement: the client times this request and
+// takes ms as the device clock at its midpoint (best of several tries).
+// "build" tells reports from different firmware apart.
+void handleTime() {
+  char json[96];
+  snprintf(json, sizeof(json), "{\"ms\":%u,\"build\":\"%s\"}", (unsigned)millis(),
+           FIRMWARE_BUILD);
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  server.send(200, "application/json", json);
+}
 
-  esp_camera_fb_return(fb);
+static void sendSessionState() {
+  char json[128];
+  snprintf(json, sizeof(json),
+           "{\"recording\":%s,\"bytes\":%u,\"capacity\":%u,\"full\":%s,\"frameEvery\":%u}",
+           sessionRecording.load() ? "true" : "false", (unsigned)session.size(),
+           (unsigned)sessionCapacity, session.full() ? "true" : "false",
+           (unsigned)sessionFrameEvery);
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  server.send(200, "application/json", json);
+}
+
+// /record?start[&frames=N] starts a new session (replacing the last one),
+// recording every Nth tracked frame (default 1, 0 = tilt only);
+// /record?stop ends it. Both, and plain /record, reply with the state.
+void handleRecord() {
+  if (server.hasArg("start")) {
+    if (sessionDownload.active) {
+      server.send(409, "text/plain", "The last recording is still downloading");
+      return;
+    }
+    xSemaphoreTake(sessionLock, portMAX_DELAY);
+    if (!sessionBuf) {
+      sessionCapacity = psramFound() ? SESSION_BYTES_PSRAM : SESSION_BYTES_DRAM;
+      sessionBuf = (uint8_t *)(psramFound() ? ps_malloc(sessionCapacity) : malloc(sessionCapacity));
+    }
+    if (!sessionBuf) {
+      xSemaphoreGive(sessionLock);
+      Serial.println("Session buffer allocation failed");
+      server.send(500, "text/plain", "No memory for a recording");
+      return;
+    }
+    session.reset(sessionBuf, sessionCapacity);
+    TiltConfig config = tiltConfig;
+    SessionConfig header = {SESSION_SOURCE_DEVICE, config.threshold, config.invert,
+                            TILT_DISPLAY_LEAD_MS, FIRMWARE_BUILD, strlen(FIRMWARE_BUILD)};
+    session.config(millis(), header);
+    sessionFrameEvery = server.hasArg("frames") ? server.arg("frames").toInt() : 1;
+    if (!psramFound()) {
+      sessionFrameEvery = 0;
+    }
+    sessionFrames = 0;
+    sessionLane.reset();
+    sessionRecording.store(true);
+    xSemaphoreGive(sessionLock);
+  } else if (server.hasArg("stop")) {
+    sessionRecording.store(false);
+  }
+  sendSessionState();
+}
+
+// Downloads the recording; this also ends it. Only the header goes out
+// here, serviceSessionDownload() sends the rest.
+void handleSession() {
+  sessionRecording.store(false);
+  if (sessionDownload.active) {
+    server.send(503, "text/plain", "A download is already running");
+    return;
+  }
+  xSemaphoreTake(sessionLock, portMAX_DELAY);
+  bool recorded = sessionBuf != NULL;
+  size_t length = session.size();
+  xSemaphoreGive(sessionLock);
+  if (!recorded) {
+    server.send(404, "text/plain", "Nothing recorded; start with /record?start");
+    return;
+  }
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  server.sendHeader("Content-Disposition", "attachment; filename=\"session.htrs\"");
+  server.setContentLength(length);
+  server.send(200, "application/octet-stream", "");
+
+  SessionDownload &d = sessionDownload;
+  d.client = server.client();
+  d.length = length;
+  d.offset = 0;
+  d.chunkLen = 0;
+  d.chunkSent = 0;
+  d.progressMs = millis();
+  d.active = true;
+}
+
+static void closeSessionDownload() {
+  sessionDownload.client.stop();
+  sessionDownload.client = WiFiClient();
+  sessionDownload.active = false;
+}
+
+// From httpTask's loop: up to VIEWER_BURST chunks of the /session body.
+// recordSessionFrame() may still be appending past `length`, so each
+// chunk is copied out under sessionLock, which is never held for a send.
+void serviceSessionDownload() {
+  SessionDownload &d = sessionDownload;
+  if (!d.active) {
+    return;
+  }
+  if (!d.client.connected() || millis() - d.progressMs > SESSION_STALL_MS) {
+    closeSessionDownload();
+    return;
+  }
+  int fd = d.client.fd();
+  for (int burst = 0; burst < VIEWER_BURST && d.offset < d.length; burst++) {
+    if (d.chunkSent == d.chunkLen) {
+      size_t n = d.length - d.offset < SESSION_CHUNK ? d.length - d.offset : SESSION_CHUNK;
+      xSemaphoreTake(sessionLock, portMAX_DELAY);
+      memcpy(d.chunk, sessionBuf + d.offset, n);
+      xSemaphoreGive(sessionLock);
+      d.chunkLen = n;
+      d.chunkSent = 0;
+    }
+    int sent = send(fd, d.chunk + d.chunkSent, d.chunkLen - d.chunkSent, MSG_DONTWAIT);
+    if (sent < 0) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        closeSessionDownload();
+        return;
+      }
+      break;
+    }
+    d.chunkSent += sent;
+    d.offset += sent;
+    d.progressMs = millis();
+  }
+  if (d.offset >= d.length) {
+    closeSessionDownload();
+  }
+}
+
+// Current stream settings and recent controller decisions. Optional
+// ?fps=<target>&latency=<ms> changes the targets. The level only drives
+// the sensor while the "adaptive" profile is active (see /profile).
+void handleQuality() {
+  if (!qualityController) {
+    server.send(404, "text/plain", "Adaptive quality needs the JPEG pipeline");
+    return;
+  }
+
+  if (server.hasArg("fps") || server.hasArg("latency")) {
+    float fps = server.hasArg("fps") ? server.arg("fps").toFloat() : qualityController->targetFps();
+    uint32_t latency = server.hasArg("latency") ? server.arg("latency").toInt()
+                                                : qualityController->latencyBudgetMs();
+    if (fps > 0 && latency > 0) {
+      qualityController->setTarget(fps, latency);
+    }
+  }
+
+  QualityLevel current = qualityController->current();
+  const QualityStats &stats = qualityController->stats();
+  QualityDecision history[QUALITY_HISTORY];
+  size_t count = qualityController->history(history, QUALITY_HISTORY);
+
+  String json;
+  json.reserve(256 + count * 96);
+  char buf[256];
+  snprintf(buf, sizeof(buf),
+           "{\"profile\":\"%s\",\"level\":%u,\"width\":%u,\"height\":%u,\"quality\":%d,"
+           "\"target_fps\":%.1f,\"latency_budget_ms\":%u,"
+           "\"fps\":%.1f,\"send_ms\":%.1f,\"kbps\":%.0f,\"client_fps\":%.1f,\"held\":%s,\"history\":[",
+           SENSOR_PROFILES[activeProfile].name, (unsigned)qualityController->level(),
+           resolution[current.frameSize].width, resolution[current.frameSize].height,
+           current.quality, qualityController->targetFps(),
+           (unsigned)qualityController->latencyBudgetMs(),
+           stats.fps, stats.sendMs, stats.kbps, stats.clientFps, stats.held ? "true" : "false");
+  json += buf;
+  for (size_t i = 0; i < count; i++) {
+    const QualityDecision &d = history[i];
+    snprintf(buf, sizeof(buf),
+             "%s{\"t_ms\":%u,\"from\":%u,\"to\":%u,\"fps\":%.1f,\"send_ms\":%.1f,"
+             "\"kbps\":%.0f}",
+             i ? "," : "", (unsigned)d.timeMs, d.from, d.to, d.stats.fps, d.stats.sendMs,
+             d.stats.kbps);
+    json += buf;
+  }
+  json += "]}";
+
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  server.send(200, "application/json", json);
+}
+
+static int findProfile(const String &name) {
+  for (size_t i = 0; i < SENSOR_PROFILE_COUNT; i++) {
+    if (name == SENSOR_PROFILES[i].name) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// One profile as JSON, with its effective frame size and what its last
+// benchmark achieved (fps 0 = not measured yet)
+static int profileJson(char *out, size_t size, size_t index) {
+  const SensorProfile &p = SENSOR_PROFILES[index];
+  const ProfileBench &bench = profileBench[index];
+  framesize_t frameSize = profileFrameSize(p);
+  return snprintf(out, size,
+                  "{\"name\":\"%s\",\"label\":\"%s\",\"width\":%u,\"height\":%u,"
+                  "\"xclk_mhz\":%u,\"fps\":%.1f,\"bytes\":%u,\"interval_p50_us\":%u,"
+                  "\"interval_max_us\":%u}",
+                  p.name, p.label, resolution[frameSize].width, resolution[frameSize].height,
+                  p.xclkMhz, bench.fps, (unsigned)bench.bytes, (unsigned)bench.p50Micros,
+                  (unsigned)bench.maxMicros);
+}
+
+// Sensor profiles. /profile lists them; ?name=<profile> applies one
+// (?name=adaptive hands the sensor back to the quality controller).
+// ?bench[=frames] starts timing CAMERA_FB_GET() under every profile, or
+// only the one given with name, and answers straight away; poll /profile
+// until "bench" is "idle" for the results. The run ends on the profile it
+// started with, or on the named one.
+void handleProfile() {
+#ifdef CAMERA_SYNTHETIC
+  server.send(404, "text/plain", "Sensor profiles need a camera (not CAMERA_SYNTHETIC)");
+  return;
+#endif
+  if (!esp_camera_sensor_get()) {
+    server.send(503, "text/plain", "Camera is not running");
+    return;
+  }
+  int chosen = -1;
+  if (server.hasArg("name")) {
+    chosen = findProfile(server.arg("name"));
+    if (chosen < 0) {
+      server.send(400, "text/plain", "Unknown profile");
+      return;
+    }
+  }
+
+  if (server.hasArg("bench")) {
+    String bench = server.arg("bench");
+    int frames = bench.length() ? bench.toInt() : CAPTURE_BENCH_FRAMES;
+    if (frames < 1 || frames > CAPTURE_BENCH_MAX_FRAMES) {
+      server.send(400, "text/plain", "bench: 1-200 frames");
+      return;
+    }
+    if (!startProfileBench(chosen, frames)) {
+      server.send(409, "text/plain", "A benchmark is already running");
+      return;
+    }
+  } else if (chosen >= 0) {
+    if (profileBenchRun.active) {
+      server.send(409, "text/plain", "A benchmark is running");
+      return;
+    }
+    applyProfile(chosen);
+  }
+
+  char json[1024];
+  int len = snprintf(json, sizeof(json),
+                     "{\"active\":\"%s\",\"bench\":\"%s\",\"profiles\":[",
+                     SENSOR_PROFILES[activeProfile].name,
+                     profileBenchRun.active ? "running" : "idle");
+  for (size_t i = 0; i < SENSOR_PROFILE_COUNT; i++) {
+    len += snprintf(json + len, sizeof(json) - len, "%s", i ? "," : "");
+    len += profileJson(json + len, sizeof(json) - len, i);
+  }
+  snprintf(json + len, sizeof(json) - len, "]}");
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  server.send(200, "application/json", json);
+}
+
+static void appendLine(MetricsText &out, const char *format, ...) {
+  if (out.len >= out.size) {
+    return;
+  }
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(out.buf + out.len, out.size - out.len, format, args);
+  va_end(args);
+  if (n > 0 && (size_t)n < out.size - out.len) {
+    out.len += n;
+  } else {
+    out.buf[out.len] = '\0';
+  }
+}
+
+static void appendMetric(MetricsText &out, const char *name, uint32_t value) {
+  appendLine(out, "%s %u\n", name, (unsigned)value);
+}
+
+static void appendHistogram(MetricsText &out, const char *name, const char *stage,
+                            const LatencyHistogram &h) {
+  static const char *QUANTILES[] = {"0.5", "0.9", "0.99"};
+  static const float VALUES[] = {0.5f, 0.9f, 0.99f};
+  for (int i = 0; i < 3; i++) {
+    appendLine(out, "%s{stage=\"%s\",quantile=\"%s\"} %u\n", name, stage, QUANTILES[i],
+               (unsigned)h.percentile(VALUES[i]));
+  }
+  appendLine(out, "%s_max{stage=\"%s\"} %u\n%s_count{stage=\"%s\"} %u\n", name, stage,
+             (unsigned)h.max(), name, stage, (unsigned)h.count());
+}
+
+// Prometheus text format: counters, memory and per-stage percentiles
+void handleMetrics() {
+  int streamCount = 0;
+  int captureCount = 0;
+  for (int i = 0; i < MAX_VIEWERS; i++) {
+    if (viewers[i].active) {
+      viewers[i].stream ? streamCount++ : captureCount++;
+    }
+  }
+
+  if (!metricsText) {
+    server.send(503, "text/plain", "No metrics buffer");
+    return;
+  }
+  MetricsText out = {metricsText, METRICS_BYTES, 0};
+  appendMetric(out, "frames_captured_total", framesCaptured);
+  appendMetric(out, "frames_sent_total", framesSent);
+  appendMetric(out, "frames_dropped_total", framesDropped);
+  appendMetric(out, "capture_failures_total", captureFailures);
+  appendMetric(out, "frames_unchanged_total", framesUnchanged);
+  appendMetric(out, "bytes_saved_total", bytesSaved);
+  appendMetric(out, "frames_decoded_in_bands_total", framesBanded);
+  appendMetric(out, "stream_clients", streamCount);
+  appendMetric(out, "capture_clients", captureCount);
+  appendMetric(out, "heap_free_bytes", ESP.getFreeHeap());
+  appendMetric(out, "heap_min_free_bytes", ESP.getMinFreeHeap());
+  // High water: the most ever in use; largest block: how fragmented it is
+  appendMetric(out, "heap_high_water_bytes", ESP.getHeapSize() - ESP.getMinFreeHeap());
+  appendMetric(out, "heap_largest_free_block_bytes", ESP.getMaxAllocHeap());
+  appendMetric(out, "psram_free_bytes", ESP.getFreePsram());
+  appendMetric(out, "psram_high_water_bytes", ESP.getPsramSize() - ESP.getMinFreePsram());
+  appendMetric(out, "arena_bytes{arena=\"internal\"}", fastArena.size());
+  appendMetric(out, "arena_used_bytes{arena=\"internal\"}", fastArena.used());
+  appendMetric(out, "arena_bytes{arena=\"bulk\"}", bulkArena.size());
+  appendMetric(out, "arena_used_bytes{arena=\"bulk\"}", bulkArena.used());
+  appendMetric(out, "encode_slots", encodeSlots.slots());
+  appendMetric(out, "encode_slots_in_use", encodeSlots.inUse());
+  appendMetric(out, "encode_slots_high_water", encodeSlots.highWater());
+  appendMetric(out, "encode_slots_exhausted_total", encodeSlots.exhausted());
+  appendHistogram(out, "stage_micros", "grab", grabMicros);
+  appendHistogram(out, "stage_micros", "header_send", headerMicros);
+  appendHistogram(out, "stage_micros", "body_send", bodyMicros);
+  appendHistogram(out, "stage_micros", "buffer_return", returnMicros);
+  appendHistogram(out, "stage_micros", "decode", decodeMicros);
+  appendHistogram(out, "stage_micros", "track", trackMicros);
+  appendHistogram(out, "frame_age_micros", "send_start", sendAgeMicros);
+  appendHistogram(out, "frame_age_micros", "tilt_ready", trackAgeMicros);
+  appendHistogram(out, "frame_bytes", "jpeg", frameBytes);
+
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  server.setContentLength(out.len);
+  server.send(200, "text/plain; version=0.0.4", "");
+  server.sendContent(out.buf, out.len);
+}
+
+void handleStream() {
+  // Keep the connection open; serviceViewers() pushes every new frame down
+  // it instead of paying a full request/response per frame like /capture.
+  Viewer *v = freeViewer();
+  if (!v) {
+    server.send(503, "text/plain", "Too many viewers");
+    return;
+  }
+  v->client = server.client();
+  v->stream = true;
+  v->headerSent = false;
+  v->sending = false;
+  v->gated = false;
+  v->roi = false;
+  v->seq = 0;
+  v->active = true;
+}
+
+void onWebSocketEvent(uint8_t num, WStype_t type, uint8_t *payload, size_t length) {
+  // The page tells us its sensitivity/inversion so our lane matches its own
+  // and where it found the face, which steers the /roi crop
+  TiltConfig config;
+  FaceBox box;
+  float clientFps;
+  if (type != WStype_BIN) {
+    return;
+  }
+  if (decodeTiltConfig(payload, length, &config)) {
+    tiltConfig = config;
+  } else if (decodeFaceBox(payload, length, &box)) {
+    uint32_t now = millis();
+    portENTER_CRITICAL(&tiltMux);
+    faceBox = box;
+    faceBoxAtMs = now;
+    pageBoxAtMs = now;
+    portEXIT_CRITICAL(&tiltMux);
+  } else if (qualityController && decodeClientFps(payload, length, &clientFps)) {
+    qualityController->onClientFps(clientFps, millis());
+  }
+}
+
+// Step the sensor along the quality ladder when the controller asks to
+void updateQuality() {
+  // A fixed sensor profile (/profile) overrides the controller, and so
+  // does a profile benchmark
+  if (!qualityController || !SENSOR_PROFILES[activeProfile].adaptive ||
+      profileBenchRun.active) {
+    return;
+  }
+  if (!qualityController->update(millis())) {
+    return;
+  }
+
+  QualityLevel level = qualityController->current();
+  sensor_t *s = esp_camera_sensor_get();
+  s->set_framesize(s, (framesize_t)level.frameSize);
+  s->set_quality(s, level.quality);
+  Serial.printf("Stream quality: %ux%u q%d\n", resolution[level.frameSize].width,
+                resolution[level.frameSize].height, level.quality);
+}
+
+void broadcastTilt() {
+  portENTER_CRITICAL(&tiltMux);
+  TiltReport report = tiltReport;
+  portEXIT_CRITICAL(&tiltMux);
+  if (report.seq == lastBroadcastSeq) {
+    return;
+  }
+  lastBroadcastSeq = report.seq;
+
+  // Send the smoothed angle as it will be when the page shows it, and a
+  // confidence that also drops when the measurements disagree
+  uint32_t now = millis();
+  float angle = report.filter.valid() ? report.filter.predict(now + TILT_DISPLAY_LEAD_MS)
+                                      : report.tilt.angle;
+  TiltUpdate update;
+  update.found = report.tilt.found;
+  update.angle = tiltConfig.invert ? -angle : angle;
+  update.confidence = report.tilt.confidence * report.filter.confidence(now);
+  update.seq = report.seq;
+  update.captureMs = report.captureMs;
+  // Without a face, hold the last lane like the page does
+  if (update.found) {
+    broadcastLane.update(update.angle, tiltConfig.threshold);
+  }
+  update.lane = broadcastLane.lane();
+
+  uint8_t msg[TILT_UPDATE_SIZE];
+  webSocket.broadcastBIN(msg, encodeTiltUpdate(update, msg));
+}
+
+// All HTTP work lives on the PRO core, opposite the capture task
+void httpTask(void *arg) {
+  for (;;) {
+    server.handleClient();
+    webSocket.loop();
+    broadcastTilt();
+    serviceViewers();
+    serviceSessionDownload();
+    serviceProfileBench();
+    serviceDecodeBench();
+    updateQuality();
+    vTaskDelay(1);
+  }
+}
+
+// ==========================================
+// FRAME ARENA
+// ==========================================
+
+// Carves every frame-path buffer once, before the tasks start. Without
+// PSRAM both arenas are internal RAM, with fewer and smaller encode slots
+// and crops.
+bool setupArena() {
+  bool psram = psramFound();
+  size_t slotBytes = psram ? ENCODE_SLOT_BYTES_PSRAM : ENCODE_SLOT_BYTES_DRAM;
+  uint8_t slots = psram ? MAX_VIEWERS : ENCODE_SLOTS_DRAM;
+  roiCropBytes = psram ? ROI_CROP_BYTES_PSRAM : ROI_CROP_BYTES_DRAM;
+  size_t fastBytes = TRACK_MAX_WIDTH * TRACK_MAX_HEIGHT + JPEG_WORKS * JPEG_WORK_BYTES + 16;
+  size_t bulkBytes = slotBytes * slots + roiCropBytes + METRICS_BYTES + 16;
+
+  fastArena.begin((uint8_t *)heap_caps_malloc(fastBytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT),
+                  fastBytes);
+  bulkArena.begin((uint8_t *)(psram ? ps_malloc(bulkBytes)
+                                    : heap_caps_malloc(bulkBytes,
+                                                       MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)),
+                  bulkBytes);
+  trackGray = fastArena.carve(TRACK_MAX_WIDTH * TRACK_MAX_HEIGHT);
+  for (int i = 0; i < JPEG_WORKS; i++) {
+    jpegWork[i] = fastArena.carve(JPEG_WORK_BYTES);
+  }
+  encodeSlots.begin(bulkArena, slotBytes, slots);
+  roiCrop = bulkArena.carve(roiCropBytes);
+  metricsText = (char *)bulkArena.carve(METRICS_BYTES);
+  if (!roiCrop) {
+    roiCropBytes = 0;
+  }
+
+  Serial.printf("Frame arena: %u/%u bytes internal, %u/%u bytes %s, %u encode slots of %u\n",
+                (unsigned)fastArena.used(), (unsigned)fastArena.size(), (unsigned)bulkArena.used(),
+                (unsigned)bulkArena.size(), psram ? "PSRAM" : "internal",
+                (unsigned)encodeSlots.slots(), (unsigned)encodeSlots.slotSize());
+  return fastArena.failures() == 0 && bulkArena.failures() == 0;
 }
 
 // ==========================================
@@ -108,7 +2167,25 @@ void setup() {
   Serial.setDebugOutput(true);
   Serial.println();
 
+  cpuMHz = ESP.getCpuFreqMHz();
   setupCamera();
+  xTaskCreatePinnedToCore(captureTask, "capture", 4096, NULL, 2, NULL, APP_CPU_NUM);
+
+  sessionLock = xSemaphoreCreateMutex();
+  if (!setupArena()) {
+    Serial.println("Frame arena allocation failed");
+  }
+  if (trackGray && DECODE_BANDS > 1) {
+    decodeHelperQueue = xQueueCreate(1, sizeof(GrayDecodeJob *));
+    decodeHelperDone = xSemaphoreCreateBinary();
+    xTaskCreatePinnedToCore(decodeHelperTask, "decode", 4096, decodeHelperQueue, 1, NULL,
+                            PRO_CPU_NUM);
+  }
+  if (trackGray) {
+    xTaskCreatePinnedToCore(trackTask, "track", 8192, NULL, 1, NULL, APP_CPU_NUM);
+  } else {
+    Serial.println("Tracking buffer allocation failed");
+  }
 
   // Connect to WiFi
   WiFi.mode(WIFI_STA);
@@ -133,11 +2210,31 @@ void setup() {
     Serial.println("\nWiFi connection failed. Check your credentials.");
   }
 
-  server.on("/", handleRoot);
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset &asset = WEB_ASSETS[i];
+    server.on(asset.path, [&asset]() { handleAsset(asset); });
+  }
   server.on("/capture", handleCapture);
+  server.on("/roi", handleRoi);
+  server.on("/stream", handleStream);
+  server.on("/tilt", handleTilt);
+  server.on("/quality", handleQuality);
+  server.on("/profile", handleProfile);
+  server.on("/metrics", handleMetrics);
+  server.on("/time", handleTime);
+  server.on("/decode", handleDecodeBench);
+  server.on("/record", handleRecord);
+  server.on("/session", handleSession);
 
+  // WebServer drops request headers unless asked to keep them
+  static const char *KEEP_HEADERS[] = {"If-None-Match"};
+  server.collectHeaders(KEEP_HEADERS, 1);
   server.begin();
+  webSocket.begin();
+  webSocket.onEvent(onWebSocketEvent);
+  xTaskCreatePinnedToCore(httpTask, "http", 8192, NULL, 1, NULL, PRO_CPU_NUM);
   Serial.println("HTTP server started");
 }
 
-void loop() { server.handleClient(); }
+// Everything runs in captureTask/httpTask; the Arduino loop task is not needed
+void loop() { vTaskDelete(NULL); }
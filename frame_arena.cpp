@@ -0,0 +1,72 @@
+#include "frame_arena.h"
+
+#include <string.h>
+
+void FrameArena::begin(uint8_t *memory, size_t size) {
+  memory_ = memory;
+  size_ = memory ? size : 0;
+  used_ = 0;
+  failures_ = 0;
+}
+
+uint8_t *FrameArena::carve(size_t size, size_t align) {
+  uintptr_t at = ((uintptr_t)memory_ + used_ + align - 1) & ~(uintptr_t)(align - 1);
+  size_t start = at - (uintptr_t)memory_;
+  if (!memory_ || start > size_ || size > size_ - start) {
+    failures_++;
+    return nullptr;
+  }
+  used_ = start + size;
+  return memory_ + start;
+}
+
+bool SlotPool::begin(FrameArena &arena, size_t slotSize, uint8_t slots) {
+  slots = slots > SLOT_POOL_MAX ? SLOT_POOL_MAX : slots;
+  // Slots start on a word boundary
+  slotSize = (slotSize + 3) & ~(size_t)3;
+  base_ = slots ? arena.carve(slotSize * slots) : nullptr;
+  slotSize_ = base_ ? slotSize : 0;
+  slots_ = base_ ? slots : 0;
+  inUse_ = 0;
+  highWater_ = 0;
+  used_ = 0;
+  exhausted_ = 0;
+  return base_ != nullptr;
+}
+
+uint8_t *SlotPool::acquire() {
+  for (uint8_t i = 0; i < slots_; i++) {
+    if (!(used_ & (1u << i))) {
+      used_ |= 1u << i;
+      inUse_++;
+      highWater_ = inUse_ > highWater_ ? inUse_ : highWater_;
+      return base_ + (size_t)i * slotSize_;
+    }
+  }
+  exhausted_++;
+  return nullptr;
+}
+
+void SlotPool::release(const uint8_t *buf) {
+  if (!base_ || buf < base_ || buf >= base_ + (size_t)slots_ * slotSize_) {
+    return;
+  }
+  size_t i = (size_t)(buf - base_) / slotSize_;
+  if (used_ & (1u << i)) {
+    used_ &= ~(1u << i);
+    inUse_--;
+  }
+}
+
+size_t slotWrite(void *arg, size_t index, const void *data, size_t len) {
+  SlotWriter *w = (SlotWriter *)arg;
+  if (index > w->capacity || len > w->capacity - index) {
+    w->overflow = true;
+    return 0;
+  }
+  memcpy(w->buf + index, data, len);
+  if (index + len > w->length) {
+    w->length = index + len;
+  }
+  return len;
+}
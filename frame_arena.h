@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// FRAME ARENA
+// ==========================================
+// Every buffer the frame path needs is carved out of one block at boot and
+// never given back, so serving and tracking frames never touches the heap
+// and cannot fragment it over a long session. FrameArena hands out the
+// regions. SlotPool lends out equal-sized buffers from one region, for
+// outputs that live for one frame (a JPEG encoded for one viewer), and
+// SlotWriter fills such a buffer as the JPEG encoder's output callback.
+//
+// Not thread-safe: a pool belongs to one task, and carving is done before
+// the tasks start.
+//
+// Plain C++ only, so the same code runs on the ESP32 and on a PC.
+
+#define SLOT_POOL_MAX 8
+
+class FrameArena {
+public:
+  // memory: size bytes owned by the caller, e.g. from ps_malloc() at boot
+  void begin(uint8_t *memory, size_t size);
+
+  // size bytes aligned to `align` (a power of two), or NULL once it does
+  // not fit
+  uint8_t *carve(size_t size, size_t align = 4);
+
+  size_t size() const { return size_; }
+  size_t used() const { return used_; }
+  uint32_t failures() const { return failures_; } // carve() calls that did not fit
+
+private:
+  uint8_t *memory_ = nullptr;
+  size_t size_ = 0;
+  size_t used_ = 0;
+  uint32_t failures_ = 0;
+};
+
+class SlotPool {
+public:
+  // Carves slots x slotSize bytes (up to SLOT_POOL_MAX slots) from arena
+  bool begin(FrameArena &arena, size_t slotSize, uint8_t slots);
+
+  // A free slot, or NULL while all of them are lent out
+  uint8_t *acquire();
+  // Ignores buffers that are not one of this pool's slots
+  void release(const uint8_t *buf);
+
+  size_t slotSize() const { return slotSize_; }
+  uint8_t slots() const { return slots_; }
+  uint8_t inUse() const { return inUse_; }
+  uint8_t highWater() const { return highWater_; } // most slots out at once
+  uint32_t exhausted() const { return exhausted_; } // acquire() calls that got NULL
+
+private:
+  uint8_t *base_ = nullptr;
+  size_t slotSize_ = 0;
+  uint8_t slots_ = 0;
+  uint8_t inUse_ = 0;
+  uint8_t highWater_ = 0;
+  uint32_t used_ = 0; // bit per slot
+  uint32_t exhausted_ = 0;
+};
+
+struct SlotWriter {
+  uint8_t *buf;
+  size_t capacity;
+  size_t length;
+  bool overflow;
+};
+
+// jpg_out_cb for fmt2jpg_cb() / frame2jpg_cb(): copies the encoder's output
+// into the slot and returns 0, which stops the encoder, once it would not
+// fit
+size_t slotWrite(void *arg, size_t index, const void *data, size_t len);
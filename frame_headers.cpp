@@ -0,0 +1,105 @@
+#include "frame_headers.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#define STREAM_BOUNDARY "frame"
+
+static const char STREAM_HEADER[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: multipart/x-mixed-replace;boundary=" STREAM_BOUNDARY "\r\n"
+    "Access-Control-Allow-Origin: *\r\n"
+    "Cache-Control: no-cache, no-store, must-revalidate\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char STREAM_PART[] =
+    "--" STREAM_BOUNDARY "\r\n"
+    "Content-Type: image/jpeg\r\n";
+static const char CAPTURE_HEADER[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: image/jpeg\r\n"
+    "Access-Control-Allow-Origin: *\r\n"
+    "Access-Control-Allow-Methods: GET\r\n"
+    "Access-Control-Expose-Headers: ETag, X-Frame-Seq, X-Capture-Ms, X-ROI, X-Frame-Size\r\n"
+    "Cache-Control: no-cache, no-store, must-revalidate\r\n"
+    "Connection: close\r\n";
+static const char NOT_MODIFIED_HEADER[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Access-Control-Allow-Origin: *\r\n"
+    "Access-Control-Expose-Headers: X-Tilt-Angle, X-Tilt-Found\r\n"
+    "Connection: close\r\n";
+
+// Appends to out at *len; false (and *len = 0) once it does not fit
+static bool append(char *out, size_t size, size_t *len, const char *block, size_t blockLen) {
+  if (*len >= size || blockLen >= size - *len) {
+    *len = 0;
+    return false;
+  }
+  memcpy(out + *len, block, blockLen);
+  *len += blockLen;
+  out[*len] = '\0';
+  return true;
+}
+
+static bool appendf(char *out, size_t size, size_t *len, const char *format, ...) {
+  if (*len >= size) {
+    *len = 0;
+    return false;
+  }
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(out + *len, size - *len, format, args);
+  va_end(args);
+  if (n < 0 || (size_t)n >= size - *len) {
+    *len = 0;
+    return false;
+  }
+  *len += n;
+  return true;
+}
+
+size_t streamResponseHeader(char *out, size_t size) {
+  size_t len = 0;
+  append(out, size, &len, STREAM_HEADER, sizeof(STREAM_HEADER) - 1);
+  return len;
+}
+
+size_t streamPartHeader(char *out, size_t size, uint32_t length, uint32_t seq,
+                        uint32_t captureMs) {
+  size_t len = 0;
+  if (append(out, size, &len, STREAM_PART, sizeof(STREAM_PART) - 1)) {
+    appendf(out, size, &len, "Content-Length: %u\r\nX-Frame-Seq: %u\r\nX-Capture-Ms: %u\r\n\r\n",
+            (unsigned)length, (unsigned)seq, (unsigned)captureMs);
+  }
+  return len;
+}
+
+size_t captureResponseHeader(char *out, size_t size, uint32_t length, uint32_t seq,
+                             uint32_t captureMs, const RoiRect *roi) {
+  size_t len = 0;
+  if (!append(out, size, &len, CAPTURE_HEADER, sizeof(CAPTURE_HEADER) - 1) ||
+      !appendf(out, size, &len,
+               "Content-Length: %u\r\nETag: \"%u\"\r\nX-Frame-Seq: %u\r\nX-Capture-Ms: %u\r\n",
+               (unsigned)length, (unsigned)seq, (unsigned)seq, (unsigned)captureMs)) {
+    return 0;
+  }
+  if (roi && !appendf(out, size, &len, "X-ROI: %u,%u,%u,%u\r\nX-Frame-Size: %u,%u\r\n", roi->x,
+                      roi->y, roi->width, roi->height, roi->frameWidth, roi->frameHeight)) {
+    return 0;
+  }
+  append(out, size, &len, "\r\n", 2);
+  return len;
+}
+
+size_t notModifiedHeader(char *out, size_t size, uint32_t seq, float angle, bool found) {
+  // Tenths of a degree by hand: printf's %f is not guaranteed heap-free
+  int tenths = (int)(angle * 10.0f + (angle < 0 ? -0.5f : 0.5f));
+  unsigned whole = (unsigned)(tenths < 0 ? -tenths : tenths);
+  size_t len = 0;
+  if (append(out, size, &len, NOT_MODIFIED_HEADER, sizeof(NOT_MODIFIED_HEADER) - 1)) {
+    appendf(out, size, &len, "ETag: \"%u\"\r\nX-Tilt-Angle: %s%u.%u\r\nX-Tilt-Found: %u\r\n\r\n",
+            (unsigned)seq, tenths < 0 ? "-" : "", whole / 10, whole % 10, found ? 1u : 0u);
+  }
+  return len;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// FRAME RESPONSE HEADERS
+// ==========================================
+// The HTTP headers the sketch writes itself for /stream, /capture and /roi
+// (and the 304 for an unchanged /capture), into a buffer the caller owns.
+// Everything that is the same on every response is one constant block,
+// copied as is; only the per-frame numbers are formatted. No String and no
+// heap, so tools/alloc_check.cpp can count what a request allocates.
+//
+// Each function returns the length written, or 0 if it did not fit in
+// `size` bytes.
+//
+// Plain C++ only, so the same code runs on the ESP32 and on a PC.
+
+#define FRAME_HEADER_MAX 448
+
+struct RoiRect {
+  uint16_t x, y, width, height; // crop sent
+  uint16_t frameWidth, frameHeight; // frame it was cut from
+};
+
+// Once per /stream connection, before the first part
+size_t streamResponseHeader(char *out, size_t size);
+
+// Before every JPEG of a stream. Every frame carries its sequence number
+// and capture time (device millis(), see /time).
+size_t streamPartHeader(char *out, size_t size, uint32_t length, uint32_t seq,
+                        uint32_t captureMs);
+
+// The whole header of a /capture response (/roi: with roi set), up to
+// and including the blank line; the ETag is the frame's sequence number
+size_t captureResponseHeader(char *out, size_t size, uint32_t length, uint32_t seq,
+                             uint32_t captureMs, const RoiRect *roi);
+
+// 304 for a /capture whose frame is unchanged, with the current tilt
+size_t notModifiedHeader(char *out, size_t size, uint32_t seq, float angle, bool found);
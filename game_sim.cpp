@@ -0,0 +1,118 @@
+#include "game_sim.h"
+
+// Obstacles are this tall for collisions (the drawn car is taller)
+#define OBSTACLE_HIT_HEIGHT 40
+#define OBSTACLE_START_Y -50
+
+GameSim::GameSim(uint32_t seed, uint8_t players)
+    : rng_(seed ? seed : 1),
+      players_(players < 1 ? 1 : players > GAME_MAX_PLAYERS ? GAME_MAX_PLAYERS : players) {}
+
+// xorshift32: tiny, and easy to reproduce bit for bit in JavaScript
+uint32_t GameSim::random() {
+  rng_ ^= rng_ << 13;
+  rng_ ^= rng_ >> 17;
+  rng_ ^= rng_ << 5;
+  return rng_;
+}
+
+void GameSim::spawn() {
+  if (count_ == GAME_MAX_OBSTACLES) {
+    return;
+  }
+  lanes_[count_] = random() % 3;
+  ys_[count_] = OBSTACLE_START_Y;
+  count_++;
+}
+
+void GameSim::step(const GameInput &input) {
+  GamePartyInput party = {{input.lane, 1, 1, 1}, input.speed};
+  stepParty(party);
+}
+
+void GameSim::stepParty(const GamePartyInput &input) {
+  if (crashed()) {
+    return;
+  }
+  tick_++;
+  for (uint8_t p = 0; p < players_; p++) {
+    if (!crashed_[p]) {
+      score_[p]++;
+      lane_[p] = input.lanes[p];
+    }
+  }
+
+  spawnTimer_++;
+  if (spawnTimer_ > (uint32_t)(60 - input.speed * 3)) {
+    spawn();
+    spawnTimer_ = 0;
+  }
+
+  // Move, collide, and drop what has left the road
+  for (size_t i = 0; i < count_;) {
+    int16_t y = ys_[i] + input.speed + 2;
+    ys_[i] = y;
+    if (y + OBSTACLE_HIT_HEIGHT > GAME_PLAYER_Y && y < GAME_PLAYER_Y + GAME_CAR_SIZE) {
+      for (uint8_t p = 0; p < players_; p++) {
+        if (!crashed_[p] && lane_[p] == lanes_[i]) {
+          crashed_[p] = true;
+          crashedCount_++;
+        }
+      }
+    }
+    if (y > GAME_HEIGHT) {
+      count_--;
+      lanes_[i] = lanes_[count_];
+      ys_[i] = ys_[count_];
+    } else {
+      i++;
+    }
+  }
+}
+
+static uint32_t fnv1a(uint32_t h, uint32_t v) {
+  for (int i = 0; i < 4; i++) {
+    h ^= (v >> (8 * i)) & 0xff;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+uint32_t GameSim::hash() const {
+  uint32_t h = 2166136261u;
+  h = fnv1a(h, tick_);
+  h = fnv1a(h, score_[0]);
+  h = fnv1a(h, rng_);
+  h = fnv1a(h, spawnTimer_);
+  h = fnv1a(h, lane_[0]);
+  h = fnv1a(h, crashed());
+  h = fnv1a(h, count_);
+  for (size_t i = 0; i < count_; i++) {
+    h = fnv1a(h, lanes_[i]);
+    h = fnv1a(h, (uint32_t)(int32_t)ys_[i]);
+  }
+  // Every player's own state, player 0 included: crashed() above is only
+  // whether all of them are out
+  for (uint8_t p = 0; p < players_; p++) {
+    h = fnv1a(h, lane_[p]);
+    h = fnv1a(h, crashed_[p]);
+    h = fnv1a(h, score_[p]);
+  }
+  return h;
+}
+
+uint32_t GameClock::advance(float frameMs) {
+  if (frameMs > GAME_MAX_FRAME_MS) {
+    frameMs = GAME_MAX_FRAME_MS;
+  } else if (frameMs < 0) {
+    frameMs = 0;
+  }
+  accumulatorMs_ += frameMs;
+  const float tickMs = 1000.0f / GAME_TICK_HZ;
+  uint32_t ticks = 0;
+  while (accumulatorMs_ >= tickMs) {
+    accumulatorMs_ -= tickMs;
+    ticks++;
+  }
+  return ticks;
+}
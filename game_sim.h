@@ -0,0 +1,108 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// GAME SIMULATION
+// ==========================================
+// The racing game's rules (obstacles, spawning, collision, score) as a
+// deterministic fixed-timestep engine: GAME_TICK_HZ steps per second no
+// matter how fast frames are drawn or faces are found, integer positions
+// and its own seeded random numbers. The same seed and per-tick inputs
+// always give the same game, at any frame rate.
+//
+// Up to GAME_MAX_PLAYERS cars share one road (party mode): each player
+// steers their own car and a crash takes only that car out; the game ends
+// once every car has crashed. With one player the game plays exactly as
+// the original one-car game did: the same obstacles at the same ticks, the
+// same score and the same crash tick. Its hash is not the old one, because
+// hash() also covers each player's lane, score and crash.
+//
+// This is the reference for GameSim in index.html, which the page runs;
+// keep the two in step for 1 to GAME_MAX_PLAYERS players
+// (tools/game_parity.js compares their hashes, and ctest pins
+// tools/game_replay.cpp's for each player count).
+// Plain C++ only, so the same code runs on the ESP32 and on a PC.
+
+#define GAME_TICK_HZ 60
+#define GAME_WIDTH 640
+#define GAME_HEIGHT 480
+#define GAME_LANE_WIDTH (GAME_WIDTH / 3)
+#define GAME_CAR_SIZE 60
+#define GAME_PLAYER_Y (GAME_HEIGHT - 100)
+#define GAME_MAX_OBSTACLES 16
+#define GAME_MAX_PLAYERS 4
+
+// What the player does during one tick
+struct GameInput {
+  uint8_t lane;  // 0 left, 1 centre, 2 right
+  uint8_t speed; // 1..10, the page's speed slider
+};
+
+// What every player does during one tick; the speed is shared
+struct GamePartyInput {
+  uint8_t lanes[GAME_MAX_PLAYERS];
+  uint8_t speed;
+};
+
+struct Obstacle {
+  uint8_t lane;
+  int16_t y; // top edge, pixels
+};
+
+class GameSim {
+public:
+  explicit GameSim(uint32_t seed, uint8_t players = 1);
+
+  // Advances one tick. Does nothing once every car has crashed.
+  void step(const GameInput &input); // one-player games
+  void stepParty(const GamePartyInput &input);
+
+  uint8_t players() const { return players_; }
+  bool crashed() const { return crashedCount_ == players_; } // all of them
+  bool crashed(uint8_t player) const { return crashed_[player]; }
+  uint32_t tick() const { return tick_; }
+  // A player's score counts the ticks until their crash
+  uint32_t score(uint8_t player = 0) const { return score_[player]; }
+  uint8_t lane(uint8_t player = 0) const { return lane_[player]; }
+  size_t obstacleCount() const { return count_; }
+  Obstacle obstacle(size_t i) const { return {lanes_[i], ys_[i]}; }
+
+  // FNV-1a over the whole state, to compare runs
+  uint32_t hash() const;
+
+private:
+  uint32_t random();
+  void spawn();
+
+  uint32_t rng_;
+  uint32_t tick_ = 0;
+  uint32_t spawnTimer_ = 0;
+  uint8_t players_;
+  uint8_t crashedCount_ = 0;
+  uint32_t score_[GAME_MAX_PLAYERS] = {};
+  uint8_t lane_[GAME_MAX_PLAYERS] = {1, 1, 1, 1};
+  bool crashed_[GAME_MAX_PLAYERS] = {};
+  // Fixed pool, one array per field; removal swaps the last one in, so
+  // obstacles are not kept in spawn order
+  uint8_t lanes_[GAME_MAX_OBSTACLES];
+  int16_t ys_[GAME_MAX_OBSTACLES];
+  size_t count_ = 0;
+};
+
+// Turns frame times into whole ticks. Carries the remainder over, and drops
+// time beyond GAME_MAX_FRAME_MS (a background tab) rather than fast-forward.
+#define GAME_MAX_FRAME_MS 250
+
+class GameClock {
+public:
+  // Ticks to run for a frame that took frameMs
+  uint32_t advance(float frameMs);
+
+  // 0..1: how far between the last tick and the next, for drawing
+  float alpha() const { return accumulatorMs_ * GAME_TICK_HZ / 1000.0f; }
+
+private:
+  float accumulatorMs_ = 0;
+};
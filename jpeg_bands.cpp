@@ -0,0 +1,162 @@
+#include "jpeg_bands.h"
+
+#include <string.h>
+
+static uint16_t get16be(const uint8_t *p) { return (p[0] << 8) | p[1]; }
+
+bool parseJpegLayout(const uint8_t *jpeg, size_t length, JpegLayout *layout) {
+  if (length < 4 || jpeg[0] != 0xFF || jpeg[1] != 0xD8) {
+    return false;
+  }
+  JpegLayout l = {};
+  uint8_t components = 0;
+  size_t pos = 2;
+  while (pos + 4 <= length) {
+    if (jpeg[pos] != 0xFF) {
+      return false;
+    }
+    uint8_t marker = jpeg[pos + 1];
+    if (marker == 0xFF) { // fill byte before a marker
+      pos++;
+      continue;
+    }
+    size_t segment = get16be(jpeg + pos + 2);
+    if (segment < 2 || pos + 2 + segment > length) {
+      return false;
+    }
+    const uint8_t *p = jpeg + pos + 4;
+    if (marker == 0xC0 || marker == 0xC1) { // baseline / extended sequential
+      if (segment < 8) {
+        return false;
+      }
+      l.sofHeightOffset = pos + 5;
+      l.height = get16be(p + 1);
+      l.width = get16be(p + 3);
+      components = p[5];
+      if (components == 0 || segment < 8 + 3u * components) {
+        return false;
+      }
+      uint8_t maxH = 1, maxV = 1;
+      for (uint8_t i = 0; i < components && components > 1; i++) {
+        uint8_t sampling = p[7 + 3 * i];
+        maxH = (sampling >> 4) > maxH ? (sampling >> 4) : maxH;
+        maxV = (sampling & 15) > maxV ? (sampling & 15) : maxV;
+      }
+      // A single-component scan has one block per MCU, whatever the factors
+      l.mcuWidth = 8 * maxH;
+      l.mcuHeight = 8 * maxV;
+    } else if (marker >= 0xC2 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 &&
+               marker != 0xCC) {
+      return false; // progressive, lossless or arithmetic
+    } else if (marker == 0xDD && segment >= 4) {
+      l.restartInterval = get16be(p);
+    } else if (marker == 0xDA) {
+      // Only one scan holding every component
+      if (components == 0 || p[0] != components || l.height == 0) {
+        return false;
+      }
+      l.scanStart = pos + 2 + segment;
+      // Camera frames can carry padding after EOI
+      size_t end = length;
+      while (end >= l.scanStart + 2 && !(jpeg[end - 2] == 0xFF && jpeg[end - 1] == 0xD9)) {
+        end--;
+      }
+      l.scanEnd = end >= l.scanStart + 2 ? end - 2 : length;
+      *layout = l;
+      return true;
+    }
+    pos += 2 + segment;
+  }
+  return false;
+}
+
+int splitJpegBands(const uint8_t *jpeg, const JpegLayout &layout, JpegBand *bands,
+                   int maxBands) {
+  bands[0] = {0, layout.height, layout.scanStart, layout.scanEnd - layout.scanStart};
+  uint32_t mcusPerRow = (layout.width + layout.mcuWidth - 1) / layout.mcuWidth;
+  uint32_t mcuRows = (layout.height + layout.mcuHeight - 1) / layout.mcuHeight;
+  if (maxBands < 2 || layout.restartInterval == 0 || mcuRows < 2) {
+    return 1;
+  }
+
+  int count = 1;
+  uint32_t markers = 0;
+  for (size_t pos = layout.scanStart; pos + 1 < layout.scanEnd && count < maxBands; pos++) {
+    // 0xFF 0x00 is a stuffed data byte; 0xFF 0xD0..0xD7 a restart marker
+    if (jpeg[pos] != 0xFF || (jpeg[pos + 1] & 0xF8) != 0xD0) {
+      continue;
+    }
+    if ((jpeg[pos + 1] & 7) != (markers & 7)) {
+      break; // out of sequence; keep what is cut so far
+    }
+    markers++;
+    pos++;
+    uint32_t mcu = markers * layout.restartInterval;
+    if (markers % 8 != 0 || mcu % mcusPerRow != 0) {
+      continue;
+    }
+    uint32_t row = mcu / mcusPerRow;
+    if (row >= mcuRows) {
+      break;
+    }
+    if (row * maxBands < count * mcuRows) {
+      continue; // this band is not tall enough yet
+    }
+    uint16_t y = row * layout.mcuHeight;
+    JpegBand &last = bands[count - 1];
+    last.length = pos - 1 - last.start;
+    last.height = y - last.y;
+    bands[count++] = {y, (uint16_t)(layout.height - y), pos + 1, layout.scanEnd - pos - 1};
+  }
+  return count;
+}
+
+size_t jpegBandSize(const JpegLayout &layout, const JpegBand &band) {
+  return layout.scanStart + band.length + 2;
+}
+
+size_t readJpegBand(const uint8_t *jpeg, const JpegLayout &layout, const JpegBand &band,
+                    size_t index, uint8_t *buf, size_t len) {
+  size_t size = jpegBandSize(layout, band);
+  if (index >= size) {
+    return 0;
+  }
+  if (len > size - index) {
+    len = size - index;
+  }
+  if (!buf) {
+    return len;
+  }
+
+  // Headers, with the band's height in place of the frame's
+  size_t done = 0;
+  if (index < layout.scanStart) {
+    size_t n = layout.scanStart - index < len ? layout.scanStart - index : len;
+    memcpy(buf, jpeg + index, n);
+    const uint8_t height[2] = {(uint8_t)(band.height >> 8), (uint8_t)band.height};
+    for (size_t i = 0; i < 2; i++) {
+      size_t at = layout.sofHeightOffset + i;
+      if (at >= index && at < index + n) {
+        buf[at - index] = height[i];
+      }
+    }
+    done = n;
+  }
+
+  // The band's data
+  size_t dataEnd = layout.scanStart + band.length;
+  if (done < len && index + done < dataEnd) {
+    size_t offset = index + done - layout.scanStart;
+    size_t n = dataEnd - (index + done) < len - done ? dataEnd - (index + done) : len - done;
+    memcpy(buf + done, jpeg + band.start + offset, n);
+    done += n;
+  }
+
+  // EOI
+  static const uint8_t EOI[2] = {0xFF, 0xD9};
+  while (done < len) {
+    buf[done] = EOI[index + done - dataEnd];
+    done++;
+  }
+  return len;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// JPEG BANDS
+// ==========================================
+// Splits a baseline JPEG into horizontal bands that decode independently,
+// so two cores (or threads on a PC) can each decode part of one frame.
+// This only works when the encoder wrote restart markers (DRI): the DC
+// prediction starts over at every marker, so the entropy-coded data can
+// be cut there. A band is the original headers with the frame height
+// changed to the band's, that band's data, and an EOI marker; any JPEG
+// decoder reads it as a small image, at any DCT scale.
+//
+// A cut has to fall on a restart marker that also starts a row of MCUs,
+// and, since decoders check that markers count RST0..RST7 in order, after
+// a multiple of 8 intervals. Frames without markers stay one band.
+//
+// Plain C++ only, so the same code runs on the ESP32 and on a PC.
+
+struct JpegLayout {
+  uint16_t width, height;
+  uint8_t mcuWidth, mcuHeight;  // pixels
+  uint16_t restartInterval;     // MCUs between markers, 0 = none
+  size_t sofHeightOffset;       // the 16-bit frame height in the headers
+  size_t scanStart, scanEnd;    // entropy-coded data, up to the EOI marker
+};
+
+struct JpegBand {
+  uint16_t y, height;   // rows of the frame, y a multiple of mcuHeight
+  size_t start, length; // entropy-coded data of the band
+};
+
+// Reads the headers of a single-scan baseline JPEG; false for anything
+// else (progressive, several scans, damaged)
+bool parseJpegLayout(const uint8_t *jpeg, size_t length, JpegLayout *layout);
+
+// Fills up to maxBands bands of roughly equal height, top to bottom, and
+// returns how many. 1 means the frame cannot be split (bands[0] is the
+// whole frame). Stops reading the data at the last cut.
+int splitJpegBands(const uint8_t *jpeg, const JpegLayout &layout, JpegBand *bands,
+                   int maxBands);
+
+// Size of a band as a standalone JPEG
+size_t jpegBandSize(const JpegLayout &layout, const JpegBand &band);
+
+// Copies len bytes of the standalone band JPEG, from `index` on, into buf
+// (or only counts them if buf is NULL, as esp_jpg_decode() asks when
+// skipping). Returns the bytes available, at most len.
+size_t readJpegBand(const uint8_t *jpeg, const JpegLayout &layout, const JpegBand &band,
+                    size_t index, uint8_t *buf, size_t len);
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// LATENCY HISTOGRAM
+// ==========================================
+// Fixed-size, lock-free log-linear histogram: four buckets per power of
+// two, so any recorded value lands in a bucket at most 25% wide. record()
+// is a couple of relaxed atomic adds and is safe from any task or core,
+// which keeps it cheap enough to leave on in production. Readers get
+// approximate percentiles (bucket midpoint, capped at the exact max; p=1
+// is the exact max).
+//
+// Values are plain uint32_t: microseconds for timings, bytes for sizes.
+// Plain C++ only, so the same code runs on the ESP32 and on a PC.
+
+#define HISTOGRAM_SUB_BUCKETS 4 // per power of two
+#define HISTOGRAM_BUCKETS (31 * HISTOGRAM_SUB_BUCKETS)
+
+class LatencyHistogram {
+public:
+  void record(uint32_t value) {
+    buckets_[bucketFor(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    uint32_t max = max_.load(std::memory_order_relaxed);
+    while (value > max &&
+           !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+  }
+
+  uint32_t count() const { return count_.load(std::memory_order_relaxed); }
+  uint32_t max() const { return max_.load(std::memory_order_relaxed); }
+
+  // p in [0, 1]. 0 when nothing was recorded.
+  uint32_t percentile(float p) const {
+    uint32_t total = 0;
+    uint32_t snapshot[HISTOGRAM_BUCKETS];
+    for (size_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+      snapshot[i] = buckets_[i].load(std::memory_order_relaxed);
+      total += snapshot[i];
+    }
+    if (total == 0) {
+      return 0;
+    }
+
+    uint32_t rank = (uint32_t)(p * total + 0.5f);
+    if (rank < 1) {
+      rank = 1;
+    }
+    // The top one is known exactly; the midpoint of its bucket can be
+    // well below it
+    if (rank >= total) {
+      return max();
+    }
+    uint32_t seen = 0;
+    for (size_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+      seen += snapshot[i];
+      if (seen >= rank) {
+        uint32_t mid = bucketMid(i);
+        uint32_t max = this->max();
+        return mid < max ? mid : max;
+      }
+    }
+    return max();
+  }
+
+  void reset() {
+    for (size_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+      buckets_[i].store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+  }
+
+private:
+  static size_t bucketFor(uint32_t value) {
+    if (value < HISTOGRAM_SUB_BUCKETS) {
+      return value;
+    }
+    int msb = 31 - __builtin_clz(value);
+    size_t sub = (value >> (msb - 2)) & (HISTOGRAM_SUB_BUCKETS - 1);
+    return (msb - 1) * HISTOGRAM_SUB_BUCKETS + sub;
+  }
+
+  static uint32_t bucketMid(size_t bucket) {
+    if (bucket < HISTOGRAM_SUB_BUCKETS) {
+      return bucket;
+    }
+    int msb = bucket / HISTOGRAM_SUB_BUCKETS + 1;
+    uint32_t sub = bucket % HISTOGRAM_SUB_BUCKETS;
+    uint32_t width = 1u << (msb - 2);
+    return ((HISTOGRAM_SUB_BUCKETS + sub) << (msb - 2)) + width / 2;
+  }
+
+  std::atomic<uint32_t> buckets_[HISTOGRAM_BUCKETS] = {};
+  std::atomic<uint32_t> count_{0};
+  std::atomic<uint32_t> max_{0};
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// LATEST FRAME EXCHANGE
+// ==========================================
+// Lock-free single-producer / multi-consumer "latest frame" slot with
+// reference-counted buffers. The capture task publishes each driver buffer
+// exactly once; any number of HTTP clients can pin the newest one and send
+// it straight from the driver's memory (no copy). A buffer is handed back
+// to the driver (returnFrame) as soon as it is neither the newest frame nor
+// pinned by any reader.
+//
+// Slots must be >= the number of buffers the driver can hand out at once
+// (fb_count), since every outstanding buffer occupies one slot.
+//
+// Plain C++ only, so the same code runs on the ESP32 and on a PC.
+
+template <typename Frame> struct PinnedFrame {
+  Frame *frame = nullptr;
+  uint32_t seq = 0;
+  std::atomic<int> refs{0};     // 0 = retiring or free
+  std::atomic<bool> free{true}; // set once the buffer went back to the driver
+};
+
+template <typename Frame, size_t Slots> class LatestFrame {
+public:
+  typedef void (*ReturnFn)(Frame *frame);
+
+  explicit LatestFrame(ReturnFn returnFrame) : returnFrame_(returnFrame) {}
+
+  // Producer only. Returns false (and hands the frame straight back) if
+  // every slot is still in use.
+  bool publish(Frame *frame) {
+    PinnedFrame<Frame> *slot = claimSlot();
+    if (!slot) {
+      returnFrame_(frame);
+      return false;
+    }
+    uint32_t seq = ++seq_;
+    slot->frame = frame;
+    slot->seq = seq;
+    // The "newest frame" reference; published with release so readers
+    // that pin the slot see frame/seq.
+    slot->refs.store(1, std::memory_order_release);
+
+    PinnedFrame<Frame> *old = latest_.exchange(slot, std::memory_order_acq_rel);
+    latestSeq_.store(seq, std::memory_order_release);
+    if (old) {
+      release(old);
+    }
+    return true;
+  }
+
+  // Reader: pin the newest frame, or nullptr if nothing was published yet.
+  // Must be paired with release().
+  const PinnedFrame<Frame> *acquire() {
+    for (;;) {
+      PinnedFrame<Frame> *slot = latest_.load(std::memory_order_acquire);
+      if (!slot) {
+        return nullptr;
+      }
+      int refs = slot->refs.load(std::memory_order_relaxed);
+      if (refs == 0) {
+        continue; // Being retired; latest_ has already moved on
+      }
+      if (!slot->refs.compare_exchange_weak(refs, refs + 1,
+                                            std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+        continue;
+      }
+      // The slot may have been recycled for a newer frame between the load
+      // and the pin. That is still a complete frame, but only hand it out
+      // if it is the current one so seq never goes backwards.
+      if (slot == latest_.load(std::memory_order_acquire)) {
+        return slot;
+      }
+      release(slot);
+    }
+  }
+
+  void release(const PinnedFrame<Frame> *pinned) {
+    PinnedFrame<Frame> *slot = const_cast<PinnedFrame<Frame> *>(pinned);
+    if (slot->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      Frame *frame = slot->frame;
+      slot->frame = nullptr;
+      returnFrame_(frame);
+      slot->free.store(true, std::memory_order_release);
+    }
+  }
+
+  // Hint only: the answer may already be stale when it returns. Kept
+  // apart from the slots, whose seq the producer rewrites when it recycles
+  // one.
+  uint32_t latestSeq() const { return latestSeq_.load(std::memory_order_acquire); }
+
+private:
+  PinnedFrame<Frame> *claimSlot() {
+    for (size_t i = 0; i < Slots; i++) {
+      bool expected = true;
+      if (slots_[i].free.compare_exchange_strong(expected, false,
+                                                 std::memory_order_acquire)) {
+        return &slots_[i];
+      }
+    }
+    return nullptr;
+  }
+
+  ReturnFn returnFrame_;
+  PinnedFrame<Frame> slots_[Slots];
+  std::atomic<PinnedFrame<Frame> *> latest_{nullptr};
+  std::atomic<uint32_t> latestSeq_{0};
+  uint32_t seq_ = 0; // producer only
+};
@@ -0,0 +1,76 @@
+#include "motion_gate.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Cell means; cells are width / GATE_THUMB_W by height / GATE_THUMB_H
+// pixels, any remainder at the right/bottom edge is ignored.
+void MotionGate::thumbnail(const uint8_t *gray, int width, int height, int stride,
+                           uint8_t *out) const {
+  int cellW = width / GATE_THUMB_W;
+  int cellH = height / GATE_THUMB_H;
+  uint32_t area = cellW * cellH;
+  uint32_t sums[GATE_THUMB_W];
+
+  for (int ty = 0; ty < GATE_THUMB_H; ty++) {
+    memset(sums, 0, sizeof(sums));
+    for (int y = ty * cellH; y < (ty + 1) * cellH; y++) {
+      const uint8_t *row = gray + (size_t)y * stride;
+      for (int tx = 0; tx < GATE_THUMB_W; tx++) {
+        const uint8_t *cell = row + tx * cellW;
+        uint32_t sum = 0;
+        for (int x = 0; x < cellW; x++) {
+          sum += cell[x];
+        }
+        sums[tx] += sum;
+      }
+    }
+    for (int tx = 0; tx < GATE_THUMB_W; tx++) {
+      out[ty * GATE_THUMB_W + tx] = sums[tx] / area;
+    }
+  }
+}
+
+bool MotionGate::update(const uint8_t *gray, int width, int height, int stride,
+                        const TiltResult &tilt) {
+  if (width < GATE_THUMB_W || height < GATE_THUMB_H) {
+    return true;
+  }
+  uint8_t thumb[GATE_THUMB_W * GATE_THUMB_H];
+  thumbnail(gray, width, height, stride, thumb);
+
+  // Region to compare: the eyes plus one eye distance around them
+  int x0 = 0, y0 = 0, x1 = GATE_THUMB_W, y1 = GATE_THUMB_H;
+  if (tilt.found) {
+    int margin = abs(tilt.rightX - tilt.leftX);
+    int left = (tilt.leftX < tilt.rightX ? tilt.leftX : tilt.rightX) - margin;
+    int right = (tilt.leftX > tilt.rightX ? tilt.leftX : tilt.rightX) + margin;
+    int top = (tilt.leftY < tilt.rightY ? tilt.leftY : tilt.rightY) - margin;
+    int bottom = (tilt.leftY > tilt.rightY ? tilt.leftY : tilt.rightY) + margin;
+    x0 = left < 0 ? 0 : left * GATE_THUMB_W / width;
+    y0 = top < 0 ? 0 : top * GATE_THUMB_H / height;
+    x1 = right >= width ? GATE_THUMB_W : right * GATE_THUMB_W / width + 1;
+    y1 = bottom >= height ? GATE_THUMB_H : bottom * GATE_THUMB_H / height + 1;
+  }
+
+  bool changed = !hasRef_;
+  if (hasRef_) {
+    uint32_t sad = 0;
+    for (int y = y0; y < y1; y++) {
+      for (int x = x0; x < x1; x++) {
+        sad += abs(thumb[y * GATE_THUMB_W + x] - ref_[y * GATE_THUMB_W + x]);
+      }
+    }
+    lastDiff_ = sad / ((x1 - x0) * (y1 - y0));
+    changed = lastDiff_ >= threshold_ || tilt.found != refTilt_.found ||
+              (tilt.found && fabsf(tilt.angle - refTilt_.angle) >= angle_);
+  }
+
+  if (changed) {
+    memcpy(ref_, thumb, sizeof(ref_));
+    refTilt_ = tilt;
+    hasRef_ = true;
+  }
+  return changed;
+}
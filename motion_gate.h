@@ -0,0 +1,49 @@
+#pragma once
+
+#include "tilt_estimator.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// MOTION GATE
+// ==========================================
+// Decides whether a frame is worth sending. Each tracked frame is reduced
+// to a GATE_THUMB_W x GATE_THUMB_H luma thumbnail and compared with the
+// thumbnail of the last frame that counted as changed: mean absolute
+// difference over the tracked region (around the eyes when they were
+// found, else the whole frame), plus the tilt itself. Comparing against
+// that reference rather than the previous frame means slow drift still
+// adds up to a change eventually.
+//
+// Plain C++ only, so the same code runs on the ESP32 and on a PC.
+
+#define GATE_THUMB_W 32
+#define GATE_THUMB_H 24
+
+class MotionGate {
+public:
+  // threshold: mean difference in gray levels; angle: degrees of tilt
+  // change that count as a change on their own
+  explicit MotionGate(uint8_t threshold = 6, float angle = 2.0f)
+      : threshold_(threshold), angle_(angle) {}
+
+  // Returns true (and makes this frame the reference) if it differs from
+  // the reference. The first frame always counts as changed.
+  bool update(const uint8_t *gray, int width, int height, int stride,
+              const TiltResult &tilt);
+
+  // Mean difference of the last update(), gray levels
+  uint32_t lastDiff() const { return lastDiff_; }
+
+private:
+  void thumbnail(const uint8_t *gray, int width, int height, int stride,
+                 uint8_t *out) const;
+
+  uint8_t threshold_;
+  float angle_;
+  bool hasRef_ = false;
+  uint8_t ref_[GATE_THUMB_W * GATE_THUMB_H];
+  TiltResult refTilt_;
+  uint32_t lastDiff_ = 0;
+};
@@ -0,0 +1,142 @@
+#include "quality_controller.h"
+
+// Length of one measurement window
+#define QUALITY_WINDOW_MS 1000
+// Client FPS reports older than this are ignored
+#define CLIENT_FPS_STALE_MS 3000
+// A client report covers about the last second of frames it received
+// (reportClientFps() in index.html); one this soon after a frame was held
+// back may have counted it as missing
+#define CLIENT_FPS_SPAN_MS 2000
+// Windows with headroom needed before stepping up
+#define UP_WINDOWS 3
+// Windows to wait after any change before judging the new level
+#define COOLDOWN_WINDOWS 1
+
+QualityController::QualityController(const QualityLevel *levels, size_t count,
+                                     size_t startLevel)
+    : levels_(levels), count_(count),
+      level_(startLevel < count ? startLevel : count - 1) {}
+
+void QualityController::setTarget(float fps, uint32_t latencyBudgetMs) {
+  targetFps_ = fps;
+  latencyBudgetMs_ = latencyBudgetMs;
+  goodWindows_ = 0;
+}
+
+void QualityController::onFrameSent(uint32_t bytes, uint32_t sendMicros) {
+  frames_++;
+  bytes_ += bytes;
+  sendMicros_ += sendMicros;
+}
+
+void QualityController::onClientFps(float fps, uint32_t nowMs) {
+  clientFps_ = fps;
+  clientFpsAt_ = nowMs;
+}
+
+void QualityController::onFrameHeld(uint32_t nowMs) {
+  held_ = true;
+  heldAt_ = nowMs;
+}
+
+bool QualityController::update(uint32_t nowMs) {
+  if (windowStart_ == 0) {
+    windowStart_ = nowMs;
+    return false;
+  }
+  uint32_t elapsed = nowMs - windowStart_;
+  if (elapsed < QUALITY_WINDOW_MS) {
+    return false;
+  }
+
+  uint32_t frames = frames_;
+  stats_.fps = frames * 1000.0f / elapsed;
+  stats_.sendMs = frames ? sendMicros_ / 1000.0f / frames : 0;
+  stats_.kbps = bytes_ * 8.0f / elapsed;
+  stats_.clientFps = 0;
+  stats_.held = held_;
+  bool clientHeld = heldAt_ != 0 && (int32_t)(clientFpsAt_ - heldAt_) < CLIENT_FPS_SPAN_MS;
+  if (clientFpsAt_ != 0 && nowMs - clientFpsAt_ < CLIENT_FPS_STALE_MS && !clientHeld) {
+    stats_.clientFps = clientFps_;
+    if (clientFps_ < stats_.fps) {
+      stats_.fps = clientFps_;
+    }
+  }
+
+  windowStart_ = nowMs;
+  frames_ = 0;
+  bytes_ = 0;
+  sendMicros_ = 0;
+  held_ = false;
+
+  // Nobody is watching: nothing to judge
+  if (frames == 0) {
+    goodWindows_ = 0;
+    return false;
+  }
+  // Few frames because little changed, not because the link is slow
+  if (stats_.held) {
+    return false;
+  }
+  if (cooldown_ > 0) {
+    cooldown_--;
+    return false;
+  }
+
+  bool overloaded = stats_.fps < targetFps_ * 0.8f || stats_.sendMs > latencyBudgetMs_;
+  bool headroom = stats_.fps >= targetFps_ * 0.95f && stats_.sendMs < latencyBudgetMs_ * 0.5f;
+
+  if (overloaded) {
+    goodWindows_ = 0;
+    if (level_ > 0) {
+      change(level_ - 1, nowMs);
+      return true;
+    }
+    return false;
+  }
+
+  if (!headroom) {
+    goodWindows_ = 0;
+    return false;
+  }
+  if (level_ + 1 < count_ && ++goodWindows_ >= UP_WINDOWS) {
+    goodWindows_ = 0;
+    change(level_ + 1, nowMs);
+    return true;
+  }
+  return false;
+}
+
+void QualityController::restartWindow(uint32_t nowMs) {
+  windowStart_ = nowMs;
+  frames_ = 0;
+  bytes_ = 0;
+  sendMicros_ = 0;
+  held_ = false;
+  goodWindows_ = 0;
+}
+
+void QualityController::change(size_t to, uint32_t nowMs) {
+  QualityDecision &d = history_[historyNext_];
+  d.timeMs = nowMs;
+  d.from = level_;
+  d.to = to;
+  d.stats = stats_;
+  historyNext_ = (historyNext_ + 1) % QUALITY_HISTORY;
+  if (historyCount_ < QUALITY_HISTORY) {
+    historyCount_++;
+  }
+
+  level_ = to;
+  cooldown_ = COOLDOWN_WINDOWS;
+}
+
+size_t QualityController::history(QualityDecision *out, size_t max) const {
+  size_t n = historyCount_ < max ? historyCount_ : max;
+  size_t first = (historyNext_ + QUALITY_HISTORY - n) % QUALITY_HISTORY;
+  for (size_t i = 0; i < n; i++) {
+    out[i] = history_[(first + i) % QUALITY_HISTORY];
+  }
+  return n;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// ADAPTIVE QUALITY CONTROLLER
+// ==========================================
+// Steps the camera through a ladder of (frame size, JPEG quality) levels
+// to hold a target frame rate and per-frame send-time budget. Fed with
+// what the stream actually achieved (bytes and send time per frame, plus
+// the frame rate the client reports), it steps down straight away when
+// overloaded and only steps back up after several windows with headroom,
+// so it does not oscillate on a marginal link.
+//
+// Knows nothing about the sensor: levels carry the framesize_t value as a
+// plain int and the caller applies them. Plain C++ only, so the same code
+// runs on the ESP32 and on a PC.
+
+struct QualityLevel {
+  int frameSize; // framesize_t
+  int quality;   // JPEG quality, 0-63, lower is better
+};
+
+// Stats of the last completed window
+struct QualityStats {
+  float fps = 0;       // min(stream fps, client fps when recently reported)
+  float sendMs = 0;    // mean time to push one frame to the slowest client
+  float kbps = 0;      // stream payload rate
+  float clientFps = 0; // last value reported by the page, 0 if stale
+  bool held = false;   // frames were held back: not judged
+};
+
+struct QualityDecision {
+  uint32_t timeMs;
+  uint8_t from;
+  uint8_t to;
+  QualityStats stats;
+};
+
+#define QUALITY_HISTORY 16
+
+class QualityController {
+public:
+  // levels[0] is the cheapest; the list must outlive the controller
+  QualityController(const QualityLevel *levels, size_t count, size_t startLevel);
+
+  void setTarget(float fps, uint32_t latencyBudgetMs);
+  float targetFps() const { return targetFps_; }
+  uint32_t latencyBudgetMs() const { return latencyBudgetMs_; }
+
+  void onFrameSent(uint32_t bytes, uint32_t sendMicros);
+  void onClientFps(float fps, uint32_t nowMs);
+
+  // A new frame was held back on purpose (the motion gate saw no change).
+  // The window it falls in then says nothing about the link, and neither
+  // does a client report that counted it as missing, so neither is judged.
+  void onFrameHeld(uint32_t nowMs);
+
+  // Call regularly. Closes a window every QUALITY_WINDOW_MS and returns
+  // true when the level changed and must be applied to the sensor.
+  bool update(uint32_t nowMs);
+
+  // Drops the current window without judging it, e.g. after the stream
+  // was paused or the sensor was set up by hand: a window that is partly
+  // pause would look like an overload.
+  void restartWindow(uint32_t nowMs);
+
+  size_t level() const { return level_; }
+  size_t levelCount() const { return count_; }
+  const QualityLevel &current() const { return levels_[level_]; }
+  const QualityStats &stats() const { return stats_; }
+
+  // Most recent decisions, oldest first. Returns how many were copied.
+  size_t history(QualityDecision *out, size_t max) const;
+
+private:
+  void change(size_t to, uint32_t nowMs);
+
+  const QualityLevel *levels_;
+  size_t count_;
+  size_t level_;
+
+  float targetFps_ = 15;
+  uint32_t latencyBudgetMs_ = 60;
+
+  // Current window
+  uint32_t windowStart_ = 0;
+  uint32_t frames_ = 0;
+  uint64_t bytes_ = 0;
+  uint64_t sendMicros_ = 0;
+
+  float clientFps_ = 0;
+  uint32_t clientFpsAt_ = 0;
+
+  bool held_ = false;   // in the current window
+  uint32_t heldAt_ = 0; // last onFrameHeld()
+
+  QualityStats stats_;
+  uint8_t goodWindows_ = 0;
+  uint8_t cooldown_ = 0;
+
+  QualityDecision history_[QUALITY_HISTORY];
+  size_t historyCount_ = 0;
+  size_t historyNext_ = 0;
+};
@@ -0,0 +1,213 @@
+#include "session_log.h"
+
+#include <string.h>
+
+static const uint8_t SESSION_MAGIC[4] = {'H', 'T', 'R', 'S'};
+
+static void put16(uint8_t *p, uint16_t v) {
+  p[0] = v & 0xff;
+  p[1] = v >> 8;
+}
+
+static void put32(uint8_t *p, uint32_t v) {
+  p[0] = v & 0xff;
+  p[1] = (v >> 8) & 0xff;
+  p[2] = (v >> 16) & 0xff;
+  p[3] = v >> 24;
+}
+
+static void putFloat(uint8_t *p, float v) {
+  uint32_t bits;
+  memcpy(&bits, &v, 4);
+  put32(p, bits);
+}
+
+static uint16_t get16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+static uint32_t get32(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+static float getFloat(const uint8_t *p) {
+  uint32_t bits = get32(p);
+  float v;
+  memcpy(&v, &bits, 4);
+  return v;
+}
+
+static size_t padded(size_t n) { return (n + 3) & ~(size_t)3; }
+
+void SessionWriter::reset(uint8_t *buf, size_t capacity) {
+  buf_ = buf;
+  capacity_ = capacity;
+  size_ = 0;
+  full_ = capacity < SESSION_FILE_HEADER_SIZE;
+  if (full_) {
+    return;
+  }
+  memcpy(buf_, SESSION_MAGIC, 4);
+  put16(buf_ + 4, SESSION_VERSION);
+  put16(buf_ + 6, 0);
+  size_ = SESSION_FILE_HEADER_SIZE;
+}
+
+uint8_t *SessionWriter::begin(uint8_t type, uint32_t timeMs, const uint8_t *head,
+                              size_t headLen, size_t tailLen) {
+  size_t length = headLen + tailLen;
+  size_t total = SESSION_RECORD_HEADER_SIZE + padded(length);
+  if (!buf_ || full_ || total > capacity_ - size_) {
+    full_ = true;
+    return nullptr;
+  }
+  uint8_t *p = buf_ + size_;
+  p[0] = type;
+  p[1] = p[2] = p[3] = 0;
+  put32(p + 4, (uint32_t)length);
+  put32(p + 8, timeMs);
+  memcpy(p + SESSION_RECORD_HEADER_SIZE, head, headLen);
+  memset(p + SESSION_RECORD_HEADER_SIZE + length, 0, padded(length) - length);
+  size_ += total;
+  return p + SESSION_RECORD_HEADER_SIZE + headLen;
+}
+
+bool SessionWriter::config(uint32_t timeMs, const SessionConfig &c) {
+  uint8_t head[4] = {c.source, c.threshold, (uint8_t)(c.invert ? SESSION_FLAG_INVERT : 0),
+                     c.leadMs};
+  uint8_t *tail = begin(SESSION_CONFIG, timeMs, head, sizeof(head), c.textLength);
+  if (!tail) {
+    return false;
+  }
+  memcpy(tail, c.text, c.textLength);
+  return true;
+}
+
+bool SessionWriter::frame(uint32_t timeMs, const SessionFrame &f) {
+  uint8_t head[12] = {};
+  put32(head, f.seq);
+  put16(head + 4, f.width);
+  put16(head + 6, f.height);
+  head[8] = f.format;
+  uint8_t *tail = begin(SESSION_FRAME, timeMs, head, sizeof(head), f.length);
+  if (!tail) {
+    return false;
+  }
+  memcpy(tail, f.data, f.length);
+  return true;
+}
+
+bool SessionWriter::tilt(uint32_t timeMs, const SessionTilt &t) {
+  uint8_t head[16] = {};
+  put32(head, t.seq);
+  putFloat(head + 4, t.angle);
+  putFloat(head + 8, t.confidence);
+  head[12] = t.found ? SESSION_FLAG_FOUND : 0;
+  head[13] = t.lane;
+  head[14] = t.player;
+  return begin(SESSION_TILT, timeMs, head, sizeof(head), 0) != nullptr;
+}
+
+bool SessionWriter::gameStart(uint32_t timeMs, const SessionGameStart &start) {
+  uint8_t head[8] = {};
+  put32(head, start.seed);
+  head[4] = start.players;
+  return begin(SESSION_GAME_START, timeMs, head, sizeof(head), 0) != nullptr;
+}
+
+bool SessionWriter::gameInput(uint32_t timeMs, const SessionGameInput &in) {
+  uint8_t head[8] = {};
+  put32(head, in.tick);
+  head[4] = in.lane;
+  head[5] = in.speed;
+  head[6] = in.player;
+  return begin(SESSION_GAME_INPUT, timeMs, head, sizeof(head), 0) != nullptr;
+}
+
+bool SessionWriter::gameEnd(uint32_t timeMs, const SessionGameEnd &end) {
+  uint8_t head[16] = {};
+  put32(head, end.tick);
+  put32(head + 4, end.score);
+  put32(head + 8, end.hash);
+  head[12] = end.crashed ? 1 : 0;
+  return begin(SESSION_GAME_END, timeMs, head, sizeof(head), 0) != nullptr;
+}
+
+SessionReader::SessionReader(const uint8_t *data, size_t size)
+    : data_(data), size_(size),
+      valid_(size >= SESSION_FILE_HEADER_SIZE && !memcmp(data, SESSION_MAGIC, 4) &&
+             get16(data + 4) == SESSION_VERSION) {}
+
+bool SessionReader::next(SessionRecord *out) {
+  if (!valid_ || size_ - pos_ < SESSION_RECORD_HEADER_SIZE) {
+    return false;
+  }
+  const uint8_t *p = data_ + pos_;
+  uint32_t length = get32(p + 4);
+  if (length > size_ - pos_ - SESSION_RECORD_HEADER_SIZE) {
+    return false;
+  }
+  out->type = p[0];
+  out->timeMs = get32(p + 8);
+  out->payload = p + SESSION_RECORD_HEADER_SIZE;
+  out->length = length;
+  // The last record's padding may be missing from a cut-short file
+  pos_ += SESSION_RECORD_HEADER_SIZE + padded(length);
+  if (pos_ > size_) {
+    pos_ = size_;
+  }
+  return true;
+}
+
+bool decodeSessionConfig(const SessionRecord &r, SessionConfig *c) {
+  if (r.type != SESSION_CONFIG || r.length < 4) {
+    return false;
+  }
+  const uint8_t *p = r.payload;
+  *c = {p[0], p[1], (p[2] & SESSION_FLAG_INVERT) != 0, p[3], (const char *)p + 4, r.length - 4};
+  return true;
+}
+
+bool decodeSessionFrame(const SessionRecord &r, SessionFrame *f) {
+  if (r.type != SESSION_FRAME || r.length < 12) {
+    return false;
+  }
+  const uint8_t *p = r.payload;
+  *f = {get32(p), get16(p + 4), get16(p + 6), p[8], p + 12, r.length - 12};
+  return true;
+}
+
+bool decodeSessionTilt(const SessionRecord &r, SessionTilt *t) {
+  if (r.type != SESSION_TILT || r.length < 16) {
+    return false;
+  }
+  const uint8_t *p = r.payload;
+  *t = {get32(p), getFloat(p + 4), getFloat(p + 8), (p[12] & SESSION_FLAG_FOUND) != 0, p[13],
+        p[14]};
+  return true;
+}
+
+bool decodeSessionGameStart(const SessionRecord &r, SessionGameStart *start) {
+  if (r.type != SESSION_GAME_START || r.length < 4) {
+    return false;
+  }
+  start->seed = get32(r.payload);
+  start->players = r.length >= 5 && r.payload[4] ? r.payload[4] : 1;
+  return true;
+}
+
+bool decodeSessionGameInput(const SessionRecord &r, SessionGameInput *in) {
+  if (r.type != SESSION_GAME_INPUT || r.length < 8) {
+    return false;
+  }
+  *in = {get32(r.payload), r.payload[4], r.payload[5], r.payload[6]};
+  return true;
+}
+
+bool decodeSessionGameEnd(const SessionRecord &r, SessionGameEnd *end) {
+  if (r.type != SESSION_GAME_END || r.length < 16) {
+    return false;
+  }
+  const uint8_t *p = r.payload;
+  *end = {get32(p), get32(p + 4), get32(p + 8), p[12] != 0};
+  return true;
+}
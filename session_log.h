@@ -0,0 +1,194 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// SESSION RECORDING
+// ==========================================
+// An append-only log of one run, so a bad run can be played back: camera
+// frames, the tilt measured on each, the lane chosen, and the game's seed,
+// inputs and result. The ESP32 records into PSRAM (/record, then download
+// /session); the page records into a download of the same format. Both
+// can be replayed by tools/session_replay.cpp.
+//
+// All multi-byte fields are little-endian. A session starts with a file
+// header, followed by records. Every record starts on a 4-byte boundary,
+// so a reader can use the bytes in place, e.g. from a memory-mapped file.
+//
+// File header (8 bytes):
+//   0  char[4] "HTRS"
+//   4  uint16  SESSION_VERSION
+//   6  uint16  reserved, 0
+//
+// Record header (12 bytes), then `length` payload bytes, then zero padding
+// up to a multiple of 4:
+//   0  uint8   type (SESSION_*)
+//   1  uint8[3] reserved, 0
+//   4  uint32  length, payload bytes
+//   8  uint32  time, ms (recorder's clock; for frames and tilt, capture time)
+//
+// SESSION_CONFIG (4 bytes, then the firmware build or page URL as text):
+//   0  uint8   source (SESSION_SOURCE_*)
+//   1  uint8   lane threshold, degrees
+//   2  uint8   flags (SESSION_FLAG_INVERT)
+//   3  uint8   lead, ms the filter extrapolates when choosing the lane
+//
+// SESSION_FRAME (12 bytes, then the image):
+//   0  uint32  frame sequence number
+//   4  uint16  width, height
+//   8  uint8   format (SESSION_FORMAT_*)
+//   9  uint8[3] reserved, 0
+//
+// SESSION_TILT (16 bytes):
+//   0  uint32  frame sequence number the angle was measured on
+//   4  float   angle, degrees, as measured (before inversion or filtering)
+//   8  float   confidence, 0..1
+//  12  uint8   flags (SESSION_FLAG_FOUND)
+//  13  uint8   lane the recorder was in after this measurement
+//  14  uint8   player (party mode), 0 otherwise
+//  15  uint8   reserved, 0
+//
+// SESSION_GAME_START (8 bytes):  0 uint32 seed, 4 uint8 players (1-4;
+//                                files from before party mode have only
+//                                the seed, and 1 player)
+// SESSION_GAME_INPUT (8 bytes):  0 uint32 tick, 4 uint8 lane, 5 uint8 speed,
+//                                6 uint8 player
+// SESSION_GAME_END (16 bytes):   0 uint32 tick, 4 uint32 score (player 0),
+//                                8 uint32 state hash, 12 uint8 crashed (all)
+//
+// Readers skip record types they do not know. Plain C++ only, so the same
+// code runs on the ESP32 and on a PC.
+
+#define SESSION_VERSION 1
+#define SESSION_FILE_HEADER_SIZE 8
+#define SESSION_RECORD_HEADER_SIZE 12
+
+#define SESSION_CONFIG 1
+#define SESSION_FRAME 2
+#define SESSION_TILT 3
+#define SESSION_GAME_START 4
+#define SESSION_GAME_INPUT 5
+#define SESSION_GAME_END 6
+
+#define SESSION_SOURCE_DEVICE 0
+#define SESSION_SOURCE_PAGE 1
+
+#define SESSION_FORMAT_JPEG 0
+#define SESSION_FORMAT_GRAY 1
+
+#define SESSION_FLAG_INVERT 0x01
+#define SESSION_FLAG_FOUND 0x01
+
+struct SessionConfig {
+  uint8_t source;
+  uint8_t threshold;
+  bool invert;
+  uint8_t leadMs;
+  const char *text; // not NUL-terminated when read; see textLength
+  size_t textLength;
+};
+
+struct SessionFrame {
+  uint32_t seq;
+  uint16_t width, height;
+  uint8_t format;
+  const uint8_t *data;
+  size_t length;
+};
+
+struct SessionTilt {
+  uint32_t seq;
+  float angle;
+  float confidence;
+  bool found;
+  uint8_t lane;
+  uint8_t player;
+};
+
+struct SessionGameStart {
+  uint32_t seed;
+  uint8_t players;
+};
+
+struct SessionGameInput {
+  uint32_t tick;
+  uint8_t lane;
+  uint8_t speed;
+  uint8_t player;
+};
+
+struct SessionGameEnd {
+  uint32_t tick;
+  uint32_t score;
+  uint32_t hash;
+  bool crashed;
+};
+
+// Appends records to a caller-owned buffer. When a record does not fit,
+// nothing of it is written and full() becomes true; what is already there
+// stays a valid session.
+class SessionWriter {
+public:
+  SessionWriter() {}
+  SessionWriter(uint8_t *buf, size_t capacity) { reset(buf, capacity); }
+
+  // Starts a new session in buf (writes the file header)
+  void reset(uint8_t *buf, size_t capacity);
+
+  bool config(uint32_t timeMs, const SessionConfig &c);
+  bool frame(uint32_t timeMs, const SessionFrame &f);
+  bool tilt(uint32_t timeMs, const SessionTilt &t);
+  bool gameStart(uint32_t timeMs, const SessionGameStart &start);
+  bool gameInput(uint32_t timeMs, const SessionGameInput &in);
+  bool gameEnd(uint32_t timeMs, const SessionGameEnd &end);
+
+  const uint8_t *data() const { return buf_; }
+  size_t size() const { return size_; }
+  bool full() const { return full_; }
+
+private:
+  // Writes the record header and `head` payload bytes, leaving room for
+  // `tail` more; returns where the tail goes, or NULL if it does not fit
+  uint8_t *begin(uint8_t type, uint32_t timeMs, const uint8_t *head, size_t headLen,
+                 size_t tailLen);
+
+  uint8_t *buf_ = nullptr;
+  size_t capacity_ = 0;
+  size_t size_ = 0;
+  bool full_ = false;
+};
+
+struct SessionRecord {
+  uint8_t type;
+  uint32_t timeMs;
+  const uint8_t *payload;
+  size_t length;
+};
+
+// Walks the records of a session in memory. Stops (next() returns false)
+// at the end or at the first record that does not fit, e.g. the truncated
+// tail of a download that was cut short.
+class SessionReader {
+public:
+  SessionReader(const uint8_t *data, size_t size);
+
+  bool valid() const { return valid_; }
+  bool next(SessionRecord *out);
+  // Bytes after the last record next() returned: 0 once a whole file is read
+  size_t unread() const { return size_ - pos_; }
+
+private:
+  const uint8_t *data_;
+  size_t size_;
+  size_t pos_ = SESSION_FILE_HEADER_SIZE;
+  bool valid_;
+};
+
+// Payload decoders; each returns false if the payload is too short
+bool decodeSessionConfig(const SessionRecord &r, SessionConfig *c);
+bool decodeSessionFrame(const SessionRecord &r, SessionFrame *f);
+bool decodeSessionTilt(const SessionRecord &r, SessionTilt *t);
+bool decodeSessionGameStart(const SessionRecord &r, SessionGameStart *start);
+bool decodeSessionGameInput(const SessionRecord &r, SessionGameInput *in);
+bool decodeSessionGameEnd(const SessionRecord &r, SessionGameEnd *end);
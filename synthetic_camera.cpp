@@ -0,0 +1,72 @@
+#include "synthetic_camera.h"
+
+#include <math.h>
+#include <string.h>
+
+float syntheticAngle(uint32_t frame) {
+  uint32_t quarter = SYNTHETIC_SWEEP_FRAMES / 4;
+  uint32_t phase = frame % SYNTHETIC_SWEEP_FRAMES;
+  float t;
+  if (phase < quarter) {
+    t = (float)phase / quarter; // 0 -> 1
+  } else if (phase < 3 * quarter) {
+    t = 1.0f - 2.0f * (phase - quarter) / (2 * quarter); // 1 -> -1
+  } else {
+    t = -1.0f + (float)(phase - 3 * quarter) / quarter; // -1 -> 0
+  }
+  return t * SYNTHETIC_MAX_ANGLE;
+}
+
+void renderSyntheticFace(uint8_t *gray, int width, int height, float angleDeg) {
+  // Proportions of a face filling most of the frame at arm's length
+  float cx = width * 0.5f;
+  float cy = height * 0.5f;
+  float faceRx = width * 0.25f;
+  float faceRy = height * 0.42f;
+  float eyeHalf = width * 0.11f;
+  float eyeR = width * 0.022f;
+  if (eyeR < 1.5f) {
+    eyeR = 1.5f;
+  }
+
+  // Eyes sit above the centre and roll about it
+  float a = angleDeg * (float)M_PI / 180.0f;
+  float ca = cosf(a);
+  float sa = sinf(a);
+  float eyeCy = cy - height * 0.08f;
+  float ex[2] = {cx - eyeHalf * ca, cx + eyeHalf * ca};
+  float ey[2] = {eyeCy - eyeHalf * sa, eyeCy + eyeHalf * sa};
+
+  // Mouth: a dark bar below the eyes, rolled with them
+  float mouthOff = height * 0.28f;
+  float mx = cx - mouthOff * sa;
+  float my = eyeCy + mouthOff * ca;
+  float mouthHalfW = width * 0.075f;
+  float mouthHalfH = height * 0.017f + 0.5f;
+
+  for (int y = 0; y < height; y++) {
+    uint8_t *row = gray + (size_t)y * width;
+    for (int x = 0; x < width; x++) {
+      float dx = (x - cx) / faceRx;
+      float dy = (y - cy) / faceRy;
+      // Fixed texture so the frame is not trivially compressible
+      uint8_t v = (dx * dx + dy * dy < 1.0f ? 200 : 170) + (x * 7 + y * 13) % 9;
+
+      for (int e = 0; e < 2; e++) {
+        float ddx = x - ex[e];
+        float ddy = y - ey[e];
+        if (ddx * ddx + ddy * ddy < eyeR * eyeR) {
+          v = 60;
+        }
+      }
+
+      // Mouth in its own rotated frame
+      float ux = (x - mx) * ca + (y - my) * sa;
+      float uy = -(x - mx) * sa + (y - my) * ca;
+      if (fabsf(ux) < mouthHalfW && fabsf(uy) < mouthHalfH) {
+        v = 90;
+      }
+      row[x] = v;
+    }
+  }
+}
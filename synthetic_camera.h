@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// SYNTHETIC CAMERA
+// ==========================================
+// Deterministic stand-in for the sensor: renders a grayscale "face" (oval,
+// two dark eyes, mouth) rolled by a known angle. The sketch's
+// CAMERA_SYNTHETIC bench mode feeds these frames through the normal
+// capture -> stream/track path, so throughput and tracking accuracy can be
+// measured with identical input on every run, with or without a sensor.
+//
+// Plain C++ only, so the same code runs on the ESP32 and on a PC.
+
+#define SYNTHETIC_SWEEP_FRAMES 120 // one full left-right-left sweep
+#define SYNTHETIC_MAX_ANGLE 25.0f  // degrees
+
+// Roll of frame n: triangle wave over +/-SYNTHETIC_MAX_ANGLE, starting level
+float syntheticAngle(uint32_t frame);
+
+// Renders a width x height 8-bit frame (stride = width). Same convention
+// as TiltResult: positive = the right-hand eye is lower in the image.
+void renderSyntheticFace(uint8_t *gray, int width, int height, float angleDeg);
@@ -0,0 +1,131 @@
+#include "tilt_estimator.h"
+#include "tilt_kernels.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Strongest dark blobs kept for pairing
+#define MAX_BLOBS 8
+// Weakest blob worth considering: 6 gray levels darker than its surround
+#define MIN_CONTRAST (6 * 16)
+// Blob contrast that counts as full confidence
+#define FULL_CONTRAST (40 * 16)
+
+// Non-maximum suppression: keep only the strongest blob per eye-sized
+// neighbourhood, and at most MAX_BLOBS overall.
+void TiltEstimator::addBlob(int x, int y, int32_t contrast, int r) {
+  for (Blob &b : blobs_) {
+    if (abs(b.x - x) <= 2 * r && abs(b.y - y) <= 2 * r) {
+      if (contrast > b.contrast) {
+        b.x = x;
+        b.y = y;
+        b.contrast = contrast;
+      }
+      return;
+    }
+  }
+  if (blobs_.size() < MAX_BLOBS) {
+    blobs_.push_back({(int16_t)x, (int16_t)y, contrast});
+    return;
+  }
+  size_t weakest = 0;
+  for (size_t i = 1; i < blobs_.size(); i++) {
+    if (blobs_[i].contrast < blobs_[weakest].contrast) {
+      weakest = i;
+    }
+  }
+  if (contrast > blobs_[weakest].contrast) {
+    blobs_[weakest] = {(int16_t)x, (int16_t)y, contrast};
+  }
+}
+
+TiltResult TiltEstimator::estimate(const uint8_t *gray, int width, int height,
+                                   int stride) {
+  TiltResult result;
+
+  // Eye radius and surround radius scale with the frame
+  int r = width / 40;
+  if (r < 2) {
+    r = 2;
+  }
+  int outer = 3 * r;
+  if (width <= 2 * outer || height <= 2 * outer) {
+    return result;
+  }
+
+  // Blur away sensor noise, then build the summed-area table the blob
+  // search reads its box means from.
+  blurred_.resize((size_t)width * height);
+  integral_.resize((size_t)(width + 1) * (height + 1));
+  contrast_.resize(width);
+  boxBlur3(gray, width, height, stride, blurred_.data());
+  integralImage(blurred_.data(), width, height, width, integral_.data());
+
+  // Scan for dark-centre/bright-surround blobs. Eyes sit in the upper
+  // part of a face, so the bottom quarter of the frame is skipped.
+  int yEnd = height * 3 / 4;
+  if (yEnd > height - outer - 1) {
+    yEnd = height - outer - 1;
+  }
+  int x0 = outer;
+  int x1 = width - outer;
+
+  blobs_.clear();
+  for (int y = outer; y < yEnd; y++) {
+    blobContrastRow(integral_.data(), width + 1, y, r, outer, x0, x1, contrast_.data());
+    for (int x = x0; x < x1; x++) {
+      int32_t contrast = contrast_[x - x0];
+      if (contrast >= MIN_CONTRAST) {
+        addBlob(x, y, contrast, r);
+      }
+    }
+  }
+
+  // Pick the strongest, most balanced pair with a plausible eye spacing
+  // and less than 45 degrees of roll.
+  int minSpacing = width / 10;
+  int maxSpacing = width / 2;
+  int32_t bestScore = 0;
+  const Blob *bestLeft = nullptr;
+  const Blob *bestRight = nullptr;
+  for (size_t i = 0; i < blobs_.size(); i++) {
+    for (size_t j = i + 1; j < blobs_.size(); j++) {
+      const Blob *a = &blobs_[i];
+      const Blob *b = &blobs_[j];
+      if (a->x > b->x) {
+        const Blob *t = a;
+        a = b;
+        b = t;
+      }
+      int dx = b->x - a->x;
+      int dy = b->y - a->y;
+      if (dx < minSpacing || dx > maxSpacing || abs(dy) > dx) {
+        continue;
+      }
+      int32_t weaker = a->contrast < b->contrast ? a->contrast : b->contrast;
+      int32_t score = 2 * weaker - abs(dy) * 16 / r;
+      if (score > bestScore) {
+        bestScore = score;
+        bestLeft = a;
+        bestRight = b;
+      }
+    }
+  }
+
+  if (!bestLeft) {
+    return result;
+  }
+
+  result.found = true;
+  result.leftX = bestLeft->x;
+  result.leftY = bestLeft->y;
+  result.rightX = bestRight->x;
+  result.rightY = bestRight->y;
+  result.angle = atan2f((float)(bestRight->y - bestLeft->y),
+                        (float)(bestRight->x - bestLeft->x)) *
+                 (180.0f / (float)M_PI);
+  float confidence = (float)bestScore / (2 * FULL_CONTRAST);
+  result.confidence = confidence > 1 ? 1 : confidence;
+  return result;
+}
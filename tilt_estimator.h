@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// ==========================================
+// ON-DEVICE TILT ESTIMATOR
+// ==========================================
+// Finds the two eyes as a pair of dark blobs in a small grayscale frame
+// (e.g. 160x120, a 1/4-scale decode of the VGA JPEG) and reports the head
+// roll angle with the same convention as processHeadTilt() in the page:
+// atan2(right.y - left.y, right.x - left.x), where "left" is the eye on the
+// left of the image. Positive = tilted towards image-right.
+//
+// The per-pixel work is done by the fixed-point kernels in tilt_kernels.h.
+// Plain C++ only, so the same code runs on the ESP32 and on a PC.
+
+struct TiltResult {
+  bool found = false;
+  float angle = 0;      // degrees
+  float confidence = 0; // 0..1
+  int16_t leftX = 0, leftY = 0, rightX = 0, rightY = 0; // input pixels
+};
+
+class TiltEstimator {
+public:
+  // gray: width*height bytes, rows `stride` bytes apart.
+  TiltResult estimate(const uint8_t *gray, int width, int height, int stride);
+
+private:
+  struct Blob {
+    int16_t x, y;
+    int32_t contrast; // surround mean - centre mean, in gray levels * 16
+  };
+
+  void addBlob(int x, int y, int32_t contrast, int r);
+
+  // Scratch buffers, sized on first use and reused afterwards
+  std::vector<uint8_t> blurred_;
+  std::vector<uint32_t> integral_;
+  std::vector<int32_t> contrast_;
+  std::vector<Blob> blobs_;
+};
@@ -0,0 +1,88 @@
+#include "tilt_filter.h"
+
+#include <math.h>
+
+// Weight of a new sample for a first-order low-pass at cutoffHz
+static float smoothingAlpha(float cutoffHz, float dt) {
+  float tau = 1.0f / (2.0f * (float)M_PI * cutoffHz);
+  return 1.0f / (1.0f + tau / dt);
+}
+
+TiltFilter::TiltFilter(const TiltFilterConfig &config) : config_(config) {}
+
+void TiltFilter::reset() {
+  valid_ = false;
+  angle_ = 0;
+  velocity_ = 0;
+  jitter_ = 0;
+  lastMs_ = 0;
+}
+
+void TiltFilter::update(float angle, uint32_t timeMs) {
+  // First sample, or the face was gone long enough that the old motion
+  // says nothing about the new one
+  if (!valid_ || timeMs - lastMs_ > config_.holdMs) {
+    valid_ = true;
+    angle_ = angle;
+    velocity_ = 0;
+    jitter_ = 0;
+    lastMs_ = timeMs;
+    return;
+  }
+
+  float dt = (int32_t)(timeMs - lastMs_) / 1000.0f;
+  if (dt <= 0) {
+    dt = 0.001f;
+  }
+
+  float error = angle - (angle_ + velocity_ * dt);
+  jitter_ += (error * error - jitter_) * 0.2f;
+
+  float rawVelocity = (angle - angle_) / dt;
+  velocity_ += smoothingAlpha(config_.derivCutoff, dt) * (rawVelocity - velocity_);
+  float cutoff = config_.minCutoff + config_.beta * fabsf(velocity_);
+  angle_ += smoothingAlpha(cutoff, dt) * (angle - angle_);
+  lastMs_ = timeMs;
+}
+
+float TiltFilter::predict(uint32_t timeMs) const {
+  if (!valid_) {
+    return 0;
+  }
+  int32_t lead = (int32_t)(timeMs - lastMs_);
+  if (lead < 0) {
+    lead = 0;
+  } else if ((uint32_t)lead > config_.maxLeadMs) {
+    lead = config_.maxLeadMs;
+  }
+  float speed = fabsf(velocity_) - config_.noiseSpeed;
+  if (speed <= 0) {
+    return angle_;
+  }
+  return angle_ + (velocity_ < 0 ? -speed : speed) * lead / 1000.0f;
+}
+
+float TiltFilter::confidence(uint32_t timeMs) const {
+  if (!valid_) {
+    return 0;
+  }
+  int32_t age = (int32_t)(timeMs - lastMs_);
+  float fresh = 1.0f - (float)(age > 0 ? age : 0) / config_.holdMs;
+  float agree = 1.0f - sqrtf(jitter_) / config_.jitterScale;
+  if (fresh <= 0 || agree <= 0) {
+    return 0;
+  }
+  return fresh * agree;
+}
+
+uint8_t TiltLaneLatch::update(float angle, float threshold) {
+  float leave = threshold > hysteresis_ ? threshold - hysteresis_ : 0;
+  if (angle > threshold) {
+    lane_ = 2;
+  } else if (angle < -threshold) {
+    lane_ = 0;
+  } else if ((lane_ == 2 && angle < leave) || (lane_ == 0 && angle > -leave)) {
+    lane_ = 1;
+  }
+  return lane_;
+}
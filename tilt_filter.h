@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stdint.h>
+
+// ==========================================
+// TILT FILTER
+// ==========================================
+// Smooths the raw tilt angle with a One-Euro filter: heavy smoothing while
+// the head is still (no jitter at the lane boundary), light smoothing while
+// it moves (little lag). The filtered velocity is used to extrapolate the
+// angle to when it will actually be shown, which hides part of the capture
+// and inference delay. TiltLaneLatch then picks the lane with hysteresis.
+//
+// Times are milliseconds from any monotonic clock, stamped when the frame
+// was captured. The page has a JavaScript copy of this (TiltFilter in
+// index.html); keep the two in step. Plain C++ only, so the same code runs
+// on the ESP32 and on a PC.
+
+// The defaults are tuned with tools/tilt_replay.cpp to change lane no later
+// than the raw angle would (mean and p90) with fewer false switches: any
+// more smoothing of a still head costs latency on slow moves.
+struct TiltFilterConfig {
+  float minCutoff = 4.0f;   // Hz, cutoff while still
+  float beta = 0.5f;        // cutoff increase per degree/second of motion
+  float derivCutoff = 1.5f; // Hz, smoothing of the velocity estimate
+  uint32_t maxLeadMs = 80;  // never extrapolate further than this
+  float noiseSpeed = 10.0f; // degrees/second of apparent motion that is just jitter
+  uint32_t holdMs = 500;    // without measurements, confidence fades over this
+  float jitterScale = 6.0f; // degrees of measurement noise that mean "no trust"
+};
+
+class TiltFilter {
+public:
+  TiltFilter() {}
+  explicit TiltFilter(const TiltFilterConfig &config);
+
+  void reset();
+
+  // One measured angle (degrees) from a frame captured at timeMs
+  void update(float angle, uint32_t timeMs);
+
+  bool valid() const { return valid_; }
+  float angle() const { return angle_; }       // filtered, at lastMs()
+  float velocity() const { return velocity_; } // degrees/second
+  uint32_t lastMs() const { return lastMs_; }
+
+  // Filtered angle extrapolated to timeMs, e.g. when the next game frame
+  // is shown. The lead is capped at maxLeadMs, and only speed beyond
+  // noiseSpeed is extrapolated, so a still head does not wobble.
+  float predict(uint32_t timeMs) const;
+
+  // 0..1: how well recent measurements agree with the filter, faded by how
+  // old the last one is at timeMs
+  float confidence(uint32_t timeMs) const;
+
+private:
+  TiltFilterConfig config_;
+  bool valid_ = false;
+  float angle_ = 0;
+  float velocity_ = 0;
+  float jitter_ = 0; // smoothed squared prediction error
+  uint32_t lastMs_ = 0;
+};
+
+// Lane choice with hysteresis: a side lane is entered beyond +/-threshold
+// (same as the old rule, so no added delay) but only left again once the
+// angle is back inside threshold - hysteresis.
+class TiltLaneLatch {
+public:
+  explicit TiltLaneLatch(float hysteresis = 0.3f) : hysteresis_(hysteresis) {}
+
+  uint8_t update(float angle, float threshold);
+  uint8_t lane() const { return lane_; }
+  float hysteresis() const { return hysteresis_; }
+  void reset() { lane_ = 1; }
+
+private:
+  float hysteresis_;
+  uint8_t lane_ = 1; // 0 left, 1 centre, 2 right
+};
@@ -0,0 +1,109 @@
+#include "tilt_kernels.h"
+
+#include <string.h>
+
+#if TILT_KERNELS_VECTOR
+typedef uint32_t v4u32 __attribute__((vector_size(16)));
+
+// Unaligned load; memcpy compiles to a single move
+static inline v4u32 load4u32(const uint32_t *p) {
+  v4u32 v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+#endif
+
+// x / 9 for x <= 9 * 255, rounded: (x * 7282 + 32768) >> 16
+#define DIV9_MUL 7282u
+
+void downscale2x(const uint8_t *src, int width, int height, int srcStride,
+                 uint8_t *dst, int dstStride) {
+  int outW = width / 2;
+  int outH = height / 2;
+  for (int y = 0; y < outH; y++) {
+    const uint8_t *a = src + (size_t)(2 * y) * srcStride;
+    const uint8_t *b = a + srcStride;
+    uint8_t *out = dst + (size_t)y * dstStride;
+    for (int x = 0; x < outW; x++) {
+      out[x] = (a[2 * x] + a[2 * x + 1] + b[2 * x] + b[2 * x + 1] + 2) >> 2;
+    }
+  }
+}
+
+void boxBlur3(const uint8_t *src, int width, int height, int srcStride,
+              uint8_t *dst) {
+  memcpy(dst, src, width);
+  if (height > 1) {
+    memcpy(dst + (size_t)(height - 1) * width, src + (size_t)(height - 1) * srcStride, width);
+  }
+
+  for (int y = 1; y < height - 1; y++) {
+    const uint8_t *up = src + (size_t)(y - 1) * srcStride;
+    const uint8_t *mid = up + srcStride;
+    const uint8_t *down = mid + srcStride;
+    uint8_t *out = dst + (size_t)y * width;
+    out[0] = mid[0];
+    out[width - 1] = mid[width - 1];
+
+    // No vector path: widening to four 32-bit lanes (SSE2 has no 32-bit
+    // lane multiply) ran at half the speed of this loop, which the
+    // compiler vectorizes itself (tools/kernel_check.cpp)
+    for (int x = 1; x < width - 1; x++) {
+      uint32_t sum = up[x - 1] + up[x] + up[x + 1] + mid[x - 1] + mid[x] + mid[x + 1] +
+                     down[x - 1] + down[x] + down[x + 1];
+      out[x] = (sum * DIV9_MUL + 32768u) >> 16;
+    }
+  }
+}
+
+void integralImage(const uint8_t *src, int width, int height, int stride,
+                   uint32_t *out) {
+  int outStride = width + 1;
+  memset(out, 0, sizeof(uint32_t) * outStride);
+  for (int y = 0; y < height; y++) {
+    const uint8_t *row = src + (size_t)y * stride;
+    const uint32_t *above = out + (size_t)y * outStride;
+    uint32_t *cur = out + (size_t)(y + 1) * outStride;
+    uint32_t rowSum = 0;
+    cur[0] = 0;
+    for (int x = 0; x < width; x++) {
+      rowSum += row[x];
+      cur[x + 1] = above[x + 1] + rowSum;
+    }
+  }
+}
+
+void blobContrastRow(const uint32_t *integral, int integralStride, int y,
+                     int r, int outer, int x0, int x1, int32_t *out) {
+  const uint32_t *innerTop = integral + (size_t)(y - r) * integralStride;
+  const uint32_t *innerBottom = integral + (size_t)(y + r + 1) * integralStride;
+  const uint32_t *outerTop = integral + (size_t)(y - outer) * integralStride;
+  const uint32_t *outerBottom = integral + (size_t)(y + outer + 1) * integralStride;
+
+  // Divide by the box areas with 16.16 reciprocals; the products stay
+  // below 2^31 for any 8-bit input.
+  uint32_t innerArea = (2 * r + 1) * (2 * r + 1);
+  uint32_t ringArea = (2 * outer + 1) * (2 * outer + 1) - innerArea;
+  uint32_t innerRecip = (16u << 16) / innerArea;
+  uint32_t ringRecip = (16u << 16) / ringArea;
+
+  int x = x0;
+#if TILT_KERNELS_VECTOR
+  for (; x + 4 <= x1; x += 4) {
+    v4u32 inner = load4u32(innerBottom + x + r + 1) - load4u32(innerBottom + x - r) -
+                  load4u32(innerTop + x + r + 1) + load4u32(innerTop + x - r);
+    v4u32 total = load4u32(outerBottom + x + outer + 1) - load4u32(outerBottom + x - outer) -
+                  load4u32(outerTop + x + outer + 1) + load4u32(outerTop + x - outer);
+    v4u32 contrast = (((total - inner) * ringRecip) >> 16) - ((inner * innerRecip) >> 16);
+    memcpy(out + (x - x0), &contrast, sizeof(contrast));
+  }
+#endif
+  for (; x < x1; x++) {
+    uint32_t inner = innerBottom[x + r + 1] - innerBottom[x - r] - innerTop[x + r + 1] +
+                     innerTop[x - r];
+    uint32_t total = outerBottom[x + outer + 1] - outerBottom[x - outer] -
+                     outerTop[x + outer + 1] + outerTop[x - outer];
+    out[x - x0] = (int32_t)(((total - inner) * ringRecip) >> 16) -
+                  (int32_t)((inner * innerRecip) >> 16);
+  }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// TRACKING KERNELS
+// ==========================================
+// Integer/fixed-point image kernels used by TiltEstimator. All of them walk
+// contiguous rows so the compiler (or the vector path below) can keep the
+// inner loops tight; none of them allocate.
+//
+// Define TILT_KERNELS_SCALAR to force the plain C++ loops. Otherwise a
+// GCC/Clang vector-extension path is used on targets with a SIMD unit
+// (SSE2 / NEON); the ESP32 always takes the scalar path.
+
+#if !defined(TILT_KERNELS_SCALAR) && defined(__GNUC__) &&                      \
+    (defined(__SSE2__) || defined(__ARM_NEON))
+#define TILT_KERNELS_VECTOR 1
+#else
+#define TILT_KERNELS_VECTOR 0
+#endif
+
+// 2x2 average: dst is (width / 2) x (height / 2), dstStride bytes per row.
+void downscale2x(const uint8_t *src, int width, int height, int srcStride,
+                 uint8_t *dst, int dstStride);
+
+// 3x3 box blur. Edge rows/columns are copied unblurred. dst must not
+// alias src and is written with `width` bytes per row.
+void boxBlur3(const uint8_t *src, int width, int height, int srcStride,
+              uint8_t *dst);
+
+// Summed-area table with a zero first row/column: out is
+// (width + 1) x (height + 1) entries, `width + 1` per row.
+void integralImage(const uint8_t *src, int width, int height, int stride,
+                   uint32_t *out);
+
+// Dark-blob contrast for one row of centres y, columns [x0, x1):
+// mean of the (2 * outer + 1)^2 surround minus mean of the (2 * r + 1)^2
+// centre, in gray levels * 16, written to out[0 .. x1 - x0). Both boxes
+// must lie inside the image: outer <= x0, x1 + outer <= width,
+// outer <= y, y + outer < height.
+void blobContrastRow(const uint32_t *integral, int integralStride, int y,
+                     int r, int outer, int x0, int x1, int32_t *out);
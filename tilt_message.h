@@ -0,0 +1,148 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==========================================
+// TILT CONTROL MESSAGES
+// ==========================================
+// Compact binary messages on the WebSocket control channel (port 81).
+// All multi-byte fields are little-endian. The page decodes the same
+// layout with a DataView.
+//
+// Device -> page, TILT_MSG_UPDATE (14 bytes):
+//   0  uint8   type
+//   1  uint8   lane (0 left, 1 centre, 2 right)
+//   2  int16   angle, 0.01 degree units (steering inversion applied)
+//   4  uint8   confidence, 0..255
+//   5  uint8   flags (TILT_FLAG_FOUND)
+//   6  uint32  frame sequence number
+//  10  uint32  capture time of that frame, device ms (see /time)
+//
+// Page -> device, TILT_MSG_CONFIG (3 bytes):
+//   0  uint8   type
+//   1  uint8   lane threshold, degrees
+//   2  uint8   flags (TILT_FLAG_INVERT)
+//
+// Page -> device, TILT_MSG_CLIENT_STATS (3 bytes):
+//   0  uint8   type
+//   1  uint16  frames the page processed per second, 0.1 fps units
+//
+// Page -> device, TILT_MSG_FACE_BOX (13 bytes):
+//   0  uint8   type
+//   1  uint16  x, y, width, height of the face, full-frame pixels
+//   9  uint16  frame width, height those pixels refer to
+
+#define TILT_MSG_UPDATE 1
+#define TILT_MSG_CONFIG 2
+#define TILT_MSG_CLIENT_STATS 3
+#define TILT_MSG_FACE_BOX 4
+
+#define TILT_UPDATE_SIZE 14
+#define TILT_CONFIG_SIZE 3
+#define TILT_CLIENT_STATS_SIZE 3
+#define TILT_FACE_BOX_SIZE 13
+
+#define TILT_FLAG_FOUND 0x01
+#define TILT_FLAG_INVERT 0x01
+
+struct TiltUpdate {
+  uint8_t lane;
+  float angle;
+  float confidence; // 0..1
+  bool found;
+  uint32_t seq;
+  uint32_t captureMs;
+};
+
+struct FaceBox {
+  uint16_t x, y, width, height;
+  uint16_t frameWidth, frameHeight; // frame the box was measured in
+};
+
+struct TiltConfig {
+  uint8_t threshold = 8; // same default as the page's sensitivity slider
+  bool invert = false;
+};
+
+// Same rule as the page: beyond +/-threshold degrees is a side lane
+inline uint8_t tiltLane(float angle, float threshold) {
+  if (angle > threshold) {
+    return 2;
+  }
+  if (angle < -threshold) {
+    return 0;
+  }
+  return 1;
+}
+
+inline size_t encodeTiltUpdate(const TiltUpdate &u, uint8_t *out) {
+  float centi = u.angle * 100.0f;
+  if (centi > 32767.0f) {
+    centi = 32767.0f;
+  } else if (centi < -32768.0f) {
+    centi = -32768.0f;
+  }
+  int16_t angle = (int16_t)(centi < 0 ? centi - 0.5f : centi + 0.5f);
+  float conf = u.confidence < 0 ? 0 : (u.confidence > 1 ? 1 : u.confidence);
+
+  out[0] = TILT_MSG_UPDATE;
+  out[1] = u.lane;
+  out[2] = (uint16_t)angle & 0xff;
+  out[3] = (uint16_t)angle >> 8;
+  out[4] = (uint8_t)(conf * 255.0f + 0.5f);
+  out[5] = u.found ? TILT_FLAG_FOUND : 0;
+  out[6] = u.seq & 0xff;
+  out[7] = (u.seq >> 8) & 0xff;
+  out[8] = (u.seq >> 16) & 0xff;
+  out[9] = u.seq >> 24;
+  out[10] = u.captureMs & 0xff;
+  out[11] = (u.captureMs >> 8) & 0xff;
+  out[12] = (u.captureMs >> 16) & 0xff;
+  out[13] = u.captureMs >> 24;
+  return TILT_UPDATE_SIZE;
+}
+
+inline bool decodeTiltUpdate(const uint8_t *in, size_t len, TiltUpdate *u) {
+  if (len < TILT_UPDATE_SIZE || in[0] != TILT_MSG_UPDATE) {
+    return false;
+  }
+  u->lane = in[1];
+  u->angle = (int16_t)(in[2] | (in[3] << 8)) / 100.0f;
+  u->confidence = in[4] / 255.0f;
+  u->found = (in[5] & TILT_FLAG_FOUND) != 0;
+  u->seq = (uint32_t)in[6] | ((uint32_t)in[7] << 8) | ((uint32_t)in[8] << 16) |
+           ((uint32_t)in[9] << 24);
+  u->captureMs = (uint32_t)in[10] | ((uint32_t)in[11] << 8) | ((uint32_t)in[12] << 16) |
+                 ((uint32_t)in[13] << 24);
+  return true;
+}
+
+inline bool decodeTiltConfig(const uint8_t *in, size_t len, TiltConfig *c) {
+  if (len < TILT_CONFIG_SIZE || in[0] != TILT_MSG_CONFIG) {
+    return false;
+  }
+  c->threshold = in[1];
+  c->invert = (in[2] & TILT_FLAG_INVERT) != 0;
+  return true;
+}
+
+inline bool decodeClientFps(const uint8_t *in, size_t len, float *fps) {
+  if (len < TILT_CLIENT_STATS_SIZE || in[0] != TILT_MSG_CLIENT_STATS) {
+    return false;
+  }
+  *fps = (in[1] | (in[2] << 8)) / 10.0f;
+  return true;
+}
+
+inline bool decodeFaceBox(const uint8_t *in, size_t len, FaceBox *box) {
+  if (len < TILT_FACE_BOX_SIZE || in[0] != TILT_MSG_FACE_BOX) {
+    return false;
+  }
+  uint16_t v[6];
+  for (int i = 0; i < 6; i++) {
+    v[i] = in[1 + 2 * i] | (in[2 + 2 * i] << 8);
+  }
+  *box = {v[0], v[1], v[2], v[3], v[4], v[5]};
+  return box->width > 0 && box->height > 0 && box->frameWidth > 0 && box->frameHeight > 0;
+}
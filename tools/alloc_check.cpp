@@ -0,0 +1,335 @@
+// Counts heap allocations on the sketch's per-frame and per-request path,
+// run on a PC. malloc/calloc/realloc/free and operator new/delete are
+// hooked; everything the sketch sets up once at boot (the frame arena,
+// encode slots, the session buffer, the estimator's scratch) is created
+// first, uncounted, then every simulated frame does what captureTask,
+// trackTask and the HTTP handlers do with it:
+//
+//   render a frame into the arena (stand-in for the camera buffer),
+//   publish it through LatestFrame and pin it as a reader would,
+//   estimate the tilt, run the motion gate, filter and lane latch,
+//   encode the WebSocket tilt update and record it in the session,
+//   build /stream, /capture (with X-ROI) and 304 headers,
+//   borrow an encode slot and fill it through slotWrite() in the chunks
+//   the JPEG encoder writes, then give it back.
+//
+// The first --warmup frames are not counted (the estimator sizes its
+// scratch once). Prints allocations and bytes per frame, which should be 0,
+// and the heap high water; exits 1 if anything allocated after warm-up.
+// What the ESP32 libraries allocate inside (WebServer request parsing, the
+// JPEG encoder's own scratch) is not covered; /metrics reports the heap
+// high water on the device for that.
+//
+// Build and run on Linux from the repository root:
+//   g++ -O2 -I. tools/alloc_check.cpp frame_arena.cpp frame_headers.cpp motion_gate.cpp session_log.cpp synthetic_camera.cpp tilt_*.cpp -o alloc_check
+//   ./alloc_check
+//   ./alloc_check --frames 5000 --json --tag "$(git rev-parse --short HEAD)"
+
+#include "frame_arena.h"
+#include "frame_headers.h"
+#include "latency_histogram.h"
+#include "latest_frame.h"
+#include "motion_gate.h"
+#include "session_log.h"
+#include "synthetic_camera.h"
+#include "tilt_estimator.h"
+#include "tilt_filter.h"
+#include "tilt_message.h"
+
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <new>
+
+// Same sizes as the sketch: VGA camera frames, 160x120 tracking frames
+#define FRAME_WIDTH 640
+#define FRAME_HEIGHT 480
+#define TRACK_WIDTH 160
+#define TRACK_HEIGHT 120
+#define FB_COUNT 2
+#define ENCODE_SLOT_BYTES (48 * 1024)
+#define ENCODE_SLOTS 4
+#define SESSION_BYTES (1024 * 1024)
+#define ENCODER_CHUNK 1024 // the encoder's output buffer flushes this much at a time
+
+// ==========================================
+// ALLOCATION HOOKS
+// ==========================================
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void __libc_free(void *ptr);
+}
+
+static bool counting = false;
+static size_t allocations = 0;
+static size_t allocatedBytes = 0;
+static size_t liveBytes = 0;
+static size_t highWater = 0;
+
+static void counted(void *ptr) {
+  if (!ptr) {
+    return;
+  }
+  size_t size = malloc_usable_size(ptr);
+  liveBytes += size;
+  highWater = liveBytes > highWater ? liveBytes : highWater;
+  if (counting) {
+    allocations++;
+    allocatedBytes += size;
+  }
+}
+
+static void uncounted(void *ptr) {
+  if (ptr) {
+    liveBytes -= malloc_usable_size(ptr);
+  }
+}
+
+extern "C" void *malloc(size_t size) {
+  void *ptr = __libc_malloc(size);
+  counted(ptr);
+  return ptr;
+}
+
+extern "C" void *calloc(size_t n, size_t size) {
+  void *ptr = __libc_calloc(n, size);
+  counted(ptr);
+  return ptr;
+}
+
+extern "C" void *realloc(void *ptr, size_t size) {
+  uncounted(ptr);
+  void *out = __libc_realloc(ptr, size);
+  counted(out ? out : ptr);
+  return out;
+}
+
+extern "C" void free(void *ptr) {
+  uncounted(ptr);
+  __libc_free(ptr);
+}
+
+void *operator new(size_t size) {
+  void *ptr = malloc(size ? size : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete[](void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { free(ptr); }
+
+// ==========================================
+// SIMULATED FRAME PATH
+// ==========================================
+// Stand-in for camera_fb_t: a buffer carved from the arena at boot
+struct FakeFrame {
+  uint8_t *buf;
+  size_t len;
+  bool out; // lent to LatestFrame
+};
+
+static void returnFrame(FakeFrame *frame) { frame->out = false; }
+
+struct Device {
+  FrameArena arena;
+  SlotPool encodeSlots;
+  FakeFrame frames[FB_COUNT];
+  uint8_t *trackGray;
+  uint8_t *sessionBuf;
+  LatestFrame<FakeFrame, FB_COUNT + 1> latest{returnFrame};
+  TiltEstimator estimator;
+  MotionGate gate;
+  TiltFilter filter;
+  TiltLaneLatch latch;
+  SessionWriter session;
+  LatencyHistogram frameBytes;
+  uint8_t fakeJpeg[20 * 1024]; // what the encoder would produce for a frame
+};
+
+static bool setupDevice(Device &d, uint8_t *memory, size_t size) {
+  d.arena.begin(memory, size);
+  for (int i = 0; i < FB_COUNT; i++) {
+    d.frames[i].buf = d.arena.carve(FRAME_WIDTH * FRAME_HEIGHT);
+    d.frames[i].len = FRAME_WIDTH * FRAME_HEIGHT;
+    d.frames[i].out = false;
+  }
+  d.trackGray = d.arena.carve(TRACK_WIDTH * TRACK_HEIGHT);
+  d.sessionBuf = d.arena.carve(SESSION_BYTES);
+  if (!d.encodeSlots.begin(d.arena, ENCODE_SLOT_BYTES, ENCODE_SLOTS) || !d.sessionBuf) {
+    return false;
+  }
+  d.session.reset(d.sessionBuf, SESSION_BYTES);
+  for (size_t i = 0; i < sizeof(d.fakeJpeg); i++) {
+    d.fakeJpeg[i] = (uint8_t)(i * 31 + 7);
+  }
+  return true;
+}
+
+// Nearest-neighbour shrink, as decodeGray() would deliver the frame
+static void shrink(const uint8_t *src, uint8_t *dst) {
+  for (int y = 0; y < TRACK_HEIGHT; y++) {
+    const uint8_t *row = src + (size_t)(y * FRAME_HEIGHT / TRACK_HEIGHT) * FRAME_WIDTH;
+    for (int x = 0; x < TRACK_WIDTH; x++) {
+      dst[y * TRACK_WIDTH + x] = row[x * FRAME_WIDTH / TRACK_WIDTH];
+    }
+  }
+}
+
+// One frame through capture, tracking and every response the sketch sends
+// for it. Returns false if something on the path failed.
+static bool runFrame(Device &d, uint32_t n) {
+  uint32_t nowMs = n * 33;
+
+  // captureTask
+  FakeFrame *fb = nullptr;
+  for (FakeFrame &f : d.frames) {
+    if (!f.out) {
+      fb = &f;
+      break;
+    }
+  }
+  if (!fb) {
+    return false;
+  }
+  renderSyntheticFace(fb->buf, FRAME_WIDTH, FRAME_HEIGHT, syntheticAngle(n));
+  fb->out = true;
+  d.latest.publish(fb);
+
+  // trackTask
+  const PinnedFrame<FakeFrame> *pinned = d.latest.acquire();
+  if (!pinned) {
+    return false;
+  }
+  shrink(pinned->frame->buf, d.trackGray);
+  TiltResult tilt = d.estimator.estimate(d.trackGray, TRACK_WIDTH, TRACK_HEIGHT, TRACK_WIDTH);
+  d.gate.update(d.trackGray, TRACK_WIDTH, TRACK_HEIGHT, TRACK_WIDTH, tilt);
+  if (tilt.found) {
+    d.filter.update(tilt.angle, nowMs);
+  }
+  float angle = d.filter.predict(nowMs);
+  TiltUpdate update;
+  update.lane = d.latch.update(angle, 8);
+  update.angle = angle;
+  update.confidence = d.filter.confidence(nowMs);
+  update.found = tilt.found;
+  update.seq = pinned->seq;
+  update.captureMs = nowMs;
+  uint8_t message[TILT_UPDATE_SIZE];
+  encodeTiltUpdate(update, message);
+
+  SessionTilt record = {pinned->seq, angle, update.confidence, tilt.found, update.lane, 0};
+  if (d.session.full()) {
+    d.session.reset(d.sessionBuf, SESSION_BYTES);
+  }
+  d.session.tilt(nowMs, record);
+
+  // HTTP: /stream part, /capture with ROI, 304 for an unchanged frame
+  char header[FRAME_HEADER_MAX];
+  RoiRect roi = {200, 120, 240, 180, FRAME_WIDTH, FRAME_HEIGHT};
+  bool ok = streamPartHeader(header, sizeof(header), sizeof(d.fakeJpeg), pinned->seq, nowMs) &&
+            captureResponseHeader(header, sizeof(header), sizeof(d.fakeJpeg), pinned->seq,
+                                  nowMs, &roi) &&
+            notModifiedHeader(header, sizeof(header), pinned->seq, angle, tilt.found);
+
+  // Viewer of a grayscale frame: encode into a borrowed slot
+  uint8_t *slot = d.encodeSlots.acquire();
+  if (!slot) {
+    ok = false;
+  } else {
+    SlotWriter writer = {slot, d.encodeSlots.slotSize(), 0, false};
+    for (size_t at = 0; at < sizeof(d.fakeJpeg); at += ENCODER_CHUNK) {
+      size_t len = sizeof(d.fakeJpeg) - at < ENCODER_CHUNK ? sizeof(d.fakeJpeg) - at
+                                                           : ENCODER_CHUNK;
+      slotWrite(&writer, at, d.fakeJpeg + at, len);
+    }
+    ok = ok && !writer.overflow && writer.length == sizeof(d.fakeJpeg);
+    d.frameBytes.record(writer.length);
+    d.encodeSlots.release(slot);
+  }
+
+  d.latest.release(pinned);
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  uint32_t frames = 1000;
+  uint32_t warmup = 10;
+  bool json = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--frames") && i + 1 < argc) {
+      frames = strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--warmup") && i + 1 < argc) {
+      warmup = strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else {
+      frames = 0;
+      break;
+    }
+  }
+  if (frames == 0) {
+    fprintf(stderr, "usage: %s [--frames n] [--warmup n] [--tag name] [--json]\n", argv[0]);
+    return 2;
+  }
+
+  // Boot: one block, as setupArena() gets from ps_malloc()
+  size_t arenaBytes = FB_COUNT * FRAME_WIDTH * FRAME_HEIGHT + TRACK_WIDTH * TRACK_HEIGHT +
+                      SESSION_BYTES + ENCODE_SLOTS * ENCODE_SLOT_BYTES + 64;
+  uint8_t *memory = (uint8_t *)malloc(arenaBytes);
+  Device *device = new Device();
+  if (!memory || !setupDevice(*device, memory, arenaBytes)) {
+    fprintf(stderr, "Arena too small for the frame path\n");
+    return 1;
+  }
+  size_t bootHighWater = highWater;
+
+  uint32_t failed = 0;
+  for (uint32_t n = 0; n < warmup; n++) {
+    failed += !runFrame(*device, n);
+  }
+  size_t warmupHighWater = highWater;
+  counting = true;
+  for (uint32_t n = warmup; n < warmup + frames; n++) {
+    failed += !runFrame(*device, n);
+  }
+  counting = false;
+  size_t steadyHighWater = highWater; // before printf() buffers stdout
+
+  bool clean = allocations == 0 && failed == 0;
+  if (json) {
+    printf("{\"tag\":\"%s\",\"frames\":%u,\"allocations\":%zu,\"allocated_bytes\":%zu,"
+           "\"allocations_per_frame\":%.3f,\"boot_high_water_bytes\":%zu,"
+           "\"high_water_bytes\":%zu,\"arena_bytes\":%zu,\"arena_used_bytes\":%zu,"
+           "\"encode_slots_high_water\":%u,\"failed_frames\":%u}\n",
+           tag, frames, allocations, allocatedBytes, (double)allocations / frames,
+           bootHighWater, steadyHighWater, device->arena.size(), device->arena.used(),
+           device->encodeSlots.highWater(), failed);
+  } else {
+    printf("frames counted:        %u (after %u warm-up)\n", frames, warmup);
+    printf("allocations:           %zu (%.3f per frame, %zu bytes)\n", allocations,
+           (double)allocations / frames, allocatedBytes);
+    printf("heap high water:       %zu bytes at boot, %zu after warm-up, %zu at the end\n",
+           bootHighWater, warmupHighWater, steadyHighWater);
+    printf("arena:                 %zu of %zu bytes carved\n", device->arena.used(),
+           device->arena.size());
+    printf("encode slots:          %u of %u out at most\n", device->encodeSlots.highWater(),
+           device->encodeSlots.slots());
+    if (failed) {
+      printf("failed frames:         %u\n", failed);
+    }
+    printf("%s\n", clean ? "OK: no allocations on the frame path"
+                         : "FAIL: the frame path allocates");
+  }
+  return clean ? 0 : 1;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+// Timing and percentiles for the PC benchmarks and checks.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+inline uint32_t elapsedUs(std::chrono::steady_clock::time_point since) {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - since)
+      .count();
+}
+
+// The value p (0..1) of the way up v, or 0 if v is empty. Sorts v in place.
+template <typename T> T percentile(std::vector<T> &v, double p) {
+  if (v.empty()) {
+    return 0;
+  }
+  std::sort(v.begin(), v.end());
+  return v[std::min(v.size() - 1, (size_t)(p * v.size()))];
+}
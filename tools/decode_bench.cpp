@@ -0,0 +1,344 @@
+// Times JPEG decoding the ways the tracker could do it: the full frame at
+// full size, straight to 1/2, 1/4 or 1/8 size (DCT scaling, what
+// decodeGray() in the sketch does), and at tracking size split into bands
+// (jpeg_bands.h) decoded on 2..N threads, the PC version of the sketch's
+// DECODE_BANDS. Prints per-frame p50/p99 for each, and checks the banded
+// output is identical to the single decode (exit 1 if any frame differs or
+// fails to decode).
+//
+// Frames come from session recordings (session_log.h) or, without files,
+// from synthetic VGA faces stored like the camera's (colour, 4:2:2).
+// Bands need restart markers; --restart-rows N re-encodes the frames with
+// a marker every N MCU rows to show what they would gain (grayscale, so
+// slightly quicker to decode than the originals).
+//
+// Build and run on Linux from the repository root:
+//   g++ -O2 -pthread -I. tools/decode_bench.cpp jpeg_bands.cpp session_log.cpp synthetic_camera.cpp -ljpeg -o decode_bench
+//   ./decode_bench                                  # synthetic frames
+//   ./decode_bench esp32.htrs --threads 2,4 --restart-rows 1
+//   ./decode_bench --json --tag "$(git rev-parse --short HEAD)" > decode.json
+
+#include "jpeg_bands.h"
+#include "session_log.h"
+#include "synthetic_camera.h"
+#include "tools/bench_stats.h"
+#include "tools/jpeg_gray.h"
+#include "tools/session_file.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define SYNTHETIC_WIDTH 640
+#define SYNTHETIC_HEIGHT 480
+#define JPEG_QUALITY 80
+#define TRACK_MAX_WIDTH 200 // as in the sketch
+#define TRACK_MAX_HEIGHT 150
+#define MAX_BANDS 16
+
+struct Mode {
+  char name[24];
+  unsigned denom; // 0 = the tracking size
+  int threads;    // > 1 decodes in bands
+  std::vector<uint32_t> micros;
+  uint32_t banded;     // frames that split into more than one band
+  uint32_t mismatched; // frames whose banded output differs
+};
+
+// Band i runs on worker i - 1; band 0 on the caller, who then waits for all
+class BandPool {
+public:
+  explicit BandPool(int workers) {
+    for (int i = 0; i < workers; i++) {
+      threads_.emplace_back([this, i]() { loop(i + 1); });
+    }
+  }
+
+  ~BandPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &t : threads_) {
+      t.join();
+    }
+  }
+
+  void run(int bands, const std::function<void(int)> &work) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      work_ = &work;
+      bands_ = bands;
+      pending_ = std::min(bands - 1, (int)threads_.size());
+      generation_++;
+    }
+    wake_.notify_all();
+    work(0);
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return pending_ == 0; });
+  }
+
+private:
+  void loop(int band) {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      wake_.wait(lock, [&]() { return stop_ || generation_ != seen; });
+      if (stop_) {
+        return;
+      }
+      seen = generation_;
+      if (band >= bands_) {
+        continue;
+      }
+      const std::function<void(int)> *work = work_;
+      lock.unlock();
+      (*work)(band);
+      lock.lock();
+      if (--pending_ == 0) {
+        done_.notify_one();
+      }
+    }
+  }
+
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable wake_, done_;
+  const std::function<void(int)> *work_ = nullptr;
+  int bands_ = 0;
+  int pending_ = 0;
+  uint64_t generation_ = 0;
+  bool stop_ = false;
+};
+
+static unsigned trackingDenom(int width) {
+  unsigned denom = 1;
+  while (width / (int)denom > TRACK_MAX_WIDTH && denom < 8) {
+    denom *= 2;
+  }
+  return denom;
+}
+
+// Splits the frame and decodes each band into its rows of out. Falls back
+// to one decode when the frame has no usable restart markers.
+static bool decodeBanded(const std::vector<uint8_t> &jpeg, unsigned denom, int bandsWanted,
+                         BandPool &pool, std::vector<uint8_t> *out, int *bandsUsed) {
+  JpegLayout layout;
+  JpegBand bands[MAX_BANDS];
+  int count = 1;
+  if (parseJpegLayout(jpeg.data(), jpeg.size(), &layout)) {
+    count = splitJpegBands(jpeg.data(), layout, bands, bandsWanted);
+  }
+  *bandsUsed = count;
+  int width, height;
+  if (count == 1) {
+    return decodeJpegGrayRows(jpeg.data(), jpeg.size(), denom, 0, 0, out, NULL, 0, &width,
+                              &height);
+  }
+
+  int stride = (layout.width + denom - 1) / denom;
+  int rows = (layout.height + denom - 1) / denom;
+  out->resize((size_t)stride * rows);
+  bool ok[MAX_BANDS];
+  pool.run(count, [&](int i) {
+    // Each band as its own small JPEG, read through the same code the
+    // ESP32 decoder's input callback uses
+    std::vector<uint8_t> band(jpegBandSize(layout, bands[i]));
+    readJpegBand(jpeg.data(), layout, bands[i], 0, band.data(), band.size());
+    int top = bands[i].y / denom;
+    int w, h;
+    ok[i] = decodeJpegGrayRows(band.data(), band.size(), denom, stride, rows - top, NULL,
+                               out->data() + (size_t)top * stride, stride, &w, &h);
+  });
+  return std::all_of(ok, ok + count, [](bool b) { return b; });
+}
+
+// --- Corpus ---
+
+static bool loadSession(const char *path, std::vector<std::vector<uint8_t>> *frames) {
+  SessionFile file;
+  if (!file.open(path)) {
+    return false;
+  }
+  SessionReader reader(file.data(), file.size());
+  SessionRecord r;
+  SessionFrame frame;
+  while (reader.next(&r)) {
+    if (decodeSessionFrame(r, &frame) && frame.format == SESSION_FORMAT_JPEG) {
+      frames->emplace_back(frame.data, frame.data + frame.length);
+    }
+  }
+  return true;
+}
+
+static std::vector<int> parseThreads(const char *list) {
+  std::vector<int> threads;
+  for (const char *p = list; *p;) {
+    char *end;
+    long n = strtol(p, &end, 10);
+    if (end == p || n < 2 || n > MAX_BANDS) {
+      return {};
+    }
+    threads.push_back((int)n);
+    p = *end == ',' ? end + 1 : end;
+  }
+  return threads;
+}
+
+int main(int argc, char **argv) {
+  std::vector<const char *> paths;
+  std::vector<int> threads = {2, 4};
+  int passes = 3;
+  int restartRows = -1; // keep the frames as they are
+  bool json = false;
+  const char *tag = "";
+  bool usage = false;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+      threads = parseThreads(argv[++i]);
+      usage |= threads.empty();
+    } else if (!strcmp(argv[i], "--passes") && i + 1 < argc) {
+      passes = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--restart-rows") && i + 1 < argc) {
+      restartRows = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else if (argv[i][0] != '-') {
+      paths.push_back(argv[i]);
+    } else {
+      usage = true;
+    }
+  }
+  if (usage || passes < 1) {
+    fprintf(stderr,
+            "usage: %s [session.htrs ...] [--threads 2,4] [--passes n] [--restart-rows n] "
+            "[--tag name] [--json]\n",
+            argv[0]);
+    return 2;
+  }
+
+  std::vector<std::vector<uint8_t>> frames;
+  for (const char *path : paths) {
+    if (!loadSession(path, &frames)) {
+      return 1;
+    }
+  }
+  if (paths.empty()) {
+    std::vector<uint8_t> gray(SYNTHETIC_WIDTH * SYNTHETIC_HEIGHT);
+    for (uint32_t i = 0; i < SYNTHETIC_SWEEP_FRAMES; i++) {
+      renderSyntheticFace(gray.data(), SYNTHETIC_WIDTH, SYNTHETIC_HEIGHT, syntheticAngle(i));
+      frames.push_back(encodeJpegGray(gray.data(), SYNTHETIC_WIDTH, SYNTHETIC_HEIGHT,
+                                      JPEG_QUALITY, restartRows < 0 ? 1 : restartRows, true));
+    }
+  } else if (restartRows >= 0) {
+    for (std::vector<uint8_t> &jpeg : frames) {
+      std::vector<uint8_t> gray;
+      int w, h;
+      if (decodeJpegGray(jpeg.data(), jpeg.size(), 1 << 16, &gray, &w, &h)) {
+        jpeg = encodeJpegGray(gray.data(), w, h, JPEG_QUALITY, restartRows);
+      }
+    }
+  }
+  if (frames.empty()) {
+    fprintf(stderr, "No JPEG frames in the corpus\n");
+    return 1;
+  }
+
+  JpegLayout first = {};
+  parseJpegLayout(frames[0].data(), frames[0].size(), &first);
+  unsigned trackDenom = trackingDenom(first.width);
+  std::vector<Mode> modes;
+  for (unsigned denom : {1u, 2u, 4u, 8u}) {
+    Mode m = {};
+    snprintf(m.name, sizeof(m.name), denom == 1 ? "full" : "1/%u", denom);
+    m.denom = denom;
+    m.threads = 1;
+    modes.push_back(m);
+  }
+  for (int n : threads) {
+    Mode m = {};
+    snprintf(m.name, sizeof(m.name), "1/%u bands", trackDenom);
+    m.denom = trackDenom;
+    m.threads = n;
+    modes.push_back(m);
+  }
+
+  int maxThreads = *std::max_element(threads.begin(), threads.end());
+  BandPool pool(maxThreads - 1);
+  std::vector<uint8_t> out, single;
+  for (Mode &m : modes) {
+    for (int pass = 0; pass < passes; pass++) {
+      for (const std::vector<uint8_t> &jpeg : frames) {
+        int w, h, bands = 1;
+        auto start = std::chrono::steady_clock::now();
+        bool ok = m.threads > 1 ? decodeBanded(jpeg, m.denom, m.threads, pool, &out, &bands)
+                                : decodeJpegGrayRows(jpeg.data(), jpeg.size(), m.denom, 0, 0,
+                                                     &out, NULL, 0, &w, &h);
+        m.micros.push_back(elapsedUs(start));
+        if (!ok || pass > 0 || m.threads == 1) {
+          m.mismatched += !ok;
+          continue;
+        }
+        m.banded += bands > 1;
+        decodeJpegGrayRows(jpeg.data(), jpeg.size(), m.denom, 0, 0, &single, NULL, 0, &w, &h);
+        m.mismatched += out != single;
+      }
+    }
+  }
+
+  size_t bytes = 0;
+  for (const std::vector<uint8_t> &jpeg : frames) {
+    bytes += jpeg.size();
+  }
+  bool mismatched = false;
+  for (const Mode &m : modes) {
+    mismatched |= m.mismatched > 0;
+  }
+  if (json) {
+    printf("{\"tag\":\"%s\",\"corpus\":\"%s\",\"frames\":%zu,\"width\":%u,\"height\":%u,"
+           "\"mean_bytes\":%zu,\"restart_interval\":%u,\"passes\":%d,\"results\":[",
+           tag, paths.empty() ? "synthetic" : "sessions", frames.size(), first.width,
+           first.height, bytes / frames.size(), first.restartInterval, passes);
+    for (size_t i = 0; i < modes.size(); i++) {
+      Mode &m = modes[i];
+      printf("%s{\"mode\":\"%s\",\"scale\":%u,\"threads\":%d,\"decode_us\":{\"p50\":%u,"
+             "\"p99\":%u},\"banded\":%u,\"mismatched\":%u}",
+             i ? "," : "", m.name, m.denom, m.threads, percentile(m.micros, 0.5),
+             percentile(m.micros, 0.99), m.banded, m.mismatched);
+    }
+    printf("]}\n");
+    return mismatched ? 1 : 0;
+  }
+
+  printf("%zu frames, %ux%u, %zu bytes mean, restart interval %u MCUs, %d passes, "
+         "%u hardware threads\n",
+         frames.size(), first.width, first.height, bytes / frames.size(),
+         first.restartInterval, passes, std::thread::hardware_concurrency());
+  printf("%-12s %7s %17s  %s\n", "mode", "threads", "decode us p50/p99", "banded/mismatched");
+  uint32_t full = percentile(modes[0].micros, 0.5);
+  for (Mode &m : modes) {
+    char times[32], check[32] = "-";
+    uint32_t p50 = percentile(m.micros, 0.5);
+    snprintf(times, sizeof(times), "%u/%u", p50, percentile(m.micros, 0.99));
+    if (m.threads > 1) {
+      snprintf(check, sizeof(check), "%u/%u", m.banded, m.mismatched);
+    }
+    printf("%-12s %7d %17s  %-17s %.1fx\n", m.name, m.threads, times, check,
+           p50 ? (double)full / p50 : 0.0);
+  }
+  if (mismatched) {
+    fprintf(stderr, "banded decode differs from the single decode\n");
+  }
+  return mismatched ? 1 : 0;
+}
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""Embed the game page (and any vendored scripts) into web_assets.h.
+
+Each asset is gzipped deterministically (level 9, mtime 0) and written as a
+PROGMEM byte array with a precomputed ETag, so the sketch can serve it
+straight from flash with Content-Encoding: gzip and answer If-None-Match
+with 304.
+
+  index.html      -> /
+  vendor/<name>   -> /vendor/<name>   (optional, e.g. tf.min.js for offline use)
+
+Usage:
+  python tools/embed_web.py          regenerate web_assets.h
+  python tools/embed_web.py --check  verify web_assets.h decompresses back to
+                                     the current sources and its ETags match
+                                     (exit 1 if stale)
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+import sys
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUTPUT = os.path.join(ROOT, "web_assets.h")
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".js": "application/javascript",
+    ".css": "text/css",
+    ".json": "application/json",
+}
+
+
+def find_assets():
+    """(url path, file path) pairs, page first, then vendor/ sorted by name."""
+    assets = [("/", os.path.join(ROOT, "index.html"))]
+    vendor = os.path.join(ROOT, "vendor")
+    if os.path.isdir(vendor):
+        for name in sorted(os.listdir(vendor)):
+            path = os.path.join(vendor, name)
+            if os.path.isfile(path) and not name.startswith("."):
+                assets.append(("/vendor/" + name, path))
+    return assets
+
+
+def symbol_for(url):
+    name = "index" if url == "/" else url
+    return "asset_" + re.sub(r"[^0-9A-Za-z]", "_", name).strip("_")
+
+
+def compress(data):
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def render(assets):
+    out = [
+        "#pragma once",
+        "",
+        "// Generated by tools/embed_web.py - do not edit.",
+        "// Edit index.html (or vendor/) and re-run the script instead.",
+        "",
+        "#include <pgmspace.h>",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "",
+        "struct WebAsset {",
+        "  const char *path;",
+        "  const char *contentType;",
+        "  const char *etag; // quoted, ready for the ETag header",
+        "  const uint8_t *data; // gzip, in flash",
+        "  size_t length;",
+        "  size_t rawLength;",
+        "};",
+        "",
+    ]
+    table = []
+    for url, path in assets:
+        with open(path, "rb") as f:
+            raw = f.read()
+        packed = compress(raw)
+        etag = '\\"%s\\"' % hashlib.sha1(packed).hexdigest()[:16]
+        ext = os.path.splitext(path)[1].lower()
+        ctype = CONTENT_TYPES.get(ext, "application/octet-stream")
+        sym = symbol_for(url)
+
+        out.append("// %s: %d bytes, %d gzipped" % (os.path.relpath(path, ROOT), len(raw), len(packed)))
+        out.append("static const uint8_t %s[] PROGMEM = {" % sym)
+        for i in range(0, len(packed), 16):
+            out.append("  " + ", ".join("0x%02x" % b for b in packed[i:i + 16]) + ",")
+        out.append("};")
+        out.append("")
+        table.append('  {"%s", "%s", "%s", %s, sizeof(%s), %d},' % (url, ctype, etag, sym, sym, len(raw)))
+
+    out.append("static const WebAsset WEB_ASSETS[] = {")
+    out.extend(table)
+    out.append("};")
+    out.append("#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))")
+    out.append("")
+    return "\n".join(out)
+
+
+def parse_arrays(text):
+    """Symbol -> bytes for every PROGMEM array in a generated header."""
+    arrays = {}
+    for m in re.finditer(r"static const uint8_t (\w+)\[\] PROGMEM = \{(.*?)\};", text, re.S):
+        arrays[m.group(1)] = bytes(int(v, 16) for v in re.findall(r"0x[0-9a-f]{2}", m.group(2)))
+    return arrays
+
+
+def check(assets):
+    try:
+        with open(OUTPUT) as f:
+            text = f.read()
+    except OSError:
+        print("web_assets.h is missing; run tools/embed_web.py")
+        return 1
+
+    arrays = parse_arrays(text)
+    ok = len(arrays) == len(assets)
+    for url, path in assets:
+        with open(path, "rb") as f:
+            raw = f.read()
+        packed = arrays.get(symbol_for(url))
+        try:
+            same = packed is not None and gzip.decompress(packed) == raw
+        except (OSError, EOFError, zlib.error):
+            same = False
+        if not same:
+            print("%s: embedded copy does not match %s" % (url, os.path.relpath(path, ROOT)))
+            ok = False
+    # Only the content has to match: gzip bytes may differ between zlib
+    # versions, but each ETag must still hash the bytes it is served with
+    for etag, sym in re.findall(r'"\\"(\w+)\\"", (\w+),', text):
+        if sym in arrays and hashlib.sha1(arrays[sym]).hexdigest()[:16] != etag:
+            print("%s: ETag does not match the embedded bytes" % sym)
+            ok = False
+    print("web_assets.h is up to date" if ok else "web_assets.h is stale; run tools/embed_web.py")
+    return 0 if ok else 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true",
+                        help="verify web_assets.h round-trips to the sources")
+    args = parser.parse_args()
+
+    assets = find_assets()
+    if args.check:
+        return check(assets)
+
+    text = render(assets)
+    with open(OUTPUT, "w", newline="\n") as f:
+        f.write(text)
+    for url, path in assets:
+        print("%-24s <- %s" % (url, os.path.relpath(path, ROOT)))
+    print("wrote %s" % os.path.relpath(OUTPUT, ROOT))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
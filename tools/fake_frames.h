@@ -0,0 +1,58 @@
+#pragma once
+
+// Fake camera frames for the host build to replay (--frames): synthetic
+// faces that swing from one side to the other on every frame, so the
+// motion gate never holds one back. Colour JPEGs with a restart marker
+// every MCU row, like the camera's. For the PC tools; link with
+// synthetic_camera.cpp and -ljpeg.
+
+#include "synthetic_camera.h"
+#include "tools/jpeg_gray.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+inline std::string fakeFrameName(const std::string &folder, int i) {
+  char name[32];
+  snprintf(name, sizeof(name), "/frame_%02d.jpg", i);
+  return folder + name;
+}
+
+// Writes count frames to a new folder under /tmp and, if jpegs is given,
+// keeps their bytes there too. Returns the folder, or "" if that failed.
+inline std::string writeFakeFrames(int count, int width, int height, int quality,
+                                   std::vector<std::vector<uint8_t>> *jpegs = nullptr) {
+  char folder[] = "/tmp/fake_frames.XXXXXX";
+  if (!mkdtemp(folder)) {
+    return "";
+  }
+  std::vector<uint8_t> gray(width * height);
+  for (int i = 0; i < count; i++) {
+    float angle = (i % 2 ? 1 : -1) * SYNTHETIC_MAX_ANGLE * (0.4f + 0.6f * i / count);
+    renderSyntheticFace(gray.data(), width, height, angle);
+    std::vector<uint8_t> jpeg = encodeJpegGray(gray.data(), width, height, quality, 1, true);
+    FILE *f = fopen(fakeFrameName(folder, i).c_str(), "wb");
+    bool written = f && fwrite(jpeg.data(), 1, jpeg.size(), f) == jpeg.size();
+    if (f) {
+      fclose(f);
+    }
+    if (!written) {
+      return "";
+    }
+    if (jpegs) {
+      jpegs->push_back(std::move(jpeg));
+    }
+  }
+  return folder;
+}
+
+inline void removeFakeFrames(const std::string &folder, int count) {
+  for (int i = 0; i < count; i++) {
+    unlink(fakeFrameName(folder, i).c_str());
+  }
+  rmdir(folder.c_str());
+}
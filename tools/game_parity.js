@@ -0,0 +1,102 @@
+#!/usr/bin/env node
+// Checks that the page's GameSim (index.html) and the C++ one (game_sim.cpp)
+// play the same games bit for bit, for every player count.
+//
+// For each seed and 1..MAX_PLAYERS players it has tools/game_replay.cpp
+// record its autopilot game (--inputs-out), replays those inputs through
+// the page's own replayGame() and compares the end tick, player 1's score
+// and the state hash, which covers every car's lane, score and crash.
+// The GameSim class, replayGame() and the constants they use are taken
+// out of index.html as they are, so the check runs the code the page runs.
+//
+// Usage (from the repository root; ctest runs it on the build's game_replay):
+//   node tools/game_parity.js build/game_replay
+//   node tools/game_parity.js build/game_replay --seeds 1,7,42 --speed 8
+//
+// Exits 1 if any game differs, 2 on a usage error.
+
+"use strict";
+
+const childProcess = require("child_process");
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
+
+const ROOT = path.dirname(__dirname);
+
+function usage() {
+    console.error("usage: node tools/game_parity.js <game_replay> [--seeds 1,7,42] [--speed 1-10]");
+    process.exit(2);
+}
+
+// The page's game code, evaluated on its own
+function loadPageSim() {
+    const html = fs.readFileSync(path.join(ROOT, "index.html"), "utf8");
+    const constants = ["GAME_TICK_HZ", "GAME_MAX_OBSTACLES", "OBSTACLE_HIT_HEIGHT", "CANVAS_H",
+        "CAR_SIZE", "MAX_PLAYERS"].map(name => {
+        const m = html.match(new RegExp(`const ${name} = [^;]+;`));
+        if (!m) throw new Error(`index.html: no ${name}`);
+        return m[0];
+    });
+    const playerY = html.match(/let playerY = [^;]+;/);
+    const sim = html.match(/class GameSim \{[\s\S]*?\n {8}\}\n/);
+    const replay = html.match(/function replayGame\([\s\S]*?\n {8}\}\n/);
+    if (!playerY || !sim || !replay) throw new Error("index.html: GameSim or replayGame() not found");
+    const source = [...constants, playerY[0], sim[0], replay[0]].join("\n");
+    return new Function(`${source}\nreturn { replayGame, MAX_PLAYERS };`)();
+}
+
+function main() {
+    const args = process.argv.slice(2);
+    let binary = null;
+    let seeds = [1, 7, 42];
+    let speed = 5;
+    for (let i = 0; i < args.length; i++) {
+        if (args[i] === "--seeds" && i + 1 < args.length) {
+            seeds = args[++i].split(",").map(Number);
+        } else if (args[i] === "--speed" && i + 1 < args.length) {
+            speed = Number(args[++i]);
+        } else if (!args[i].startsWith("-") && !binary) {
+            binary = args[i];
+        } else {
+            usage();
+        }
+    }
+    if (!binary || seeds.some(s => !Number.isInteger(s) || s < 0) || !(speed >= 1 && speed <= 10)) {
+        usage();
+    }
+
+    const page = loadPageSim();
+    const dir = fs.mkdtempSync(path.join(os.tmpdir(), "game_parity-"));
+    const csv = path.join(dir, "inputs.csv");
+    let same = true;
+    try {
+        for (const seed of seeds) {
+            for (let players = 1; players <= page.MAX_PLAYERS; players++) {
+                const out = childProcess.execFileSync(binary, ["--seed", String(seed), "--speed",
+                    String(speed), "--players", String(players), "--inputs-out", csv], { encoding: "utf8" });
+                const m = out.match(/tick +(\d+) +score +(\d+) +\w+ +hash ([0-9a-f]{8})/);
+                if (!m) throw new Error(`unexpected game_replay output:\n${out}`);
+                const cpp = { tick: Number(m[1]), score: Number(m[2]), hash: parseInt(m[3], 16) };
+                const inputs = fs.readFileSync(csv, "utf8").trim().split("\n").map(line => {
+                    const [tick, lane, speed, player] = line.split(",").map(Number);
+                    return { tick, lane, speed, player };
+                });
+                // game_replay stops a game that nobody loses; stop at the same tick
+                const js = page.replayGame(seed, inputs, cpp.tick);
+                const match = js.tick === cpp.tick && js.score === cpp.score &&
+                    parseInt(js.hash, 16) === cpp.hash;
+                same = same && match;
+                console.log(`seed ${seed}, ${players} player${players === 1 ? " " : "s"}  ` +
+                    `tick ${String(cpp.tick).padStart(6)}  C++ ${m[3]}  page ` +
+                    `${js.hash.padStart(8, "0")}  ${match ? "ok" : "MISMATCH"}`);
+            }
+        }
+    } finally {
+        fs.rmSync(dir, { recursive: true, force: true });
+    }
+    console.log(same ? "page and C++ agree" : "page and C++ differ");
+    process.exit(same ? 0 : 1);
+}
+
+main();
@@ -0,0 +1,238 @@
+// Replays one game (seed plus per-tick inputs) through GameSim while
+// drawing at different frame rates, and checks that every run ends the
+// same: same score, same crash tick, same state hash. This is what lets
+// rendering and face tracking run at whatever rate they manage.
+//
+// Build and run on a PC from the repository root:
+//   g++ -O2 -I. tools/game_replay.cpp game_sim.cpp -o game_replay
+//   ./game_replay                  # built-in autopilot game, seed 1
+//   ./game_replay --players 4      # a party game, one autopilot per car
+//   ./game_replay --seed 42 inputs.csv
+//
+// An input file is CSV, one line per change: tick, lane (0-2), speed
+// (1-10) and optionally the player (0-3, default 0); --inputs-out writes
+// the autopilot's in the same form. The page's replayGame() takes the
+// same seed and changes and must print the same hash
+// (tools/game_parity.js checks it does). Exits 1 if the runs disagree,
+// or if --hash is given and the game ends with a different hash.
+
+#include "game_sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#define MAX_TICKS (GAME_TICK_HZ * 300)
+
+struct InputChange {
+  uint32_t tick;
+  GameInput input;
+  uint8_t player;
+};
+
+struct Outcome {
+  uint32_t tick;
+  uint32_t score;
+  bool crashed;
+  uint32_t hash;
+  uint32_t frames;
+};
+
+// A simple driver per car that dodges whatever is close in its lane, with
+// the odd lapse of attention, recorded tick by tick like the page records
+// a game. Car 0 drives the same with or without company.
+static std::vector<InputChange> autopilotInputs(uint32_t seed, uint8_t speed, uint8_t players) {
+  std::vector<InputChange> changes;
+  GameSim sim(seed, players);
+  uint32_t state[GAME_MAX_PLAYERS];
+  uint32_t lapseUntil[GAME_MAX_PLAYERS] = {};
+  GamePartyInput input = {{1, 1, 1, 1}, speed};
+  for (uint8_t p = 0; p < players; p++) {
+    state[p] = (seed + p * 7919u) * 2654435761u + 1;
+    changes.push_back({0, {1, speed}, p});
+  }
+  while (!sim.crashed() && sim.tick() < MAX_TICKS) {
+    for (uint8_t p = 0; p < players; p++) {
+      if (sim.crashed(p)) {
+        continue;
+      }
+      uint8_t lane = input.lanes[p];
+      state[p] = state[p] * 1664525u + 1013904223u;
+      if ((state[p] >> 16) % 1000 < 2) {
+        lapseUntil[p] = sim.tick() + GAME_TICK_HZ / 2;
+      }
+      if (sim.tick() >= lapseUntil[p]) {
+        bool danger[3] = {false, false, false};
+        for (size_t i = 0; i < sim.obstacleCount(); i++) {
+          Obstacle o = sim.obstacle(i);
+          if (o.y > GAME_PLAYER_Y - 150 && o.y < GAME_PLAYER_Y + GAME_CAR_SIZE) {
+            danger[o.lane] = true;
+          }
+        }
+        if (danger[lane]) {
+          uint8_t order[3] = {1, (uint8_t)((state[p] >> 20) % 2 ? 0 : 2), 0};
+          order[2] = 2 - order[1];
+          for (uint8_t to : order) {
+            if (!danger[to]) {
+              lane = to;
+              break;
+            }
+          }
+        }
+      }
+      if (lane != input.lanes[p]) {
+        input.lanes[p] = lane;
+        changes.push_back({sim.tick(), {lane, speed}, p});
+      }
+    }
+    sim.stepParty(input);
+  }
+  return changes;
+}
+
+static bool loadInputs(const char *path, std::vector<InputChange> *changes) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    fprintf(stderr, "Cannot open %s\n", path);
+    return false;
+  }
+  char line[128];
+  unsigned tick, lane, speed, player;
+  while (fgets(line, sizeof(line), f)) {
+    int fields = sscanf(line, "%u,%u,%u,%u", &tick, &lane, &speed, &player);
+    if (fields == 3) {
+      player = 0;
+    }
+    if (fields >= 3 && lane < 3 && speed >= 1 && speed <= 10 && player < GAME_MAX_PLAYERS) {
+      changes->push_back({tick, {(uint8_t)lane, (uint8_t)speed}, (uint8_t)player});
+    }
+  }
+  fclose(f);
+  return !changes->empty();
+}
+
+static bool saveInputs(const char *path, const std::vector<InputChange> &changes) {
+  FILE *f = fopen(path, "w");
+  if (!f) {
+    fprintf(stderr, "Cannot write %s\n", path);
+    return false;
+  }
+  for (const InputChange &c : changes) {
+    fprintf(f, "%u,%u,%u,%u\n", (unsigned)c.tick, c.input.lane, c.input.speed, c.player);
+  }
+  return fclose(f) == 0;
+}
+
+// Draws "frames" of frameMs (plus jitter, from a fixed sequence) and runs
+// whatever ticks each one is due, like the page's render loop
+static Outcome play(uint32_t seed, uint8_t players, const std::vector<InputChange> &changes,
+                    float frameMs, float jitterMs) {
+  GameSim sim(seed, players);
+  GameClock clock;
+  size_t next = 0;
+  GamePartyInput input = {{1, 1, 1, 1}, changes[0].input.speed};
+  uint32_t frames = 0;
+  uint32_t jitter = 1;
+  while (!sim.crashed() && sim.tick() < MAX_TICKS) {
+    jitter = jitter * 1103515245u + 12345u;
+    float ms = frameMs + jitterMs * (((jitter >> 16) % 2001) / 1000.0f - 1.0f);
+    uint32_t ticks = clock.advance(ms);
+    frames++;
+    for (uint32_t i = 0; i < ticks && !sim.crashed(); i++) {
+      // Inputs belong to ticks, not to frames
+      while (next < changes.size() && changes[next].tick <= sim.tick()) {
+        input.lanes[changes[next].player] = changes[next].input.lane;
+        input.speed = changes[next++].input.speed;
+      }
+      sim.stepParty(input);
+    }
+  }
+  return {sim.tick(), sim.score(), sim.crashed(), sim.hash(), frames};
+}
+
+int main(int argc, char **argv) {
+  uint32_t seed = 1;
+  unsigned speed = 5;
+  unsigned players = 0; // from the input file, or 1
+  const char *path = NULL;
+  const char *inputsOut = NULL;
+  const char *expectHash = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+      seed = strtoul(argv[++i], NULL, 10);
+    } else if (!strcmp(argv[i], "--speed") && i + 1 < argc) {
+      speed = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--players") && i + 1 < argc) {
+      players = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--inputs-out") && i + 1 < argc) {
+      inputsOut = argv[++i];
+    } else if (!strcmp(argv[i], "--hash") && i + 1 < argc) {
+      expectHash = argv[++i];
+    } else if (argv[i][0] != '-') {
+      path = argv[i];
+    } else {
+      fprintf(stderr,
+              "usage: %s [inputs.csv] [--seed n] [--speed 1-10] [--players 1-%d] "
+              "[--inputs-out file.csv] [--hash hex]\n",
+              argv[0], GAME_MAX_PLAYERS);
+      return 2;
+    }
+  }
+  if (players > GAME_MAX_PLAYERS) {
+    fprintf(stderr, "--players is 1-%d\n", GAME_MAX_PLAYERS);
+    return 2;
+  }
+
+  std::vector<InputChange> changes;
+  if (path) {
+    if (!loadInputs(path, &changes)) {
+      return 1;
+    }
+    // Like replayGame(): as many players as the file has inputs for
+    for (const InputChange &c : changes) {
+      players = c.player + 1u > players ? c.player + 1u : players;
+    }
+  } else {
+    players = players ? players : 1;
+    changes = autopilotInputs(seed, speed < 1 ? 1 : (speed > 10 ? 10 : speed), players);
+  }
+  if (inputsOut && !saveInputs(inputsOut, changes)) {
+    return 1;
+  }
+
+  struct Rate {
+    const char *name;
+    float frameMs;
+    float jitterMs;
+  } rates[] = {
+      {"15 fps", 1000.0f / 15, 0},  {"24 fps", 1000.0f / 24, 0},
+      {"30 fps", 1000.0f / 30, 0},  {"60 fps", 1000.0f / 60, 0},
+      {"75 fps", 1000.0f / 75, 0},  {"144 fps", 1000.0f / 144, 0},
+      {"jittery 10-110 ms", 60, 50}, {"stalls 40-300 ms", 170, 130},
+  };
+
+  printf("seed %u, %u player%s, %u input changes\n", (unsigned)seed, players,
+         players == 1 ? "" : "s", (unsigned)changes.size());
+  Outcome first = {};
+  bool same = true;
+  for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+    Outcome o = play(seed, (uint8_t)players, changes, rates[i].frameMs, rates[i].jitterMs);
+    if (i == 0) {
+      first = o;
+    }
+    bool match = o.tick == first.tick && o.score == first.score &&
+                 o.crashed == first.crashed && o.hash == first.hash;
+    same = same && match;
+    printf("%-18s %6u frames  tick %6u  score %6u  %s  hash %08x  %s\n", rates[i].name,
+           (unsigned)o.frames, (unsigned)o.tick, (unsigned)o.score,
+           o.crashed ? "crashed" : "survived", (unsigned)o.hash, match ? "ok" : "MISMATCH");
+  }
+  printf(same ? "identical at every frame rate\n" : "runs differ\n");
+  if (expectHash && strtoul(expectHash, NULL, 16) != first.hash) {
+    printf("hash %08x, expected %s: GameSim has changed\n", (unsigned)first.hash, expectHash);
+    return 1;
+  }
+  return same ? 0 : 1;
+}
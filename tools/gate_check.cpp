@@ -0,0 +1,291 @@
+// Runs synthetic camera sequences through the motion gate (motion_gate.h)
+// the way serviceViewers() sends a stream, and reports how many bytes the
+// gate saved, how many tilt changes a viewer missed because their frame
+// was held back, and whether the quality controller stepped down while
+// nothing was wrong with the link.
+//
+// Frames are rendered by synthetic_camera.h at the grayscale pipeline's
+// 320x240 with sensor noise added, JPEG encoded to size them, and tracked
+// at 160x120. A tilt change is the true angle moving TILT_CHANGE_DEG away
+// from where it was at the last one. One is missed when a run of held
+// frames leaves the viewer with a head TILT_CHANGE_DEG or more away from
+// where it really is (counted once per run). Each sequence is run once as
+// the sketch does it and once without telling the controller about held
+// frames (as before onFrameHeld()), to show what that costs.
+//
+// Build and run on Linux from the repository root:
+//   g++ -O2 -I. tools/gate_check.cpp motion_gate.cpp quality_controller.cpp synthetic_camera.cpp tilt_*.cpp -ljpeg -o gate_check
+//   ./gate_check
+//   ./gate_check --threshold 4 --noise 3 --json --tag "$(git rev-parse --short HEAD)"
+// Exits 1 if a tilt change was missed or the controller stepped down.
+
+#include "motion_gate.h"
+#include "quality_controller.h"
+#include "synthetic_camera.h"
+#include "tilt_estimator.h"
+#include "tools/jpeg_gray.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+// As in the .ino
+#define GATE_THRESHOLD 6
+#define GATE_KEYFRAME_MS 1000
+#define FRAME_MS 40 // SYNTHETIC_FPS 25
+
+#define FRAME_W 320
+#define FRAME_H 240
+#define TRACK_W 160
+#define TRACK_H 120
+#define JPEG_QUALITY 80 // libjpeg scale; about the camera's default of 12
+#define LINK_MBPS 8     // a good link: no reason to step down
+#define TILT_CHANGE_DEG 4.0f
+#define CLIENT_REPORT_MS 1000 // reportClientFps() in index.html
+
+// Levels only need to exist: frames keep their size whatever the level
+static const QualityLevel LADDER[] = {{5, 20}, {6, 15}, {8, 12}};
+#define LADDER_COUNT (sizeof(LADDER) / sizeof(LADDER[0]))
+
+// Small deterministic generator so every run sees the same frames
+static uint32_t rngState = 12345;
+static float uniform() {
+  rngState = rngState * 1664525u + 1013904223u;
+  return (rngState >> 8) / 16777216.0f;
+}
+static float gaussian() {
+  float u = uniform() + 1e-7f;
+  return sqrtf(-2.0f * logf(u)) * cosf(2.0f * (float)M_PI * uniform());
+}
+
+// Holding still for seconds at a time, quick steering between lanes, and a
+// slow drift that only adds up to a change over several seconds
+static std::vector<float> playSequence() {
+  struct Segment {
+    float target;
+    int rampMs;
+    int holdMs;
+  };
+  const Segment script[] = {
+      {0, 0, 4000},     {20, 250, 3000}, {0, 250, 5000}, {-18, 200, 2500},
+      {-12, 1500, 2000}, {0, 300, 6000}, {8, 8000, 3000}, {22, 300, 1500},
+      {0, 250, 4000},
+  };
+  std::vector<float> angles;
+  float angle = 0;
+  for (const Segment &s : script) {
+    float from = angle;
+    for (int t = 0; t < s.rampMs; t += FRAME_MS) {
+      angles.push_back(from + (s.target - from) * t / s.rampMs);
+    }
+    angle = s.target;
+    for (int t = 0; t < s.holdMs; t += FRAME_MS) {
+      angles.push_back(angle);
+    }
+  }
+  return angles;
+}
+
+// What CAMERA_SYNTHETIC streams: never still
+static std::vector<float> sweepSequence() {
+  std::vector<float> angles;
+  for (uint32_t n = 0; n < 4 * SYNTHETIC_SWEEP_FRAMES; n++) {
+    angles.push_back(syntheticAngle(n));
+  }
+  return angles;
+}
+
+struct Frame {
+  float truth;
+  uint32_t jpegBytes;
+  std::vector<uint8_t> track; // TRACK_W x TRACK_H
+};
+
+static std::vector<Frame> renderFrames(const std::vector<float> &angles, float noise) {
+  std::vector<Frame> frames;
+  std::vector<uint8_t> gray(FRAME_W * FRAME_H);
+  for (float angle : angles) {
+    renderSyntheticFace(gray.data(), FRAME_W, FRAME_H, angle);
+    for (uint8_t &p : gray) {
+      int v = p + (int)lroundf(gaussian() * noise);
+      p = v < 0 ? 0 : v > 255 ? 255 : v;
+    }
+    Frame f;
+    f.truth = angle;
+    f.jpegBytes = encodeJpegGray(gray.data(), FRAME_W, FRAME_H, JPEG_QUALITY).size();
+    f.track.resize(TRACK_W * TRACK_H);
+    for (int y = 0; y < TRACK_H; y++) {
+      for (int x = 0; x < TRACK_W; x++) {
+        const uint8_t *p = &gray[(2 * y) * FRAME_W + 2 * x];
+        f.track[y * TRACK_W + x] = (p[0] + p[1] + p[FRAME_W] + p[FRAME_W + 1] + 2) / 4;
+      }
+    }
+    frames.push_back(std::move(f));
+  }
+  return frames;
+}
+
+struct GateResult {
+  uint32_t frames = 0;
+  uint32_t sent = 0;
+  uint32_t keyframes = 0; // sent only because GATE_KEYFRAME_MS was up
+  uint64_t bytesAll = 0;
+  uint64_t bytesSent = 0;
+  uint32_t changes = 0;
+  uint32_t missed = 0; // held runs that fell TILT_CHANGE_DEG behind
+  float worstHeldDeg = 0; // truth of a held frame vs the one the viewer has
+  uint32_t stepDowns = 0;
+  uint32_t stepDownsUnreported = 0; // without onFrameHeld()
+};
+
+// One stream viewer on a fast link; returns the number of step-downs
+static uint32_t runStream(const std::vector<Frame> &frames, uint8_t threshold,
+                          bool reportHeld, GateResult *result) {
+  MotionGate gate(threshold);
+  TiltEstimator estimator;
+  QualityController controller(LADDER, LADDER_COUNT, LADDER_COUNT - 1);
+  controller.setTarget(15, 60);
+
+  uint32_t lastSendMs = 0;
+  float sentTruth = 0, changeRef = 0;
+  uint32_t clientFrames = 0, clientSince = 0;
+  uint32_t stepDowns = 0;
+  bool behind = false; // this run of held frames already counted as a miss
+  for (size_t i = 0; i < frames.size(); i++) {
+    const Frame &f = frames[i];
+    uint32_t nowMs = 1000 + i * FRAME_MS;
+    TiltResult tilt = estimator.estimate(f.track.data(), TRACK_W, TRACK_H, TRACK_W);
+    bool changed = gate.update(f.track.data(), TRACK_W, TRACK_H, TRACK_W, tilt);
+    bool send = changed || i == 0 || nowMs - lastSendMs >= GATE_KEYFRAME_MS;
+
+    bool change = fabsf(f.truth - changeRef) >= TILT_CHANGE_DEG;
+    if (change) {
+      changeRef = f.truth;
+    }
+    if (result) {
+      result->frames++;
+      result->bytesAll += f.jpegBytes;
+      result->changes += change;
+    }
+
+    if (send) {
+      uint32_t sendMicros = f.jpegBytes * 8 / LINK_MBPS;
+      controller.onFrameSent(f.jpegBytes, sendMicros);
+      lastSendMs = nowMs;
+      sentTruth = f.truth;
+      behind = false;
+      // The page counts frames as they arrive and reports once a second
+      uint32_t arriveMs = nowMs + sendMicros / 1000;
+      if (clientSince == 0) {
+        clientSince = arriveMs;
+      }
+      clientFrames++;
+      if (arriveMs - clientSince >= CLIENT_REPORT_MS) {
+        controller.onClientFps(clientFrames * 1000.0f / (arriveMs - clientSince), arriveMs);
+        clientFrames = 0;
+        clientSince = arriveMs;
+      }
+      if (result) {
+        result->sent++;
+        result->keyframes += !changed && i != 0;
+        result->bytesSent += f.jpegBytes;
+      }
+    } else {
+      if (reportHeld) {
+        controller.onFrameHeld(nowMs);
+      }
+      if (result) {
+        float err = fabsf(f.truth - sentTruth);
+        result->worstHeldDeg = err > result->worstHeldDeg ? err : result->worstHeldDeg;
+        if (err >= TILT_CHANGE_DEG && !behind) {
+          behind = true;
+          result->missed++;
+        }
+      }
+    }
+
+    size_t level = controller.level();
+    if (controller.update(nowMs) && controller.level() < level) {
+      stepDowns++;
+    }
+  }
+  return stepDowns;
+}
+
+static GateResult check(const std::vector<Frame> &frames, uint8_t threshold) {
+  GateResult result;
+  result.stepDowns = runStream(frames, threshold, true, &result);
+  result.stepDownsUnreported = runStream(frames, threshold, false, NULL);
+  return result;
+}
+
+int main(int argc, char **argv) {
+  int threshold = GATE_THRESHOLD;
+  float noise = 2.0f;
+  bool json = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--threshold") && i + 1 < argc) {
+      threshold = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--noise") && i + 1 < argc) {
+      noise = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else {
+      fprintf(stderr, "usage: %s [--threshold gray levels] [--noise sigma] [--tag name] [--json]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+  if (threshold < 1 || threshold > 255) {
+    fprintf(stderr, "--threshold must be 1..255\n");
+    return 2;
+  }
+
+  struct Sequence {
+    const char *name;
+    std::vector<float> angles;
+  };
+  const Sequence sequences[] = {{"play", playSequence()}, {"sweep", sweepSequence()}};
+
+  bool ok = true;
+  if (json) {
+    printf("{\"tag\":\"%s\",\"threshold\":%d,\"noise\":%.1f,\"sequences\":[", tag, threshold,
+           noise);
+  } else {
+    printf("gate threshold %d, sensor noise %.1f, tilt change %.0f deg, keyframe %d ms\n",
+           threshold, noise, TILT_CHANGE_DEG, GATE_KEYFRAME_MS);
+    printf("sequence  frames   sent  keyframes  bytes saved  changes  missed  worst held  "
+           "step-downs (unreported)\n");
+  }
+  for (size_t s = 0; s < sizeof(sequences) / sizeof(sequences[0]); s++) {
+    std::vector<Frame> frames = renderFrames(sequences[s].angles, noise);
+    GateResult r = check(frames, threshold);
+    double saved = r.bytesAll ? 100.0 * (r.bytesAll - r.bytesSent) / r.bytesAll : 0;
+    ok = ok && r.missed == 0 && r.stepDowns == 0;
+    if (json) {
+      printf("%s{\"name\":\"%s\",\"frames\":%u,\"sent\":%u,\"keyframes\":%u,\"bytes\":%llu,"
+             "\"bytes_sent\":%llu,\"saved_pct\":%.1f,\"changes\":%u,\"missed\":%u,"
+             "\"worst_held_deg\":%.2f,\"step_downs\":%u,\"step_downs_unreported\":%u}",
+             s ? "," : "", sequences[s].name, r.frames, r.sent, r.keyframes,
+             (unsigned long long)r.bytesAll, (unsigned long long)r.bytesSent, saved, r.changes,
+             r.missed, r.worstHeldDeg, r.stepDowns, r.stepDownsUnreported);
+    } else {
+      printf("%-8s  %6u  %5u  %9u  %6.0f KB %3.0f%%  %7u  %6u  %6.2f deg  %10u (%u)\n",
+             sequences[s].name, r.frames, r.sent, r.keyframes,
+             (r.bytesAll - r.bytesSent) / 1024.0, saved, r.changes, r.missed, r.worstHeldDeg,
+             r.stepDowns, r.stepDownsUnreported);
+    }
+  }
+  if (json) {
+    printf("],\"ok\":%s}\n", ok ? "true" : "false");
+  } else {
+    printf("%s\n", ok ? "OK" : "FAIL");
+  }
+  return ok ? 0 : 1;
+}
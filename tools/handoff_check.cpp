@@ -0,0 +1,263 @@
+// Stress test for the camera handoff as the sketch really runs it: the
+// host build (see HOST BUILD in README.txt) with captureTask, trackTask
+// and httpTask on std::threads, publishing every camera buffer through
+// LatestFrame to /capture and /stream viewers. tools/latest_frame_bench.cpp
+// tests LatestFrame alone; this one covers what the sketch does around it
+// (pinning for a viewer, sending from the pinned buffer, giving it back).
+//
+// The host build replays fake frames (tools/fake_frames.h) at a high rate,
+// and its camera stamps every JPEG with the capture's number and aborts if
+// a buffer is handed back twice or was never lent (tools/host/host_camera.cpp).
+// --captures threads poll /capture and --streams threads read /stream
+// meanwhile, and every frame they get is checked byte for byte against
+// the file its stamp says it came from. Fails if
+//   - a frame differs from its file (the buffer was refilled or given
+//     back while it was being sent: a torn frame),
+//   - one X-Frame-Seq arrives with two different captures behind it,
+//   - seq goes backwards for a client, or repeats on a stream,
+//   - a request fails, or the host build dies (a double return aborts it).
+// A 503 while every viewer slot is taken is expected, and only counted.
+//
+// Build and run on Linux from the repository root (build/headtilt_host
+// comes from the CMake build):
+//   g++ -O2 -pthread -I. tools/handoff_check.cpp synthetic_camera.cpp -ljpeg -o handoff_check
+//   ./handoff_check build/headtilt_host
+//   ./handoff_check build/headtilt_host --captures 8 --streams 3 --fps 400 --seconds 10 --json
+
+#include "tools/fake_frames.h"
+#include "tools/http_client.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#define READ_TIMEOUT_MS 5000
+#define FAKE_FRAMES 16
+#define FAKE_WIDTH 320
+#define FAKE_HEIGHT 240
+#define FAKE_QUALITY 76
+#define HOST_FRAME_STAMP "host frame " // as tools/host/esp_camera.h
+
+static std::vector<std::vector<uint8_t>> fakeJpegs;
+
+static std::atomic<uint64_t> checked{0};
+static std::atomic<uint32_t> torn{0};
+static std::atomic<uint32_t> mismatched{0};
+static std::atomic<uint32_t> backwards{0};
+static std::atomic<uint32_t> repeats{0};
+static std::atomic<uint32_t> errors{0};
+static std::atomic<uint32_t> busy{0};
+static std::atomic<uint32_t> lastCapture{0};
+
+static std::mutex seqLock;
+static std::unordered_map<uint32_t, uint32_t> captureOfSeq;
+
+// The capture number from the stamp, and whether the rest of the body is
+// exactly that capture's file
+static bool checkFrame(const std::string &body, uint32_t *capture) {
+  const uint8_t *b = (const uint8_t *)body.data();
+  size_t stampLen = sizeof(HOST_FRAME_STAMP) - 1;
+  if (body.size() < 6 || b[0] != 0xFF || b[1] != 0xD8 || b[2] != 0xFF || b[3] != 0xFE) {
+    return false;
+  }
+  size_t segment = (b[4] << 8) | b[5];
+  if (segment < 2 + stampLen || body.size() < 4 + segment ||
+      body.compare(6, stampLen, HOST_FRAME_STAMP) != 0) {
+    return false;
+  }
+  *capture = strtoul(body.substr(6 + stampLen, segment - 2 - stampLen).c_str(), nullptr, 10);
+  const std::vector<uint8_t> &file = fakeJpegs[*capture % fakeJpegs.size()];
+  size_t rest = body.size() - 4 - segment;
+  return rest == file.size() - 2 && !memcmp(b + 4 + segment, file.data() + 2, rest);
+}
+
+// A whole frame is checked against its file and against what other
+// clients saw for the same seq
+static void recordFrame(const std::string &body, uint32_t seq) {
+  checked++;
+  uint32_t capture;
+  if (!checkFrame(body, &capture)) {
+    torn++;
+    return;
+  }
+  uint32_t last = lastCapture.load();
+  while (capture > last && !lastCapture.compare_exchange_weak(last, capture)) {
+  }
+  std::lock_guard<std::mutex> lock(seqLock);
+  auto seen = captureOfSeq.emplace(seq, capture);
+  if (!seen.second && seen.first->second != capture) {
+    mismatched++;
+  }
+}
+
+// ==========================================
+// CLIENTS
+// ==========================================
+static void captureClient(const char *host, int port, double endMs) {
+  uint32_t lastSeq = 0;
+  std::vector<std::string> headers;
+  std::string body;
+  while (httpNowMs() < endMs) {
+    HttpConn conn;
+    int status = conn.get(host, port, "/capture", READ_TIMEOUT_MS) ? conn.readHead(&headers) : 0;
+    size_t length = strtoul(httpHeader(headers, "Content-Length").c_str(), nullptr, 10);
+    if (status == 503) {
+      busy++;
+      continue;
+    }
+    if (status != 200 || !conn.read(length, &body)) {
+      errors++;
+      continue;
+    }
+    uint32_t seq = strtoul(httpHeader(headers, "X-Frame-Seq").c_str(), nullptr, 10);
+    if (seq < lastSeq) {
+      backwards++;
+    }
+    lastSeq = seq;
+    recordFrame(body, seq);
+  }
+}
+
+static void streamClient(const char *host, int port, double endMs) {
+  while (httpNowMs() < endMs) {
+    HttpConn conn;
+    std::vector<std::string> headers;
+    int status = conn.get(host, port, "/stream", READ_TIMEOUT_MS) ? conn.readHead(&headers) : 0;
+    if (status == 503) {
+      busy++;
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      continue;
+    }
+    if (status != 200) {
+      errors++;
+      continue;
+    }
+
+    uint32_t lastSeq = 0;
+    std::string line, body;
+    while (httpNowMs() < endMs) {
+      while (conn.readLine(&line) && line.empty()) {
+      }
+      std::vector<std::string> part;
+      bool boundary = line == "--frame";
+      while (boundary && conn.readLine(&line) && !line.empty()) {
+        part.push_back(line);
+      }
+      size_t length = strtoul(httpHeader(part, "Content-Length").c_str(), nullptr, 10);
+      if (!boundary || !line.empty() || !conn.read(length, &body)) {
+        errors++;
+        break;
+      }
+      uint32_t seq = strtoul(httpHeader(part, "X-Frame-Seq").c_str(), nullptr, 10);
+      if (seq == lastSeq) {
+        repeats++;
+      } else if (seq < lastSeq) {
+        backwards++;
+      }
+      lastSeq = seq;
+      recordFrame(body, seq);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  const char *binary = nullptr;
+  int portOffset = 9700;
+  int captures = 4;
+  int streams = 2;
+  double fps = 250;
+  double seconds = 3;
+  bool json = false;
+  bool usage = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--port-offset") && i + 1 < argc) {
+      portOffset = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--captures") && i + 1 < argc) {
+      captures = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--streams") && i + 1 < argc) {
+      streams = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--fps") && i + 1 < argc) {
+      fps = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--seconds") && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else if (argv[i][0] != '-' && !binary) {
+      binary = argv[i];
+    } else {
+      usage = true;
+    }
+  }
+  if (usage || !binary || captures < 0 || streams < 0 || captures + streams == 0 || fps <= 0 ||
+      seconds <= 0) {
+    fprintf(stderr,
+            "usage: %s <headtilt_host> [--port-offset n] [--captures n] [--streams n] [--fps n] "
+            "[--seconds n] [--tag name] [--json]\n",
+            argv[0]);
+    return 2;
+  }
+
+  std::string folder = writeFakeFrames(FAKE_FRAMES, FAKE_WIDTH, FAKE_HEIGHT, FAKE_QUALITY,
+                                       &fakeJpegs);
+  if (folder.empty()) {
+    fprintf(stderr, "cannot write the fake frames under /tmp\n");
+    return 1;
+  }
+  char fpsArg[16];
+  snprintf(fpsArg, sizeof(fpsArg), "%g", fps);
+  pid_t pid = startHostBuild(binary, portOffset, {"--frames", folder, "--fps", fpsArg});
+  if (pid < 0) {
+    removeFakeFrames(folder, FAKE_FRAMES);
+    return 1;
+  }
+
+  const char *host = "127.0.0.1";
+  int port = 80 + portOffset;
+  double endMs = httpNowMs() + seconds * 1000;
+  std::vector<std::thread> clients;
+  for (int i = 0; i < captures; i++) {
+    clients.emplace_back(captureClient, host, port, endMs);
+  }
+  for (int i = 0; i < streams; i++) {
+    clients.emplace_back(streamClient, host, port, endMs);
+  }
+  for (std::thread &t : clients) {
+    t.join();
+  }
+  bool alive = stopHostBuild(pid);
+  removeFakeFrames(folder, FAKE_FRAMES);
+
+  bool ok = alive && checked > 0 && torn == 0 && mismatched == 0 && backwards == 0 &&
+            repeats == 0 && errors == 0;
+  if (json) {
+    printf("{\"tag\":\"%s\",\"captures\":%d,\"streams\":%d,\"camera_fps\":%.1f,\"seconds\":%.1f,"
+           "\"camera_frames\":%u,\"checked\":%llu,\"torn\":%u,\"mismatched\":%u,"
+           "\"backwards\":%u,\"repeats\":%u,\"errors\":%u,\"busy\":%u,\"host_alive\":%s,"
+           "\"ok\":%s}\n",
+           tag, captures, streams, fps, seconds, lastCapture.load() + 1,
+           (unsigned long long)checked.load(), torn.load(), mismatched.load(), backwards.load(),
+           repeats.load(), errors.load(), busy.load(), alive ? "true" : "false",
+           ok ? "true" : "false");
+  } else {
+    printf("%s: %d /capture and %d /stream clients, camera at %.0f fps for %.0f s\n", binary,
+           captures, streams, fps, seconds);
+    printf("  %llu frames checked, up to capture %u; %u answers of 503 (all viewers busy)\n",
+           (unsigned long long)checked.load(), lastCapture.load(), busy.load());
+    printf("  torn %u, seq with two captures %u, seq backwards %u, stream repeats %u, "
+           "failed requests %u, host build %s\n",
+           torn.load(), mismatched.load(), backwards.load(), repeats.load(), errors.load(),
+           alive ? "ran to the end" : "died");
+    printf("%s\n", ok ? "OK" : "FAIL");
+  }
+  return ok ? 0 : 1;
+}
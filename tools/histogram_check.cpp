@@ -0,0 +1,329 @@
+// Checks the /metrics histogram (latency_histogram.h): how far a reported
+// value can be from the value recorded, that percentiles come from the
+// right rank, and that record() from several threads at once loses
+// nothing. Also times record(), which the sketch calls on every frame.
+//
+//   - Bucket error: one value at a time (every value below 65536, values
+//     around every power of two, random values in every octave, and the
+//     largest) must come back within 25%, and exactly below 4.
+//   - Percentile ranks: uniform, long-tailed and two-peaked samples; each
+//     percentile must be within 25% of the exact nearest-rank value, p=1
+//     must be the exact max, and percentiles must not fall as p grows.
+//   - Concurrent record(): --threads threads record the same values a
+//     single thread records into another histogram, while a reader keeps
+//     asking for percentiles. Counts, max and every percentile must match
+//     once they are done.
+//
+// Build and run on Linux from the repository root:
+//   g++ -O2 -pthread -I. tools/histogram_check.cpp -o histogram_check
+//   ./histogram_check
+//   ./histogram_check --threads 8 --values 2000000 --json --tag "$(git rev-parse --short HEAD)"
+// Exits 1 if a check failed.
+
+#include "latency_histogram.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#define MAX_ERROR 0.25
+
+static uint32_t failures = 0;
+
+static void expect(bool ok, const char *what, double value, double got) {
+  if (!ok) {
+    if (failures < 10) {
+      fprintf(stderr, "  %s: %.0f came back as %.0f\n", what, value, got);
+    }
+    failures++;
+  }
+}
+
+// Small deterministic generator so every run sees the same values
+static uint32_t rngState = 12345;
+static uint32_t random32() {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+// ==========================================
+// BUCKET ERROR
+// ==========================================
+struct BucketResult {
+  uint32_t values = 0;
+  double worst = 0; // relative error
+  uint32_t worstValue = 0;
+};
+
+// A histogram holding value and something far larger, so the reported
+// value is the bucket's own and not capped at the max
+static void checkValue(LatencyHistogram *h, uint32_t value, BucketResult *r) {
+  h->reset();
+  h->record(value);
+  h->record(UINT32_MAX);
+  uint32_t got = h->percentile(0.5f);
+  double error = value ? fabs((double)got - value) / value : got;
+  if (value < HISTOGRAM_SUB_BUCKETS) {
+    expect(got == value, "small value", value, got);
+  } else {
+    expect(error <= MAX_ERROR, "bucket error over 25%", value, got);
+  }
+  if (error > r->worst) {
+    r->worst = error;
+    r->worstValue = value;
+  }
+  r->values++;
+}
+
+static BucketResult bucketError() {
+  static LatencyHistogram h;
+  BucketResult r;
+  for (uint32_t v = 0; v < 65536; v++) {
+    checkValue(&h, v, &r);
+  }
+  for (int bit = 16; bit < 32; bit++) {
+    for (int d = -64; d <= 64; d++) {
+      checkValue(&h, (uint32_t)((1ull << bit) + d), &r);
+    }
+    for (int i = 0; i < 2000; i++) {
+      checkValue(&h, (uint32_t)(1ull << bit) | (random32() & (uint32_t)((1ull << bit) - 1)), &r);
+    }
+  }
+  checkValue(&h, UINT32_MAX, &r);
+  return r;
+}
+
+// ==========================================
+// PERCENTILE RANKS
+// ==========================================
+static const float PERCENTILES[] = {0, 0.01f, 0.1f, 0.25f, 0.5f, 0.75f, 0.9f, 0.95f, 0.99f,
+                                    0.999f, 1};
+#define PERCENTILE_COUNT (sizeof(PERCENTILES) / sizeof(PERCENTILES[0]))
+
+struct Distribution {
+  const char *name;
+  uint32_t (*next)();
+};
+
+static uint32_t uniformMicros() { return 100 + random32() % 5000; }
+// Mostly fast with an exponential tail, like send times on WiFi
+static uint32_t tailMicros() {
+  double u = (random32() + 1.0) / 4294967297.0;
+  return 800 + (uint32_t)(-log(u) * 3000);
+}
+// Two kinds of frame: full frames and face crops
+static uint32_t twoPeakBytes() {
+  return random32() % 4 ? 4000 + random32() % 1500 : 30000 + random32() % 8000;
+}
+
+struct RankResult {
+  const char *name;
+  uint32_t values;
+  uint32_t exact[PERCENTILE_COUNT];
+  uint32_t estimate[PERCENTILE_COUNT];
+};
+
+// Nearest rank, as percentile() counts it
+static uint32_t exactPercentile(const std::vector<uint32_t> &sorted, float p) {
+  size_t rank = (size_t)(p * sorted.size() + 0.5f);
+  return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+static RankResult percentileRanks(const Distribution &d, uint32_t count) {
+  static LatencyHistogram h;
+  h.reset();
+  RankResult r = {d.name, count, {}, {}};
+  expect(h.percentile(0.5f) == 0, "empty histogram", 0, h.percentile(0.5f));
+  std::vector<uint32_t> values(count);
+  for (uint32_t &v : values) {
+    v = d.next();
+    h.record(v);
+  }
+  std::sort(values.begin(), values.end());
+  expect(h.count() == count, "count", count, h.count());
+  expect(h.max() == values.back(), "max", values.back(), h.max());
+  for (size_t i = 0; i < PERCENTILE_COUNT; i++) {
+    r.exact[i] = exactPercentile(values, PERCENTILES[i]);
+    r.estimate[i] = h.percentile(PERCENTILES[i]);
+    expect(fabs((double)r.estimate[i] - r.exact[i]) <= MAX_ERROR * r.exact[i], d.name,
+           r.exact[i], r.estimate[i]);
+  }
+  expect(r.estimate[PERCENTILE_COUNT - 1] == values.back(), "p100 is not the max", values.back(),
+         r.estimate[PERCENTILE_COUNT - 1]);
+  uint32_t last = 0;
+  for (int i = 0; i <= 1000; i++) {
+    uint32_t v = h.percentile(i / 1000.0f);
+    expect(v >= last, "percentile falls as p grows", last, v);
+    last = v;
+  }
+  return r;
+}
+
+// ==========================================
+// CONCURRENT RECORD
+// ==========================================
+struct ConcurrentResult {
+  int threads;
+  uint32_t values;
+  uint32_t mismatches = 0;
+  uint32_t reads = 0;    // percentile() calls while recording
+  double nsSingle = 0;   // per record(), one thread
+  double nsContended = 0; // per record(), all threads on one histogram
+};
+
+static ConcurrentResult concurrentRecord(int threads, uint32_t perThread) {
+  static LatencyHistogram shared, serial;
+  shared.reset();
+  serial.reset();
+  ConcurrentResult r = {threads, perThread * threads};
+
+  // Each thread gets its own slice; one of them holds the max
+  std::vector<std::vector<uint32_t>> slices(threads);
+  for (std::vector<uint32_t> &slice : slices) {
+    slice.resize(perThread);
+    for (uint32_t &v : slice) {
+      v = tailMicros();
+    }
+  }
+  slices[threads - 1][perThread / 2] = 0x7fffffff;
+
+  auto start = std::chrono::steady_clock::now();
+  for (const std::vector<uint32_t> &slice : slices) {
+    for (uint32_t v : slice) {
+      serial.record(v);
+    }
+  }
+  r.nsSingle = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+                   .count() /
+               r.values;
+
+  std::atomic<int> ready{0};
+  std::atomic<bool> done{false};
+  uint32_t readerBad = 0;
+  std::thread reader([&] {
+    uint32_t lastCount = 0;
+    while (!done.load()) {
+      // Only what holds without a consistent snapshot: nothing recorded
+      // goes away, and nothing reported is above what was recorded
+      uint32_t count = shared.count();
+      uint32_t p99 = shared.percentile(0.99f);
+      if (count < lastCount || p99 > 0x7fffffff) {
+        readerBad++;
+      }
+      lastCount = count;
+      r.reads++;
+    }
+  });
+  std::vector<std::thread> writers;
+  for (int t = 0; t < threads; t++) {
+    writers.emplace_back([&, t] {
+      ready++;
+      while (ready.load() < threads) {
+      }
+      for (uint32_t v : slices[t]) {
+        shared.record(v);
+      }
+    });
+  }
+  start = std::chrono::steady_clock::now();
+  for (std::thread &w : writers) {
+    w.join();
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+                  .count();
+  done = true;
+  reader.join();
+  // Wall time per record() per thread, so it compares with nsSingle
+  r.nsContended = ns * threads / r.values;
+
+  r.mismatches += shared.count() != serial.count();
+  r.mismatches += shared.max() != serial.max();
+  for (int i = 0; i <= 1000; i++) {
+    r.mismatches += shared.percentile(i / 1000.0f) != serial.percentile(i / 1000.0f);
+  }
+  r.mismatches += readerBad;
+  expect(r.mismatches == 0, "concurrent record() differs from one thread's", serial.count(),
+         shared.count());
+  return r;
+}
+
+int main(int argc, char **argv) {
+  int threads = 4;
+  uint32_t values = 1000000;
+  bool json = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+      threads = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--values") && i + 1 < argc) {
+      values = strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else {
+      threads = 0;
+      break;
+    }
+  }
+  if (threads < 1 || values < (uint32_t)threads) {
+    fprintf(stderr, "usage: %s [--threads n] [--values n] [--tag name] [--json]\n", argv[0]);
+    return 2;
+  }
+
+  BucketResult buckets = bucketError();
+  const Distribution distributions[] = {
+      {"uniform us", uniformMicros}, {"long tail us", tailMicros}, {"two peaks bytes", twoPeakBytes}};
+  std::vector<RankResult> ranks;
+  for (const Distribution &d : distributions) {
+    ranks.push_back(percentileRanks(d, 100000));
+  }
+  ConcurrentResult concurrent = concurrentRecord(threads, values / threads);
+  bool ok = failures == 0;
+
+  if (json) {
+    printf("{\"tag\":\"%s\",\"bucket_values\":%u,\"worst_error\":%.4f,\"worst_value\":%u,"
+           "\"percentiles\":[",
+           tag, buckets.values, buckets.worst, buckets.worstValue);
+    for (size_t d = 0; d < ranks.size(); d++) {
+      printf("%s{\"name\":\"%s\"", d ? "," : "", ranks[d].name);
+      for (size_t i = 0; i < PERCENTILE_COUNT; i++) {
+        printf(",\"p%g\":[%u,%u]", PERCENTILES[i] * 100, ranks[d].exact[i], ranks[d].estimate[i]);
+      }
+      printf("}");
+    }
+    printf("],\"concurrent\":{\"threads\":%d,\"values\":%u,\"reads\":%u,\"mismatches\":%u,"
+           "\"ns_per_record\":%.2f,\"ns_per_record_contended\":%.2f},\"failures\":%u,"
+           "\"ok\":%s}\n",
+           concurrent.threads, concurrent.values, concurrent.reads, concurrent.mismatches,
+           concurrent.nsSingle, concurrent.nsContended, failures, ok ? "true" : "false");
+  } else {
+    printf("bucket error: %u values, worst %.1f%% (at %u)\n", buckets.values,
+           buckets.worst * 100, buckets.worstValue);
+    printf("percentiles, exact / reported:\n");
+    for (const RankResult &r : ranks) {
+      printf("  %-16s", r.name);
+      for (size_t i = 0; i < PERCENTILE_COUNT; i++) {
+        if (PERCENTILES[i] >= 0.5f) {
+          printf("  p%g %u/%u", PERCENTILES[i] * 100, r.exact[i], r.estimate[i]);
+        }
+      }
+      printf("\n");
+    }
+    printf("concurrent: %d threads, %u values, %u percentile reads meanwhile, %u mismatches\n",
+           concurrent.threads, concurrent.values, concurrent.reads, concurrent.mismatches);
+    printf("record(): %.1f ns alone, %.1f ns with %d threads on one histogram\n",
+           concurrent.nsSingle, concurrent.nsContended, concurrent.threads);
+    printf("%s\n", ok ? "OK" : "FAIL");
+  }
+  return ok ? 0 : 1;
+}
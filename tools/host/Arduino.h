@@ -0,0 +1,120 @@
+#pragma once
+
+// Host build stand-in for the Arduino core: just what the sketch uses,
+// on top of the C++ standard library (see HOST BUILD in README.txt).
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+typedef uint8_t byte;
+#define PROGMEM
+#define PGM_P const char *
+#define F(x) x
+
+class String {
+public:
+  String() {}
+  String(const char *s) : s_(s ? s : "") {}
+  String(const char *s, size_t length) : s_(s, length) {}
+  String(const std::string &s) : s_(s) {}
+  String(int v) : s_(std::to_string(v)) {}
+  String(unsigned v) : s_(std::to_string(v)) {}
+  String(long v) : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+
+  const char *c_str() const { return s_.c_str(); }
+  size_t length() const { return s_.size(); }
+  bool isEmpty() const { return s_.empty(); }
+  void reserve(size_t size) { s_.reserve(size); }
+  long toInt() const { return atol(s_.c_str()); }
+  float toFloat() const { return atof(s_.c_str()); }
+  bool startsWith(const char *prefix) const { return s_.compare(0, strlen(prefix), prefix) == 0; }
+
+  String &operator+=(const String &o) {
+    s_ += o.s_;
+    return *this;
+  }
+  String &operator+=(const char *o) {
+    s_ += o;
+    return *this;
+  }
+  String &operator+=(char c) {
+    s_ += c;
+    return *this;
+  }
+  String operator+(const String &o) const { return String(s_ + o.s_); }
+  bool operator==(const String &o) const { return s_ == o.s_; }
+  bool operator==(const char *o) const { return s_ == o; }
+  bool operator!=(const String &o) const { return s_ != o.s_; }
+  bool operator!=(const char *o) const { return s_ != o; }
+
+private:
+  std::string s_;
+};
+
+inline String operator+(const char *a, const String &b) {
+  return String(a) + b;
+}
+
+class IPAddress {
+public:
+  IPAddress(uint32_t address = 0) : address_(address) {} // network order
+  String toString() const;
+
+private:
+  uint32_t address_;
+};
+
+// Serial goes to stdout
+class HardwareSerial {
+public:
+  void begin(unsigned long) {}
+  void setDebugOutput(bool) {}
+  int printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  void print(const char *s) { fputs(s, stdout); }
+  void print(const String &s) { print(s.c_str()); }
+  void print(const IPAddress &ip) { print(ip.toString()); }
+  void print(long v) { printf("%ld", v); }
+  void println() { print("\n"); }
+  template <typename T> void println(const T &v) {
+    print(v);
+    println();
+  }
+};
+extern HardwareSerial Serial;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+// The host has "PSRAM": the sketch then sizes everything as on a board
+// with it
+bool psramFound();
+void *ps_malloc(size_t size);
+
+class EspClass {
+public:
+  uint32_t getCycleCount(); // micros() at getCpuFreqMHz()
+  uint32_t getCpuFreqMHz() { return 240; }
+  uint32_t getHeapSize();
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getPsramSize();
+  uint32_t getFreePsram();
+  uint32_t getMinFreePsram();
+};
+extern EspClass ESP;
@@ -0,0 +1,74 @@
+#pragma once
+
+// Host build stand-in for the ESP32 WebServer, over a TCP socket. Same
+// model: handleClient() accepts at most one connection per call, reads its
+// request, runs the handler and closes the connection unless the handler
+// kept a copy of client(). Responses are HTTP/1.1 with Connection: close.
+
+#include "WiFi.h"
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_DELETE, HTTP_OPTIONS };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+// Ports are the sketch's plus this, so the host build can run without root
+// (headtilt_host --port-offset)
+extern int hostPortOffset;
+
+class WebServer {
+public:
+  typedef std::function<void()> THandlerFunction;
+
+  explicit WebServer(int port = 80) : port_(port) {}
+
+  void begin();
+  void handleClient();
+  void on(const char *uri, THandlerFunction handler);
+  void on(const char *uri, HTTPMethod method, THandlerFunction handler);
+  void onNotFound(THandlerFunction handler) { notFound_ = handler; }
+  void collectHeaders(const char *headerKeys[], size_t count);
+
+  String uri() const { return String(uri_); }
+  HTTPMethod method() const { return method_; }
+  bool hasArg(const char *name) const;
+  String arg(const char *name) const;
+  String header(const char *name) const;
+  String header(int i) const;
+  WiFiClient client() { return client_; }
+
+  void sendHeader(const String &name, const String &value, bool first = false);
+  void setContentLength(size_t length) { contentLength_ = length; }
+  void send(int code, const char *contentType = NULL, const String &content = String());
+  void sendContent(const char *data, size_t length);
+  void sendContent(const String &content) { sendContent(content.c_str(), content.length()); }
+
+private:
+  struct Route {
+    std::string uri;
+    HTTPMethod method;
+    THandlerFunction handler;
+  };
+
+  bool readRequest();
+  void writeAll(const char *data, size_t length);
+
+  int port_;
+  int listenFd_ = -1;
+  std::vector<Route> routes_;
+  THandlerFunction notFound_;
+  std::vector<std::string> headerKeys_;
+
+  // Current request
+  WiFiClient client_;
+  HTTPMethod method_ = HTTP_GET;
+  std::string uri_;
+  std::vector<std::pair<std::string, std::string>> args_;
+  std::vector<std::string> headerValues_; // one per headerKeys_
+  std::string responseHeaders_;
+  size_t contentLength_ = CONTENT_LENGTH_UNKNOWN;
+};
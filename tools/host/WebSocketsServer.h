@@ -0,0 +1,35 @@
+#pragma once
+
+// Host build stand-in for arduinoWebSockets' server: accepts no
+// connections, so the control channel (port 81) is not served and the
+// page falls back to polling /tilt. Everything on port 80 works.
+
+#include "Arduino.h"
+
+#include <functional>
+
+typedef enum {
+  WStype_ERROR,
+  WStype_DISCONNECTED,
+  WStype_CONNECTED,
+  WStype_TEXT,
+  WStype_BIN,
+  WStype_FRAGMENT_TEXT_START,
+  WStype_FRAGMENT_BIN_START,
+  WStype_FRAGMENT,
+  WStype_FRAGMENT_FIN,
+  WStype_PING,
+  WStype_PONG,
+} WStype_t;
+
+class WebSocketsServer {
+public:
+  typedef std::function<void(uint8_t num, WStype_t type, uint8_t *payload, size_t length)>
+      WebSocketServerEvent;
+
+  explicit WebSocketsServer(uint16_t port) {}
+  void begin() {}
+  void loop() {}
+  void onEvent(WebSocketServerEvent event) {}
+  bool broadcastBIN(const uint8_t *payload, size_t length) { return false; }
+};
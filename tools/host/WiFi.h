@@ -0,0 +1,39 @@
+#pragma once
+
+// Host build stand-in for WiFi: the station is "connected" from the start
+// and WiFiClient is a TCP socket, closed when the last copy lets go of it
+// or on stop(), like the ESP32's.
+
+#include "Arduino.h"
+
+#include <memory>
+
+#define WIFI_STA 1
+#define WL_CONNECTED 3
+
+class WiFiClass {
+public:
+  void mode(int) {}
+  void begin(const char *, const char *) {}
+  int status() { return WL_CONNECTED; }
+  IPAddress localIP();
+};
+extern WiFiClass WiFi;
+
+class WiFiClient {
+public:
+  WiFiClient() {}
+  explicit WiFiClient(int fd);
+
+  int fd() const;
+  // Until the peer closes its end or the socket fails
+  bool connected();
+  size_t write(const uint8_t *data, size_t length);
+  size_t write(const char *data, size_t length) { return write((const uint8_t *)data, length); }
+  void stop();
+  operator bool() { return connected(); }
+
+private:
+  struct Socket;
+  std::shared_ptr<Socket> socket_;
+};
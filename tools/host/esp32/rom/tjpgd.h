@@ -0,0 +1,39 @@
+#pragma once
+
+// Host build stand-in for the ROM's TJpgDec, on libjpeg. jd_prepare()
+// reads the whole stream through the input function; jd_decomp() hands
+// the image to the output function in RGB888 blocks of up to 16 rows.
+// The work area is not used.
+
+#include <stdint.h>
+
+typedef unsigned int UINT;
+typedef unsigned char BYTE;
+typedef uint16_t WORD;
+
+typedef enum {
+  JDR_OK = 0,
+  JDR_INTR,
+  JDR_INP,
+  JDR_MEM1,
+  JDR_MEM2,
+  JDR_PAR,
+  JDR_FMT1,
+  JDR_FMT2,
+  JDR_FMT3
+} JRESULT;
+
+typedef struct {
+  WORD left, right, top, bottom;
+} JRECT;
+
+typedef struct JDEC JDEC;
+struct JDEC {
+  WORD width, height; // full size
+  void *device;
+  void *stream; // host: the JPEG read by jd_prepare()
+};
+
+JRESULT jd_prepare(JDEC *jd, UINT (*infunc)(JDEC *, BYTE *, UINT), void *pool, UINT size,
+                   void *device);
+JRESULT jd_decomp(JDEC *jd, UINT (*outfunc)(JDEC *, void *, JRECT *), BYTE scale);
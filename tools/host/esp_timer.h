@@ -0,0 +1,7 @@
+#pragma once
+
+// Host build stand-in: microseconds since the program started
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time();
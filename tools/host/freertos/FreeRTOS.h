@@ -0,0 +1,40 @@
+#pragma once
+
+// Host build stand-in for FreeRTOS: tasks are std::threads (priority and
+// core are ignored), a tick is one millisecond, and queues, semaphores and
+// critical sections are built on std::mutex (see host_arduino.cpp).
+
+#include <stdint.h>
+
+#include <mutex>
+
+typedef void *TaskHandle_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define pdPASS 1
+#define pdFAIL 0
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portMAX_DELAY ((TickType_t)0xffffffff)
+#define portTICK_PERIOD_MS 1
+#define PRO_CPU_NUM 0
+#define APP_CPU_NUM 1
+#define tskNO_AFFINITY 0x7fffffff
+
+// Not a spinlock: a mutex does the same job between threads
+struct portMUX_TYPE {
+  std::mutex lock;
+};
+#define portMUX_INITIALIZER_UNLOCKED portMUX_TYPE()
+#define portENTER_CRITICAL(mux) (mux)->lock.lock()
+#define portEXIT_CRITICAL(mux) (mux)->lock.unlock()
+
+typedef struct HostQueue *QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t wait);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait);
@@ -0,0 +1,266 @@
+// Host build: the Arduino core, FreeRTOS and ESP32 system calls the sketch
+// uses, on std::thread and friends, plus main(), which runs setup() like
+// the Arduino core's loop task would.
+
+#include "Arduino.h"
+#include "WebServer.h"
+#include "esp_camera.h"
+
+#include <malloc.h>
+#include <pthread.h>
+#include <signal.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <vector>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// ==========================================
+// TIME
+// ==========================================
+static const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+
+int64_t esp_timer_get_time() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                               bootTime)
+      .count();
+}
+
+unsigned long millis() {
+  return (unsigned long)(uint32_t)(esp_timer_get_time() / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)(uint32_t)esp_timer_get_time();
+}
+
+void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+int HardwareSerial::printf(const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  int n = vprintf(format, args);
+  va_end(args);
+  return n;
+}
+
+// ==========================================
+// MEMORY
+// ==========================================
+// Sizes reported to /metrics: the ESP32-CAM's, less what the sketch took
+#define HOST_HEAP_BYTES (320 * 1024)
+#define HOST_PSRAM_BYTES (4 * 1024 * 1024)
+
+static std::atomic<size_t> psramUsed{0};
+
+bool psramFound() {
+  return true;
+}
+
+void *ps_malloc(size_t size) {
+  psramUsed += size;
+  return malloc(size);
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps) {
+  if (caps & MALLOC_CAP_SPIRAM) {
+    psramUsed += size;
+  }
+  return malloc(size);
+}
+
+void heap_caps_free(void *ptr) {
+  free(ptr);
+}
+
+uint32_t EspClass::getCycleCount() {
+  return (uint32_t)(esp_timer_get_time() * getCpuFreqMHz());
+}
+
+uint32_t EspClass::getHeapSize() {
+  return HOST_HEAP_BYTES;
+}
+
+// What this process has in use, as if it came out of the ESP32's heap
+uint32_t EspClass::getFreeHeap() {
+  struct mallinfo2 info = mallinfo2();
+  size_t total = info.uordblks + info.hblkhd;
+  size_t psram = psramUsed.load();
+  size_t used = total > psram ? total - psram : 0;
+  return used < HOST_HEAP_BYTES ? HOST_HEAP_BYTES - used : 0;
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+  static std::atomic<uint32_t> lowest{HOST_HEAP_BYTES};
+  uint32_t now = getFreeHeap();
+  uint32_t low = lowest.load();
+  while (now < low && !lowest.compare_exchange_weak(low, now)) {
+  }
+  return lowest.load();
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+  return getFreeHeap();
+}
+
+uint32_t EspClass::getPsramSize() {
+  return HOST_PSRAM_BYTES;
+}
+
+uint32_t EspClass::getFreePsram() {
+  size_t used = psramUsed.load();
+  return used < HOST_PSRAM_BYTES ? HOST_PSRAM_BYTES - used : 0;
+}
+
+// Nothing in PSRAM is ever freed
+uint32_t EspClass::getMinFreePsram() {
+  return getFreePsram();
+}
+
+// ==========================================
+// FREERTOS
+// ==========================================
+struct HostQueue {
+  std::mutex lock;
+  std::condition_variable changed;
+  size_t length;
+  size_t itemSize;
+  std::deque<std::vector<uint8_t>> items;
+};
+
+// Waits for ready() under q's lock, up to `wait` ticks
+template <typename Ready>
+static bool waitFor(HostQueue *q, std::unique_lock<std::mutex> &lock, TickType_t wait,
+                    Ready ready) {
+  if (wait == portMAX_DELAY) {
+    q->changed.wait(lock, ready);
+    return true;
+  }
+  return q->changed.wait_for(lock, std::chrono::milliseconds(wait), ready);
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  HostQueue *q = new HostQueue;
+  q->length = length;
+  q->itemSize = itemSize;
+  return q;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t wait) {
+  std::unique_lock<std::mutex> lock(q->lock);
+  if (!waitFor(q, lock, wait, [q] { return q->items.size() < q->length; })) {
+    return pdFALSE;
+  }
+  const uint8_t *bytes = (const uint8_t *)item;
+  q->items.emplace_back(bytes, bytes + q->itemSize);
+  q->changed.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait) {
+  std::unique_lock<std::mutex> lock(q->lock);
+  if (!waitFor(q, lock, wait, [q] { return !q->items.empty(); })) {
+    return pdFALSE;
+  }
+  if (q->itemSize) {
+    memcpy(item, q->items.front().data(), q->itemSize);
+  }
+  q->items.pop_front();
+  q->changed.notify_all();
+  return pdTRUE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  SemaphoreHandle_t s = xQueueCreate(1, 0);
+  xSemaphoreGive(s);
+  return s;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+  return xQueueCreate(1, 0);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait) {
+  return xQueueReceive(s, NULL, wait);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  return xQueueSend(s, NULL, 0);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackBytes,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *handle,
+                                   BaseType_t core) {
+  std::thread thread(task, arg);
+  pthread_setname_np(thread.native_handle(), name);
+  if (handle) {
+    *handle = NULL;
+  }
+  thread.detach();
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+  for (;;) {
+    std::this_thread::sleep_for(std::chrono::hours(1));
+  }
+}
+
+void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+void vTaskDelayUntil(TickType_t *previousWake, TickType_t period) {
+  *previousWake += period;
+  int32_t wait = (int32_t)(*previousWake - xTaskGetTickCount());
+  if (wait > 0) {
+    vTaskDelay(wait);
+  }
+}
+
+TickType_t xTaskGetTickCount() {
+  return millis();
+}
+
+// ==========================================
+// MAIN
+// ==========================================
+void setup();
+void loop();
+
+int main(int argc, char **argv) {
+  const char *frames = NULL;
+  float fps = 25;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--port-offset") && i + 1 < argc) {
+      hostPortOffset = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--frames") && i + 1 < argc) {
+      frames = argv[++i];
+    } else if (!strcmp(argv[i], "--fps") && i + 1 < argc) {
+      fps = atof(argv[++i]);
+    } else {
+      fprintf(stderr, "usage: %s [--port-offset n] [--frames folder] [--fps n]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (fps <= 0 || hostPortOffset < 0 || hostPortOffset + 81 > 65535) {
+    fprintf(stderr, "--fps must be positive and --port-offset 0-65454\n");
+    return 2;
+  }
+  // A viewer that went away must not kill the server
+  signal(SIGPIPE, SIG_IGN);
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  hostCameraSource(frames, fps);
+  setup();
+  for (;;) {
+    loop();
+  }
+}
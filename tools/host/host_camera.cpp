@@ -0,0 +1,281 @@
+// Host build: the camera driver (esp_camera.h). A capture thread is not
+// needed: esp_camera_fb_get() waits for the next frame time itself, then
+// fills a free buffer, so frames come at the set rate for as long as the
+// sketch keeps up and hands its buffers back.
+//
+// Stricter than the driver: a buffer handed back twice, or one it never
+// lent, aborts the process, and one handed back is overwritten with
+// RETURNED_FILL at once, so whatever still reads it gets garbage rather
+// than a frame that looks right until the camera reuses the buffer. Every
+// JPEG starts with a comment naming the capture (HOST_FRAME_STAMP and its
+// number, counting from 0), so a client can tell such a frame from a
+// whole one (tools/handoff_check.cpp).
+
+#include "esp_camera.h"
+
+#include "Arduino.h"
+#include "jpeg_bands.h"
+#include "synthetic_camera.h"
+#include "tools/jpeg_gray.h"
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+const resolution_info_t resolution[FRAMESIZE_INVALID] = {
+    {96, 96},   {160, 120}, {176, 144}, {240, 176},  {240, 240},  {320, 240},  {400, 296},
+    {480, 320}, {640, 480}, {800, 600}, {1024, 768}, {1280, 720}, {1280, 1024}, {1600, 1200},
+};
+
+#define RETURNED_FILL 0xA5
+
+struct HostFrame {
+  camera_fb_t fb;
+  std::vector<uint8_t> data;
+  bool lent = false;
+};
+
+static const char *sourceFolder = NULL;
+static float sourceFps = 25;
+struct SourceFile {
+  std::vector<uint8_t> jpeg;
+  uint16_t width, height;
+};
+static std::vector<SourceFile> files; // JPEGs of sourceFolder, by name
+
+static pixformat_t format = PIXFORMAT_JPEG;
+static std::atomic<int> frameSize{FRAMESIZE_VGA};
+static std::atomic<int> quality{12};
+static std::vector<HostFrame> frames;
+static std::vector<HostFrame *> freeFrames;
+static std::mutex framesLock;
+static std::condition_variable frameReturned;
+static std::mutex grabLock; // one frame at a time, like the sensor
+static int64_t nextFrameUs = 0;
+static uint32_t frameCount = 0;
+static sensor_t sensor;
+
+void hostCameraSource(const char *folder, float fps) {
+  sourceFolder = folder;
+  sourceFps = fps;
+}
+
+static bool loadFolder(const char *folder) {
+  DIR *dir = opendir(folder);
+  if (!dir) {
+    return false;
+  }
+  std::vector<std::string> names;
+  while (dirent *entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    size_t dot = name.rfind('.');
+    std::string ext = dot == std::string::npos ? "" : name.substr(dot);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    if (ext == ".jpg" || ext == ".jpeg") {
+      names.push_back(std::string(folder) + "/" + name);
+    }
+  }
+  closedir(dir);
+  std::sort(names.begin(), names.end());
+  for (const std::string &name : names) {
+    FILE *f = fopen(name.c_str(), "rb");
+    if (!f) {
+      continue;
+    }
+    SourceFile file;
+    uint8_t buf[65536];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+      file.jpeg.insert(file.jpeg.end(), buf, buf + n);
+    }
+    fclose(f);
+    // The camera only ever sends baseline JPEGs
+    JpegLayout layout;
+    if (!parseJpegLayout(file.jpeg.data(), file.jpeg.size(), &layout)) {
+      Serial.printf("Skipping %s: not a baseline JPEG\n", name.c_str());
+      continue;
+    }
+    file.width = layout.width;
+    file.height = layout.height;
+    files.push_back(std::move(file));
+  }
+  return !files.empty();
+}
+
+// The sensor's 0-63 (lower is better) as libjpeg's 1-100
+static int libjpegQuality(int q) {
+  int result = 100 - 2 * q;
+  return result < 5 ? 5 : result;
+}
+
+// A replayed JPEG keeps its own size; a grayscale frame is decoded from it
+// at the scale that fits the frame size
+static void fillFromFile(HostFrame &f, const SourceFile &file, int width) {
+  if (format == PIXFORMAT_JPEG) {
+    f.data = file.jpeg;
+    f.fb.width = file.width;
+    f.fb.height = file.height;
+    return;
+  }
+  int w = 0, h = 0;
+  decodeJpegGray(file.jpeg.data(), file.jpeg.size(), width, &f.data, &w, &h);
+  f.fb.width = w;
+  f.fb.height = h;
+}
+
+static void fillSynthetic(HostFrame &f, int width, int height, float angle) {
+  std::vector<uint8_t> gray(width * height);
+  renderSyntheticFace(gray.data(), width, height, angle);
+  if (format == PIXFORMAT_JPEG) {
+    // Colour, with a restart marker every MCU row, like the OV2640
+    f.data = encodeJpegGray(gray.data(), width, height, libjpegQuality(quality.load()), 1, true);
+  } else {
+    f.data = std::move(gray);
+  }
+  f.fb.width = width;
+  f.fb.height = height;
+}
+
+// A COM segment right after SOI
+static void stampFrame(std::vector<uint8_t> &jpeg, uint32_t n) {
+  char text[32];
+  int len = snprintf(text, sizeof(text), HOST_FRAME_STAMP "%u", (unsigned)n);
+  uint8_t marker[4] = {0xFF, 0xFE, (uint8_t)((len + 2) >> 8), (uint8_t)(len + 2)};
+  jpeg.insert(jpeg.begin() + 2, (const uint8_t *)text, (const uint8_t *)text + len);
+  jpeg.insert(jpeg.begin() + 2, marker, marker + 4);
+}
+
+// ==========================================
+// SENSOR
+// ==========================================
+static int setFramesize(sensor_t *s, framesize_t size) {
+  if (size < 0 || size >= FRAMESIZE_INVALID) {
+    return -1;
+  }
+  frameSize = size;
+  s->status.framesize = size;
+  return 0;
+}
+
+static int setQuality(sensor_t *s, int q) {
+  quality = q;
+  s->status.quality = q;
+  return 0;
+}
+
+static int setXclk(sensor_t *s, int timer, int xclk) {
+  s->xclk_freq_hz = xclk * 1000000;
+  return 0;
+}
+
+// No windowing: PID is not the OV2640's, so the sketch does not ask
+static int setResRaw(sensor_t *, int, int, int, int, int, int, int, int, int, int, bool, bool) {
+  return -1;
+}
+
+static int setIgnored(sensor_t *, int) {
+  return 0;
+}
+
+static int setGainceiling(sensor_t *, gainceiling_t) {
+  return 0;
+}
+
+// ==========================================
+// DRIVER
+// ==========================================
+esp_err_t esp_camera_init(const camera_config_t *config) {
+  if (sourceFolder && !loadFolder(sourceFolder)) {
+    Serial.printf("No JPEG files in %s\n", sourceFolder);
+    return ESP_ERR_NOT_FOUND;
+  }
+  format = config->pixel_format;
+  frameSize = config->frame_size;
+  quality = config->jpeg_quality;
+  frames = std::vector<HostFrame>(config->fb_count);
+  for (HostFrame &f : frames) {
+    f.fb.format = format;
+    freeFrames.push_back(&f);
+  }
+
+  sensor.id.PID = 0;
+  sensor.status.framesize = config->frame_size;
+  sensor.status.quality = config->jpeg_quality;
+  sensor.xclk_freq_hz = config->xclk_freq_hz;
+  sensor.set_framesize = setFramesize;
+  sensor.set_quality = setQuality;
+  sensor.set_xclk = setXclk;
+  sensor.set_res_raw = setResRaw;
+  sensor.set_exposure_ctrl = setIgnored;
+  sensor.set_gain_ctrl = setIgnored;
+  sensor.set_aec2 = setIgnored;
+  sensor.set_ae_level = setIgnored;
+  sensor.set_gainceiling = setGainceiling;
+  Serial.printf("Host camera: %s at %.0f fps, %u buffers\n",
+                sourceFolder ? sourceFolder : "synthetic faces", sourceFps,
+                (unsigned)config->fb_count);
+  return ESP_OK;
+}
+
+camera_fb_t *esp_camera_fb_get() {
+  if (frames.empty()) {
+    return NULL;
+  }
+  std::lock_guard<std::mutex> grab(grabLock);
+  HostFrame *f;
+  {
+    std::unique_lock<std::mutex> lock(framesLock);
+    frameReturned.wait(lock, [] { return !freeFrames.empty(); });
+    f = freeFrames.back();
+    freeFrames.pop_back();
+    f->lent = true;
+  }
+
+  // Paced like the sensor: a frame every 1/fps, later if nobody took one
+  int64_t now = esp_timer_get_time();
+  if (nextFrameUs > now) {
+    std::this_thread::sleep_for(std::chrono::microseconds(nextFrameUs - now));
+    now = nextFrameUs;
+  }
+  nextFrameUs = now + (int64_t)(1000000 / sourceFps);
+
+  const resolution_info_t &size = resolution[frameSize.load()];
+  uint32_t n = frameCount++;
+  if (files.empty()) {
+    fillSynthetic(*f, size.width, size.height, syntheticAngle(n));
+  } else {
+    fillFromFile(*f, files[n % files.size()], size.width);
+  }
+  if (format == PIXFORMAT_JPEG) {
+    stampFrame(f->data, n);
+  }
+  f->fb.buf = f->data.data();
+  f->fb.len = f->data.size();
+  int64_t at = esp_timer_get_time();
+  f->fb.timestamp.tv_sec = at / 1000000;
+  f->fb.timestamp.tv_usec = at % 1000000;
+  return &f->fb;
+}
+
+void esp_camera_fb_return(camera_fb_t *fb) {
+  std::lock_guard<std::mutex> lock(framesLock);
+  HostFrame *f = (HostFrame *)fb; // fb is the first member
+  if (frames.empty() || f < &frames.front() || f > &frames.back() || !f->lent) {
+    fprintf(stderr, "esp_camera_fb_return: buffer %p was not lent out\n", (void *)fb);
+    abort();
+  }
+  f->lent = false;
+  std::fill(f->data.begin(), f->data.end(), RETURNED_FILL);
+  freeFrames.push_back(f);
+  frameReturned.notify_all();
+}
+
+sensor_t *esp_camera_sensor_get() {
+  return frames.empty() ? NULL : &sensor;
+}
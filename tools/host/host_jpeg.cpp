@@ -0,0 +1,163 @@
+// Host build: the ROM JPEG decoder (esp32/rom/tjpgd.h) and the esp32-camera
+// encoder (img_converters.h), both on libjpeg
+
+#include "esp32/rom/tjpgd.h"
+#include "img_converters.h"
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <jpeglib.h>
+
+#include <vector>
+
+struct HostJpegError {
+  jpeg_error_mgr mgr;
+  jmp_buf jump;
+};
+
+static void hostJpegFail(j_common_ptr cinfo) {
+  longjmp(((HostJpegError *)cinfo->err)->jump, 1);
+}
+
+// ==========================================
+// DECODER
+// ==========================================
+#define DECODE_BLOCK_ROWS 16 // an MCU row of a 4:2:0 or 4:2:2 frame
+
+JRESULT jd_prepare(JDEC *jd, UINT (*infunc)(JDEC *, BYTE *, UINT), void *pool, UINT size,
+                   void *device) {
+  jd->device = device;
+  std::vector<uint8_t> *stream = new std::vector<uint8_t>;
+  BYTE buf[4096];
+  UINT n;
+  while ((n = infunc(jd, buf, sizeof(buf))) > 0) {
+    stream->insert(stream->end(), buf, buf + n);
+  }
+
+  jpeg_decompress_struct cinfo;
+  HostJpegError err;
+  cinfo.err = jpeg_std_error(&err.mgr);
+  err.mgr.error_exit = hostJpegFail;
+  if (setjmp(err.jump)) {
+    jpeg_destroy_decompress(&cinfo);
+    delete stream;
+    return JDR_FMT1;
+  }
+  jpeg_create_decompress(&cinfo);
+  jpeg_mem_src(&cinfo, stream->data(), stream->size());
+  jpeg_read_header(&cinfo, TRUE);
+  jd->width = cinfo.image_width;
+  jd->height = cinfo.image_height;
+  jpeg_destroy_decompress(&cinfo);
+  jd->stream = stream;
+  return JDR_OK;
+}
+
+JRESULT jd_decomp(JDEC *jd, UINT (*outfunc)(JDEC *, void *, JRECT *), BYTE scale) {
+  std::vector<uint8_t> *stream = (std::vector<uint8_t> *)jd->stream;
+  jd->stream = NULL;
+  if (!stream) {
+    return JDR_PAR;
+  }
+
+  jpeg_decompress_struct cinfo;
+  HostJpegError err;
+  cinfo.err = jpeg_std_error(&err.mgr);
+  err.mgr.error_exit = hostJpegFail;
+  std::vector<uint8_t> block;
+  JRESULT result = JDR_OK;
+  if (setjmp(err.jump)) {
+    jpeg_destroy_decompress(&cinfo);
+    delete stream;
+    return JDR_FMT1;
+  }
+  jpeg_create_decompress(&cinfo);
+  jpeg_mem_src(&cinfo, stream->data(), stream->size());
+  jpeg_read_header(&cinfo, TRUE);
+  cinfo.out_color_space = JCS_RGB;
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = 1 << scale;
+  jpeg_start_decompress(&cinfo);
+
+  size_t rowBytes = (size_t)cinfo.output_width * 3;
+  block.resize(rowBytes * DECODE_BLOCK_ROWS);
+  while (cinfo.output_scanline < cinfo.output_height && result == JDR_OK) {
+    JRECT rect;
+    rect.left = 0;
+    rect.right = cinfo.output_width - 1;
+    rect.top = cinfo.output_scanline;
+    while (cinfo.output_scanline < cinfo.output_height &&
+           cinfo.output_scanline - rect.top < DECODE_BLOCK_ROWS) {
+      JSAMPROW row = block.data() + (cinfo.output_scanline - rect.top) * rowBytes;
+      jpeg_read_scanlines(&cinfo, &row, 1);
+    }
+    rect.bottom = cinfo.output_scanline - 1;
+    if (!outfunc(jd, block.data(), &rect)) {
+      result = JDR_INTR;
+    }
+  }
+  jpeg_abort_decompress(&cinfo);
+  jpeg_destroy_decompress(&cinfo);
+  delete stream;
+  return result;
+}
+
+// ==========================================
+// ENCODER
+// ==========================================
+#define ENCODE_CHUNK 1024
+
+bool fmt2jpg_cb(uint8_t *src, size_t srcLen, uint16_t width, uint16_t height,
+                pixformat_t format, uint8_t quality, jpg_out_cb cb, void *arg) {
+  int components = format == PIXFORMAT_GRAYSCALE ? 1 : 3;
+  if ((format != PIXFORMAT_GRAYSCALE && format != PIXFORMAT_RGB888) ||
+      srcLen < (size_t)width * height * components) {
+    return false;
+  }
+
+  jpeg_compress_struct cinfo;
+  HostJpegError err;
+  cinfo.err = jpeg_std_error(&err.mgr);
+  err.mgr.error_exit = hostJpegFail;
+  unsigned char *out = NULL;
+  unsigned long length = 0;
+  if (setjmp(err.jump)) {
+    jpeg_destroy_compress(&cinfo);
+    free(out);
+    return false;
+  }
+  jpeg_create_compress(&cinfo);
+  jpeg_mem_dest(&cinfo, &out, &length);
+  cinfo.image_width = width;
+  cinfo.image_height = height;
+  cinfo.input_components = components;
+  cinfo.in_color_space = components == 1 ? JCS_GRAYSCALE : JCS_RGB;
+  jpeg_set_defaults(&cinfo);
+  jpeg_set_quality(&cinfo, quality, TRUE);
+  jpeg_start_compress(&cinfo, TRUE);
+  std::vector<uint8_t> rgb((size_t)width * 3);
+  while (cinfo.next_scanline < cinfo.image_height) {
+    JSAMPROW row = src + (size_t)cinfo.next_scanline * width * components;
+    if (components == 3) {
+      for (size_t x = 0; x < width; x++) {
+        rgb[3 * x] = row[3 * x + 2];
+        rgb[3 * x + 1] = row[3 * x + 1];
+        rgb[3 * x + 2] = row[3 * x];
+      }
+      row = rgb.data();
+    }
+    jpeg_write_scanlines(&cinfo, &row, 1);
+  }
+  jpeg_finish_compress(&cinfo);
+  jpeg_destroy_compress(&cinfo);
+
+  bool ok = true;
+  for (size_t index = 0; index < length && ok; index += ENCODE_CHUNK) {
+    size_t n = length - index < ENCODE_CHUNK ? length - index : ENCODE_CHUNK;
+    ok = cb(arg, index, out + index, n) == n;
+  }
+  free(out);
+  return ok;
+}
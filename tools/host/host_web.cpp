@@ -0,0 +1,356 @@
+// Host build: WiFi, WiFiClient and WebServer (WiFi.h, WebServer.h) on
+// BSD sockets
+
+#include "WebServer.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// CONFIG_LWIP_TCP_SND_BUF_DEFAULT in the ESP32 Arduino core
+#define HOST_TCP_SND_BUF 5744
+
+int hostPortOffset = 8000;
+
+WiFiClass WiFi;
+
+// Listening on loopback only: this is for load tests, not for the LAN
+IPAddress WiFiClass::localIP() {
+  return IPAddress(htonl(INADDR_LOOPBACK));
+}
+
+String IPAddress::toString() const {
+  char text[INET_ADDRSTRLEN];
+  struct in_addr addr;
+  addr.s_addr = address_;
+  inet_ntop(AF_INET, &addr, text, sizeof(text));
+  return String(text);
+}
+
+// ==========================================
+// WIFI CLIENT
+// ==========================================
+struct WiFiClient::Socket {
+  int fd;
+  ~Socket() {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+};
+
+WiFiClient::WiFiClient(int fd) : socket_(new Socket{fd}) {}
+
+int WiFiClient::fd() const {
+  return socket_ ? socket_->fd : -1;
+}
+
+bool WiFiClient::connected() {
+  int s = fd();
+  if (s < 0) {
+    return false;
+  }
+  char c;
+  int n = recv(s, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+  return n > 0 || (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+}
+
+size_t WiFiClient::write(const uint8_t *data, size_t length) {
+  int s = fd();
+  size_t sent = 0;
+  while (s >= 0 && sent < length) {
+    ssize_t n = send(s, data + sent, length - sent, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      break;
+    }
+    sent += n;
+  }
+  return sent;
+}
+
+// Every copy sees the socket closed
+void WiFiClient::stop() {
+  if (socket_ && socket_->fd >= 0) {
+    close(socket_->fd);
+    socket_->fd = -1;
+  }
+}
+
+// ==========================================
+// WEB SERVER
+// ==========================================
+// As the ESP32 WebServer: a request must arrive within this long
+#define HTTP_MAX_DATA_WAIT 5000
+#define HTTP_MAX_REQUEST 4096
+
+void WebServer::begin() {
+  listenFd_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  int one = 1;
+  setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(port_ + hostPortOffset);
+  if (bind(listenFd_, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+      listen(listenFd_, 16) != 0) {
+    Serial.printf("Cannot listen on port %d: %s\n", port_ + hostPortOffset, strerror(errno));
+    close(listenFd_);
+    listenFd_ = -1;
+    return;
+  }
+  Serial.printf("Listening on http://127.0.0.1:%d/\n", port_ + hostPortOffset);
+}
+
+void WebServer::on(const char *uri, THandlerFunction handler) {
+  on(uri, HTTP_ANY, handler);
+}
+
+void WebServer::on(const char *uri, HTTPMethod method, THandlerFunction handler) {
+  routes_.push_back({uri, method, handler});
+}
+
+void WebServer::collectHeaders(const char *headerKeys[], size_t count) {
+  headerKeys_.assign(headerKeys, headerKeys + count);
+  headerValues_.assign(count, std::string());
+}
+
+static int hexValue(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  c |= 0x20;
+  return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+}
+
+static std::string urlDecode(const std::string &s) {
+  std::string out;
+  for (size_t i = 0; i < s.size(); i++) {
+    int hi, lo;
+    if (s[i] == '+') {
+      out += ' ';
+    } else if (s[i] == '%' && i + 2 < s.size() && (hi = hexValue(s[i + 1])) >= 0 &&
+               (lo = hexValue(s[i + 2])) >= 0) {
+      out += (char)(hi * 16 + lo);
+      i += 2;
+    } else {
+      out += s[i];
+    }
+  }
+  return out;
+}
+
+// Request line and headers; a body is not read, no handler takes one
+bool WebServer::readRequest() {
+  std::string request;
+  int fd = client_.fd();
+  while (request.find("\r\n\r\n") == std::string::npos) {
+    char buf[1024];
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0 || request.size() + n > HTTP_MAX_REQUEST) {
+      return false;
+    }
+    request.append(buf, n);
+  }
+
+  size_t lineEnd = request.find("\r\n");
+  std::string line = request.substr(0, lineEnd);
+  size_t sp1 = line.find(' ');
+  size_t sp2 = line.find(' ', sp1 + 1);
+  if (sp1 == std::string::npos || sp2 == std::string::npos) {
+    return false;
+  }
+  std::string methodName = line.substr(0, sp1);
+  method_ = methodName == "POST"      ? HTTP_POST
+            : methodName == "HEAD"    ? HTTP_HEAD
+            : methodName == "PUT"     ? HTTP_PUT
+            : methodName == "DELETE"  ? HTTP_DELETE
+            : methodName == "OPTIONS" ? HTTP_OPTIONS
+                                      : HTTP_GET;
+  std::string target = line.substr(sp1 + 1, sp2 - sp1 - 1);
+  size_t query = target.find('?');
+  uri_ = urlDecode(target.substr(0, query));
+  args_.clear();
+  if (query != std::string::npos) {
+    std::string rest = target.substr(query + 1);
+    size_t start = 0;
+    while (start <= rest.size()) {
+      size_t end = rest.find('&', start);
+      std::string pair = rest.substr(start, end == std::string::npos ? end : end - start);
+      if (!pair.empty()) {
+        size_t eq = pair.find('=');
+        args_.push_back({urlDecode(pair.substr(0, eq)),
+                         eq == std::string::npos ? "" : urlDecode(pair.substr(eq + 1))});
+      }
+      if (end == std::string::npos) {
+        break;
+      }
+      start = end + 1;
+    }
+  }
+
+  headerValues_.assign(headerKeys_.size(), std::string());
+  size_t pos = lineEnd + 2;
+  for (;;) {
+    size_t end = request.find("\r\n", pos);
+    if (end == std::string::npos || end == pos) {
+      break;
+    }
+    std::string header = request.substr(pos, end - pos);
+    pos = end + 2;
+    size_t colon = header.find(':');
+    if (colon == std::string::npos) {
+      continue;
+    }
+    std::string name = header.substr(0, colon);
+    size_t value = header.find_first_not_of(' ', colon + 1);
+    for (size_t i = 0; i < headerKeys_.size(); i++) {
+      if (!strcasecmp(name.c_str(), headerKeys_[i].c_str())) {
+        headerValues_[i] = value == std::string::npos ? "" : header.substr(value);
+      }
+    }
+  }
+  return true;
+}
+
+void WebServer::handleClient() {
+  if (listenFd_ < 0) {
+    return;
+  }
+  int fd = accept4(listenFd_, NULL, NULL, SOCK_CLOEXEC);
+  if (fd < 0) {
+    return;
+  }
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  // lwIP's send buffer, so a slow client pushes back on the sketch as
+  // soon as it would on the board instead of after megabytes
+  int sendBuffer = HOST_TCP_SND_BUF;
+  setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sendBuffer, sizeof(sendBuffer));
+  struct timeval wait = {HTTP_MAX_DATA_WAIT / 1000, (HTTP_MAX_DATA_WAIT % 1000) * 1000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &wait, sizeof(wait));
+  client_ = WiFiClient(fd);
+  responseHeaders_.clear();
+  contentLength_ = CONTENT_LENGTH_UNKNOWN;
+
+  if (readRequest()) {
+    const Route *route = NULL;
+    for (const Route &r : routes_) {
+      if (r.uri == uri_ && (r.method == HTTP_ANY || r.method == method_)) {
+        route = &r;
+        break;
+      }
+    }
+    if (route) {
+      route->handler();
+    } else if (notFound_) {
+      notFound_();
+    } else {
+      send(404, "text/plain", String(("Not found: " + uri_).c_str()));
+    }
+  }
+  // Closes the connection, unless a handler kept a copy of client()
+  client_ = WiFiClient();
+}
+
+bool WebServer::hasArg(const char *name) const {
+  for (const auto &a : args_) {
+    if (a.first == name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+String WebServer::arg(const char *name) const {
+  for (const auto &a : args_) {
+    if (a.first == name) {
+      return String(a.second.c_str(), a.second.size());
+    }
+  }
+  return String();
+}
+
+String WebServer::header(const char *name) const {
+  for (size_t i = 0; i < headerKeys_.size(); i++) {
+    if (!strcasecmp(name, headerKeys_[i].c_str())) {
+      return String(headerValues_[i].c_str(), headerValues_[i].size());
+    }
+  }
+  return String();
+}
+
+String WebServer::header(int i) const {
+  if (i < 0 || (size_t)i >= headerValues_.size()) {
+    return String();
+  }
+  return String(headerValues_[i].c_str(), headerValues_[i].size());
+}
+
+void WebServer::sendHeader(const String &name, const String &value, bool first) {
+  std::string line = std::string(name.c_str()) + ": " + value.c_str() + "\r\n";
+  responseHeaders_ = first ? line + responseHeaders_ : responseHeaders_ + line;
+}
+
+static const char *reason(int code) {
+  switch (code) {
+  case 200:
+    return "OK";
+  case 304:
+    return "Not Modified";
+  case 400:
+    return "Bad Request";
+  case 404:
+    return "Not Found";
+  case 409:
+    return "Conflict";
+  case 500:
+    return "Internal Server Error";
+  case 503:
+    return "Service Unavailable";
+  case 504:
+    return "Gateway Timeout";
+  default:
+    return "";
+  }
+}
+
+// With setContentLength(), content is usually "" and the body follows by
+// sendContent(), as on the ESP32
+void WebServer::send(int code, const char *contentType, const String &content) {
+  size_t length = contentLength_ != CONTENT_LENGTH_UNKNOWN ? contentLength_ : content.length();
+  char status[64];
+  snprintf(status, sizeof(status), "HTTP/1.1 %d %s\r\n", code, reason(code));
+  std::string head = status;
+  if (contentType && *contentType) {
+    head += std::string("Content-Type: ") + contentType + "\r\n";
+  }
+  head += "Content-Length: " + std::to_string(length) + "\r\n";
+  head += "Connection: close\r\n";
+  head += responseHeaders_;
+  head += "\r\n";
+  writeAll(head.data(), head.size());
+  writeAll(content.c_str(), content.length());
+  responseHeaders_.clear();
+  contentLength_ = CONTENT_LENGTH_UNKNOWN;
+}
+
+void WebServer::sendContent(const char *data, size_t length) {
+  writeAll(data, length);
+}
+
+void WebServer::writeAll(const char *data, size_t length) {
+  if (length) {
+    client_.write((const uint8_t *)data, length);
+  }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+// Host build stand-in for esp32-camera's JPEG encoder, on libjpeg.
+// RGB888 input is BGR, as on the ESP32.
+
+#include "esp_camera.h"
+
+typedef enum {
+  JPG_SCALE_NONE,
+  JPG_SCALE_2X,
+  JPG_SCALE_4X,
+  JPG_SCALE_8X,
+  JPG_SCALE_MAX = JPG_SCALE_8X
+} jpg_scale_t;
+
+typedef size_t (*jpg_reader_cb)(void *arg, size_t index, uint8_t *buf, size_t len);
+typedef bool (*jpg_writer_cb)(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                              uint8_t *data);
+typedef size_t (*jpg_out_cb)(void *arg, size_t index, const void *data, size_t len);
+
+// quality as for the ESP32 encoder: 1-100, higher is better
+bool fmt2jpg_cb(uint8_t *src, size_t srcLen, uint16_t width, uint16_t height,
+                pixformat_t format, uint8_t quality, jpg_out_cb cb, void *arg);
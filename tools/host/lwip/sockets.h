@@ -0,0 +1,9 @@
+#pragma once
+
+// Host build: lwIP's BSD socket API is the real one
+
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
@@ -0,0 +1,3 @@
+#pragma once
+
+// Host build: flash is ordinary memory
@@ -0,0 +1,7 @@
+// The sketch itself, for the host build. The Arduino IDE puts the
+// Arduino.h include in front of the .ino; the sketch declares everything
+// before it is used, so it needs no generated prototypes.
+
+#include "Arduino.h"
+
+#include "Head_Tilt_Racing_Game_EspCam.ino"
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Starts the host build of the sketch and checks that it serves.
+
+Runs headtilt_host on a free set of ports, waits for a frame, then checks
+the game page, a /capture frame and its ETag revalidation, two /stream
+parts, /tilt and /metrics. Exits 1 on the first failure. ctest runs it for
+every host build; it is also a quick check before a load test.
+
+Example:
+  python3 tools/host/smoke_test.py _gate_build/headtilt_host --port-offset 9300
+"""
+
+import argparse
+import http.client
+import json
+import subprocess
+import sys
+import time
+
+
+def get(port, path, headers=None, timeout=5):
+    conn = http.client.HTTPConnection("127.0.0.1", port, timeout=timeout)
+    conn.request("GET", path, headers=headers or {})
+    res = conn.getresponse()
+    body = res.read()
+    conn.close()
+    return res, body
+
+
+def wait_until_up(port, proc, seconds):
+    """Until /capture has a frame: /time answers as soon as the server is
+    up, /capture only once the camera task published its first frame."""
+    deadline = time.time() + seconds
+    while time.time() < deadline:
+        if proc.poll() is not None:
+            raise AssertionError("headtilt_host exited with %d" % proc.returncode)
+        try:
+            res, _ = get(port, "/capture", timeout=1)
+            if res.status == 200:
+                return
+        except OSError:
+            pass
+        time.sleep(0.1)
+    raise AssertionError("no frame on port %d" % port)
+
+
+def read_stream_parts(port, count, timeout):
+    conn = http.client.HTTPConnection("127.0.0.1", port, timeout=timeout)
+    conn.request("GET", "/stream")
+    res = conn.getresponse()
+    check(res.status == 200, "/stream status %d" % res.status)
+    check("multipart/x-mixed-replace" in res.getheader("Content-Type", ""),
+          "/stream is not multipart")
+    sizes = []
+    while len(sizes) < count:
+        line = res.fp.readline()
+        if not line:
+            raise AssertionError("/stream ended after %d parts" % len(sizes))
+        if line.lower().startswith(b"content-length:"):
+            length = int(line.split(b":")[1])
+            while res.fp.readline() not in (b"\r\n", b""):
+                pass
+            jpeg = res.fp.read(length)
+            check(jpeg[:2] == b"\xff\xd8", "/stream part is not a JPEG")
+            sizes.append(length)
+    conn.close()
+    return sizes
+
+
+def check(ok, message):
+    if not ok:
+        raise AssertionError(message)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("binary", help="headtilt_host executable")
+    parser.add_argument("--port-offset", type=int, default=9300)
+    parser.add_argument("--frames", help="folder of JPEG frames to replay")
+    parser.add_argument("--timeout", type=float, default=10)
+    args = parser.parse_args()
+
+    command = [args.binary, "--port-offset", str(args.port_offset)]
+    if args.frames:
+        command += ["--frames", args.frames]
+    port = 80 + args.port_offset
+    proc = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    try:
+        wait_until_up(port, proc, args.timeout)
+
+        res, body = get(port, "/")
+        check(res.status == 200, "/ status %d" % res.status)
+        check(res.getheader("Content-Encoding") == "gzip" and body[:2] == b"\x1f\x8b",
+              "/ is not the gzipped page")
+        page_bytes = len(body)
+
+        res, body = get(port, "/capture")
+        check(res.status == 200, "/capture status %d" % res.status)
+        check(body[:2] == b"\xff\xd8" and body[-2:] == b"\xff\xd9", "/capture is not a JPEG")
+        check(len(body) == int(res.getheader("Content-Length")), "/capture length mismatch")
+        capture_bytes = len(body)
+        etag = res.getheader("ETag")
+        check(etag is not None, "/capture has no ETag")
+        res, _ = get(port, "/capture", {"If-None-Match": etag})
+        check(res.status in (200, 304), "/capture revalidation status %d" % res.status)
+
+        sizes = read_stream_parts(port, 2, args.timeout)
+
+        res, body = get(port, "/tilt")
+        tilt = json.loads(body)
+        check(res.status == 200 and tilt["seq"] > 0, "/tilt has no tracked frame")
+
+        res, body = get(port, "/metrics")
+        check(res.status == 200 and b"frames_sent_total" in body, "/metrics incomplete")
+
+        print("OK: page %d bytes, capture %d bytes, stream parts %s, tilt %.1f (found %s)"
+              % (page_bytes, capture_bytes, sizes, tilt["angle"], tilt["found"]))
+        return 0
+    except (AssertionError, OSError, ValueError) as e:
+        print("FAIL: %s" % e)
+        return 1
+    finally:
+        proc.terminate()
+        try:
+            output, _ = proc.communicate(timeout=5)
+        except subprocess.TimeoutExpired:
+            proc.kill()
+            output, _ = proc.communicate()
+        if output:
+            sys.stdout.write(output.decode(errors="replace"))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
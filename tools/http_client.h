@@ -0,0 +1,230 @@
+#pragma once
+
+// Bare HTTP/1.1 over a socket for the PC tools that talk to the sketch,
+// either the host build (tools/host/, started here) or a board on the LAN.
+// Every byte in and out is counted, headers included, which is what the
+// tools measure; a library client would hide that.
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+inline double httpNowMs() {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Connected socket, or -1. Reads time out after timeoutMs.
+inline int httpConnect(const char *host, int port, int timeoutMs) {
+  struct addrinfo hints = {}, *res = nullptr;
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  char service[16];
+  snprintf(service, sizeof(service), "%d", port);
+  if (getaddrinfo(host, service, &hints, &res) != 0) {
+    return -1;
+  }
+  int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd >= 0 && connect(fd, res->ai_addr, res->ai_addrlen) != 0) {
+    close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(res);
+  if (fd >= 0) {
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    struct timeval wait = {timeoutMs / 1000, (timeoutMs % 1000) * 1000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &wait, sizeof(wait));
+  }
+  return fd;
+}
+
+// A request and the buffered reading of its response
+struct HttpConn {
+  int fd = -1;
+  std::string buf; // received, not yet consumed
+  size_t pos = 0;
+  uint64_t bytesIn = 0;
+  uint64_t bytesOut = 0;
+
+  ~HttpConn() { close(); }
+
+  void close() {
+    if (fd >= 0) {
+      ::close(fd);
+      fd = -1;
+    }
+  }
+
+  bool get(const char *host, int port, const char *path, int timeoutMs,
+           const char *extraHeaders = "") {
+    close();
+    buf.clear();
+    pos = 0;
+    fd = httpConnect(host, port, timeoutMs);
+    if (fd < 0) {
+      return false;
+    }
+    char request[512];
+    int len = snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: %s\r\n%s\r\n", path,
+                       host, extraHeaders);
+    if (len <= 0 || (size_t)len >= sizeof(request)) {
+      return false;
+    }
+    bytesOut += len;
+    return send(fd, request, len, MSG_NOSIGNAL) == len;
+  }
+
+  // More bytes into buf; false on close, error or timeout
+  bool fill() {
+    if (pos > 65536) {
+      buf.erase(0, pos);
+      pos = 0;
+    }
+    char chunk[16384];
+    ssize_t n;
+    do {
+      n = recv(fd, chunk, sizeof(chunk), 0);
+    } while (n < 0 && errno == EINTR);
+    if (n <= 0) {
+      return false;
+    }
+    bytesIn += n;
+    buf.append(chunk, n);
+    return true;
+  }
+
+  // One line without its CRLF
+  bool readLine(std::string *line) {
+    size_t end;
+    while ((end = buf.find("\r\n", pos)) == std::string::npos) {
+      if (!fill()) {
+        return false;
+      }
+    }
+    line->assign(buf, pos, end - pos);
+    pos = end + 2;
+    return true;
+  }
+
+  // The next n bytes (into out, if given)
+  bool read(size_t n, std::string *out) {
+    while (buf.size() - pos < n) {
+      if (!fill()) {
+        return false;
+      }
+    }
+    if (out) {
+      out->assign(buf, pos, n);
+    }
+    pos += n;
+    return true;
+  }
+
+  // Status line and headers up to the blank line: the status code, or 0
+  int readHead(std::vector<std::string> *headers) {
+    std::string line;
+    if (!readLine(&line) || line.compare(0, 5, "HTTP/") != 0) {
+      return 0;
+    }
+    int status = atoi(line.c_str() + line.find(' ') + 1);
+    headers->clear();
+    while (readLine(&line) && !line.empty()) {
+      headers->push_back(line);
+    }
+    return line.empty() ? status : 0;
+  }
+};
+
+// Value of header `name` (case-insensitive), or "" if absent
+inline std::string httpHeader(const std::vector<std::string> &headers, const char *name) {
+  size_t n = strlen(name);
+  for (const std::string &h : headers) {
+    if (h.size() > n && h[n] == ':' && !strncasecmp(h.c_str(), name, n)) {
+      size_t value = h.find_first_not_of(' ', n + 1);
+      return value == std::string::npos ? "" : h.substr(value);
+    }
+  }
+  return "";
+}
+
+// ==========================================
+// HOST BUILD
+// ==========================================
+// Starts a host build of the sketch (build/headtilt_host and friends) with
+// its output thrown away, and waits until /capture has a frame on port
+// 80 + portOffset (the server answers before the camera task published
+// one). Returns its pid, or -1.
+inline pid_t startHostBuild(const char *binary, int portOffset,
+                            const std::vector<std::string> &args, double waitSeconds = 10) {
+  std::string offset = std::to_string(portOffset);
+  std::vector<const char *> argv = {binary, "--port-offset", offset.c_str()};
+  for (const std::string &a : args) {
+    argv.push_back(a.c_str());
+  }
+  argv.push_back(nullptr);
+  pid_t pid = fork();
+  if (pid == 0) {
+    int null = open("/dev/null", O_WRONLY);
+    dup2(null, STDOUT_FILENO);
+    execv(binary, (char *const *)argv.data());
+    _exit(127);
+  }
+  if (pid < 0) {
+    return -1;
+  }
+
+  double deadline = httpNowMs() + waitSeconds * 1000;
+  while (httpNowMs() < deadline) {
+    int status;
+    if (waitpid(pid, &status, WNOHANG) == pid) {
+      fprintf(stderr, "%s exited before it answered\n", binary);
+      return -1;
+    }
+    HttpConn conn;
+    std::vector<std::string> headers;
+    if (conn.get("127.0.0.1", 80 + portOffset, "/capture", 1000) && conn.readHead(&headers) == 200) {
+      return pid;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  fprintf(stderr, "%s served no frame on port %d\n", binary, 80 + portOffset);
+  kill(pid, SIGKILL);
+  waitpid(pid, nullptr, 0);
+  return -1;
+}
+
+// False if it had already exited (crashed or aborted) before it was told to
+inline bool stopHostBuild(pid_t pid) {
+  if (pid <= 0) {
+    return true;
+  }
+  int status;
+  if (waitpid(pid, &status, WNOHANG) == pid) {
+    fprintf(stderr, "host build exited early (%s %d)\n",
+            WIFSIGNALED(status) ? "signal" : "status",
+            WIFSIGNALED(status) ? WTERMSIG(status) : WEXITSTATUS(status));
+    return false;
+  }
+  kill(pid, SIGTERM);
+  waitpid(pid, nullptr, 0);
+  return true;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+// Grayscale JPEG decode/encode with libjpeg, for the PC tools (link with
+// -ljpeg). The decode picks the smallest JPEG scale (1/1 .. 1/8) that
+// brings the width down to maxWidth, like the sketch's decodeGray(); its
+// luma differs slightly from the ESP32 decoder's (r + 2g + b) / 4.
+
+#include <setjmp.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <jpeglib.h>
+
+#include <vector>
+
+struct JpegGrayError {
+  jpeg_error_mgr mgr;
+  jmp_buf jump; // libjpeg is C: errors come back by longjmp, not exceptions
+};
+
+// Decodes at 1/denom scale (1, 2, 4 or 8), or if denom is 0 at the
+// smallest scale that fits maxWidth. Rows go to *vec (resized to fit) or,
+// without one, to out with `stride` bytes per row, up to maxWidth x
+// maxHeight.
+inline bool decodeJpegGrayRows(const uint8_t *jpeg, size_t length, unsigned denom,
+                               int maxWidth, int maxHeight, std::vector<uint8_t> *vec,
+                               uint8_t *out, int stride, int *width, int *height) {
+  jpeg_decompress_struct cinfo;
+  JpegGrayError err;
+  cinfo.err = jpeg_std_error(&err.mgr);
+  err.mgr.error_exit = [](j_common_ptr c) { longjmp(((JpegGrayError *)c->err)->jump, 1); };
+  err.mgr.output_message = [](j_common_ptr) {};
+  if (setjmp(err.jump)) {
+    jpeg_destroy_decompress(&cinfo);
+    return false;
+  }
+  jpeg_create_decompress(&cinfo);
+  jpeg_mem_src(&cinfo, jpeg, length);
+  jpeg_read_header(&cinfo, TRUE);
+  // Nothing set after setjmp() lives in a local, as longjmp() may lose it
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = denom ? denom : 1;
+  for (unsigned w = cinfo.image_width; !denom && w > (unsigned)maxWidth && cinfo.scale_denom < 8;
+       w /= 2) {
+    cinfo.scale_denom *= 2;
+  }
+  cinfo.out_color_space = JCS_GRAYSCALE;
+  jpeg_start_decompress(&cinfo);
+  *width = cinfo.output_width;
+  *height = cinfo.output_height;
+  if (vec) {
+    vec->resize((size_t)*width * *height);
+  } else if (*width > maxWidth || *height > maxHeight) {
+    jpeg_destroy_decompress(&cinfo);
+    return false;
+  }
+  while (cinfo.output_scanline < cinfo.output_height) {
+    JSAMPROW row = vec ? vec->data() + (size_t)cinfo.output_scanline * *width
+                       : out + (size_t)cinfo.output_scanline * stride;
+    jpeg_read_scanlines(&cinfo, &row, 1);
+  }
+  jpeg_finish_decompress(&cinfo);
+  jpeg_destroy_decompress(&cinfo);
+  return true;
+}
+
+inline bool decodeJpegGray(const uint8_t *jpeg, size_t length, int maxWidth,
+                           std::vector<uint8_t> *gray, int *width, int *height) {
+  return decodeJpegGrayRows(jpeg, length, 0, maxWidth, 0, gray, NULL, 0, width, height);
+}
+
+// restartRows > 0 puts a restart marker after every that many MCU rows;
+// ycbcr stores the gray image as a colour JPEG (4:2:2, like the camera's)
+inline std::vector<uint8_t> encodeJpegGray(const uint8_t *gray, int width, int height,
+                                           int quality, int restartRows = 0,
+                                           bool ycbcr = false) {
+  jpeg_compress_struct cinfo;
+  jpeg_error_mgr jerr;
+  cinfo.err = jpeg_std_error(&jerr);
+  jpeg_create_compress(&cinfo);
+  unsigned char *out = NULL;
+  unsigned long length = 0;
+  jpeg_mem_dest(&cinfo, &out, &length);
+  cinfo.image_width = width;
+  cinfo.image_height = height;
+  cinfo.input_components = ycbcr ? 3 : 1;
+  cinfo.in_color_space = ycbcr ? JCS_RGB : JCS_GRAYSCALE;
+  jpeg_set_defaults(&cinfo);
+  jpeg_set_quality(&cinfo, quality, TRUE);
+  if (ycbcr) {
+    cinfo.comp_info[0].h_samp_factor = 2;
+    cinfo.comp_info[0].v_samp_factor = 1;
+  }
+  cinfo.restart_in_rows = restartRows;
+  jpeg_start_compress(&cinfo, TRUE);
+  std::vector<uint8_t> rgb(ycbcr ? (size_t)width * 3 : 0);
+  while (cinfo.next_scanline < cinfo.image_height) {
+    JSAMPROW row = (JSAMPROW)gray + (size_t)cinfo.next_scanline * width;
+    if (ycbcr) {
+      for (int x = 0; x < width; x++) {
+        rgb[3 * x] = rgb[3 * x + 1] = rgb[3 * x + 2] = row[x];
+      }
+      row = rgb.data();
+    }
+    jpeg_write_scanlines(&cinfo, &row, 1);
+  }
+  jpeg_finish_compress(&cinfo);
+  std::vector<uint8_t> jpeg(out, out + length);
+  free(out);
+  jpeg_destroy_compress(&cinfo);
+  return jpeg;
+}
@@ -0,0 +1,306 @@
+// Checks that the vector path of the tracking kernels (tilt_kernels.h)
+// gives exactly the same output as the plain C++ loops the ESP32 runs,
+// and times both in nanoseconds per pixel.
+//
+// tilt_kernels.cpp is compiled twice into this file, once as it is (the
+// vector path, on a PC with SSE2 or NEON) and once with the vector path
+// switched off, in two namespaces. Every kernel then runs on the same
+// inputs through both: odd and even sizes, rows with padding, random
+// noise, flat black and white, and a synthetic face; blobContrastRow at
+// several radii and starting columns, so the scalar tail after the last
+// group of four is covered too. Any differing byte is a failure.
+//
+// The timing runs each kernel over QQVGA and QVGA frames (the grayscale
+// pipeline's sizes) with the estimator's own radius, best of a few
+// batches, and adds up a whole frame of tracking.
+//
+// Build and run on Linux from the repository root:
+//   g++ -O2 -I. tools/kernel_check.cpp synthetic_camera.cpp -o kernel_check
+//   ./kernel_check
+//   ./kernel_check --json --tag "$(git rev-parse --short HEAD)"
+// Exits 1 if the two paths differ anywhere.
+
+#include "synthetic_camera.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+// The kernels as built for this machine...
+namespace vec {
+#include "tilt_kernels.cpp"
+}
+static const bool HAVE_VECTOR = TILT_KERNELS_VECTOR;
+
+// ...and as the ESP32 builds them. tilt_kernels.h is not read again
+// (#pragma once), so the switch is set here rather than by
+// TILT_KERNELS_SCALAR.
+#undef TILT_KERNELS_VECTOR
+#define TILT_KERNELS_VECTOR 0
+namespace scalar {
+#include "tilt_kernels.cpp"
+}
+
+// The estimator's eye radius for a frame this wide (tilt_estimator.cpp)
+static int eyeRadius(int width) {
+  return width / 40 < 2 ? 2 : width / 40;
+}
+
+// ==========================================
+// EQUIVALENCE
+// ==========================================
+enum Pattern { PATTERN_NOISE, PATTERN_BLACK, PATTERN_WHITE, PATTERN_FACE, PATTERN_COUNT };
+static const char *PATTERN_NAMES[] = {"noise", "black", "white", "face"};
+
+static void fill(std::vector<uint8_t> &image, int width, int height, int stride,
+                 Pattern pattern, uint32_t seed) {
+  image.assign((size_t)stride * height, 0);
+  std::vector<uint8_t> face;
+  if (pattern == PATTERN_FACE) {
+    face.resize((size_t)width * height);
+    renderSyntheticFace(face.data(), width, height, (float)(seed % 41) - 20);
+  }
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < stride; x++) {
+      seed = seed * 1103515245u + 12345u;
+      uint8_t noise = seed >> 24;
+      uint8_t v = noise; // padding past width is noise too
+      if (x < width && pattern == PATTERN_BLACK) {
+        v = 0;
+      } else if (x < width && pattern == PATTERN_WHITE) {
+        v = 255;
+      } else if (x < width && pattern == PATTERN_FACE) {
+        v = face[(size_t)y * width + x];
+      }
+      image[(size_t)y * stride + x] = v;
+    }
+  }
+}
+
+struct Mismatches {
+  uint32_t cases = 0;
+  uint32_t downscale = 0, blur = 0, integral = 0, contrast = 0;
+  uint32_t total() const { return downscale + blur + integral + contrast; }
+};
+
+template <typename T> static bool same(const std::vector<T> &a, const std::vector<T> &b) {
+  return a.size() == b.size() && !memcmp(a.data(), b.data(), a.size() * sizeof(T));
+}
+
+static void report(const char *kernel, int width, int height, int stride, Pattern pattern,
+                   const char *extra = "") {
+  fprintf(stderr, "  %s differs: %dx%d stride %d, %s%s\n", kernel, width, height, stride,
+          PATTERN_NAMES[pattern], extra);
+}
+
+static void compareAt(int width, int height, int pad, Pattern pattern, uint32_t seed,
+                      Mismatches *m) {
+  int stride = width + pad;
+  std::vector<uint8_t> src;
+  fill(src, width, height, stride, pattern, seed);
+  m->cases++;
+
+  // The sentinels catch writes past the end of a row or the output
+  int halfW = width / 2, halfH = height / 2;
+  std::vector<uint8_t> downV((size_t)(halfW + 1) * halfH + 1, 0x5A), downS = downV;
+  vec::downscale2x(src.data(), width, height, stride, downV.data(), halfW + 1);
+  scalar::downscale2x(src.data(), width, height, stride, downS.data(), halfW + 1);
+  if (!same(downV, downS)) {
+    m->downscale++;
+    report("downscale2x", width, height, stride, pattern);
+  }
+
+  std::vector<uint8_t> blurV((size_t)width * height + 1, 0x5A), blurS = blurV;
+  vec::boxBlur3(src.data(), width, height, stride, blurV.data());
+  scalar::boxBlur3(src.data(), width, height, stride, blurS.data());
+  if (!same(blurV, blurS)) {
+    m->blur++;
+    report("boxBlur3", width, height, stride, pattern);
+  }
+
+  int istride = width + 1;
+  std::vector<uint32_t> intV((size_t)istride * (height + 1) + 1, 0x5A5A5A5A), intS = intV;
+  vec::integralImage(src.data(), width, height, stride, intV.data());
+  scalar::integralImage(src.data(), width, height, stride, intS.data());
+  if (!same(intV, intS)) {
+    m->integral++;
+    report("integralImage", width, height, stride, pattern);
+    return;
+  }
+
+  // Radii the estimator uses and a few more; x0 shifted so the groups of
+  // four start at every alignment
+  for (int r : {2, 3, eyeRadius(width), 8}) {
+    int outer = 3 * r;
+    if (width <= 2 * outer + 1 || height <= 2 * outer + 1) {
+      continue;
+    }
+    for (int shift = 0; shift < 4 && outer + shift < width - outer; shift++) {
+      int x0 = outer + shift, x1 = width - outer;
+      std::vector<int32_t> rowV(x1 - x0 + 1, 0x5A5A5A5A), rowS = rowV;
+      for (int y = outer; y < height - outer; y++) {
+        vec::blobContrastRow(intV.data(), istride, y, r, outer, x0, x1, rowV.data());
+        scalar::blobContrastRow(intV.data(), istride, y, r, outer, x0, x1, rowS.data());
+        if (!same(rowV, rowS)) {
+          m->contrast++;
+          char extra[64];
+          snprintf(extra, sizeof(extra), ", r %d x0 %d row %d", r, x0, y);
+          report("blobContrastRow", width, height, stride, pattern, extra);
+          break;
+        }
+      }
+    }
+  }
+}
+
+static Mismatches compareAll() {
+  static const int WIDTHS[] = {3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 64, 97, 160, 161, 200, 320};
+  static const int HEIGHTS[] = {3, 4, 9, 30, 120, 121, 240};
+  Mismatches m;
+  uint32_t seed = 1;
+  for (int width : WIDTHS) {
+    for (int height : HEIGHTS) {
+      for (int pad : {0, 3}) {
+        for (int p = 0; p < PATTERN_COUNT; p++) {
+          compareAt(width, height, pad, (Pattern)p, seed++, &m);
+        }
+      }
+    }
+  }
+  return m;
+}
+
+// ==========================================
+// TIMING
+// ==========================================
+#define TIME_BATCHES 5
+#define TIME_BATCH_NS 20000000 // each batch runs at least this long
+
+// Best batch, in nanoseconds per call
+template <typename Fn> static double bestNs(Fn fn) {
+  double best = 0;
+  for (int batch = 0; batch < TIME_BATCHES; batch++) {
+    uint32_t calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    double ns;
+    do {
+      fn();
+      calls++;
+      ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+               .count();
+    } while (ns < TIME_BATCH_NS);
+    if (batch == 0 || ns / calls < best) {
+      best = ns / calls;
+    }
+  }
+  return best;
+}
+
+struct KernelTimes {
+  double blur, integral, contrast, frame; // ns per pixel of the frame
+};
+
+template <typename Blur, typename Integral, typename Contrast>
+static KernelTimes timeKernels(int width, int height, Blur blur, Integral integral,
+                               Contrast contrast) {
+  std::vector<uint8_t> src, blurred((size_t)width * height);
+  fill(src, width, height, width, PATTERN_FACE, 7);
+  std::vector<uint32_t> table((size_t)(width + 1) * (height + 1));
+  std::vector<int32_t> row(width);
+  int r = eyeRadius(width), outer = 3 * r;
+  int yEnd = height * 3 / 4; // the rows the estimator scans
+  double pixels = (double)width * height;
+  blur(src.data(), width, height, width, blurred.data());
+  integral(blurred.data(), width, height, width, table.data());
+
+  KernelTimes t;
+  t.blur = bestNs([&] { blur(src.data(), width, height, width, blurred.data()); }) / pixels;
+  t.integral =
+      bestNs([&] { integral(blurred.data(), width, height, width, table.data()); }) / pixels;
+  t.contrast = bestNs([&] {
+                 for (int y = outer; y < yEnd; y++) {
+                   contrast(table.data(), width + 1, y, r, outer, outer, width - outer,
+                            row.data());
+                 }
+               }) /
+               pixels;
+  t.frame = t.blur + t.integral + t.contrast;
+  return t;
+}
+
+struct SizeResult {
+  const char *name;
+  int width, height;
+  KernelTimes scalar, vector;
+};
+
+int main(int argc, char **argv) {
+  bool json = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else {
+      fprintf(stderr, "usage: %s [--tag name] [--json]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  Mismatches m = compareAll();
+  SizeResult sizes[] = {{"qqvga", 160, 120, {}, {}}, {"qvga", 320, 240, {}, {}}};
+  for (SizeResult &s : sizes) {
+    s.scalar = timeKernels(s.width, s.height, scalar::boxBlur3, scalar::integralImage,
+                           scalar::blobContrastRow);
+    s.vector = timeKernels(s.width, s.height, vec::boxBlur3, vec::integralImage,
+                           vec::blobContrastRow);
+  }
+  bool ok = m.total() == 0;
+
+  if (json) {
+    printf("{\"tag\":\"%s\",\"vector_path\":%s,\"cases\":%u,\"mismatches\":{\"downscale2x\":%u,"
+           "\"boxBlur3\":%u,\"integralImage\":%u,\"blobContrastRow\":%u},\"ns_per_pixel\":{",
+           tag, HAVE_VECTOR ? "true" : "false", m.cases, m.downscale, m.blur, m.integral,
+           m.contrast);
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+      const SizeResult &s = sizes[i];
+      printf("%s\"%s\":{", i ? "," : "", s.name);
+      const KernelTimes *paths[] = {&s.scalar, &s.vector};
+      for (int p = 0; p < 2; p++) {
+        printf("%s\"%s\":{\"boxBlur3\":%.3f,\"integralImage\":%.3f,\"blobContrastRow\":%.3f,"
+               "\"frame\":%.3f}",
+               p ? "," : "", p ? "vector" : "scalar", paths[p]->blur, paths[p]->integral,
+               paths[p]->contrast, paths[p]->frame);
+      }
+      printf("}");
+    }
+    printf("},\"ok\":%s}\n", ok ? "true" : "false");
+    return ok ? 0 : 1;
+  }
+
+  printf("scalar vs %s: %u cases, differing downscale2x %u, boxBlur3 %u, integralImage %u, "
+         "blobContrastRow %u\n",
+         HAVE_VECTOR ? "vector" : "scalar (no vector path on this machine)", m.cases,
+         m.downscale, m.blur, m.integral, m.contrast);
+  printf("ns per pixel     %-22s %-22s\n", "scalar", "vector");
+  for (const SizeResult &s : sizes) {
+    printf("%s %dx%d\n", s.name, s.width, s.height);
+    printf("  boxBlur3       %6.3f %21.3f (x%.1f)\n", s.scalar.blur, s.vector.blur,
+           s.scalar.blur / s.vector.blur);
+    printf("  integralImage  %6.3f %21.3f (x%.1f)\n", s.scalar.integral, s.vector.integral,
+           s.scalar.integral / s.vector.integral);
+    printf("  blob contrast  %6.3f %21.3f (x%.1f)\n", s.scalar.contrast, s.vector.contrast,
+           s.scalar.contrast / s.vector.contrast);
+    printf("  whole frame    %6.3f %21.3f (x%.1f), %.0f us a frame with the vector path\n",
+           s.scalar.frame, s.vector.frame, s.scalar.frame / s.vector.frame,
+           s.vector.frame * s.width * s.height / 1000);
+  }
+  printf("%s\n", ok ? "OK" : "FAIL");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,285 @@
+// Stress test and microbenchmark for LatestFrame (latest_frame.h).
+//
+// Stress: a publisher thread takes buffers from a fake driver (fb_count
+// buffers, handed out and taken back like esp_camera_fb_get/_return) and
+// publishes each one; N reader threads pin the newest frame, check it and
+// release it, as the HTTP handlers and the tracker do. Fails if
+//   - a buffer goes back to the driver twice, or while it is not lent out,
+//   - a reader sees a buffer that was already given back (use after
+//     return), or whose contents do not belong to the seq it was pinned as
+//     (torn or recycled under the reader),
+//   - a reader sees seq go backwards.
+//
+// Benchmark: nanoseconds per publish with no readers, per acquire+release
+// with no publisher, and both with every reader running.
+//
+// Build and run on Linux from the repository root:
+//   g++ -O2 -pthread -I. tools/latest_frame_bench.cpp -o latest_frame_bench
+//   ./latest_frame_bench
+//   ./latest_frame_bench --readers 8 --frames 5000000 --json --tag "$(git rev-parse --short HEAD)"
+// Exits 1 if the stress test found a problem.
+
+#include "latest_frame.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define FB_COUNT 3 // what setupCamera() asks for with PSRAM
+#define SLOTS FB_COUNT
+#define FRAME_BYTES 256
+
+// ==========================================
+// FAKE DRIVER
+// ==========================================
+#define BUFFER_FREE 0
+#define BUFFER_LENT 1
+
+struct FakeFrame {
+  uint32_t stamp; // seq the publisher wrote into it
+  size_t len;
+  std::atomic<int> state{BUFFER_FREE};
+  uint8_t buf[FRAME_BYTES];
+};
+
+static FakeFrame frames[FB_COUNT];
+static std::mutex driverLock; // the driver's own queue is locked too
+static std::vector<FakeFrame *> driverFree;
+static std::atomic<uint32_t> badReturns{0};
+
+static FakeFrame *driverGet() {
+  std::lock_guard<std::mutex> lock(driverLock);
+  if (driverFree.empty()) {
+    return nullptr;
+  }
+  FakeFrame *fb = driverFree.back();
+  driverFree.pop_back();
+  if (fb->state.exchange(BUFFER_LENT) != BUFFER_FREE) {
+    badReturns++;
+  }
+  return fb;
+}
+
+static void driverReturn(FakeFrame *fb) {
+  if (fb->state.exchange(BUFFER_FREE) != BUFFER_LENT) {
+    badReturns++; // returned twice, or never handed out
+    return;
+  }
+  std::lock_guard<std::mutex> lock(driverLock);
+  driverFree.push_back(fb);
+}
+
+static void resetDriver() {
+  std::lock_guard<std::mutex> lock(driverLock);
+  driverFree.clear();
+  for (FakeFrame &f : frames) {
+    f.state.store(BUFFER_FREE);
+    driverFree.push_back(&f);
+  }
+}
+
+// Blocks like the driver while every buffer is still held downstream
+static FakeFrame *driverGetBlocking(const std::atomic<bool> &stop) {
+  for (;;) {
+    FakeFrame *fb = driverGet();
+    if (fb || stop.load(std::memory_order_relaxed)) {
+      return fb;
+    }
+    std::this_thread::yield();
+  }
+}
+
+// ==========================================
+// STRESS TEST
+// ==========================================
+struct StressResult {
+  uint32_t published = 0;
+  uint32_t dropped = 0; // publish() found no free slot
+  uint64_t reads = 0;
+  uint32_t useAfterReturn = 0;
+  uint32_t torn = 0;
+  uint32_t backwards = 0;
+  uint32_t badReturns = 0;
+  uint32_t leaked = 0; // buffers still lent out at the end, besides the newest
+  double acquireNs = 0; // acquire + release with the publisher running
+  double publishNs = 0; // with the readers running
+};
+
+static StressResult stress(int readers, uint32_t target) {
+  resetDriver();
+  badReturns = 0;
+  StressResult result;
+  std::atomic<uint32_t> useAfterReturn{0}, torn{0}, backwards{0};
+  std::atomic<uint64_t> reads{0}, readNs{0};
+  std::atomic<bool> stop{false};
+  {
+    LatestFrame<FakeFrame, SLOTS> latest(driverReturn);
+    std::vector<std::thread> threads;
+    for (int r = 0; r < readers; r++) {
+      threads.emplace_back([&] {
+        uint32_t last = 0;
+        uint64_t n = 0;
+        auto start = std::chrono::steady_clock::now();
+        while (!stop.load(std::memory_order_relaxed)) {
+          const PinnedFrame<FakeFrame> *pinned = latest.acquire();
+          if (!pinned) {
+            continue;
+          }
+          FakeFrame *fb = pinned->frame;
+          if (fb->state.load() != BUFFER_LENT) {
+            useAfterReturn++;
+          }
+          if (fb->stamp != pinned->seq) {
+            torn++;
+          }
+          uint8_t fill = (uint8_t)pinned->seq;
+          for (size_t i = 0; i < fb->len; i++) {
+            if (fb->buf[i] != fill) {
+              torn++;
+              break;
+            }
+          }
+          if (pinned->seq < last) {
+            backwards++;
+          }
+          last = pinned->seq;
+          // Still lent out after reading it all
+          if (fb->state.load() != BUFFER_LENT) {
+            useAfterReturn++;
+          }
+          latest.release(pinned);
+          n++;
+        }
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+        reads += n;
+        readNs += n ? ns : 0;
+      });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    uint32_t seq = 0;
+    while (result.published < target) {
+      FakeFrame *fb = driverGetBlocking(stop);
+      // The seq publish() will give it, if a slot is free
+      fb->stamp = seq + 1;
+      fb->len = FRAME_BYTES / 2 + (seq % (FRAME_BYTES / 2));
+      memset(fb->buf, (uint8_t)(seq + 1), fb->len);
+      if (latest.publish(fb)) {
+        seq++;
+        result.published++;
+      } else {
+        result.dropped++;
+      }
+    }
+    result.publishNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count() /
+                       (double)(result.published + result.dropped);
+    stop = true;
+    for (std::thread &t : threads) {
+      t.join();
+    }
+    // Only the newest frame may still be lent out
+    const PinnedFrame<FakeFrame> *newest = latest.acquire();
+    for (FakeFrame &f : frames) {
+      result.leaked += f.state.load() != BUFFER_FREE && (!newest || &f != newest->frame);
+    }
+    // ...and it is the last one published
+    if (!newest || newest->seq != seq) {
+      backwards++;
+    }
+    if (newest) {
+      latest.release(newest);
+    }
+  }
+  result.reads = reads.load();
+  result.acquireNs = result.reads ? (double)readNs.load() * readers / result.reads : 0;
+  result.useAfterReturn = useAfterReturn.load();
+  result.torn = torn.load();
+  result.backwards = backwards.load();
+  result.badReturns = badReturns.load();
+  return result;
+}
+
+// ==========================================
+// MICROBENCHMARK
+// ==========================================
+template <typename Fn> static double nsPerOp(uint32_t ops, Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < ops; i++) {
+    fn();
+  }
+  auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count();
+  return (double)ns / ops;
+}
+
+// Uncontended: publish alone (every buffer goes straight back when the
+// next one replaces it), then acquire+release alone on a fixed frame
+static void uncontended(uint32_t ops, double *publishNs, double *acquireNs) {
+  resetDriver();
+  LatestFrame<FakeFrame, SLOTS> latest(driverReturn);
+  std::atomic<bool> never{false};
+  *publishNs = nsPerOp(ops, [&] { latest.publish(driverGetBlocking(never)); });
+  *acquireNs = nsPerOp(ops, [&] { latest.release(latest.acquire()); });
+}
+
+int main(int argc, char **argv) {
+  int readers = 4;
+  uint32_t target = 2000000;
+  bool json = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--readers") && i + 1 < argc) {
+      readers = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--frames") && i + 1 < argc) {
+      target = strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else {
+      readers = 0;
+      break;
+    }
+  }
+  if (readers < 1 || target == 0) {
+    fprintf(stderr, "usage: %s [--readers n] [--frames n] [--tag name] [--json]\n", argv[0]);
+    return 2;
+  }
+
+  double publishNs, acquireNs;
+  uncontended(target, &publishNs, &acquireNs);
+  StressResult r = stress(readers, target);
+  bool ok = r.useAfterReturn == 0 && r.torn == 0 && r.backwards == 0 && r.badReturns == 0 &&
+            r.leaked == 0;
+
+  if (json) {
+    printf("{\"tag\":\"%s\",\"readers\":%d,\"published\":%u,\"dropped\":%u,\"reads\":%llu,"
+           "\"use_after_return\":%u,\"torn\":%u,\"backwards\":%u,\"bad_returns\":%u,"
+           "\"leaked\":%u,\"publish_ns\":%.1f,\"acquire_release_ns\":%.1f,"
+           "\"contended_publish_ns\":%.1f,\"contended_acquire_release_ns\":%.1f,\"ok\":%s}\n",
+           tag, readers, r.published, r.dropped, (unsigned long long)r.reads, r.useAfterReturn,
+           r.torn, r.backwards, r.badReturns, r.leaked, publishNs, acquireNs, r.publishNs,
+           r.acquireNs, ok ? "true" : "false");
+  } else {
+    printf("stress: %d readers, %u frames published (%u with no free slot), %llu reads\n",
+           readers, r.published, r.dropped, (unsigned long long)r.reads);
+    printf("  use after return %u, torn %u, seq backwards %u, bad returns %u, leaked %u\n",
+           r.useAfterReturn, r.torn, r.backwards, r.badReturns, r.leaked);
+    printf("cost per call          alone   with %d readers\n", readers);
+    printf("  publish          %7.1f ns   %7.1f ns\n", publishNs, r.publishNs);
+    printf("  acquire+release  %7.1f ns   %7.1f ns\n", acquireNs, r.acquireNs);
+    printf("%s\n", ok ? "OK" : "FAIL");
+  }
+  return ok ? 0 : 1;
+}
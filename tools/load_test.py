@@ -0,0 +1,328 @@
+#!/usr/bin/env python3
+"""Load-test the ESP32-CAM web server: throughput and latency percentiles.
+
+Runs N concurrent clients against one endpoint for a fixed time and reports
+requests/s, payload rate and latency percentiles. Frames carry their capture
+time (X-Capture-Ms); after syncing clocks with /time, the age of each frame
+on arrival is reported too, together with the firmware build it came from.
+For numbers that are comparable between runs, build the sketch with
+CAMERA_SYNTHETIC so every run serves the same frames.
+
+Examples:
+  python tools/load_test.py 192.168.137.145                    # /capture
+  python tools/load_test.py 192.168.137.145 --path / --revalidate
+  python tools/load_test.py 192.168.137.145 --stream --clients 4
+  python tools/load_test.py 192.168.137.145 --stream --clients 4 --slow 2 --slow-kbps 40
+  python tools/load_test.py 192.168.137.145 --json > run.json
+"""
+
+import argparse
+import http.client
+import json
+import sys
+import threading
+import time
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return 0.0
+    index = min(len(sorted_values) - 1, max(0, int(round(p * len(sorted_values))) - 1))
+    return sorted_values[index]
+
+
+class Results:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latencies = []  # seconds: request sent -> body complete
+        self.first_bytes = []  # seconds: request sent -> status line
+        self.ages = []  # seconds: frame captured -> body complete
+        self.bytes = 0
+        self.status = {}
+        self.errors = 0
+        self.skipped = 0  # stream: frames the device skipped for this client
+
+    def add(self, status, latency, first_byte, size, age=None):
+        with self.lock:
+            self.status[status] = self.status.get(status, 0) + 1
+            self.latencies.append(latency)
+            self.first_bytes.append(first_byte)
+            self.bytes += size
+            if age is not None:
+                self.ages.append(age)
+
+    def error(self):
+        with self.lock:
+            self.errors += 1
+
+
+def read_body(fp, length, kbps):
+    """Reads length bytes; a positive kbps throttles like a slow phone."""
+    if kbps <= 0:
+        return fp.read(length)
+    chunks = []
+    left = length
+    while left > 0:
+        chunk = fp.read(min(1460, left))
+        if not chunk:
+            break
+        chunks.append(chunk)
+        left -= len(chunk)
+        time.sleep(len(chunk) / (kbps * 1024.0))
+    return b"".join(chunks)
+
+
+class Clock:
+    """Maps device millis() onto time.monotonic() via /time round trips."""
+
+    def __init__(self, offset=None, rtt=0.0, build=""):
+        self.offset = offset  # device seconds - monotonic seconds
+        self.rtt = rtt
+        self.build = build
+
+    def age(self, capture_ms, now):
+        if self.offset is None or capture_ms is None:
+            return None
+        return now - (int(capture_ms) / 1000.0 - self.offset)
+
+
+def sync_clock(args, tries=8):
+    best = Clock()
+    for _ in range(tries):
+        try:
+            conn = http.client.HTTPConnection(args.host, args.port, timeout=args.timeout)
+            t0 = time.monotonic()
+            conn.request("GET", "/time")
+            resp = conn.getresponse()
+            body = resp.read()
+            t1 = time.monotonic()
+            conn.close()
+            if resp.status != 200:
+                return best
+            reply = json.loads(body)
+        except (OSError, ValueError, http.client.HTTPException):
+            continue
+        if best.offset is None or t1 - t0 < best.rtt:
+            best = Clock(reply["ms"] / 1000.0 - (t0 + t1) / 2, t1 - t0, reply.get("build", ""))
+    return best
+
+
+def request_client(args, results, deadline, kbps):
+    etag = None
+    while time.monotonic() < deadline:
+        conn = http.client.HTTPConnection(args.host, args.port, timeout=args.timeout)
+        headers = {"Accept-Encoding": "gzip"}
+        if etag:
+            headers["If-None-Match"] = etag
+        try:
+            start = time.monotonic()
+            conn.request("GET", args.path, headers=headers)
+            resp = conn.getresponse()
+            first = time.monotonic()
+            length = resp.getheader("Content-Length")
+            body = read_body(resp, int(length), kbps) if length else resp.read()
+            end = time.monotonic()
+            if args.revalidate:
+                etag = resp.getheader("ETag") or etag
+            results.add(resp.status, end - start, first - start, len(body),
+                        args.clock.age(resp.getheader("X-Capture-Ms"), end))
+        except (OSError, http.client.HTTPException):
+            results.error()
+            time.sleep(0.1)
+        finally:
+            conn.close()
+
+
+def stream_client(args, results, deadline, kbps):
+    """Counts multipart parts; latency is the gap between frames."""
+    conn = http.client.HTTPConnection(args.host, args.port, timeout=args.timeout)
+    try:
+        conn.request("GET", args.path)
+        resp = conn.getresponse()
+        if resp.status != 200:
+            results.add(resp.status, 0, 0, 0)
+            return
+        last = time.monotonic()
+        last_seq = None
+        while time.monotonic() < deadline:
+            # Part headers, blank line, body of Content-Length, CRLF
+            length = None
+            capture_ms = None
+            seq = None
+            while True:
+                line = resp.fp.readline()
+                if not line:
+                    raise EOFError()
+                line = line.strip()
+                if not line and length is not None:
+                    break
+                name, _, value = line.partition(b":")
+                name = name.lower()
+                if name == b"content-length":
+                    length = int(value)
+                elif name == b"x-capture-ms":
+                    capture_ms = int(value)
+                elif name == b"x-frame-seq":
+                    seq = int(value)
+            body = read_body(resp.fp, length, kbps)
+            resp.fp.readline()
+            now = time.monotonic()
+            results.add(200, now - last, 0, len(body), args.clock.age(capture_ms, now))
+            if seq is not None and last_seq is not None and seq > last_seq + 1:
+                with results.lock:
+                    results.skipped += seq - last_seq - 1
+            last_seq = seq
+            last = now
+    except (OSError, EOFError, ValueError, http.client.HTTPException):
+        results.error()
+    finally:
+        conn.close()
+
+
+def summarize(results, elapsed, stream):
+    lat = sorted(results.latencies)
+    ttfb = sorted(results.first_bytes)
+    count = len(lat)
+    summary = {
+        "responses": count,
+        "errors": results.errors,
+        "status": {str(k): v for k, v in sorted(results.status.items())},
+        "per_second": round(count / elapsed, 2) if elapsed else 0,
+        "kbytes_per_second": round(results.bytes / 1024 / elapsed, 1) if elapsed else 0,
+        "mean_bytes": int(results.bytes / count) if count else 0,
+        "latency_ms": {
+            "p50": round(percentile(lat, 0.5) * 1000, 1),
+            "p90": round(percentile(lat, 0.9) * 1000, 1),
+            "p99": round(percentile(lat, 0.99) * 1000, 1),
+            "max": round(lat[-1] * 1000, 1) if lat else 0,
+        },
+    }
+    if results.ages:
+        ages = sorted(results.ages)
+        summary["frame_age_ms"] = {
+            "p50": round(percentile(ages, 0.5) * 1000, 1),
+            "p90": round(percentile(ages, 0.9) * 1000, 1),
+            "p99": round(percentile(ages, 0.99) * 1000, 1),
+            "max": round(ages[-1] * 1000, 1),
+        }
+    if stream:
+        summary["frames_skipped"] = results.skipped
+    if not stream:
+        summary["first_byte_ms"] = {
+            "p50": round(percentile(ttfb, 0.5) * 1000, 1),
+            "p99": round(percentile(ttfb, 0.99) * 1000, 1),
+        }
+    return summary
+
+
+def print_summary(name, summary, stream):
+    what = "frames" if stream else "responses"
+    print("  %s: %d %s (%.1f/s), %d errors, status %s"
+          % (name, summary["responses"], what, summary["per_second"], summary["errors"],
+             summary["status"]))
+    print("    %.1f KB/s, %d bytes each on average"
+          % (summary["kbytes_per_second"], summary["mean_bytes"]))
+    label = "frame gap" if stream else "latency"
+    l = summary["latency_ms"]
+    print("    %s ms: p50 %.1f  p90 %.1f  p99 %.1f  max %.1f"
+          % (label, l["p50"], l["p90"], l["p99"], l["max"]))
+    if "frame_age_ms" in summary:
+        a = summary["frame_age_ms"]
+        print("    frame age ms (capture -> received): p50 %.1f  p90 %.1f  p99 %.1f  max %.1f"
+              % (a["p50"], a["p90"], a["p99"], a["max"]))
+    if stream:
+        print("    frames skipped by the device: %d" % summary["frames_skipped"])
+    if not stream:
+        f = summary["first_byte_ms"]
+        print("    first byte ms: p50 %.1f  p99 %.1f" % (f["p50"], f["p99"]))
+
+
+def fetch_metrics(args):
+    try:
+        conn = http.client.HTTPConnection(args.host, args.port, timeout=args.timeout)
+        conn.request("GET", "/metrics")
+        resp = conn.getresponse()
+        text = resp.read().decode("utf-8", "replace") if resp.status == 200 else ""
+        conn.close()
+        return text
+    except (OSError, http.client.HTTPException):
+        return ""
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", help="ESP32 IP address or host name")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--path", default=None, help="endpoint (default /capture, or /stream)")
+    parser.add_argument("--clients", type=int, default=4)
+    parser.add_argument("--seconds", type=float, default=10)
+    parser.add_argument("--timeout", type=float, default=5)
+    parser.add_argument("--stream", action="store_true",
+                        help="hold MJPEG streams open and time frame gaps")
+    parser.add_argument("--slow", type=int, default=0,
+                        help="how many of the clients read slowly")
+    parser.add_argument("--slow-kbps", type=float, default=30,
+                        help="read rate of the slow clients")
+    parser.add_argument("--revalidate", action="store_true",
+                        help="send If-None-Match with the last ETag (expects 304s)")
+    parser.add_argument("--json", action="store_true", help="machine-readable output")
+    args = parser.parse_args()
+    if args.path is None:
+        args.path = "/stream" if args.stream else "/capture"
+    args.clock = sync_clock(args)
+
+    # Slow clients are timed separately: the point is that they must not
+    # hold back the others
+    fast = Results()
+    slow = Results()
+    deadline = time.monotonic() + args.seconds
+    worker = stream_client if args.stream else request_client
+    threads = []
+    for i in range(args.clients):
+        is_slow = i < args.slow
+        threads.append(threading.Thread(
+            target=worker, daemon=True,
+            args=(args, slow if is_slow else fast, deadline, args.slow_kbps if is_slow else 0)))
+    started = time.monotonic()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join(args.seconds + args.timeout + 1)
+    elapsed = time.monotonic() - started
+
+    report = {
+        "path": args.path,
+        "mode": "stream" if args.stream else "request",
+        "clients": args.clients,
+        "slow_clients": args.slow,
+        "seconds": round(elapsed, 2),
+        "build": args.clock.build,
+        "clock_rtt_ms": round(args.clock.rtt * 1000, 1),
+        "fast": summarize(fast, elapsed, args.stream),
+    }
+    if args.slow:
+        report["slow"] = summarize(slow, elapsed, args.stream)
+    metrics = fetch_metrics(args)
+
+    if args.json:
+        report["device_metrics"] = metrics
+        json.dump(report, sys.stdout, indent=2)
+        print()
+        return 0
+
+    print("%s  %d clients (%d slow)  %.1f s" % (args.path, args.clients, args.slow, elapsed))
+    if args.clock.offset is not None:
+        print("firmware %s, clock synced to +/-%.1f ms"
+              % (args.clock.build, args.clock.rtt * 500))
+    print_summary("clients" if not args.slow else "fast clients", report["fast"], args.stream)
+    if args.slow:
+        print_summary("slow clients", report["slow"], args.stream)
+    if metrics:
+        print("device /metrics:")
+        for line in metrics.splitlines():
+            print("  " + line)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
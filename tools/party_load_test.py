@@ -0,0 +1,363 @@
+#!/usr/bin/env python3
+"""Load-test party mode: several simulated cameras sharing one face model.
+
+Starts N fake ESP32-CAM servers on this machine, each serving /capture at
+its own frame rate and latency, then runs the page's party scheduler
+against them with a fixed model time per frame and reports, per camera,
+frames fetched and tracked per second, its share of the model, and how old
+its frames were when tracked (request midpoint -> model done, which is how
+stale that player's lane is). Fairness is Jain's index over each camera's
+tracked rate divided by its max-min fair share of the model (1.0 = every
+camera got its share): a camera that can deliver less than an equal share
+gets all it delivers, and the others split the rest equally.
+
+Two policies:
+  fair  what index.html does: one /capture in flight and at most one frame
+        waiting per camera; the model takes the waiting frame of the camera
+        it served longest ago
+  fifo  for comparison: every camera fetches as fast as it can into one
+        shared queue (oldest frames dropped past 2 per camera) and the
+        model takes frames in arrival order
+
+--serve-only just runs the cameras, so the real page can be pointed at
+them (Camera IP 127.0.0.1:8101, More Cameras 127.0.0.1:8102, ...); give it
+a real JPEG with --image for the model to find a face in.
+
+Examples:
+  python tools/party_load_test.py                                # 3 cameras
+  python tools/party_load_test.py --fps 25,10,5 --latency 20,60,150 --infer-ms 40
+  python tools/party_load_test.py --policy fifo --json > fifo.json
+  python tools/party_load_test.py --serve-only --image face.jpg
+"""
+
+import argparse
+import collections
+import http.client
+import http.server
+import json
+import os
+import random
+import sys
+import threading
+import time
+
+from load_test import percentile
+
+
+def per_camera(text, count, cast):
+    """'25,10' -> [25, 10, 10, ...]: the last value repeats."""
+    values = [cast(v) for v in str(text).split(",") if v.strip()]
+    return [values[min(i, len(values) - 1)] for i in range(count)]
+
+
+# ==========================================
+# SIMULATED CAMERAS
+# ==========================================
+
+class Camera:
+    def __init__(self, index, fps, latency_ms, jitter_ms, payload):
+        self.index = index
+        self.period = 1.0 / fps
+        self.latency = latency_ms / 1000.0
+        self.jitter = jitter_ms / 1000.0
+        self.payload = payload
+        self.started = time.monotonic()
+        self.lock = threading.Lock()
+        self.seq = 0
+        self.served = 0
+
+    def next_frame(self):
+        """Waits for the sensor's next frame, as /capture does."""
+        now = time.monotonic()
+        frames = int((now - self.started) / self.period) + 1
+        time.sleep(max(0.0, self.started + frames * self.period - now))
+        with self.lock:
+            self.seq += 1
+            self.served += 1
+            return self.seq, int((time.monotonic() - self.started) * 1000)
+
+
+def make_handler(camera):
+    class Handler(http.server.BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.1"
+
+        def do_GET(self):
+            if self.path.split("?")[0] != "/capture":
+                self.send_error(404)
+                return
+            seq, capture_ms = camera.next_frame()
+            time.sleep(max(0.0, camera.latency + random.uniform(-camera.jitter, camera.jitter)))
+            self.send_response(200)
+            self.send_header("Content-Type", "image/jpeg")
+            self.send_header("Content-Length", str(len(camera.payload)))
+            self.send_header("Cache-Control", "no-store")
+            self.send_header("X-Frame-Seq", str(seq))
+            self.send_header("X-Capture-Ms", str(capture_ms))
+            self.send_header("Access-Control-Allow-Origin", "*")
+            self.send_header("Access-Control-Expose-Headers", "X-Frame-Seq, X-Capture-Ms")
+            self.end_headers()
+            self.wfile.write(camera.payload)
+
+        def log_message(self, *args):
+            pass
+
+    return Handler
+
+
+def start_cameras(args, payload):
+    fps = per_camera(args.fps, args.cameras, float)
+    latency = per_camera(args.latency, args.cameras, float)
+    cameras, servers = [], []
+    for i in range(args.cameras):
+        camera = Camera(i, fps[i], latency[i], args.jitter, payload)
+        server = http.server.ThreadingHTTPServer((args.bind, args.base_port + i), make_handler(camera))
+        server.daemon_threads = True
+        threading.Thread(target=server.serve_forever, daemon=True).start()
+        cameras.append(camera)
+        servers.append(server)
+    return cameras, servers
+
+
+# ==========================================
+# PARTY SCHEDULER (as in index.html)
+# ==========================================
+
+class Source:
+    """One camera as the page sees it."""
+
+    def __init__(self, index, host, port):
+        self.index = index
+        self.host = host
+        self.port = port
+        self.pending = None  # (frame time, bytes) waiting for the model
+        self.served_at = 0.0
+        self.fetched = 0
+        self.tracked = 0
+        self.errors = 0
+        self.busy = 0.0  # seconds spent in successful requests
+        self.ages = []  # seconds: frame time -> model done
+        self.gaps = []  # seconds between tracked frames
+
+
+def fetch(source, conn, args):
+    """One /capture; returns (frame time, payload) or None."""
+    sent = time.monotonic()
+    try:
+        conn.request("GET", "/capture")
+        resp = conn.getresponse()
+        body = resp.read()
+        if resp.status != 200:
+            raise http.client.HTTPException("status %d" % resp.status)
+    except (OSError, http.client.HTTPException):
+        source.errors += 1
+        conn.close()
+        time.sleep(0.25)
+        return None
+    source.fetched += 1
+    source.busy += time.monotonic() - sent
+    # Each camera has its own clock: take the middle of the request
+    return ((sent + time.monotonic()) / 2, body)
+
+
+def fair_fetcher(source, args, cond, deadline):
+    conn = http.client.HTTPConnection(source.host, source.port, timeout=args.timeout)
+    while time.monotonic() < deadline:
+        with cond:
+            while source.pending is not None and time.monotonic() < deadline:
+                cond.wait(0.05)
+        frame = fetch(source, conn, args)
+        if frame is None:
+            continue
+        with cond:
+            source.pending = frame
+            cond.notify_all()
+
+
+def fifo_fetcher(source, args, cond, queue, deadline):
+    conn = http.client.HTTPConnection(source.host, source.port, timeout=args.timeout)
+    while time.monotonic() < deadline:
+        frame = fetch(source, conn, args)
+        if frame is None:
+            continue
+        with cond:
+            queue.append((source, frame))
+            if len(queue) > 2 * args.cameras:
+                queue.popleft()
+            cond.notify_all()
+
+
+def run_model(source, frame_time, args):
+    time.sleep(args.infer_ms / 1000.0)
+    done = time.monotonic()
+    if source.served_at:
+        source.gaps.append(done - source.served_at)
+    source.served_at = done
+    source.tracked += 1
+    source.ages.append(done - frame_time)
+
+
+def run_client(args, sources):
+    cond = threading.Condition()
+    queue = collections.deque()
+    deadline = time.monotonic() + args.seconds
+    for source in sources:
+        if args.policy == "fair":
+            target, extra = fair_fetcher, (args, cond, deadline)
+        else:
+            target, extra = fifo_fetcher, (args, cond, queue, deadline)
+        threading.Thread(target=target, args=(source,) + extra, daemon=True).start()
+
+    started = time.monotonic()
+    while time.monotonic() < deadline:
+        with cond:
+            if args.policy == "fair":
+                waiting = [s for s in sources if s.pending is not None]
+                if not waiting:
+                    cond.wait(0.005)
+                    continue
+                source = min(waiting, key=lambda s: s.served_at)
+                frame_time, _ = source.pending
+                source.pending = None
+                cond.notify_all()
+            else:
+                if not queue:
+                    cond.wait(0.005)
+                    continue
+                source, (frame_time, _) = queue.popleft()
+        run_model(source, frame_time, args)
+    return time.monotonic() - started
+
+
+def fair_shares(demands, capacity):
+    """Max-min fair split of capacity (water-filling)."""
+    shares = [0.0] * len(demands)
+    left = sorted(range(len(demands)), key=lambda i: demands[i])
+    while left:
+        each = capacity / len(left)
+        i = left[0]
+        if demands[i] > each:
+            for j in left:
+                shares[j] = each
+            break
+        shares[i] = demands[i]
+        capacity -= demands[i]
+        left.pop(0)
+    return shares
+
+
+def jain(values):
+    total = sum(values)
+    squares = sum(v * v for v in values)
+    return total * total / (len(values) * squares) if squares else 0.0
+
+
+def summarize(sources, cameras, elapsed, infer_ms):
+    tracked = sum(s.tracked for s in sources)
+    # What each camera could deliver on its own: one request after another
+    demands = [s.fetched / s.busy if s.busy else 0.0 for s in sources]
+    shares = fair_shares(demands, 1000.0 / infer_ms if infer_ms > 0 else float("inf"))
+    report = []
+    for source, camera, share in zip(sources, cameras, shares):
+        ages = sorted(source.ages)
+        gaps = sorted(source.gaps)
+        report.append({
+            "camera": source.index + 1,
+            "camera_fps": round(1.0 / camera.period, 1),
+            "latency_ms": round(camera.latency * 1000, 1),
+            "fetched_per_second": round(source.fetched / elapsed, 2),
+            "tracked_per_second": round(source.tracked / elapsed, 2),
+            "fair_share_per_second": round(share, 2),
+            "model_share": round(source.tracked / tracked, 3) if tracked else 0.0,
+            "errors": source.errors,
+            "frame_age_ms": {
+                "p50": round(percentile(ages, 0.5) * 1000, 1),
+                "p99": round(percentile(ages, 0.99) * 1000, 1),
+            },
+            "gap_ms": {
+                "p50": round(percentile(gaps, 0.5) * 1000, 1),
+                "p99": round(percentile(gaps, 0.99) * 1000, 1),
+            },
+        })
+    return report
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--cameras", type=int, default=3)
+    parser.add_argument("--fps", default="25,15,8",
+                        help="frame rate per camera, comma separated (the last repeats)")
+    parser.add_argument("--latency", default="20,60,120",
+                        help="ms from frame to response per camera (the last repeats)")
+    parser.add_argument("--jitter", type=float, default=10, help="+/- ms on every response")
+    parser.add_argument("--infer-ms", type=float, default=80, help="model time per frame")
+    parser.add_argument("--policy", choices=["fair", "fifo"], default="fair")
+    parser.add_argument("--seconds", type=float, default=10)
+    parser.add_argument("--timeout", type=float, default=5)
+    parser.add_argument("--bind", default="127.0.0.1")
+    parser.add_argument("--base-port", type=int, default=8101)
+    parser.add_argument("--image", help="JPEG to serve (default: random bytes)")
+    parser.add_argument("--bytes", type=int, default=20000, help="random payload size")
+    parser.add_argument("--serve-only", action="store_true",
+                        help="only run the cameras, for the real page")
+    parser.add_argument("--json", action="store_true", help="machine-readable output")
+    args = parser.parse_args()
+    args.cameras = max(1, min(args.cameras, 4))  # the page's MAX_PLAYERS
+
+    if args.image:
+        with open(args.image, "rb") as f:
+            payload = f.read()
+    else:
+        payload = os.urandom(args.bytes)
+    cameras, servers = start_cameras(args, payload)
+
+    if args.serve_only:
+        for camera in cameras:
+            print("P%d  http://%s:%d/capture  %.1f fps, %.0f ms"
+                  % (camera.index + 1, args.bind, args.base_port + camera.index,
+                     1.0 / camera.period, camera.latency * 1000))
+        print("Ctrl-C to stop")
+        try:
+            while True:
+                time.sleep(1)
+        except KeyboardInterrupt:
+            return 0
+
+    sources = [Source(i, args.bind, args.base_port + i) for i in range(args.cameras)]
+    elapsed = run_client(args, sources)
+    for server in servers:
+        server.shutdown()
+    per_source = summarize(sources, cameras, elapsed, args.infer_ms)
+    report = {
+        "policy": args.policy,
+        "cameras": args.cameras,
+        "infer_ms": args.infer_ms,
+        "seconds": round(elapsed, 2),
+        "model_runs_per_second": round(sum(s.tracked for s in sources) / elapsed, 2),
+        "jain_fairness": round(jain([s["tracked_per_second"] / s["fair_share_per_second"]
+                                     for s in per_source if s["fair_share_per_second"] > 0]), 3),
+        "sources": per_source,
+    }
+
+    if args.json:
+        json.dump(report, sys.stdout, indent=2)
+        print()
+        return 0
+
+    print("%s policy  %d cameras  model %.0f ms/frame  %.1f s"
+          % (args.policy, args.cameras, args.infer_ms, elapsed))
+    print("  %.1f model runs/s, Jain fairness %.3f"
+          % (report["model_runs_per_second"], report["jain_fairness"]))
+    for s in per_source:
+        print("  P%d (%.0f fps, %.0f ms): fetched %.1f/s, tracked %.1f/s of a fair %.1f/s"
+              " (%.0f%% of the model), %d errors"
+              % (s["camera"], s["camera_fps"], s["latency_ms"], s["fetched_per_second"],
+                 s["tracked_per_second"], s["fair_share_per_second"], s["model_share"] * 100,
+                 s["errors"]))
+        print("    frame age ms: p50 %.1f  p99 %.1f   gap between tracked frames ms: p50 %.1f  p99 %.1f"
+              % (s["frame_age_ms"]["p50"], s["frame_age_ms"]["p99"],
+                 s["gap_ms"]["p50"], s["gap_ms"]["p99"]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,310 @@
+// Drives the adaptive quality controller (quality_controller.h) with a
+// simulated stream over synthetic bandwidth traces and checks how it
+// steps: how soon it steps down after the link drops, that it settles
+// instead of oscillating on a steady link, and that it waits out its
+// cooldown after every change.
+//
+// The stream is modelled on serviceViewers(): the camera has a new frame
+// every CAMERA_MS, the next one goes out as soon as the last has been
+// sent, and a frame of the current level's size takes bytes / bandwidth
+// plus a round trip to send. The page reports the frame rate it received
+// once a second. Frame sizes per level are about what the OV2640 makes of
+// a face at the PSRAM ladder's settings.
+//
+// Fails if on any trace
+//   - the first step down comes more than two windows after the drop, or
+//     the level does not hold the target again within one step per
+//     cooldown plus a window,
+//   - the level changes more than once in the second half of a steady
+//     trace (after settling), or steps up and back down there,
+//   - a change follows another sooner than the cooldown allows, or a step
+//     up comes without the windows of headroom it needs.
+//
+// Build and run on Linux from the repository root:
+//   g++ -O2 -I. tools/quality_check.cpp quality_controller.cpp -o quality_check
+//   ./quality_check
+//   ./quality_check --json --tag "$(git rev-parse --short HEAD)"
+// Exits 1 if a check failed.
+
+#include "quality_controller.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+// As in quality_controller.cpp
+#define WINDOW_MS 1000
+#define COOLDOWN_WINDOWS 1
+#define UP_WINDOWS 3
+
+// As in the .ino
+#define TARGET_FPS 15
+#define LATENCY_BUDGET_MS 60
+#define CAMERA_MS 40 // 25 fps out of the sensor
+#define CLIENT_REPORT_MS 1000
+#define TICK_MS 5 // httpTask calls updateQuality() about this often
+
+#define RTT_MS 4
+
+// The PSRAM ladder, with about the bytes per frame of each
+static const QualityLevel LADDER[] = {{5, 15}, {6, 14}, {7, 12}, {8, 14}, {8, 10}};
+static const uint32_t LEVEL_BYTES[] = {7000, 11000, 16000, 24000, 34000};
+static const char *LEVEL_NAMES[] = {"QVGA q15", "CIF q14", "HVGA q12", "VGA q14", "VGA q10"};
+#define LEVELS (sizeof(LADDER) / sizeof(LADDER[0]))
+
+// Bandwidth in kilobytes per second from atMs on
+struct Segment {
+  uint32_t atMs;
+  float kBps;
+};
+
+struct Trace {
+  const char *name;
+  std::vector<Segment> segments;
+  uint32_t lengthMs;
+  float jitter; // +- fraction of the bandwidth, changing every 100 ms
+  bool steady;  // one bandwidth throughout: must settle
+};
+
+// Level i keeps the target at kBps when a frame takes under a frame period
+static float kBpsFor(size_t level, float fps) {
+  return LEVEL_BYTES[level] / (1000.0f / fps - RTT_MS);
+}
+
+static float bandwidthAt(const Trace &trace, uint32_t ms, uint32_t *rng) {
+  float kBps = trace.segments[0].kBps;
+  for (const Segment &s : trace.segments) {
+    if (ms >= s.atMs) {
+      kBps = s.kBps;
+    }
+  }
+  if (trace.jitter > 0) {
+    uint32_t slot = ms / 100;
+    uint32_t h = slot * 2654435761u ^ *rng;
+    h ^= h >> 15;
+    h *= 2246822519u;
+    h ^= h >> 13;
+    kBps *= 1 + trace.jitter * ((h & 0xffff) / 32768.0f - 1);
+  }
+  return kBps;
+}
+
+// Highest level that holds the target at this bandwidth, with the
+// controller's own margins
+static size_t sustainableLevel(float kBps) {
+  size_t best = 0;
+  for (size_t i = 0; i < LEVELS; i++) {
+    float sendMs = LEVEL_BYTES[i] / kBps + RTT_MS;
+    float fps = fminf(1000.0f / CAMERA_MS, 1000.0f / fmaxf(sendMs, CAMERA_MS));
+    if (fps >= TARGET_FPS * 0.8f && sendMs <= LATENCY_BUDGET_MS) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+struct TraceResult {
+  const char *name = "";
+  size_t startLevel = 0, endLevel = 0;
+  uint32_t changes = 0;
+  uint32_t firstDownMs = 0;  // after the drop; 0 if there was none
+  uint32_t settleMs = 0;     // until the level holds the target again
+  uint32_t lateChanges = 0;  // in the second half of a steady trace
+  uint32_t reversals = 0;    // up then straight back down, there
+  uint32_t minGapMs = 0;     // between any two changes
+  uint32_t cooldownMisses = 0;
+  double fps = 0;            // frames delivered per second overall
+  std::vector<QualityDecision> decisions;
+  bool ok = true;
+  char why[96] = "";
+};
+
+static void fail(TraceResult *r, const char *why) {
+  if (r->ok) {
+    snprintf(r->why, sizeof(r->why), "%s", why);
+  }
+  r->ok = false;
+}
+
+static TraceResult run(const Trace &trace) {
+  TraceResult r;
+  r.name = trace.name;
+  QualityController controller(LADDER, LEVELS, LEVELS - 1);
+  controller.setTarget(TARGET_FPS, LATENCY_BUDGET_MS);
+  r.startLevel = controller.level();
+  uint32_t rng = 0x9e3779b9;
+
+  // The first drop in the trace, if any, and the level that fits after it
+  uint32_t dropMs = 0;
+  size_t dropLevel = LEVELS;
+  for (size_t i = 1; i < trace.segments.size() && dropMs == 0; i++) {
+    if (trace.segments[i].kBps < trace.segments[i - 1].kBps &&
+        sustainableLevel(trace.segments[i].kBps) < controller.level()) {
+      dropMs = trace.segments[i].atMs;
+      dropLevel = sustainableLevel(trace.segments[i].kBps);
+    }
+  }
+
+  uint32_t sendingUntil = 0, lastCameraMs = 0, lastSentCameraMs = 0;
+  uint32_t clientFrames = 0, clientSince = 0, delivered = 0;
+  uint32_t lastChangeMs = 0;
+  const uint32_t startMs = 1000;
+  for (uint32_t t = startMs; t < startMs + trace.lengthMs; t += TICK_MS) {
+    uint32_t ms = t - startMs;
+    lastCameraMs = t - t % CAMERA_MS;
+    // A new camera frame and the link free: send it
+    if (t >= sendingUntil && lastCameraMs != lastSentCameraMs) {
+      lastSentCameraMs = lastCameraMs;
+      uint32_t bytes = LEVEL_BYTES[controller.level()];
+      float kBps = bandwidthAt(trace, ms, &rng);
+      uint32_t sendMicros = (uint32_t)(bytes * 1000.0f / kBps) + RTT_MS * 1000;
+      controller.onFrameSent(bytes, sendMicros);
+      sendingUntil = t + sendMicros / 1000;
+      delivered++;
+      uint32_t arriveMs = sendingUntil;
+      if (clientSince == 0) {
+        clientSince = arriveMs;
+      }
+      clientFrames++;
+      if (arriveMs - clientSince >= CLIENT_REPORT_MS) {
+        controller.onClientFps(clientFrames * 1000.0f / (arriveMs - clientSince), arriveMs);
+        clientFrames = 0;
+        clientSince = arriveMs;
+      }
+    }
+
+    size_t before = controller.level();
+    if (!controller.update(t)) {
+      continue;
+    }
+    size_t after = controller.level();
+    r.changes++;
+    QualityDecision d = {t, (uint8_t)before, (uint8_t)after, controller.stats()};
+    r.decisions.push_back(d);
+
+    uint32_t gap = lastChangeMs ? t - lastChangeMs : 0;
+    if (lastChangeMs && (r.minGapMs == 0 || gap < r.minGapMs)) {
+      r.minGapMs = gap;
+    }
+    // A change is judged on a whole window after the cooldown's; a step
+    // up on UP_WINDOWS of them
+    uint32_t needMs = (after > before ? COOLDOWN_WINDOWS + UP_WINDOWS : COOLDOWN_WINDOWS + 1) *
+                      WINDOW_MS;
+    if (lastChangeMs && gap < needMs) {
+      r.cooldownMisses++;
+    }
+    lastChangeMs = t;
+
+    if (dropMs && ms >= dropMs && after < before && r.firstDownMs == 0) {
+      r.firstDownMs = ms - dropMs;
+    }
+    if (dropMs && ms >= dropMs && after <= dropLevel && r.settleMs == 0) {
+      r.settleMs = ms - dropMs;
+    }
+    if (trace.steady && ms >= trace.lengthMs / 2) {
+      r.lateChanges++;
+      size_t n = r.decisions.size();
+      if (n >= 2 && r.decisions[n - 2].to > r.decisions[n - 2].from && after < before) {
+        r.reversals++;
+      }
+    }
+  }
+  r.endLevel = controller.level();
+  r.fps = delivered * 1000.0 / trace.lengthMs;
+
+  if (dropMs) {
+    // From the top level down to the one that fits: a step per window and
+    // cooldown, after up to two windows to notice
+    uint32_t steps = r.startLevel - dropLevel;
+    uint32_t settleLimit = 2 * WINDOW_MS + (steps - 1) * (COOLDOWN_WINDOWS + 1) * WINDOW_MS;
+    if (r.firstDownMs == 0 || r.firstDownMs > 2 * WINDOW_MS) {
+      fail(&r, "slow to step down after the drop");
+    } else if (r.settleMs == 0 || r.settleMs > settleLimit) {
+      fail(&r, "slow to reach a level that fits");
+    }
+  }
+  if (trace.steady && (r.lateChanges > 1 || r.reversals > 0)) {
+    fail(&r, "oscillates on a steady link");
+  }
+  if (trace.steady && r.endLevel > sustainableLevel(trace.segments[0].kBps)) {
+    fail(&r, "settled on a level the link cannot carry");
+  }
+  if (r.cooldownMisses > 0) {
+    fail(&r, "changed again before its cooldown was over");
+  }
+  return r;
+}
+
+int main(int argc, char **argv) {
+  bool json = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else {
+      fprintf(stderr, "usage: %s [--tag name] [--json]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  // Bandwidths between two levels' needs, so the top that fits is clear
+  float fitsTop = kBpsFor(LEVELS - 1, 20);
+  float fitsHvga = (kBpsFor(2, TARGET_FPS) + kBpsFor(3, TARGET_FPS)) / 2;
+  float fitsQvga = (kBpsFor(0, TARGET_FPS) + kBpsFor(1, TARGET_FPS)) / 2;
+  std::vector<Trace> traces = {
+      {"good link", {{0, fitsTop * 2}}, 60000, 0, true},
+      {"drop to HVGA", {{0, fitsTop * 2}, {10000, fitsHvga}}, 60000, 0, false},
+      {"drop to QVGA", {{0, fitsTop * 2}, {10000, fitsQvga}}, 60000, 0, false},
+      {"drop and recover", {{0, fitsTop * 2}, {10000, fitsQvga}, {30000, fitsTop * 2}}, 90000, 0,
+       false},
+      {"steady HVGA", {{0, fitsHvga}}, 120000, 0, true},
+      {"steady QVGA", {{0, fitsQvga}}, 120000, 0, true},
+      {"jittery HVGA", {{0, fitsHvga}}, 120000, 0.2f, true},
+      {"below the ladder", {{0, kBpsFor(0, TARGET_FPS) / 2}}, 60000, 0, true},
+  };
+
+  std::vector<TraceResult> results;
+  bool ok = true;
+  for (const Trace &trace : traces) {
+    results.push_back(run(trace));
+    ok = ok && results.back().ok;
+  }
+
+  if (json) {
+    printf("{\"tag\":\"%s\",\"traces\":[", tag);
+    for (size_t i = 0; i < results.size(); i++) {
+      const TraceResult &r = results[i];
+      printf("%s{\"name\":\"%s\",\"end_level\":%zu,\"changes\":%u,\"first_down_ms\":%u,"
+             "\"settle_ms\":%u,\"late_changes\":%u,\"reversals\":%u,\"min_gap_ms\":%u,"
+             "\"fps\":%.1f,\"ok\":%s}",
+             i ? "," : "", r.name, r.endLevel, r.changes, r.firstDownMs, r.settleMs,
+             r.lateChanges, r.reversals, r.minGapMs, r.fps, r.ok ? "true" : "false");
+    }
+    printf("],\"ok\":%s}\n", ok ? "true" : "false");
+  } else {
+    printf("target %d fps, %d ms per frame; levels:", TARGET_FPS, LATENCY_BUDGET_MS);
+    for (size_t i = 0; i < LEVELS; i++) {
+      printf(" %s (%u B)%s", LEVEL_NAMES[i], LEVEL_BYTES[i], i + 1 < LEVELS ? "," : "\n");
+    }
+    printf("%-18s %-9s %7s %10s %9s %6s %9s %6s\n", "trace", "end", "changes", "1st down",
+           "settled", "late", "min gap", "fps");
+    for (const TraceResult &r : results) {
+      char down[16] = "-", settle[16] = "-";
+      if (r.firstDownMs) {
+        snprintf(down, sizeof(down), "%u ms", r.firstDownMs);
+      }
+      if (r.settleMs) {
+        snprintf(settle, sizeof(settle), "%u ms", r.settleMs);
+      }
+      printf("%-18s %-9s %7u %10s %9s %6u %6u ms %6.1f%s%s\n", r.name, LEVEL_NAMES[r.endLevel],
+             r.changes, down, settle, r.lateChanges, r.minGapMs, r.fps, r.ok ? "" : "  FAIL: ",
+             r.why);
+    }
+    printf("%s\n", ok ? "OK" : "FAIL");
+  }
+  return ok ? 0 : 1;
+}
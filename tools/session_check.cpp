@@ -0,0 +1,199 @@
+// Records a session on the host build (see HOST BUILD in README.txt) and
+// downloads it through /session the way a phone on a slow link would,
+// while a /stream client keeps reading as fast as it can. The sketch sends
+// the download a chunk at a time from httpTask's loop; one that sent the
+// whole recording in its handler would stop the stream for as long as the
+// download took.
+//
+// /record?start&frames=--frame-every, --seconds of recording, then /session
+// read at most --kbps into --out, for
+// tools/session_replay.cpp to play back (ctest does, which checks the file
+// is a whole HTRS recording).
+//
+// Fails if the host build dies, /record or /session fails, the download is
+// shorter than its Content-Length, or the stream goes more than
+// STREAM_GAP_MAX_MS without a frame while the download runs.
+//
+// Build and run on Linux from the repository root (build/headtilt_host_gray
+// comes from the CMake build; the grayscale pipeline records raw frames,
+// which session_replay tracks without libjpeg):
+//   g++ -O2 -pthread -I. tools/session_check.cpp -o session_check
+//   ./session_check build/headtilt_host_gray --out session.htrs
+//   ./session_replay session.htrs
+
+#include "tools/http_client.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define READ_TIMEOUT_MS 5000
+#define STREAM_GAP_MAX_MS 500   // a blocking download would stall it for seconds
+
+struct StreamResult {
+  std::atomic<bool> stop{false};
+  std::atomic<double> downloadStartMs{0}; // 0 until the download starts
+  std::atomic<double> downloadEndMs{0};
+  uint32_t frames = 0;          // during the download
+  double gapMaxMs = 0;          // between frames, during the download
+  bool failed = false;
+};
+
+// Reads /stream parts until told to stop, timing the gaps that fall inside
+// the download
+static void streamClient(const char *host, int port, StreamResult *r) {
+  HttpConn conn;
+  std::vector<std::string> headers;
+  if (!conn.get(host, port, "/stream", READ_TIMEOUT_MS) || conn.readHead(&headers) != 200) {
+    r->failed = true;
+    return;
+  }
+  double last = 0;
+  std::string line;
+  while (!r->stop) {
+    while (conn.readLine(&line) && line.empty()) {
+    }
+    if (line != "--frame") {
+      r->failed = true;
+      return;
+    }
+    headers.clear();
+    while (conn.readLine(&line) && !line.empty()) {
+      headers.push_back(line);
+    }
+    size_t length = strtoul(httpHeader(headers, "Content-Length").c_str(), nullptr, 10);
+    if (length == 0 || !conn.read(length, nullptr)) {
+      r->failed = true;
+      return;
+    }
+    double now = httpNowMs();
+    double start = r->downloadStartMs, end = r->downloadEndMs;
+    if (start > 0 && last > 0 && (end == 0 || last < end)) {
+      r->frames++;
+      double gap = now - (last > start ? last : start);
+      r->gapMaxMs = gap > r->gapMaxMs ? gap : r->gapMaxMs;
+    }
+    last = now;
+  }
+}
+
+int main(int argc, char **argv) {
+  const char *binary = nullptr;
+  const char *out = "session.htrs";
+  int portOffset = 9900;
+  int frameEvery = 8;
+  double seconds = 2;
+  double kbps = 128;
+  bool json = false;
+  bool usage = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--port-offset") && i + 1 < argc) {
+      portOffset = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--out") && i + 1 < argc) {
+      out = argv[++i];
+    } else if (!strcmp(argv[i], "--frame-every") && i + 1 < argc) {
+      frameEvery = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--seconds") && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--kbps") && i + 1 < argc) {
+      kbps = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else if (argv[i][0] != '-' && !binary) {
+      binary = argv[i];
+    } else {
+      usage = true;
+    }
+  }
+  if (usage || !binary || frameEvery < 0 || seconds <= 0 || kbps <= 0) {
+    fprintf(stderr,
+            "usage: %s <headtilt_host_gray> [--out session.htrs] [--port-offset n] "
+            "[--frame-every n] [--seconds n] [--kbps n] [--tag name] [--json]\n",
+            argv[0]);
+    return 2;
+  }
+
+  pid_t pid = startHostBuild(binary, portOffset, {});
+  if (pid < 0) {
+    return 1;
+  }
+  const char *host = "127.0.0.1";
+  int port = 80 + portOffset;
+
+  HttpConn conn;
+  std::vector<std::string> headers;
+  char path[64];
+  snprintf(path, sizeof(path), "/record?start&frames=%d", frameEvery);
+  bool recorded = conn.get(host, port, path, READ_TIMEOUT_MS) && conn.readHead(&headers) == 200;
+  std::this_thread::sleep_for(std::chrono::milliseconds((int64_t)(seconds * 1000)));
+
+  StreamResult stream;
+  std::thread streamer(streamClient, host, port, &stream);
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+  // The download, no faster than kbps
+  std::string body;
+  size_t length = 0;
+  int status = 0;
+  double startMs = httpNowMs();
+  stream.downloadStartMs = startMs;
+  if (recorded && conn.get(host, port, "/session", READ_TIMEOUT_MS)) {
+    status = conn.readHead(&headers);
+    length = strtoul(httpHeader(headers, "Content-Length").c_str(), nullptr, 10);
+    body = conn.buf.substr(conn.pos);
+    conn.buf.clear();
+    conn.pos = 0;
+    while (status == 200 && body.size() < length) {
+      double due = startMs + conn.bytesIn / kbps;
+      double now = httpNowMs();
+      if (due > now) {
+        std::this_thread::sleep_for(std::chrono::microseconds((int64_t)((due - now) * 1000)));
+      }
+      if (!conn.fill()) {
+        break;
+      }
+      body += conn.buf;
+      conn.buf.clear();
+    }
+  }
+  double downloadMs = httpNowMs() - startMs;
+  stream.downloadEndMs = httpNowMs();
+  stream.stop = true;
+  streamer.join();
+  bool alive = stopHostBuild(pid);
+
+  bool whole = status == 200 && length > 0 && body.size() == length;
+  FILE *f = whole ? fopen(out, "wb") : nullptr;
+  bool written = f && fwrite(body.data(), 1, body.size(), f) == body.size();
+  if (f) {
+    fclose(f);
+  }
+  bool ok = alive && recorded && whole && written && !stream.failed &&
+            stream.gapMaxMs <= STREAM_GAP_MAX_MS;
+
+  if (json) {
+    printf("{\"tag\":\"%s\",\"seconds\":%.1f,\"frame_every\":%d,\"kbps\":%.0f,\"status\":%d,"
+           "\"bytes\":%zu,\"content_length\":%zu,\"download_ms\":%.0f,\"stream_frames\":%u,"
+           "\"stream_gap_max_ms\":%.1f,\"host_alive\":%s,\"ok\":%s}\n",
+           tag, seconds, frameEvery, kbps, status, body.size(), length, downloadMs, stream.frames,
+           stream.gapMaxMs, alive ? "true" : "false", ok ? "true" : "false");
+  } else {
+    printf("%s: %.1f s recorded (every %d frames), /session read at %.0f kB/s\n", binary,
+           seconds, frameEvery, kbps);
+    printf("download      status %d, %zu of %zu bytes in %.0f ms%s\n", status, body.size(),
+           length, downloadMs, written ? "" : " (not written)");
+    printf("stream        %u frames meanwhile, longest gap %.0f ms%s\n", stream.frames,
+           stream.gapMaxMs, stream.failed ? " (stream failed)" : "");
+    printf("host build    %s\n", alive ? "ran to the end" : "died");
+    printf("%s\n", ok ? "OK" : "FAIL");
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+// A session recording (session_log.h) mapped read-only from a file, for
+// the PC tools that read one back.
+
+#include "session_log.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+class SessionFile {
+public:
+  SessionFile() = default;
+  SessionFile(const SessionFile &) = delete;
+  SessionFile &operator=(const SessionFile &) = delete;
+  ~SessionFile() {
+    if (data_) {
+      munmap((void *)data_, size_);
+    }
+  }
+
+  // Maps path and checks it is a recording; says why not on stderr
+  bool open(const char *path) {
+    int fd = ::open(path, O_RDONLY);
+    struct stat sb;
+    if (fd < 0 || fstat(fd, &sb) < 0 || sb.st_size == 0) {
+      if (fd >= 0) {
+        close(fd);
+      }
+      fprintf(stderr, "Cannot open %s\n", path);
+      return false;
+    }
+    void *data = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+      fprintf(stderr, "Cannot map %s\n", path);
+      return false;
+    }
+    data_ = (const uint8_t *)data;
+    size_ = sb.st_size;
+    if (!SessionReader(data_, size_).valid()) {
+      fprintf(stderr, "%s is not a session recording (version %d)\n", path, SESSION_VERSION);
+      return false;
+    }
+    return true;
+  }
+
+  const uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+
+private:
+  const uint8_t *data_ = nullptr;
+  size_t size_ = 0;
+};
@@ -0,0 +1,314 @@
+// Plays a recorded session (session_log.h: /session from the ESP32, or the
+// page's "Record" download) back through the tracker and game code, as
+// fast as it goes, to reproduce a bad run or compare builds on it:
+//   - frames through TiltEstimator (raw gray; JPEG too when built with
+//     libjpeg), compared with the angles recorded for them
+//   - tilt measurements through TiltFilter + TiltLaneLatch with the
+//     recorded threshold, inversion and lead, compared with the recorded
+//     lanes (the ESP32 records this same rule, so once the filter has
+//     settled its lanes match; the page picks lanes per display frame, so
+//     expect close, not equal)
+//   - every recorded game through GameSim, checked against its recorded end
+//     (party games too: each player's tilt and inputs are kept apart)
+// The file is memory-mapped and read in place.
+//
+// Build and run on a PC from the repository root:
+//   g++ -O2 -I. tools/session_replay.cpp session_log.cpp tilt_*.cpp game_sim.cpp -o session_replay
+//   ./session_replay session.htrs [--repeat 10] [--trace tilt.csv] [--json]
+// Add -DSESSION_REPLAY_JPEG and -ljpeg to decode JPEG frames too.
+// --trace writes the measured angles as CSV for tools/tilt_replay.cpp.
+// Exits 1 if a game ends differently from its recording, or if the file
+// ends inside a record (a download cut short).
+
+#include "game_sim.h"
+#include "session_log.h"
+#include "tilt_estimator.h"
+#include "tilt_filter.h"
+#include "tilt_kernels.h"
+#include "tools/session_file.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <vector>
+
+#ifdef SESSION_REPLAY_JPEG
+#include "tools/jpeg_gray.h"
+#endif
+
+// Same limits as the sketch's tracking buffer
+#define TRACK_MAX_WIDTH 200
+#define TRACK_MAX_HEIGHT 150
+
+struct Stats {
+  uint32_t records = 0;
+  uint32_t frames = 0;
+  uint32_t framesTracked = 0;  // decoded and run through TiltEstimator
+  uint32_t framesCompared = 0; // ... with a face in both the recording and now
+  uint32_t foundChanged = 0;   // face found in one but not the other
+  double angleErrorSum = 0;
+  float angleErrorMax = 0;
+  uint32_t tilts = 0;
+  uint32_t lanesSame = 0;
+  uint32_t games = 0;
+  uint32_t gamesSame = 0;
+  uint32_t gamesUnfinished = 0;
+  uint32_t firstMs = 0;
+  uint32_t lastMs = 0;
+  size_t unread = 0; // cut-off tail the reader could not make a record of
+  const char *source = "?";
+};
+
+static double nowSeconds() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+// Tracks one frame like trackTask does; false if it cannot be decoded here
+static bool trackFrame(const SessionFrame &f, TiltEstimator &estimator,
+                       std::vector<uint8_t> &scratch, TiltResult *out) {
+  if (f.format == SESSION_FORMAT_GRAY) {
+    if (f.length < (size_t)f.width * f.height) {
+      return false;
+    }
+    if (f.width > TRACK_MAX_WIDTH) {
+      int w = f.width / 2;
+      int h = f.height / 2;
+      scratch.resize((size_t)w * h);
+      downscale2x(f.data, f.width, f.height, f.width, scratch.data(), w);
+      *out = estimator.estimate(scratch.data(), w, h, w);
+    } else {
+      *out = estimator.estimate(f.data, f.width, f.height, f.width);
+    }
+    return true;
+  }
+#ifdef SESSION_REPLAY_JPEG
+  int w, h;
+  if (f.format == SESSION_FORMAT_JPEG &&
+      decodeJpegGray(f.data, f.length, TRACK_MAX_WIDTH, &scratch, &w, &h) &&
+      h <= TRACK_MAX_HEIGHT) {
+    *out = estimator.estimate(scratch.data(), w, h, w);
+    return true;
+  }
+#endif
+  return false;
+}
+
+struct Game {
+  SessionGameStart start;
+  std::vector<SessionGameInput> inputs;
+};
+
+// Plays a game to the recorded end tick; true if it ends the same way
+static bool replayGame(const Game &game, const SessionGameEnd &end) {
+  GameSim sim(game.start.seed, game.start.players);
+  size_t next = 0;
+  GamePartyInput input = {{1, 1, 1, 1}, 5};
+  while (sim.tick() < end.tick && !sim.crashed()) {
+    while (next < game.inputs.size() && game.inputs[next].tick <= sim.tick()) {
+      const SessionGameInput &in = game.inputs[next++];
+      if (in.player < GAME_MAX_PLAYERS) {
+        input.lanes[in.player] = in.lane;
+        input.speed = in.speed;
+      }
+    }
+    sim.stepParty(input);
+  }
+  return sim.tick() == end.tick && sim.score() == end.score && sim.crashed() == end.crashed &&
+         sim.hash() == end.hash;
+}
+
+static Stats replay(const uint8_t *data, size_t size, FILE *trace) {
+  Stats st;
+  SessionReader reader(data, size);
+  SessionRecord r;
+  SessionConfig config = {SESSION_SOURCE_DEVICE, 8, false, 0, "", 0};
+  TiltEstimator estimator;
+  TiltFilter filters[GAME_MAX_PLAYERS]; // one tilt track per player
+  TiltLaneLatch latches[GAME_MAX_PLAYERS];
+  std::vector<uint8_t> scratch;
+  std::vector<TiltResult> tracked; // by frame, for the tilt record that follows
+  std::vector<uint32_t> trackedSeq;
+  Game game = {};
+  bool inGame = false;
+
+  while (reader.next(&r)) {
+    // Records are in the order they were made, not strictly by time
+    if (st.records++ == 0 || r.timeMs < st.firstMs) {
+      st.firstMs = r.timeMs;
+    }
+    if (r.timeMs > st.lastMs) {
+      st.lastMs = r.timeMs;
+    }
+    SessionFrame frame;
+    SessionTilt tilt;
+    SessionGameInput input;
+    SessionGameEnd end;
+    if (decodeSessionConfig(r, &config)) {
+      st.source = config.source == SESSION_SOURCE_PAGE ? "page" : "device";
+      for (int p = 0; p < GAME_MAX_PLAYERS; p++) {
+        filters[p].reset();
+        latches[p].reset();
+      }
+    } else if (decodeSessionFrame(r, &frame)) {
+      st.frames++;
+      TiltResult result;
+      if (trackFrame(frame, estimator, scratch, &result)) {
+        st.framesTracked++;
+        tracked.push_back(result);
+        trackedSeq.push_back(frame.seq);
+      }
+    } else if (decodeSessionTilt(r, &tilt)) {
+      st.tilts++;
+      // The frame this was measured on, if it was recorded and decoded
+      for (size_t i = tracked.size(); i-- > 0;) {
+        if (trackedSeq[i] != tilt.seq) {
+          continue;
+        }
+        if (tracked[i].found != tilt.found) {
+          st.foundChanged++;
+        } else if (tilt.found) {
+          float err = fabsf(tracked[i].angle - tilt.angle);
+          st.framesCompared++;
+          st.angleErrorSum += err;
+          st.angleErrorMax = err > st.angleErrorMax ? err : st.angleErrorMax;
+        }
+        break;
+      }
+      if (tracked.size() > 16) {
+        tracked.erase(tracked.begin(), tracked.end() - 8);
+        trackedSeq.erase(trackedSeq.begin(), trackedSeq.end() - 8);
+      }
+
+      TiltFilter &filter = filters[tilt.player % GAME_MAX_PLAYERS];
+      TiltLaneLatch &latch = latches[tilt.player % GAME_MAX_PLAYERS];
+      if (tilt.found) {
+        filter.update(config.invert ? -tilt.angle : tilt.angle, r.timeMs);
+        latch.update(filter.predict(r.timeMs + config.leadMs), config.threshold);
+      }
+      if (latch.lane() == tilt.lane) {
+        st.lanesSame++;
+      }
+      if (trace) {
+        if (tilt.found) {
+          fprintf(trace, "%u,%.3f\n", (unsigned)r.timeMs, tilt.angle);
+        } else {
+          fprintf(trace, "%u,nan\n", (unsigned)r.timeMs);
+        }
+      }
+    } else if (decodeSessionGameStart(r, &game.start)) {
+      st.gamesUnfinished += inGame;
+      game.inputs.clear();
+      inGame = true;
+    } else if (decodeSessionGameInput(r, &input)) {
+      game.inputs.push_back(input);
+    } else if (decodeSessionGameEnd(r, &end) && inGame) {
+      st.games++;
+      st.gamesSame += replayGame(game, end);
+      inGame = false;
+    }
+  }
+  st.gamesUnfinished += inGame;
+  st.unread = reader.unread();
+  return st;
+}
+
+int main(int argc, char **argv) {
+  const char *path = NULL;
+  const char *tracePath = NULL;
+  int repeat = 1;
+  bool json = false;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--repeat") && i + 1 < argc) {
+      repeat = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--trace") && i + 1 < argc) {
+      tracePath = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else if (argv[i][0] != '-' && !path) {
+      path = argv[i];
+    } else {
+      path = NULL;
+      break;
+    }
+  }
+  if (!path || repeat < 1) {
+    fprintf(stderr, "usage: %s session.htrs [--repeat n] [--trace tilt.csv] [--json]\n",
+            argv[0]);
+    return 2;
+  }
+
+  SessionFile file;
+  if (!file.open(path)) {
+    return 1;
+  }
+
+  FILE *trace = tracePath ? fopen(tracePath, "w") : NULL;
+  if (tracePath && !trace) {
+    fprintf(stderr, "Cannot write %s\n", tracePath);
+    return 1;
+  }
+  Stats st = replay(file.data(), file.size(), trace);
+  if (trace) {
+    fclose(trace);
+  }
+  // Timed separately, without the trace file
+  double start = nowSeconds();
+  for (int i = 0; i < repeat; i++) {
+    replay(file.data(), file.size(), NULL);
+  }
+  double seconds = (nowSeconds() - start) / repeat;
+
+  double sessionSeconds = (st.lastMs - st.firstMs) / 1000.0;
+  double meanError = st.framesCompared ? st.angleErrorSum / st.framesCompared : 0;
+  double lanePercent = st.tilts ? 100.0 * st.lanesSame / st.tilts : 0;
+  double speedup = seconds > 0 ? sessionSeconds / seconds : 0;
+  bool gamesOk = st.gamesSame == st.games;
+  bool whole = st.unread == 0;
+
+  if (json) {
+    printf("{\"file\":\"%s\",\"source\":\"%s\",\"bytes\":%lld,\"records\":%u,"
+           "\"session_s\":%.2f,\"replay_ms\":%.3f,\"speedup\":%.1f,"
+           "\"frames\":%u,\"frames_tracked\":%u,\"frames_compared\":%u,"
+           "\"found_changed\":%u,\"angle_error_mean\":%.3f,\"angle_error_max\":%.3f,"
+           "\"tilts\":%u,\"lanes_same_pct\":%.1f,\"games\":%u,\"games_same\":%u,"
+           "\"games_unfinished\":%u,\"unread_bytes\":%zu}\n",
+           path, st.source, (long long)file.size(), st.records, sessionSeconds, seconds * 1000,
+           speedup, st.frames, st.framesTracked, st.framesCompared, st.foundChanged,
+           meanError, st.angleErrorMax, st.tilts, lanePercent, st.games, st.gamesSame,
+           st.gamesUnfinished, st.unread);
+  } else {
+    printf("%s: %s session, %lld bytes, %u records over %.1f s\n", path, st.source,
+           (long long)file.size(), st.records, sessionSeconds);
+    if (!whole) {
+      printf("cut short     the last %zu bytes are not a whole record\n", st.unread);
+    }
+    printf("replay        %.2f ms (%.0fx real time)\n", seconds * 1000, speedup);
+    printf("frames        %u recorded, %u tracked here", st.frames, st.framesTracked);
+#ifndef SESSION_REPLAY_JPEG
+    if (st.framesTracked < st.frames) {
+      printf(" (JPEG frames need -DSESSION_REPLAY_JPEG)");
+    }
+#endif
+    printf("\n");
+    if (st.framesTracked > 0) {
+      printf("angle         %u compared, mean error %.2f deg, max %.2f, face found "
+             "differently %u times\n",
+             st.framesCompared, meanError, st.angleErrorMax, st.foundChanged);
+    }
+    printf("lanes         %u measurements, %.1f%% same lane as recorded\n", st.tilts,
+           lanePercent);
+    printf("games         %u finished, %u identical%s", st.games, st.gamesSame,
+           gamesOk ? "" : " (MISMATCH)");
+    if (st.gamesUnfinished) {
+      printf(", %u not finished in the recording", st.gamesUnfinished);
+    }
+    printf("\n");
+  }
+  return gamesOk && whole ? 0 : 1;
+}
@@ -0,0 +1,253 @@
+// Frames per second and bytes of overhead per frame for /capture polling
+// versus /stream, against the host build of the sketch (see HOST BUILD in
+// README.txt) or against a board.
+//
+// The host build replays fake frames at VGA (tools/fake_frames.h) that
+// change every time, so the motion gate never holds one back from /stream
+// and both endpoints can get every frame the camera makes.
+//
+// /capture is polled the way the page used to: one request per frame,
+// the next as soon as the last one is in. /stream is one connection
+// whose parts are counted for as long. For each, a frame is a new
+// X-Frame-Seq; fps counts those, and overhead is every byte on the
+// connection both ways (request, status line, headers, part boundaries,
+// repeats of a frame already seen) that is not a new frame's JPEG,
+// divided by the new frames. TCP/IP headers are not counted, so
+// /capture's extra connection per frame costs more than it shows here.
+//
+// Exits 1 if either endpoint delivers no frames, a response or part is
+// not a whole JPEG, a stream part repeats or goes back, or /stream's
+// overhead per frame is not below /capture's.
+//
+// Build and run on Linux from the repository root (build/headtilt_host
+// comes from the CMake build):
+//   g++ -O2 -I. tools/stream_check.cpp synthetic_camera.cpp -ljpeg -o stream_check
+//   ./stream_check build/headtilt_host
+//   ./stream_check build/headtilt_host --fps 100 --seconds 5 --json --tag "$(git rev-parse --short HEAD)"
+//   ./stream_check --host 192.168.137.145    (a board, as it is)
+
+#include "tools/fake_frames.h"
+#include "tools/http_client.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#define READ_TIMEOUT_MS 5000
+#define FAKE_FRAMES 16
+#define FAKE_WIDTH 640
+#define FAKE_HEIGHT 480
+#define FAKE_QUALITY 76 // the sketch's jpeg_quality 12 in libjpeg's terms
+
+struct EndpointResult {
+  uint32_t frames = 0;   // new X-Frame-Seq values
+  uint32_t responses = 0; // /capture: requests answered; /stream: parts
+  uint32_t connections = 0;
+  uint32_t errors = 0; // non-200 answers, broken or non-JPEG bodies
+  uint32_t repeats = 0; // /stream parts whose seq did not go up
+  uint64_t wireBytes = 0;
+  uint64_t jpegBytes = 0; // of the new frames only
+  double seconds = 0;
+
+  double fps() const { return seconds > 0 ? frames / seconds : 0; }
+  double overhead() const { return frames ? (double)(wireBytes - jpegBytes) / frames : 0; }
+};
+
+static bool isJpeg(const std::string &body) {
+  return body.size() >= 4 && (uint8_t)body[0] == 0xFF && (uint8_t)body[1] == 0xD8 &&
+         (uint8_t)body[body.size() - 2] == 0xFF && (uint8_t)body[body.size() - 1] == 0xD9;
+}
+
+// ==========================================
+// /capture
+// ==========================================
+static EndpointResult pollCapture(const char *host, int port, double seconds) {
+  EndpointResult r;
+  uint32_t lastSeq = 0;
+  double start = httpNowMs();
+  double end = start + seconds * 1000;
+  std::vector<std::string> headers;
+  std::string body;
+  while (httpNowMs() < end) {
+    HttpConn conn;
+    r.connections++;
+    bool sent = conn.get(host, port, "/capture", READ_TIMEOUT_MS);
+    int status = sent ? conn.readHead(&headers) : 0;
+    size_t length = strtoul(httpHeader(headers, "Content-Length").c_str(), nullptr, 10);
+    bool whole = status != 0 && conn.read(length, &body);
+    r.wireBytes += conn.bytesIn + conn.bytesOut;
+    if (status != 200 || !whole || !isJpeg(body)) {
+      r.errors++;
+      continue;
+    }
+    r.responses++;
+    uint32_t seq = strtoul(httpHeader(headers, "X-Frame-Seq").c_str(), nullptr, 10);
+    if (seq != lastSeq) {
+      r.frames++;
+      r.jpegBytes += length;
+      lastSeq = seq;
+    }
+  }
+  r.seconds = (httpNowMs() - start) / 1000;
+  return r;
+}
+
+// ==========================================
+// /stream
+// ==========================================
+static EndpointResult readStream(const char *host, int port, double seconds) {
+  EndpointResult r;
+  HttpConn conn;
+  std::vector<std::string> headers;
+  r.connections = 1;
+  double start = httpNowMs();
+  if (!conn.get(host, port, "/stream", READ_TIMEOUT_MS) || conn.readHead(&headers) != 200 ||
+      httpHeader(headers, "Content-Type").find("multipart/x-mixed-replace") == std::string::npos) {
+    r.errors++;
+    return r;
+  }
+
+  uint32_t lastSeq = 0;
+  double end = start + seconds * 1000;
+  std::string line, body;
+  while (httpNowMs() < end) {
+    // Boundary, then the part's headers up to the blank line
+    while (conn.readLine(&line) && line.empty()) {
+    }
+    if (line != "--frame") {
+      r.errors++;
+      break;
+    }
+    std::vector<std::string> part;
+    while (conn.readLine(&line) && !line.empty()) {
+      part.push_back(line);
+    }
+    size_t length = strtoul(httpHeader(part, "Content-Length").c_str(), nullptr, 10);
+    if (!line.empty() || length == 0 || !conn.read(length, &body) || !isJpeg(body)) {
+      r.errors++;
+      break;
+    }
+    r.responses++;
+    uint32_t seq = strtoul(httpHeader(part, "X-Frame-Seq").c_str(), nullptr, 10);
+    if (seq <= lastSeq) {
+      r.repeats++;
+      continue;
+    }
+    r.frames++;
+    r.jpegBytes += length;
+    lastSeq = seq;
+  }
+  r.seconds = (httpNowMs() - start) / 1000;
+  // What came in past the last whole part is not counted against it
+  r.wireBytes = conn.bytesIn - (conn.buf.size() - conn.pos) + conn.bytesOut;
+  return r;
+}
+
+static void printResult(const char *name, const EndpointResult &r) {
+  printf("  %-9s %6.1f fps  %6.0f bytes/frame overhead  %6.0f bytes/frame JPEG  "
+         "%.2f connections/frame  (%u responses, %u errors)\n",
+         name, r.fps(), r.overhead(), r.frames ? (double)r.jpegBytes / r.frames : 0,
+         r.frames ? (double)r.connections / r.frames : 0, r.responses, r.errors);
+}
+
+static void printJson(const char *name, const EndpointResult &r) {
+  printf("\"%s\":{\"fps\":%.2f,\"overhead_bytes_per_frame\":%.1f,\"jpeg_bytes_per_frame\":%.1f,"
+         "\"frames\":%u,\"responses\":%u,\"connections\":%u,\"errors\":%u,\"repeats\":%u}",
+         name, r.fps(), r.overhead(), r.frames ? (double)r.jpegBytes / r.frames : 0, r.frames,
+         r.responses, r.connections, r.errors, r.repeats);
+}
+
+int main(int argc, char **argv) {
+  const char *binary = nullptr;
+  const char *host = nullptr;
+  int port = 80;
+  int portOffset = 9600;
+  double fps = 100;
+  double seconds = 3;
+  bool json = false;
+  bool usage = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--host") && i + 1 < argc) {
+      host = argv[++i];
+    } else if (!strcmp(argv[i], "--port") && i + 1 < argc) {
+      port = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--port-offset") && i + 1 < argc) {
+      portOffset = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--fps") && i + 1 < argc) {
+      fps = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--seconds") && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else if (argv[i][0] != '-' && !binary) {
+      binary = argv[i];
+    } else {
+      usage = true;
+    }
+  }
+  if (usage || !binary == !host || fps <= 0 || seconds <= 0) {
+    fprintf(stderr,
+            "usage: %s <headtilt_host> [--port-offset n] [--fps n] [--seconds n] [--tag name] "
+            "[--json]\n"
+            "       %s --host ip [--port n] [--seconds n] [--tag name] [--json]\n",
+            argv[0], argv[0]);
+    return 2;
+  }
+
+  pid_t pid = -1;
+  std::string folder;
+  if (binary) {
+    folder = writeFakeFrames(FAKE_FRAMES, FAKE_WIDTH, FAKE_HEIGHT, FAKE_QUALITY);
+    if (folder.empty()) {
+      fprintf(stderr, "cannot write the fake frames under /tmp\n");
+      return 1;
+    }
+    char fpsArg[16];
+    snprintf(fpsArg, sizeof(fpsArg), "%g", fps);
+    pid = startHostBuild(binary, portOffset, {"--frames", folder, "--fps", fpsArg});
+    if (pid < 0) {
+      removeFakeFrames(folder, FAKE_FRAMES);
+      return 1;
+    }
+    host = "127.0.0.1";
+    port = 80 + portOffset;
+  }
+  EndpointResult capture = pollCapture(host, port, seconds);
+  EndpointResult stream = readStream(host, port, seconds);
+  stopHostBuild(pid);
+  if (binary) {
+    removeFakeFrames(folder, FAKE_FRAMES);
+  }
+
+  bool ok = capture.frames > 0 && stream.frames > 0 && capture.errors == 0 &&
+            stream.errors == 0 && stream.repeats == 0 && stream.overhead() < capture.overhead();
+
+  if (json) {
+    printf("{\"tag\":\"%s\",\"source\":\"%s\",\"camera_fps\":%.1f,\"seconds\":%.1f,", tag,
+           binary ? "host" : host, binary ? fps : 0.0, seconds);
+    printJson("capture", capture);
+    printf(",");
+    printJson("stream", stream);
+    printf(",\"ok\":%s}\n", ok ? "true" : "false");
+  } else {
+    if (binary) {
+      printf("%s, %d fake frames at %.0f fps, %.0f s each:\n", binary, FAKE_FRAMES, fps,
+             seconds);
+    } else {
+      printf("%s:%d, %.0f s each:\n", host, port, seconds);
+    }
+    printResult("/capture", capture);
+    printResult("/stream", stream);
+    if (stream.repeats) {
+      printf("  /stream sent %u parts with a seq it had already sent\n", stream.repeats);
+    }
+    printf("%s\n", ok ? "OK" : "FAIL");
+  }
+  return ok ? 0 : 1;
+}
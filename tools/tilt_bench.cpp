@@ -0,0 +1,583 @@
+// Runs a corpus of camera frames through each tracking setup, from JPEG
+// and from raw grayscale, and reports per-frame decode and estimate times
+// (p50/p99), throughput with 1..N worker threads, and the angle error
+// against labels.
+//
+// Labels follow the page's processHeadTilt(): atan2 of the line from mesh
+// point 133 to 263. A session recorded on the page in "Crop to Face" mode
+// (session_log.h) is therefore a labelled corpus: each face crop together
+// with the Face Mesh angle measured on it. ESP32 sessions give frames
+// without labels (their angles come from the estimator under test).
+// Without files, synthetic frames with known angles are used
+// (synthetic_camera.h, same convention).
+//
+// A folder is read as recorded frames: every .jpg/.jpeg, and every .pgm
+// (8-bit binary PGM, i.e. a raw grayscale frame with a small header), in
+// name order. Labels come from labels.csv in the folder, one "name,degrees"
+// line per labelled frame. --save-synthetic writes the synthetic corpus as
+// such a folder, half JPEG and half PGM.
+//
+// --max-error fails the run (exit 1) if the mean error of any setup over
+// the labelled frames is above that many degrees, or if nothing is
+// labelled.
+//
+// Build and run on Linux from the repository root:
+//   g++ -O2 -pthread -I. tools/tilt_bench.cpp session_log.cpp synthetic_camera.cpp tilt_*.cpp -ljpeg -o tilt_bench
+//   ./tilt_bench                                   # synthetic corpus
+//   ./tilt_bench page.htrs esp32.htrs --threads 1,2,4
+//   ./tilt_bench frames/ --max-error 3             # a folder of JPEG/PGM frames
+//   ./tilt_bench --save-synthetic frames/
+//   ./tilt_bench --json --tag "$(git rev-parse --short HEAD)" > bench.json
+// --json prints one JSON object, to keep per commit and compare.
+
+#include "session_log.h"
+#include "synthetic_camera.h"
+#include "tilt_estimator.h"
+#include "tilt_kernels.h"
+#include "tools/bench_stats.h"
+#include "tools/jpeg_gray.h"
+#include "tools/session_file.h"
+
+#include <ctype.h>
+#include <dirent.h>
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define SYNTHETIC_WIDTH 640 // the sketch's default VGA frames
+#define SYNTHETIC_HEIGHT 480
+#define JPEG_QUALITY 80 // for gray frames that need a JPEG copy
+
+// Every setup uses TiltEstimator; they differ in how far the frame is
+// shrunk first (the sketch tracks at up to 200 pixels wide). Add new
+// estimators or settings here.
+struct Setup {
+  const char *name;
+  int maxWidth;
+};
+static const Setup SETUPS[] = {
+    {"blob_200", 200},
+    {"blob_100", 100},
+};
+
+struct Frame {
+  std::vector<uint8_t> jpeg;
+  std::vector<uint8_t> gray; // full size
+  int width, height;
+  bool labelled;
+  float label; // degrees
+};
+
+enum Input { INPUT_JPEG, INPUT_GRAY };
+static const char *INPUT_NAMES[] = {"jpeg", "gray"};
+
+struct FrameResult {
+  uint32_t decodeUs; // JPEG decode, or grayscale downscaling
+  uint32_t estimateUs;
+  bool found;
+  float angle;
+};
+
+struct Run {
+  const Setup *setup;
+  Input input;
+  int threads;
+  double fps;
+  std::vector<FrameResult> results; // per frame (the same on every pass)
+  std::vector<uint32_t> decodeUs, estimateUs; // every frame of every pass
+};
+
+// --- Corpus ---
+
+static bool addFrame(std::vector<Frame> *corpus, const SessionFrame &f) {
+  Frame frame;
+  frame.labelled = false;
+  frame.label = 0;
+  if (f.format == SESSION_FORMAT_JPEG) {
+    frame.jpeg.assign(f.data, f.data + f.length);
+    if (!decodeJpegGray(f.data, f.length, 1 << 16, &frame.gray, &frame.width, &frame.height)) {
+      return false;
+    }
+  } else if (f.length >= (size_t)f.width * f.height) {
+    frame.width = f.width;
+    frame.height = f.height;
+    frame.gray.assign(f.data, f.data + (size_t)f.width * f.height);
+    frame.jpeg = encodeJpegGray(frame.gray.data(), f.width, f.height, JPEG_QUALITY);
+  } else {
+    return false;
+  }
+  corpus->push_back(std::move(frame));
+  return true;
+}
+
+static bool loadSession(const char *path, std::vector<Frame> *corpus) {
+  SessionFile file;
+  if (!file.open(path)) {
+    return false;
+  }
+  SessionReader reader(file.data(), file.size());
+
+  bool pageLabels = false;
+  std::map<uint32_t, size_t> bySeq; // frame seq -> corpus index
+  SessionRecord r;
+  while (reader.next(&r)) {
+    SessionConfig config;
+    SessionFrame frame;
+    SessionTilt tilt;
+    if (decodeSessionConfig(r, &config)) {
+      pageLabels = config.source == SESSION_SOURCE_PAGE;
+    } else if (decodeSessionFrame(r, &frame)) {
+      if (addFrame(corpus, frame)) {
+        bySeq[frame.seq] = corpus->size() - 1;
+      }
+    } else if (decodeSessionTilt(r, &tilt) && pageLabels && tilt.found) {
+      auto it = bySeq.find(tilt.seq);
+      if (it != bySeq.end() && !(*corpus)[it->second].labelled) {
+        (*corpus)[it->second].labelled = true;
+        (*corpus)[it->second].label = tilt.angle;
+      }
+    }
+  }
+  return true;
+}
+
+static bool readFile(const std::string &path, std::vector<uint8_t> *data) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f) {
+    return false;
+  }
+  uint8_t buf[65536];
+  size_t n;
+  data->clear();
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    data->insert(data->end(), buf, buf + n);
+  }
+  fclose(f);
+  return true;
+}
+
+// P5 with maxval up to 255: "P5", width, height, maxval (whitespace and
+// # comments between them), one whitespace byte, then the pixels
+static bool parsePgm(const std::vector<uint8_t> &data, Frame *frame) {
+  size_t pos = 2;
+  int fields[3];
+  if (data.size() < 2 || data[0] != 'P' || data[1] != '5') {
+    return false;
+  }
+  for (int &field : fields) {
+    while (pos < data.size() && (isspace(data[pos]) || data[pos] == '#')) {
+      if (data[pos] == '#') {
+        while (pos < data.size() && data[pos] != '\n') {
+          pos++;
+        }
+      } else {
+        pos++;
+      }
+    }
+    field = 0;
+    size_t start = pos;
+    while (pos < data.size() && isdigit(data[pos]) && field < 65536) {
+      field = field * 10 + (data[pos++] - '0');
+    }
+    if (pos == start || field == 0) {
+      return false;
+    }
+  }
+  pos++;
+  size_t pixels = (size_t)fields[0] * fields[1];
+  if (fields[2] > 255 || data.size() < pos + pixels) {
+    return false;
+  }
+  frame->width = fields[0];
+  frame->height = fields[1];
+  frame->gray.assign(data.begin() + pos, data.begin() + pos + pixels);
+  frame->jpeg = encodeJpegGray(frame->gray.data(), frame->width, frame->height, JPEG_QUALITY);
+  return true;
+}
+
+static std::map<std::string, float> loadLabels(const std::string &path) {
+  std::map<std::string, float> labels;
+  FILE *f = fopen(path.c_str(), "r");
+  if (!f) {
+    return labels;
+  }
+  char line[512];
+  while (fgets(line, sizeof(line), f)) {
+    char *comma = strchr(line, ',');
+    char *end;
+    if (line[0] == '#' || !comma) {
+      continue;
+    }
+    float angle = strtof(comma + 1, &end);
+    if (end != comma + 1) {
+      labels[std::string(line, comma - line)] = angle;
+    }
+  }
+  fclose(f);
+  return labels;
+}
+
+static bool loadFolder(const char *path, std::vector<Frame> *corpus) {
+  DIR *dir = opendir(path);
+  if (!dir) {
+    fprintf(stderr, "Cannot open %s\n", path);
+    return false;
+  }
+  std::vector<std::string> names;
+  while (dirent *entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    size_t dot = name.rfind('.');
+    std::string ext = dot == std::string::npos ? "" : name.substr(dot);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    if (ext == ".jpg" || ext == ".jpeg" || ext == ".pgm") {
+      names.push_back(name);
+    }
+  }
+  closedir(dir);
+  std::sort(names.begin(), names.end());
+
+  std::string folder = path;
+  std::map<std::string, float> labels = loadLabels(folder + "/labels.csv");
+  for (const std::string &name : names) {
+    Frame frame;
+    std::vector<uint8_t> data;
+    bool pgm = name.size() > 4 && !strcasecmp(name.c_str() + name.size() - 4, ".pgm");
+    bool ok = readFile(folder + "/" + name, &data);
+    if (ok && pgm) {
+      ok = parsePgm(data, &frame);
+    } else if (ok) {
+      frame.jpeg = std::move(data);
+      ok = decodeJpegGray(frame.jpeg.data(), frame.jpeg.size(), 1 << 16, &frame.gray,
+                          &frame.width, &frame.height);
+    }
+    if (!ok) {
+      fprintf(stderr, "Cannot read %s/%s\n", path, name.c_str());
+      return false;
+    }
+    auto label = labels.find(name);
+    frame.labelled = label != labels.end();
+    frame.label = frame.labelled ? label->second : 0;
+    corpus->push_back(std::move(frame));
+  }
+  return true;
+}
+
+static bool isFolder(const char *path) {
+  struct stat sb;
+  return stat(path, &sb) == 0 && S_ISDIR(sb.st_mode);
+}
+
+static void syntheticCorpus(std::vector<Frame> *corpus) {
+  for (uint32_t i = 0; i < SYNTHETIC_SWEEP_FRAMES; i++) {
+    Frame frame;
+    frame.width = SYNTHETIC_WIDTH;
+    frame.height = SYNTHETIC_HEIGHT;
+    frame.gray.resize(SYNTHETIC_WIDTH * SYNTHETIC_HEIGHT);
+    frame.labelled = true;
+    frame.label = syntheticAngle(i);
+    renderSyntheticFace(frame.gray.data(), SYNTHETIC_WIDTH, SYNTHETIC_HEIGHT, frame.label);
+    frame.jpeg = encodeJpegGray(frame.gray.data(), SYNTHETIC_WIDTH, SYNTHETIC_HEIGHT,
+                                JPEG_QUALITY);
+    corpus->push_back(std::move(frame));
+  }
+}
+
+// The synthetic corpus as a folder loadFolder() reads: even frames as
+// JPEG, odd ones as PGM
+static bool saveFolder(const char *path, const std::vector<Frame> &corpus) {
+  if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "Cannot create %s\n", path);
+    return false;
+  }
+  std::string folder = path;
+  FILE *labels = fopen((folder + "/labels.csv").c_str(), "w");
+  if (!labels) {
+    fprintf(stderr, "Cannot write %s/labels.csv\n", path);
+    return false;
+  }
+  fprintf(labels, "# frame,degrees\n");
+  bool ok = true;
+  for (size_t i = 0; i < corpus.size() && ok; i++) {
+    const Frame &frame = corpus[i];
+    char name[32];
+    snprintf(name, sizeof(name), "frame_%03zu.%s", i, i % 2 ? "pgm" : "jpg");
+    FILE *f = fopen((folder + "/" + name).c_str(), "wb");
+    if (!f) {
+      ok = false;
+      break;
+    }
+    if (i % 2) {
+      fprintf(f, "P5\n%d %d\n255\n", frame.width, frame.height);
+      ok = fwrite(frame.gray.data(), 1, frame.gray.size(), f) == frame.gray.size();
+    } else {
+      ok = fwrite(frame.jpeg.data(), 1, frame.jpeg.size(), f) == frame.jpeg.size();
+    }
+    ok = fclose(f) == 0 && ok;
+    fprintf(labels, "%s,%.3f\n", name, frame.label);
+  }
+  ok = fclose(labels) == 0 && ok;
+  if (!ok) {
+    fprintf(stderr, "Cannot write the frames to %s\n", path);
+  }
+  return ok;
+}
+
+// --- Benchmark ---
+
+// One frame through one setup, like trackTask: decode straight to a
+// reduced size, or halve the raw frame until it fits
+static FrameResult trackFrame(const Frame &frame, const Setup &setup, Input input,
+                              TiltEstimator &estimator, std::vector<uint8_t> *a,
+                              std::vector<uint8_t> *b) {
+  FrameResult out = {};
+  auto start = std::chrono::steady_clock::now();
+  const uint8_t *gray;
+  int width, height;
+  if (input == INPUT_JPEG) {
+    if (!decodeJpegGray(frame.jpeg.data(), frame.jpeg.size(), setup.maxWidth, a, &width,
+                        &height)) {
+      out.decodeUs = elapsedUs(start);
+      return out;
+    }
+    gray = a->data();
+  } else {
+    gray = frame.gray.data();
+    width = frame.width;
+    height = frame.height;
+    while (width > setup.maxWidth) {
+      std::vector<uint8_t> *dst = gray == a->data() ? b : a;
+      dst->resize((size_t)(width / 2) * (height / 2));
+      downscale2x(gray, width, height, width, dst->data(), width / 2);
+      gray = dst->data();
+      width /= 2;
+      height /= 2;
+    }
+  }
+  out.decodeUs = elapsedUs(start);
+
+  start = std::chrono::steady_clock::now();
+  TiltResult tilt = estimator.estimate(gray, width, height, width);
+  out.estimateUs = elapsedUs(start);
+  out.found = tilt.found;
+  out.angle = tilt.angle;
+  return out;
+}
+
+// `passes` times over the corpus, frames handed out to `threads` workers
+static Run runSetup(const std::vector<Frame> &corpus, const Setup &setup, Input input,
+                    int threads, int passes) {
+  Run run = {&setup, input, threads, 0, std::vector<FrameResult>(corpus.size()), {}, {}};
+  size_t total = corpus.size() * passes;
+  std::vector<std::vector<uint32_t>> decodeUs(threads), estimateUs(threads);
+  std::atomic<size_t> next{0};
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([&, t]() {
+      TiltEstimator estimator;
+      std::vector<uint8_t> a, b;
+      decodeUs[t].reserve(total / threads + 1);
+      estimateUs[t].reserve(total / threads + 1);
+      for (size_t i = next++; i < total; i = next++) {
+        size_t f = i % corpus.size();
+        FrameResult result = trackFrame(corpus[f], setup, input, estimator, &a, &b);
+        decodeUs[t].push_back(result.decodeUs);
+        estimateUs[t].push_back(result.estimateUs);
+        if (i < corpus.size()) {
+          run.results[f] = result;
+        }
+      }
+    });
+  }
+  for (std::thread &w : workers) {
+    w.join();
+  }
+  double seconds = elapsedUs(start) / 1e6;
+  run.fps = seconds > 0 ? total / seconds : 0;
+  for (int t = 0; t < threads; t++) {
+    run.decodeUs.insert(run.decodeUs.end(), decodeUs[t].begin(), decodeUs[t].end());
+    run.estimateUs.insert(run.estimateUs.end(), estimateUs[t].begin(), estimateUs[t].end());
+  }
+  return run;
+}
+
+// --- Report ---
+
+struct Summary {
+  uint32_t decodeP50, decodeP99, estimateP50, estimateP99;
+  double foundPct;
+  uint32_t compared;
+  double errorMean, errorP90, errorMax;
+};
+
+static Summary summarize(const Run &run, const std::vector<Frame> &corpus) {
+  Summary s = {};
+  std::vector<uint32_t> decode = run.decodeUs, estimate = run.estimateUs;
+  std::vector<float> errors;
+  uint32_t found = 0;
+  for (size_t i = 0; i < run.results.size(); i++) {
+    const FrameResult &r = run.results[i];
+    found += r.found;
+    if (r.found && corpus[i].labelled) {
+      errors.push_back(fabsf(r.angle - corpus[i].label));
+    }
+  }
+  s.decodeP50 = percentile(decode, 0.5);
+  s.decodeP99 = percentile(decode, 0.99);
+  s.estimateP50 = percentile(estimate, 0.5);
+  s.estimateP99 = percentile(estimate, 0.99);
+  s.foundPct = run.results.empty() ? 0 : 100.0 * found / run.results.size();
+  s.compared = errors.size();
+  if (!errors.empty()) {
+    std::sort(errors.begin(), errors.end());
+    double sum = 0;
+    for (float e : errors) {
+      sum += e;
+    }
+    s.errorMean = sum / errors.size();
+    s.errorP90 = percentile(errors, 0.9);
+    s.errorMax = errors.back();
+  }
+  return s;
+}
+
+static std::vector<int> parseThreads(const char *list) {
+  std::vector<int> threads;
+  for (const char *p = list; *p;) {
+    char *end;
+    long n = strtol(p, &end, 10);
+    if (end == p || n < 1) {
+      return {};
+    }
+    threads.push_back((int)n);
+    p = *end == ',' ? end + 1 : end;
+  }
+  return threads;
+}
+
+int main(int argc, char **argv) {
+  std::vector<const char *> paths;
+  std::vector<int> threads = {1, 2, 4};
+  int passes = 3;
+  float maxError = -1;
+  const char *savePath = NULL;
+  bool json = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+      threads = parseThreads(argv[++i]);
+    } else if (!strcmp(argv[i], "--max-error") && i + 1 < argc) {
+      maxError = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--save-synthetic") && i + 1 < argc) {
+      savePath = argv[++i];
+    } else if (!strcmp(argv[i], "--passes") && i + 1 < argc) {
+      passes = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else if (argv[i][0] != '-') {
+      paths.push_back(argv[i]);
+    } else {
+      threads.clear();
+      break;
+    }
+  }
+  if (threads.empty() || passes < 1) {
+    fprintf(stderr,
+            "usage: %s [session.htrs | folder ...] [--threads 1,2,4] [--passes n] "
+            "[--max-error deg] [--tag name] [--json]\n"
+            "       %s --save-synthetic folder\n",
+            argv[0], argv[0]);
+    return 2;
+  }
+  if (savePath) {
+    std::vector<Frame> corpus;
+    syntheticCorpus(&corpus);
+    return saveFolder(savePath, corpus) ? 0 : 1;
+  }
+
+  std::vector<Frame> corpus;
+  for (const char *path : paths) {
+    if (!(isFolder(path) ? loadFolder(path, &corpus) : loadSession(path, &corpus))) {
+      return 1;
+    }
+  }
+  if (paths.empty()) {
+    syntheticCorpus(&corpus);
+  }
+  if (corpus.empty()) {
+    fprintf(stderr, "No frames in the corpus (record with frames, or in Crop to Face mode, "
+                    "or put .jpg/.pgm files in the folder)\n");
+    return 1;
+  }
+  size_t labelled = std::count_if(corpus.begin(), corpus.end(),
+                                  [](const Frame &f) { return f.labelled; });
+
+  std::vector<Run> runs;
+  for (const Setup &setup : SETUPS) {
+    for (Input input : {INPUT_JPEG, INPUT_GRAY}) {
+      for (int n : threads) {
+        runs.push_back(runSetup(corpus, setup, input, n, passes));
+      }
+    }
+  }
+  bool ok = maxError < 0 || labelled > 0;
+  for (const Run &run : runs) {
+    Summary s = summarize(run, corpus);
+    ok = ok && (maxError < 0 || (s.compared > 0 && s.errorMean <= maxError));
+  }
+
+  if (json) {
+    printf("{\"tag\":\"%s\",\"corpus\":\"%s\",\"frames\":%zu,\"labelled\":%zu,"
+           "\"passes\":%d,\"results\":[",
+           tag, paths.empty() ? "synthetic" : "recorded", corpus.size(), labelled, passes);
+    for (size_t i = 0; i < runs.size(); i++) {
+      const Run &run = runs[i];
+      Summary s = summarize(run, corpus);
+      printf("%s{\"setup\":\"%s\",\"input\":\"%s\",\"threads\":%d,\"fps\":%.1f,"
+             "\"decode_us\":{\"p50\":%u,\"p99\":%u},\"estimate_us\":{\"p50\":%u,\"p99\":%u},"
+             "\"found_pct\":%.1f,\"compared\":%u,\"error_deg\":{\"mean\":%.3f,\"p90\":%.3f,"
+             "\"max\":%.3f}}",
+             i ? "," : "", run.setup->name, INPUT_NAMES[run.input], run.threads, run.fps,
+             s.decodeP50, s.decodeP99, s.estimateP50, s.estimateP99, s.foundPct, s.compared,
+             s.errorMean, s.errorP90, s.errorMax);
+    }
+    printf("],\"ok\":%s}\n", ok ? "true" : "false");
+    return ok ? 0 : 1;
+  }
+
+  printf("%zu frames (%zu labelled), %d passes, %u hardware threads\n", corpus.size(),
+         labelled, passes, std::thread::hardware_concurrency());
+  printf("%-9s %-5s %7s %9s  %-17s %-17s %6s  %s\n", "setup", "input", "threads", "fps",
+         "decode us p50/p99", "estim. us p50/p99", "found", "error deg mean/p90/max");
+  for (const Run &run : runs) {
+    Summary s = summarize(run, corpus);
+    char decode[32], estimate[32], error[48] = "-";
+    snprintf(decode, sizeof(decode), "%u/%u", s.decodeP50, s.decodeP99);
+    snprintf(estimate, sizeof(estimate), "%u/%u", s.estimateP50, s.estimateP99);
+    if (s.compared > 0) {
+      snprintf(error, sizeof(error), "%.2f/%.2f/%.2f (%u)", s.errorMean, s.errorP90,
+               s.errorMax, s.compared);
+    }
+    printf("%-9s %-5s %7d %9.1f  %-17s %-17s %5.1f%%  %s\n", run.setup->name,
+           INPUT_NAMES[run.input], run.threads, run.fps, decode, estimate, s.foundPct, error);
+  }
+  if (maxError >= 0) {
+    printf("%s: mean error %s %.2f degrees\n", ok ? "OK" : "FAIL",
+           ok ? "within" : "above (or nothing labelled)", maxError);
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,373 @@
+// Checks the WebSocket control messages (tilt_message.h) and measures how
+// fast tilt updates get across a loopback socket.
+//
+// Round trips: every angle the 0.01 degree field can hold, and angles
+// past it (clamped), confidence from 0 to 1 and beyond, every lane, both
+// flag states and awkward seq/capture-time values go through
+// encodeTiltUpdate() and back. The page -> device messages are written
+// here the way index.html writes them (DataView, little-endian) over
+// their whole value range, and decoded. Every decoder must also reject
+// a message that is a byte short or of another type.
+//
+// Loopback: a sender thread writes TILT_MSG_UPDATEs in unmasked binary
+// WebSocket frames (as WebSocketsServer sends them, 2 + 14 bytes) down a
+// TCP connection on 127.0.0.1 with Nagle off, and a receiver thread reads
+// and decodes them. The capture-time field carries the send time in
+// microseconds, so the receiver gets the end-to-end latency of each
+// message. Once paced (--rate per second, like tracked frames) and once
+// as fast as the sender can go, for messages per second. Fails if a
+// message is lost, reordered or does not decode.
+//
+// Build and run on Linux from the repository root:
+//   g++ -O2 -pthread -I. tools/tilt_message_check.cpp -o tilt_message_check
+//   ./tilt_message_check
+//   ./tilt_message_check --rate 60 --paced 600 --flood 1000000 --json --tag "$(git rev-parse --short HEAD)"
+// Exits 1 if a check failed.
+
+#include "tilt_message.h"
+#include "tools/bench_stats.h"
+
+#include <arpa/inet.h>
+#include <math.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#define WS_BINARY_FINAL 0x82 // FIN + binary opcode
+#define WS_HEADER_SIZE 2     // unmasked, payload under 126 bytes
+#define FRAME_SIZE (WS_HEADER_SIZE + TILT_UPDATE_SIZE)
+
+// ==========================================
+// ROUND TRIPS
+// ==========================================
+struct RoundTrips {
+  uint32_t checked = 0;
+  uint32_t failed = 0;
+};
+
+static void expect(RoundTrips *r, bool ok, const char *what, double value) {
+  r->checked++;
+  if (!ok) {
+    if (r->failed < 10) {
+      fprintf(stderr, "  %s: wrong for %g\n", what, value);
+    }
+    r->failed++;
+  }
+}
+
+// Decoders must not read past len, nor take another type's message
+template <typename T, typename Decode>
+static void expectRejects(RoundTrips *r, const uint8_t *msg, size_t size, Decode decode,
+                          const char *what) {
+  T out;
+  for (size_t len = 0; len < size; len++) {
+    expect(r, !decode(msg, len, &out), what, (double)len);
+  }
+  uint8_t other[32];
+  memcpy(other, msg, size);
+  for (uint8_t type = 0; type < 8; type++) {
+    if (type != msg[0]) {
+      other[0] = type;
+      expect(r, !decode(other, size, &out), what, type);
+    }
+  }
+}
+
+static bool sameUpdate(const TiltUpdate &a, const TiltUpdate &b) {
+  return a.lane == b.lane && a.found == b.found && a.seq == b.seq && a.captureMs == b.captureMs;
+}
+
+static void updateRoundTrips(RoundTrips *r) {
+  uint8_t msg[TILT_UPDATE_SIZE];
+  TiltUpdate in = {1, 0, 0.5f, true, 7, 9}, out;
+
+  // Every 0.01 degree step comes back exactly
+  for (int centi = -32768; centi <= 32767; centi++) {
+    in.angle = centi / 100.0f;
+    bool ok = encodeTiltUpdate(in, msg) == TILT_UPDATE_SIZE && decodeTiltUpdate(msg, sizeof(msg), &out);
+    expect(r, ok && lroundf(out.angle * 100) == centi && sameUpdate(in, out), "angle", in.angle);
+  }
+  // Past the field's range it clamps; in between it rounds to nearest
+  for (float angle : {400.0f, -400.0f, 1e9f, -1e9f, 327.674f, -327.684f}) {
+    in.angle = angle;
+    encodeTiltUpdate(in, msg);
+    decodeTiltUpdate(msg, sizeof(msg), &out);
+    float expected = angle > 327.67f ? 327.67f : angle < -327.68f ? -327.68f : angle;
+    expect(r, fabsf(out.angle - expected) <= 0.005f + 1e-4f, "clamped angle", angle);
+  }
+  for (int i = 0; i < 100000; i++) {
+    in.angle = -90 + 180.0f * i / 100000;
+    encodeTiltUpdate(in, msg);
+    decodeTiltUpdate(msg, sizeof(msg), &out);
+    expect(r, fabsf(out.angle - in.angle) <= 0.005f + 1e-4f, "rounded angle", in.angle);
+  }
+
+  in.angle = 3.5f;
+  for (int i = -100; i <= 1100; i++) {
+    in.confidence = i / 1000.0f;
+    encodeTiltUpdate(in, msg);
+    decodeTiltUpdate(msg, sizeof(msg), &out);
+    float expected = in.confidence < 0 ? 0 : in.confidence > 1 ? 1 : in.confidence;
+    expect(r, fabsf(out.confidence - expected) <= 0.5f / 255 + 1e-6f, "confidence",
+           in.confidence);
+  }
+
+  static const uint32_t NUMBERS[] = {0,       1,          0xff,       0x100,      0xffff,
+                                     0x10000, 0x7fffffff, 0x80000000, 0xfffffffe, 0xffffffff};
+  for (uint8_t lane = 0; lane < 3; lane++) {
+    for (bool found : {false, true}) {
+      for (uint32_t seq : NUMBERS) {
+        for (uint32_t ms : NUMBERS) {
+          in = {lane, -12.34f, 0.25f, found, seq, ms};
+          encodeTiltUpdate(in, msg);
+          expect(r, decodeTiltUpdate(msg, sizeof(msg), &out) && sameUpdate(in, out),
+                 "lane/found/seq/captureMs", seq);
+        }
+      }
+    }
+  }
+  expectRejects<TiltUpdate>(r, msg, sizeof(msg), decodeTiltUpdate, "short or mistyped update");
+
+  // The page's lane rule: the threshold itself is still the centre lane
+  for (int t = 0; t <= 45; t++) {
+    expect(r,
+           tiltLane((float)t, (float)t) == 1 && tiltLane(-(float)t, (float)t) == 1 &&
+               tiltLane(t + 0.01f, (float)t) == 2 && tiltLane(-t - 0.01f, (float)t) == 0,
+           "tiltLane", t);
+  }
+}
+
+// Page -> device messages, written as the page's DataView code does
+static void pageRoundTrips(RoundTrips *r) {
+  uint8_t msg[TILT_FACE_BOX_SIZE];
+
+  TiltConfig config;
+  for (int threshold = 0; threshold <= 255; threshold++) {
+    for (uint8_t flags : {0, TILT_FLAG_INVERT, 0xfe, 0xff}) {
+      msg[0] = TILT_MSG_CONFIG;
+      msg[1] = threshold;
+      msg[2] = flags;
+      expect(r,
+             decodeTiltConfig(msg, TILT_CONFIG_SIZE, &config) && config.threshold == threshold &&
+                 config.invert == ((flags & TILT_FLAG_INVERT) != 0),
+             "config", threshold);
+    }
+  }
+  expectRejects<TiltConfig>(r, msg, TILT_CONFIG_SIZE, decodeTiltConfig, "short or mistyped config");
+
+  float fps;
+  for (int tenths = 0; tenths <= 0xffff; tenths++) {
+    msg[0] = TILT_MSG_CLIENT_STATS;
+    msg[1] = tenths & 0xff;
+    msg[2] = tenths >> 8;
+    expect(r, decodeClientFps(msg, TILT_CLIENT_STATS_SIZE, &fps) && fps == tenths / 10.0f,
+           "client fps", tenths / 10.0);
+  }
+  expectRejects<float>(r, msg, TILT_CLIENT_STATS_SIZE, decodeClientFps,
+                       "short or mistyped client stats");
+
+  FaceBox box;
+  uint32_t seed = 1;
+  for (int i = 0; i < 20000; i++) {
+    uint16_t v[6];
+    for (uint16_t &field : v) {
+      seed = seed * 1103515245u + 12345u;
+      field = (seed >> 8) & 0xffff;
+    }
+    v[2] |= 1; // width, height and the frame size must not be 0
+    v[3] |= 1;
+    v[4] |= 1;
+    v[5] |= 1;
+    msg[0] = TILT_MSG_FACE_BOX;
+    for (int f = 0; f < 6; f++) {
+      msg[1 + 2 * f] = v[f] & 0xff;
+      msg[2 + 2 * f] = v[f] >> 8;
+    }
+    expect(r,
+           decodeFaceBox(msg, TILT_FACE_BOX_SIZE, &box) && box.x == v[0] && box.y == v[1] &&
+               box.width == v[2] && box.height == v[3] && box.frameWidth == v[4] &&
+               box.frameHeight == v[5],
+           "face box", i);
+  }
+  expectRejects<FaceBox>(r, msg, TILT_FACE_BOX_SIZE, decodeFaceBox, "short or mistyped face box");
+  for (int zero = 2; zero < 6; zero++) {
+    msg[1 + 2 * zero] = msg[2 + 2 * zero] = 0;
+    expect(r, !decodeFaceBox(msg, TILT_FACE_BOX_SIZE, &box), "empty face box", zero);
+    msg[1 + 2 * zero] = 1;
+  }
+}
+
+// ==========================================
+// LOOPBACK
+// ==========================================
+static uint32_t nowUs() {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// A connected TCP pair on 127.0.0.1, Nagle off on both ends
+static bool loopbackPair(int *sender, int *receiver) {
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t len = sizeof(addr);
+  if (listener < 0 || bind(listener, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+      listen(listener, 1) != 0 || getsockname(listener, (struct sockaddr *)&addr, &len) != 0) {
+    return false;
+  }
+  *receiver = socket(AF_INET, SOCK_STREAM, 0);
+  bool ok = connect(*receiver, (struct sockaddr *)&addr, sizeof(addr)) == 0 &&
+            (*sender = accept(listener, nullptr, nullptr)) >= 0;
+  close(listener);
+  int one = 1;
+  setsockopt(*sender, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  setsockopt(*receiver, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  return ok;
+}
+
+struct LoopbackResult {
+  uint32_t sent = 0, received = 0, bad = 0;
+  double seconds = 0;
+  std::vector<uint32_t> latencyUs;
+
+  double perSecond() const { return seconds > 0 ? received / seconds : 0; }
+};
+
+// count messages, rate per second (0: as fast as possible)
+static LoopbackResult loopback(uint32_t count, double rate) {
+  LoopbackResult result;
+  int sender = -1, receiver = -1;
+  if (!loopbackPair(&sender, &receiver)) {
+    fprintf(stderr, "cannot open a loopback connection\n");
+    result.bad = 1;
+    return result;
+  }
+  result.latencyUs.reserve(count);
+
+  auto start = std::chrono::steady_clock::now();
+  std::thread send([&] {
+    uint8_t frame[FRAME_SIZE] = {WS_BINARY_FINAL, TILT_UPDATE_SIZE};
+    for (uint32_t i = 1; i <= count; i++) {
+      if (rate > 0) {
+        std::this_thread::sleep_until(start + std::chrono::microseconds((int64_t)(i * 1e6 / rate)));
+      }
+      TiltUpdate u = {(uint8_t)(i % 3), (float)(i % 90) - 45, 0.8f, true, i, nowUs()};
+      encodeTiltUpdate(u, frame + WS_HEADER_SIZE);
+      if (::send(sender, frame, sizeof(frame), MSG_NOSIGNAL) != (ssize_t)sizeof(frame)) {
+        break;
+      }
+      result.sent++;
+    }
+    shutdown(sender, SHUT_WR);
+  });
+
+  // Reads in bulk, as a browser's socket would, and splits frames
+  std::vector<uint8_t> buf(64 * 1024);
+  size_t have = 0;
+  uint32_t expected = 1;
+  for (;;) {
+    ssize_t n = recv(receiver, buf.data() + have, buf.size() - have, 0);
+    if (n <= 0) {
+      break;
+    }
+    uint32_t arrived = nowUs();
+    have += n;
+    size_t pos = 0;
+    for (; have - pos >= FRAME_SIZE; pos += FRAME_SIZE) {
+      TiltUpdate u = {};
+      const uint8_t *frame = buf.data() + pos;
+      if (frame[0] != WS_BINARY_FINAL || frame[1] != TILT_UPDATE_SIZE ||
+          !decodeTiltUpdate(frame + WS_HEADER_SIZE, TILT_UPDATE_SIZE, &u) || u.seq != expected) {
+        result.bad++;
+      }
+      expected = u.seq + 1;
+      result.received++;
+      result.latencyUs.push_back(arrived - u.captureMs);
+    }
+    memmove(buf.data(), buf.data() + pos, have - pos);
+    have -= pos;
+  }
+  send.join();
+  result.seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  if (result.received != result.sent || have != 0) {
+    result.bad++;
+  }
+  close(sender);
+  close(receiver);
+  return result;
+}
+
+int main(int argc, char **argv) {
+  double rate = 100;
+  uint32_t paced = 300;
+  uint32_t flood = 500000;
+  bool json = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--rate") && i + 1 < argc) {
+      rate = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--paced") && i + 1 < argc) {
+      paced = strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--flood") && i + 1 < argc) {
+      flood = strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else {
+      rate = 0;
+      break;
+    }
+  }
+  if (rate <= 0 || paced == 0 || flood == 0) {
+    fprintf(stderr, "usage: %s [--rate per_second] [--paced n] [--flood n] [--tag name] [--json]\n",
+            argv[0]);
+    return 2;
+  }
+
+  RoundTrips trips;
+  updateRoundTrips(&trips);
+  pageRoundTrips(&trips);
+  LoopbackResult slow = loopback(paced, rate);
+  LoopbackResult fast = loopback(flood, 0);
+  bool ok = trips.failed == 0 && slow.bad == 0 && fast.bad == 0;
+
+  uint32_t slowP50 = percentile(slow.latencyUs, 0.5), slowP99 = percentile(slow.latencyUs, 0.99);
+  uint32_t fastP50 = percentile(fast.latencyUs, 0.5), fastP99 = percentile(fast.latencyUs, 0.99);
+  if (json) {
+    printf("{\"tag\":\"%s\",\"round_trips\":%u,\"round_trip_failures\":%u,"
+           "\"paced\":{\"rate\":%.0f,\"messages\":%u,\"latency_us\":{\"p50\":%u,\"p99\":%u,"
+           "\"max\":%u},\"bad\":%u},"
+           "\"flood\":{\"messages\":%u,\"per_second\":%.0f,\"mbytes_per_second\":%.2f,"
+           "\"latency_us\":{\"p50\":%u,\"p99\":%u},\"bad\":%u},\"ok\":%s}\n",
+           tag, trips.checked, trips.failed, rate, slow.received, slowP50, slowP99,
+           slow.latencyUs.empty() ? 0 : slow.latencyUs.back(), slow.bad, fast.received,
+           fast.perSecond(), fast.perSecond() * FRAME_SIZE / 1e6, fastP50, fastP99, fast.bad,
+           ok ? "true" : "false");
+  } else {
+    printf("round trips: %u checked, %u wrong\n", trips.checked, trips.failed);
+    printf("loopback, %d-byte frames (%d header + %d message):\n", FRAME_SIZE, WS_HEADER_SIZE,
+           TILT_UPDATE_SIZE);
+    printf("  paced  %5.0f/s  %8u messages  latency p50 %u us, p99 %u us, max %u us\n", rate,
+           slow.received, slowP50, slowP99, slow.latencyUs.empty() ? 0 : slow.latencyUs.back());
+    printf("  flood  %8.0f/s (%.1f MB/s)  %u messages  latency p50 %u us, p99 %u us\n",
+           fast.perSecond(), fast.perSecond() * FRAME_SIZE / 1e6, fast.received, fastP50,
+           fastP99);
+    if (slow.bad || fast.bad) {
+      printf("  lost, reordered or undecodable: %u paced, %u flood\n", slow.bad, fast.bad);
+    }
+    printf("%s\n", ok ? "OK" : "FAIL");
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,356 @@
+// Replays a tilt trace through the old steering rule (raw angle, hard
+// threshold) and through TiltFilter + TiltLaneLatch, and reports how late
+// each one changes lane and how often it switches when it should not.
+//
+// Build and run on a PC from the repository root:
+//   g++ -O2 -I. tools/tilt_replay.cpp tilt_filter.cpp -o tilt_replay
+//   ./tilt_replay                       # built-in synthetic trace
+//   ./tilt_replay trace.csv --latency 120 --threshold 8 --json
+//   ./tilt_replay --check
+//
+// --check exits 1 unless the filter catches as many true lane changes as
+// the old rule, no later (mean and p90), with at most CHECK_FALSE_RATIO of
+// its false switches.
+//
+// A trace is CSV, one frame per line: capture time in ms, measured angle
+// in degrees ("nan" when no face was found) and optionally the true angle.
+// Without a truth column, a centred 5-frame average of the trace stands in
+// for it. Lines starting with '#' are ignored.
+
+#include "tilt_filter.h"
+#include "tilt_message.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#define DISPLAY_FRAME_MS 16
+// A lane change up to this much before the true one still counts for it
+#define EARLY_MS 150
+#define CHECK_FALSE_RATIO 0.75f
+
+struct Sample {
+  uint32_t timeMs; // capture time
+  float angle;     // NAN when no face was found
+  float truth;
+};
+
+struct Change {
+  uint32_t timeMs;
+  uint8_t lane;
+};
+
+struct Score {
+  int changes = 0;
+  int matched = 0;
+  int falseSwitches = 0;
+  std::vector<int> latencies;
+  uint32_t wrongMs = 0;
+  uint32_t totalMs = 0;
+};
+
+// Small deterministic generator so every run sees the same trace
+static uint32_t rngState = 12345;
+static float uniform() {
+  rngState = rngState * 1664525u + 1013904223u;
+  return (rngState >> 8) / 16777216.0f;
+}
+static float gaussian() {
+  float u = uniform() + 1e-7f;
+  return sqrtf(-2.0f * logf(u)) * cosf(2.0f * (float)M_PI * uniform());
+}
+
+// Quick steering moves between lanes, plus long stretches of holding just
+// inside and just beyond the threshold, where jitter causes false switches
+static std::vector<Sample> syntheticTrace(float threshold) {
+  struct Segment {
+    float target;
+    int rampMs;
+    int holdMs;
+  };
+  const Segment script[] = {
+      {0, 0, 1500},     {22, 250, 1200},  {0, 250, 1500},  {-20, 200, 1000},
+      {0, 300, 1200},   {threshold - 1.5f, 600, 3000},   {0, 300, 800},
+      {threshold + 2.5f, 400, 2500},      {-threshold + 1.5f, 500, 3000},
+      {-18, 200, 900},  {18, 350, 1200},  {0, 250, 1500},
+  };
+
+  // Truth sampled every ms, then read by jittery ~15 fps captures
+  std::vector<float> truth;
+  float angle = 0;
+  for (int round = 0; round < 3; round++) {
+    for (const Segment &s : script) {
+      float from = angle;
+      for (int t = 0; t < s.rampMs; t++) {
+        float k = (t + 1) / (float)s.rampMs;
+        truth.push_back(from + (s.target - from) * (3 * k * k - 2 * k * k * k));
+      }
+      angle = s.target;
+      for (int t = 0; t < s.holdMs; t++) {
+        truth.push_back(angle);
+      }
+    }
+  }
+
+  std::vector<Sample> trace;
+  uint32_t t = 0;
+  while (t < truth.size()) {
+    Sample s;
+    s.timeMs = t;
+    s.truth = truth[t];
+    s.angle = uniform() < 0.02f ? NAN : truth[t] + 1.2f * gaussian();
+    trace.push_back(s);
+    t += 56 + (uint32_t)(uniform() * 20);
+  }
+  return trace;
+}
+
+static bool loadTrace(const char *path, std::vector<Sample> *trace) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    fprintf(stderr, "Cannot open %s\n", path);
+    return false;
+  }
+  char line[256];
+  bool haveTruth = true;
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    Sample s;
+    char *end;
+    s.timeMs = strtoul(line, &end, 10);
+    if (*end != ',') {
+      continue;
+    }
+    s.angle = strtof(end + 1, &end);
+    if (*end == ',') {
+      s.truth = strtof(end + 1, &end);
+    } else {
+      s.truth = NAN;
+      haveTruth = false;
+    }
+    trace->push_back(s);
+  }
+  fclose(f);
+
+  if (!haveTruth) {
+    for (size_t i = 0; i < trace->size(); i++) {
+      float sum = 0;
+      int n = 0;
+      for (size_t j = i < 2 ? 0 : i - 2; j <= i + 2 && j < trace->size(); j++) {
+        if (!isnan((*trace)[j].angle)) {
+          sum += (*trace)[j].angle;
+          n++;
+        }
+      }
+      (*trace)[i].truth = n ? sum / n : (i ? (*trace)[i - 1].truth : 0);
+    }
+  }
+  return trace->size() >= 2;
+}
+
+// True angle at any ms, interpolated between captures
+static float truthAt(const std::vector<Sample> &trace, uint32_t timeMs) {
+  auto next = std::lower_bound(trace.begin(), trace.end(), timeMs,
+                               [](const Sample &s, uint32_t t) { return s.timeMs < t; });
+  if (next == trace.begin()) {
+    return trace.front().truth;
+  }
+  if (next == trace.end()) {
+    return trace.back().truth;
+  }
+  const Sample &prev = *(next - 1);
+  float k = (timeMs - prev.timeMs) / (float)(next->timeMs - prev.timeMs);
+  return prev.truth + (next->truth - prev.truth) * k;
+}
+
+static void record(std::vector<Change> *changes, uint32_t timeMs, uint8_t lane) {
+  if (changes->empty() || changes->back().lane != lane) {
+    changes->push_back({timeMs, lane});
+  }
+}
+
+// A lane change counts for the true change it follows (or anticipates by
+// at most earlyMs), if it goes to the same lane before the next true
+// change. Every other change is a false switch.
+static Score score(const std::vector<Change> &truth, const std::vector<Change> &got,
+                   uint32_t earlyMs) {
+  Score s;
+  s.changes = got.size() - 1;
+  std::vector<bool> used(got.size(), false);
+  used[0] = true; // starting lane
+  for (size_t k = 1; k < truth.size(); k++) {
+    uint32_t from = truth[k].timeMs > earlyMs ? truth[k].timeMs - earlyMs : 0;
+    uint32_t to = k + 1 < truth.size() ? truth[k + 1].timeMs : UINT32_MAX;
+    for (size_t i = 1; i < got.size(); i++) {
+      if (!used[i] && got[i].lane == truth[k].lane && got[i].timeMs >= from &&
+          got[i].timeMs < to) {
+        used[i] = true;
+        s.matched++;
+        s.latencies.push_back((int)got[i].timeMs - (int)truth[k].timeMs);
+        break;
+      }
+    }
+  }
+  for (size_t i = 1; i < got.size(); i++) {
+    if (!used[i]) {
+      s.falseSwitches++;
+    }
+  }
+  std::sort(s.latencies.begin(), s.latencies.end());
+  return s;
+}
+
+static float mean(const std::vector<int> &v) {
+  if (v.empty()) {
+    return 0;
+  }
+  long sum = 0;
+  for (int x : v) {
+    sum += x;
+  }
+  return sum / (float)v.size();
+}
+
+static int p90(const std::vector<int> &v) {
+  return v.empty() ? 0 : v[std::min(v.size() - 1, (size_t)(0.9f * v.size()))];
+}
+
+int main(int argc, char **argv) {
+  const char *path = NULL;
+  float threshold = 8;
+  uint32_t latencyMs = 80; // capture -> tilt known to the game
+  uint32_t leadMs = DISPLAY_FRAME_MS;
+  bool json = false;
+  TiltFilterConfig config;
+  float hysteresis = TiltLaneLatch().hysteresis();
+  bool check = false;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--threshold") && i + 1 < argc) {
+      threshold = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--latency") && i + 1 < argc) {
+      latencyMs = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--lead") && i + 1 < argc) {
+      leadMs = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--min-cutoff") && i + 1 < argc) {
+      config.minCutoff = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--beta") && i + 1 < argc) {
+      config.beta = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--deriv-cutoff") && i + 1 < argc) {
+      config.derivCutoff = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--max-lead") && i + 1 < argc) {
+      config.maxLeadMs = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--noise-speed") && i + 1 < argc) {
+      config.noiseSpeed = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--hysteresis") && i + 1 < argc) {
+      hysteresis = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else if (!strcmp(argv[i], "--check")) {
+      check = true;
+    } else if (argv[i][0] != '-') {
+      path = argv[i];
+    } else {
+      fprintf(stderr, "usage: %s [trace.csv] [--threshold deg] [--latency ms] "
+                      "[--lead ms] [--min-cutoff hz] [--beta k] [--deriv-cutoff hz] "
+                      "[--max-lead ms] [--noise-speed deg/s] [--hysteresis deg] [--check] "
+                      "[--json]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  std::vector<Sample> trace;
+  if (path) {
+    if (!loadTrace(path, &trace)) {
+      return 1;
+    }
+  } else {
+    trace = syntheticTrace(threshold);
+  }
+
+  // What the lane should have been, at the moment it is displayed
+  std::vector<Change> truth;
+  uint32_t endMs = trace.back().timeMs + latencyMs;
+  for (uint32_t t = 0; t <= endMs + leadMs; t++) {
+    record(&truth, t, tiltLane(truthAt(trace, t), threshold));
+  }
+
+  // Step the game one display frame at a time; frames reach it latencyMs
+  // after capture. The old rule only changes lane when a frame arrives,
+  // the filter extrapolates on every display frame.
+  std::vector<Change> current, filtered;
+  TiltFilter filter(config);
+  TiltLaneLatch latch(hysteresis);
+  uint8_t currentLane = 1;
+  size_t next = 0;
+  Score wrong[2];
+  for (uint32_t t = 0; t <= endMs; t += DISPLAY_FRAME_MS) {
+    while (next < trace.size() && trace[next].timeMs + latencyMs <= t) {
+      const Sample &s = trace[next++];
+      if (!isnan(s.angle)) {
+        currentLane = tiltLane(s.angle, threshold);
+        filter.update(s.angle, s.timeMs);
+      }
+    }
+    if (filter.valid()) {
+      latch.update(filter.predict(t + leadMs), threshold);
+    }
+    // Shown leadMs later
+    record(&current, t + leadMs, currentLane);
+    record(&filtered, t + leadMs, latch.lane());
+
+    uint8_t want = tiltLane(truthAt(trace, t + leadMs), threshold);
+    wrong[0].wrongMs += currentLane != want ? DISPLAY_FRAME_MS : 0;
+    wrong[1].wrongMs += latch.lane() != want ? DISPLAY_FRAME_MS : 0;
+  }
+
+  Score results[2] = {score(truth, current, EARLY_MS), score(truth, filtered, EARLY_MS)};
+  const char *names[2] = {"current", "filtered"};
+  for (int i = 0; i < 2; i++) {
+    results[i].wrongMs = wrong[i].wrongMs;
+    results[i].totalMs = endMs;
+  }
+  const Score &old = results[0], &now = results[1];
+  bool ok = mean(now.latencies) <= mean(old.latencies) && p90(now.latencies) <= p90(old.latencies) &&
+            now.falseSwitches <= CHECK_FALSE_RATIO * old.falseSwitches &&
+            now.matched >= old.matched;
+  int status = check && !ok ? 1 : 0;
+
+  if (json) {
+    printf("{\"frames\":%u,\"truthChanges\":%u,\"latencyMs\":%u,\"threshold\":%.1f",
+           (unsigned)trace.size(), (unsigned)truth.size() - 1, (unsigned)latencyMs,
+           threshold);
+    for (int i = 0; i < 2; i++) {
+      const Score &r = results[i];
+      printf(",\"%s\":{\"changes\":%d,\"matched\":%d,\"falseSwitches\":%d,"
+             "\"latencyMeanMs\":%.1f,\"latencyP90Ms\":%d,\"wrongLanePct\":%.2f}",
+             names[i], r.changes, r.matched, r.falseSwitches, mean(r.latencies),
+             p90(r.latencies), 100.0f * r.wrongMs / r.totalMs);
+    }
+    printf("}\n");
+    return status;
+  }
+
+  printf("%u frames, %u true lane changes, %u ms capture->game, threshold %.1f\n",
+         (unsigned)trace.size(), (unsigned)truth.size() - 1, (unsigned)latencyMs, threshold);
+  printf("%-22s %10s %10s\n", "", names[0], names[1]);
+  printf("%-22s %10d %10d\n", "lane changes", results[0].changes, results[1].changes);
+  printf("%-22s %10d %10d\n", "matched", results[0].matched, results[1].matched);
+  printf("%-22s %10d %10d\n", "false switches", results[0].falseSwitches,
+         results[1].falseSwitches);
+  printf("%-22s %10.0f %10.0f\n", "change latency ms", mean(results[0].latencies),
+         mean(results[1].latencies));
+  printf("%-22s %10d %10d\n", "change latency p90 ms", p90(results[0].latencies),
+         p90(results[1].latencies));
+  printf("%-22s %10.1f %10.1f\n", "wrong lane %", 100.0f * results[0].wrongMs / endMs,
+         100.0f * results[1].wrongMs / endMs);
+  if (check) {
+    printf("%s\n", ok ? "OK" : "FAIL: the filter is slower, misses changes or switches too often");
+  }
+  return status;
+}
@@ -0,0 +1,365 @@
+// Aggregate throughput and tail latency of the sketch's viewers with slow
+// clients attached, against the host build (see HOST BUILD in README.txt).
+// Viewers are pumped from httpTask without blocking (serviceViewers());
+// this shows that a phone on a poor link costs the other viewers nothing
+// and only gets fewer frames itself.
+//
+// The host build replays VGA fake frames (tools/fake_frames.h) at --fps.
+// Two phases of --seconds each:
+//   - alone: --fast /stream clients reading as fast as they can and one
+//     client polling /capture once per camera frame,
+//   - loaded: the same, plus --slow /stream clients that each read at
+//     most --slow-kbps through a small receive buffer (a phone on a weak
+//     link). A slow client the sketch drops reconnects.
+// For each phase it prints the frames and bytes per second over all
+// clients, the fast streams' frame rate and 99th percentile gap between
+// frames, the /capture round trip (request sent to body in) at p50/p99,
+// and what the slow clients got.
+//
+// Fails if the host build dies, a fast client's request or stream fails,
+// a slow client gets no frame at all, or with the slow clients attached
+//   - the fast streams get under half the frames per second they got
+//     alone, or
+//   - the /capture p99 is over LOADED_CAPTURE_P99_MS: a server that sent
+//     to one client at a time would wait on the slow ones for seconds.
+//
+// Build and run on Linux from the repository root (build/headtilt_host
+// comes from the CMake build):
+//   g++ -O2 -pthread -I. tools/viewer_check.cpp synthetic_camera.cpp -ljpeg -o viewer_check
+//   ./viewer_check build/headtilt_host
+//   ./viewer_check build/headtilt_host --slow 3 --slow-kbps 32 --json --tag "$(git rev-parse --short HEAD)"
+
+#include "tools/bench_stats.h"
+#include "tools/fake_frames.h"
+#include "tools/http_client.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define READ_TIMEOUT_MS 5000
+#define FAKE_FRAMES 16
+#define FAKE_WIDTH 640
+#define FAKE_HEIGHT 480
+#define FAKE_QUALITY 76            // the sketch's jpeg_quality 12 in libjpeg's terms
+#define SLOW_RCVBUF 4096           // so a slow reader pushes back on the sender
+#define LOADED_CAPTURE_P99_MS 250  // a blocking server would take seconds
+#define MAX_VIEWERS 6              // as in the .ino
+
+struct PhaseResult {
+  const char *name;
+  double seconds = 0;
+  std::atomic<uint64_t> frames{0}; // over all clients
+  std::atomic<uint64_t> bytes{0};
+  std::atomic<uint32_t> fastFrames{0};
+  std::atomic<uint32_t> slowFrames{0};
+  std::atomic<uint32_t> slowDropped{0}; // slow connections the sketch closed
+  std::atomic<uint32_t> errors{0};      // fast clients only
+  std::atomic<uint32_t> busy{0};        // 503: every viewer slot taken
+  std::mutex lock;
+  std::vector<double> gapMs;     // between frames on a fast stream
+  std::vector<double> captureMs; // /capture round trips
+  std::vector<uint32_t> slowPerClient;
+
+  PhaseResult(const char *n) : name(n) {}
+};
+
+// One part of a stream: boundary, headers, body. In slow mode every read
+// from the socket first waits until the client is back under its rate.
+struct StreamReader {
+  HttpConn *conn;
+  double kBps = 0; // 0: as fast as possible
+  double startMs = 0;
+
+  bool fill() {
+    if (kBps > 0) {
+      double due = startMs + conn->bytesIn / kBps;
+      double now = httpNowMs();
+      if (due > now) {
+        std::this_thread::sleep_for(std::chrono::microseconds((int64_t)((due - now) * 1000)));
+      }
+    }
+    return conn->fill();
+  }
+
+  bool readLine(std::string *line) {
+    size_t end;
+    while ((end = conn->buf.find("\r\n", conn->pos)) == std::string::npos) {
+      if (!fill()) {
+        return false;
+      }
+    }
+    line->assign(conn->buf, conn->pos, end - conn->pos);
+    conn->pos = end + 2;
+    return true;
+  }
+
+  bool skip(size_t n) {
+    while (conn->buf.size() - conn->pos < n) {
+      if (!fill()) {
+        return false;
+      }
+    }
+    conn->pos += n;
+    return true;
+  }
+
+  // Body length of the next part, or 0 if the stream broke
+  size_t part() {
+    std::string line;
+    while (readLine(&line) && line.empty()) {
+    }
+    if (line != "--frame") {
+      return 0;
+    }
+    std::vector<std::string> headers;
+    while (readLine(&line) && !line.empty()) {
+      headers.push_back(line);
+    }
+    size_t length = strtoul(httpHeader(headers, "Content-Length").c_str(), nullptr, 10);
+    return line.empty() && length > 0 && skip(length) ? length : 0;
+  }
+};
+
+// ==========================================
+// CLIENTS
+// ==========================================
+static void fastStream(const char *host, int port, double endMs, PhaseResult *r) {
+  HttpConn conn;
+  std::vector<std::string> headers;
+  if (!conn.get(host, port, "/stream", READ_TIMEOUT_MS) || conn.readHead(&headers) != 200) {
+    r->errors++;
+    return;
+  }
+  StreamReader reader = {&conn};
+  std::vector<double> gaps;
+  double last = 0;
+  while (httpNowMs() < endMs) {
+    size_t length = reader.part();
+    if (length == 0) {
+      r->errors++;
+      break;
+    }
+    double now = httpNowMs();
+    if (last > 0) {
+      gaps.push_back(now - last);
+    }
+    last = now;
+    r->frames++;
+    r->fastFrames++;
+    r->bytes += length;
+  }
+  std::lock_guard<std::mutex> lock(r->lock);
+  r->gapMs.insert(r->gapMs.end(), gaps.begin(), gaps.end());
+}
+
+static void slowStream(const char *host, int port, double endMs, double kBps, PhaseResult *r) {
+  uint32_t frames = 0;
+  while (httpNowMs() < endMs) {
+    HttpConn conn;
+    std::vector<std::string> headers;
+    if (!conn.get(host, port, "/stream", READ_TIMEOUT_MS)) {
+      break;
+    }
+    int size = SLOW_RCVBUF;
+    setsockopt(conn.fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+    int status = conn.readHead(&headers);
+    if (status == 503) {
+      r->busy++;
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      continue;
+    }
+    if (status != 200) {
+      break;
+    }
+    StreamReader reader = {&conn, kBps, httpNowMs()};
+    size_t length;
+    while (httpNowMs() < endMs && (length = reader.part()) > 0) {
+      frames++;
+      r->frames++;
+      r->slowFrames++;
+      r->bytes += length;
+    }
+    if (httpNowMs() < endMs) {
+      r->slowDropped++;
+    }
+  }
+  std::lock_guard<std::mutex> lock(r->lock);
+  r->slowPerClient.push_back(frames);
+}
+
+// One request per camera frame, like a page that wants every one
+static void capturePoller(const char *host, int port, double endMs, double fps, PhaseResult *r) {
+  std::vector<double> times;
+  std::vector<std::string> headers;
+  for (double start = httpNowMs(); start < endMs; start += 1000 / fps) {
+    double now = httpNowMs();
+    if (start > now) {
+      std::this_thread::sleep_for(std::chrono::microseconds((int64_t)((start - now) * 1000)));
+    } else {
+      start = now;
+    }
+    HttpConn conn;
+    int status = conn.get(host, port, "/capture", READ_TIMEOUT_MS) ? conn.readHead(&headers) : 0;
+    size_t length = strtoul(httpHeader(headers, "Content-Length").c_str(), nullptr, 10);
+    if (status == 503) {
+      r->busy++;
+      continue;
+    }
+    if (status != 200 || !conn.read(length, nullptr)) {
+      r->errors++;
+      continue;
+    }
+    times.push_back(httpNowMs() - start);
+    r->frames++;
+    r->bytes += length;
+  }
+  std::lock_guard<std::mutex> lock(r->lock);
+  r->captureMs.insert(r->captureMs.end(), times.begin(), times.end());
+}
+
+static void runPhase(PhaseResult *r, const char *host, int port, int fast, int slow,
+                     double slowKbps, double fps, double seconds) {
+  double endMs = httpNowMs() + seconds * 1000;
+  std::vector<std::thread> clients;
+  for (int i = 0; i < slow; i++) {
+    clients.emplace_back(slowStream, host, port, endMs, slowKbps, r);
+  }
+  for (int i = 0; i < fast; i++) {
+    clients.emplace_back(fastStream, host, port, endMs, r);
+  }
+  clients.emplace_back(capturePoller, host, port, endMs, fps, r);
+  for (std::thread &t : clients) {
+    t.join();
+  }
+  r->seconds = seconds;
+}
+
+int main(int argc, char **argv) {
+  const char *binary = nullptr;
+  int portOffset = 9800;
+  int fast = 2;
+  int slow = 3;
+  double slowKbps = 64;
+  double fps = 25;
+  double seconds = 4;
+  bool json = false;
+  bool usage = false;
+  const char *tag = "";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--port-offset") && i + 1 < argc) {
+      portOffset = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--fast") && i + 1 < argc) {
+      fast = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--slow") && i + 1 < argc) {
+      slow = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--slow-kbps") && i + 1 < argc) {
+      slowKbps = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--fps") && i + 1 < argc) {
+      fps = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--seconds") && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--tag") && i + 1 < argc) {
+      tag = argv[++i];
+    } else if (!strcmp(argv[i], "--json")) {
+      json = true;
+    } else if (argv[i][0] != '-' && !binary) {
+      binary = argv[i];
+    } else {
+      usage = true;
+    }
+  }
+  // The /capture poller takes a viewer slot too
+  if (usage || !binary || fast < 1 || slow < 1 || fast + slow + 1 > MAX_VIEWERS ||
+      slowKbps <= 0 || fps <= 0 || seconds <= 0) {
+    fprintf(stderr,
+            "usage: %s <headtilt_host> [--port-offset n] [--fast n] [--slow n] [--slow-kbps n] "
+            "[--fps n] [--seconds n] [--tag name] [--json]\n"
+            "  fast + slow + 1 must be at most %d\n",
+            argv[0], MAX_VIEWERS);
+    return 2;
+  }
+
+  std::string folder = writeFakeFrames(FAKE_FRAMES, FAKE_WIDTH, FAKE_HEIGHT, FAKE_QUALITY);
+  if (folder.empty()) {
+    fprintf(stderr, "cannot write the fake frames under /tmp\n");
+    return 1;
+  }
+  char fpsArg[16];
+  snprintf(fpsArg, sizeof(fpsArg), "%g", fps);
+  pid_t pid = startHostBuild(binary, portOffset, {"--frames", folder, "--fps", fpsArg});
+  if (pid < 0) {
+    removeFakeFrames(folder, FAKE_FRAMES);
+    return 1;
+  }
+
+  const char *host = "127.0.0.1";
+  int port = 80 + portOffset;
+  PhaseResult alone("alone"), loaded("loaded");
+  runPhase(&alone, host, port, fast, 0, slowKbps, fps, seconds);
+  runPhase(&loaded, host, port, fast, slow, slowKbps, fps, seconds);
+  bool alive = stopHostBuild(pid);
+  removeFakeFrames(folder, FAKE_FRAMES);
+
+  PhaseResult *phases[] = {&alone, &loaded};
+  double fastFps[2], gapP99[2], captureP50[2], captureP99[2];
+  for (int i = 0; i < 2; i++) {
+    fastFps[i] = phases[i]->fastFrames / phases[i]->seconds / fast;
+    gapP99[i] = percentile(phases[i]->gapMs, 0.99);
+    captureP50[i] = percentile(phases[i]->captureMs, 0.5);
+    captureP99[i] = percentile(phases[i]->captureMs, 0.99);
+  }
+  bool starved = loaded.slowPerClient.size() != (size_t)slow ||
+                 std::count(loaded.slowPerClient.begin(), loaded.slowPerClient.end(), 0u) > 0;
+  bool ok = alive && alone.errors == 0 && loaded.errors == 0 && !starved &&
+            alone.captureMs.size() > 0 && loaded.captureMs.size() > 0 &&
+            fastFps[1] >= fastFps[0] / 2 && captureP99[1] <= LOADED_CAPTURE_P99_MS;
+
+  if (json) {
+    printf("{\"tag\":\"%s\",\"camera_fps\":%.1f,\"fast\":%d,\"slow\":%d,\"slow_kbps\":%.0f,"
+           "\"phases\":[",
+           tag, fps, fast, slow, slowKbps);
+    for (int i = 0; i < 2; i++) {
+      PhaseResult &p = *phases[i];
+      printf("%s{\"name\":\"%s\",\"seconds\":%.1f,\"frames_per_second\":%.1f,"
+             "\"mbytes_per_second\":%.2f,\"fast_fps\":%.1f,\"fast_gap_p99_ms\":%.1f,"
+             "\"capture_ms\":{\"p50\":%.1f,\"p99\":%.1f,\"n\":%zu},\"slow_frames\":%u,"
+             "\"slow_dropped\":%u,\"busy\":%u,\"errors\":%u}",
+             i ? "," : "", p.name, p.seconds, p.frames / p.seconds, p.bytes / p.seconds / 1e6,
+             fastFps[i], gapP99[i], captureP50[i], captureP99[i], p.captureMs.size(),
+             p.slowFrames.load(), p.slowDropped.load(), p.busy.load(), p.errors.load());
+    }
+    printf("],\"host_alive\":%s,\"ok\":%s}\n", alive ? "true" : "false", ok ? "true" : "false");
+  } else {
+    printf("%s: camera at %.0f fps, %d fast /stream clients and a /capture poller, then %d "
+           "more reading %.0f kB/s each, %.0f s each\n",
+           binary, fps, fast, slow, slowKbps, seconds);
+    printf("%-7s %9s %8s %9s %13s %21s %s\n", "", "frames/s", "MB/s", "fast fps", "fast gap p99",
+           "/capture p50 / p99", "slow clients");
+    for (int i = 0; i < 2; i++) {
+      PhaseResult &p = *phases[i];
+      printf("%-7s %9.1f %8.2f %9.1f %10.1f ms %9.1f / %6.1f ms", p.name, p.frames / p.seconds,
+             p.bytes / p.seconds / 1e6, fastFps[i], gapP99[i], captureP50[i], captureP99[i]);
+      if (i == 1) {
+        printf("  %.1f fps each, %u dropped by the sketch",
+               p.slowFrames / p.seconds / slow, p.slowDropped.load());
+      }
+      printf("\n");
+    }
+    printf("  503 (every viewer busy): %u alone, %u loaded; failed requests: %u, %u; host build "
+           "%s\n",
+           alone.busy.load(), loaded.busy.load(), alone.errors.load(), loaded.errors.load(),
+           alive ? "ran to the end" : "died");
+    if (starved) {
+      printf("  a slow client got no frame\n");
+    }
+    printf("%s\n", ok ? "OK" : "FAIL");
+  }
+  return ok ? 0 : 1;
+}
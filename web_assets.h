@@ -0,0 +1,1447 @@
+#pragma once
+
+// Generated by tools/embed_web.py - do not edit.
+// Edit index.html (or vendor/) and re-run the script instead.
+
+#include <pgmspace.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct WebAsset {
+  const char *path;
+  const char *contentType;
+  const char *etag; // quoted, ready for the ETag header
+  const uint8_t *data; // gzip, in flash
+  size_t length;
+  size_t rawLength;
+};
+
+// index.html: 94998 bytes, 22729 gzipped
+static const uint8_t asset_index[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0xbd, 0x7d, 0x5f, 0x1b, 0x39,
+  0xb2, 0x28, 0xfc, 0x7f, 0x3e, 0x85, 0xe2, 0x99, 0x9d, 0xb4, 0x07, 0xdb, 0xd8, 0x10, 0xb2, 0x19,
+  0x13, 0xc8, 0x21, 0x84, 0x24, 0xdc, 0x21, 0x21, 0x3f, 0x60, 0x26, 0x3b, 0xcb, 0xe1, 0x49, 0x1a,
+  0xbb, 0x8d, 0x7b, 0xc6, 0xb8, 0x3d, 0xdd, 0x6d, 0x08, 0x9b, 0xe1, 0x3b, 0xdd, 0xcf, 0x70, 0x3f,
+  0xd9, 0xad, 0x17, 0xa9, 0x5b, 0x52, 0x4b, 0x6d, 0x93, 0xb0, 0x7b, 0xcf, 0x33, 0x7b, 0x4e, 0xb0,
+  0xdd, 0x52, 0xb5, 0x54, 0x2a, 0x95, 0x4a, 0xf5, 0xfa, 0xec, 0xe1, 0xcb, 0xc3, 0xdd, 0x93, 0xdf,
+  0xde, 0xef, 0x89, 0x71, 0x7e, 0x39, 0xd9, 0x7e, 0xf0, 0x0c, 0xff, 0x88, 0x49, 0x38, 0xbd, 0xd8,
+  0x6a, 0x44, 0xd3, 0xc6, 0xf6, 0x03, 0xf8, 0x25, 0x0a, 0x87, 0xdb, 0x0f, 0x04, 0xfc, 0xf7, 0xec,
+  0x32, 0xca, 0x43, 0x31, 0x18, 0x87, 0x69, 0x16, 0xe5, 0x5b, 0x8d, 0x5f, 0x4e, 0x5e, 0xb5, 0x9f,
+  0x36, 0xf4, 0x47, 0xd3, 0xf0, 0x32, 0xda, 0x6a, 0x5c, 0xc5, 0xd1, 0xf5, 0x2c, 0x49, 0xf3, 0x86,
+  0x18, 0x24, 0xd3, 0x3c, 0x9a, 0x42, 0xd3, 0xeb, 0x78, 0x98, 0x8f, 0xb7, 0x86, 0xd1, 0x55, 0x3c,
+  0x88, 0xda, 0xf4, 0xa5, 0x25, 0xe2, 0x69, 0x9c, 0xc7, 0xe1, 0xa4, 0x9d, 0x0d, 0xc2, 0x49, 0xb4,
+  0xd5, 0xeb, 0x74, 0x15, 0xa8, 0x3c, 0xce, 0x27, 0xd1, 0xf6, 0x1b, 0x78, 0x6d, 0xfb, 0x24, 0x9e,
+  0xe4, 0xe2, 0x28, 0x1c, 0xc4, 0xd3, 0x8b, 0x67, 0xab, 0xfc, 0x3b, 0xb7, 0x79, 0xd8, 0x6e, 0x8b,
+  0x83, 0x24, 0x1c, 0x8a, 0x93, 0x68, 0x9a, 0x25, 0xe9, 0xab, 0x49, 0x72, 0xdd, 0xf9, 0x3d, 0x6b,
+  0x89, 0x57, 0xe1, 0x20, 0x12, 0x07, 0xe1, 0x74, 0x78, 0x19, 0xa6, 0x7f, 0x64, 0xe2, 0x65, 0x94,
+  0x47, 0x83, 0x3c, 0x4e, 0xa6, 0x02, 0x7e, 0x12, 0x2f, 0x26, 0xe1, 0xbf, 0x22, 0x6c, 0xd1, 0x17,
+  0xf9, 0x38, 0x82, 0xd1, 0xcd, 0xe2, 0x28, 0x23, 0x78, 0xf4, 0x5f, 0x74, 0x79, 0x1e, 0x0d, 0x87,
+  0xd1, 0x50, 0x40, 0x73, 0x7c, 0xbe, 0x77, 0xfc, 0x7e, 0x7d, 0x4d, 0x04, 0x57, 0xd1, 0x74, 0x98,
+  0xa4, 0xab, 0x2d, 0x91, 0x45, 0x91, 0xc8, 0x93, 0x64, 0x92, 0xad, 0x52, 0xcb, 0x8f, 0xd7, 0xd1,
+  0x79, 0x67, 0x76, 0xd3, 0x14, 0xf1, 0x48, 0xcc, 0xd2, 0x28, 0x83, 0x89, 0xb6, 0x44, 0x34, 0xc9,
+  0x22, 0xea, 0xbc, 0xfb, 0xf2, 0x9d, 0x68, 0xb7, 0xe5, 0x68, 0xb3, 0x41, 0x1a, 0xcf, 0x72, 0x91,
+  0xa5, 0x03, 0xc0, 0x0e, 0x83, 0xcb, 0x47, 0x9d, 0xcb, 0x78, 0x0a, 0x63, 0x6e, 0x6c, 0x3f, 0x5b,
+  0xe5, 0xe7, 0x46, 0xe3, 0xed, 0x62, 0x5c, 0xd7, 0x31, 0x74, 0xb8, 0xee, 0xe4, 0x23, 0xf1, 0xd7,
+  0x5f, 0x62, 0x98, 0x0c, 0xe6, 0x97, 0xf0, 0xa6, 0xce, 0x75, 0x1a, 0xe7, 0x51, 0xf0, 0xc8, 0x00,
+  0x3d, 0xce, 0xf3, 0x59, 0xd6, 0x5f, 0x5d, 0x1d, 0x0c, 0x11, 0xf0, 0x30, 0x9a, 0xc4, 0x57, 0x69,
+  0x67, 0x1a, 0xe5, 0xab, 0xd3, 0xd9, 0xe5, 0xea, 0x7f, 0xe5, 0x84, 0xa9, 0x11, 0x60, 0x0a, 0x5e,
+  0xfe, 0x7b, 0xf6, 0x5f, 0xeb, 0x9d, 0x35, 0x40, 0xfa, 0xea, 0x30, 0xce, 0x72, 0x63, 0x34, 0xff,
+  0xad, 0x86, 0xf3, 0xa8, 0xb9, 0xc9, 0x23, 0x72, 0x8d, 0xcf, 0x98, 0xcc, 0x08, 0x70, 0xda, 0x9e,
+  0x28, 0xac, 0xb7, 0x87, 0x0a, 0xeb, 0x77, 0x98, 0x1e, 0x82, 0x28, 0xd6, 0xad, 0x5c, 0xb6, 0xfb,
+  0x9a, 0x72, 0xfb, 0x32, 0x81, 0x87, 0x99, 0x77, 0xa4, 0xff, 0xd5, 0xed, 0x74, 0x3b, 0xeb, 0x8c,
+  0x8c, 0xfa, 0xd9, 0x7c, 0x05, 0x7a, 0xce, 0x91, 0xee, 0x10, 0xea, 0x1d, 0xf0, 0x51, 0xf4, 0xb9,
+  0x77, 0x14, 0x14, 0x90, 0x69, 0xce, 0x7f, 0xe7, 0x39, 0x5b, 0x43, 0xac, 0x99, 0xa4, 0x1c, 0x75,
+  0x7e, 0xa3, 0xf6, 0x22, 0xfe, 0xd7, 0x4f, 0x93, 0x24, 0x17, 0x5f, 0xca, 0xbd, 0x04, 0xff, 0xad,
+  0xfe, 0x28, 0x5e, 0x02, 0x02, 0xc5, 0x5b, 0x78, 0xad, 0x08, 0x5e, 0x02, 0xf4, 0xf9, 0x24, 0x6f,
+  0x8a, 0x1f, 0x57, 0x8d, 0x56, 0xed, 0xf6, 0xf9, 0x45, 0x7b, 0x90, 0x4c, 0x92, 0xb4, 0x2f, 0xbe,
+  0xeb, 0xf5, 0x7a, 0x9b, 0xd6, 0xd3, 0x3c, 0xfa, 0x9c, 0x17, 0xcf, 0x47, 0xa3, 0x91, 0xfd, 0x7c,
+  0x16, 0x4e, 0xa3, 0x09, 0xc0, 0x80, 0xa7, 0x6b, 0x6b, 0x6b, 0x9e, 0xa7, 0x49, 0x3a, 0x8c, 0xb0,
+  0xff, 0xe3, 0xc7, 0x8f, 0xdd, 0x2d, 0xb2, 0x71, 0x08, 0x48, 0xef, 0x8b, 0xf4, 0xe2, 0x3c, 0x0c,
+  0xba, 0x2d, 0x21, 0xff, 0xaf, 0xb3, 0xd1, 0xb4, 0xdb, 0x87, 0x83, 0x01, 0x2c, 0x44, 0x31, 0xa2,
+  0x6e, 0x77, 0xb8, 0x56, 0x1d, 0x94, 0x6c, 0x34, 0x4e, 0xae, 0xe8, 0xb5, 0xeb, 0xeb, 0x51, 0xb7,
+  0xda, 0x28, 0x8b, 0x80, 0x3d, 0x0e, 0xc3, 0xf4, 0x86, 0xe6, 0x08, 0xcd, 0x06, 0x83, 0x81, 0xdd,
+  0x26, 0x9e, 0xce, 0xe6, 0x39, 0xcf, 0x6e, 0x7d, 0x7d, 0xdd, 0xf3, 0x54, 0xcd, 0x6e, 0x63, 0x63,
+  0xc3, 0x6e, 0x31, 0x08, 0xa7, 0x57, 0x61, 0xc6, 0x00, 0xba, 0xdd, 0x6e, 0xf9, 0xf8, 0xf6, 0x41,
+  0xf1, 0xb1, 0x33, 0x89, 0x2f, 0xc6, 0x39, 0x51, 0x47, 0x75, 0x05, 0x0f, 0xf0, 0x19, 0x2f, 0x61,
+  0xdd, 0xc2, 0x8d, 0xba, 0xa3, 0xb5, 0xd1, 0x46, 0xed, 0xda, 0x39, 0xd6, 0x56, 0x5b, 0x3b, 0xff,
+  0xca, 0xaa, 0xd9, 0x0d, 0x87, 0xc3, 0xbb, 0xad, 0x5d, 0x6f, 0xf1, 0xda, 0xfd, 0xfd, 0x7c, 0xe1,
+  0xda, 0x75, 0xbb, 0x1b, 0x4f, 0xce, 0xd7, 0x17, 0xae, 0x9d, 0x03, 0xf7, 0xda, 0xda, 0x39, 0x66,
+  0x67, 0xad, 0x9d, 0x63, 0xed, 0xf5, 0xb5, 0x8b, 0xa2, 0xc8, 0xb9, 0x76, 0xe7, 0xc9, 0xf0, 0xc6,
+  0x5a, 0x34, 0x60, 0x5a, 0x17, 0xf1, 0xb4, 0x2f, 0xba, 0x26, 0xbc, 0x59, 0x38, 0x1c, 0xc2, 0x29,
+  0xda, 0x17, 0x6b, 0xdd, 0xd9, 0x67, 0xf3, 0xd1, 0x79, 0x38, 0xf8, 0xe3, 0x22, 0x4d, 0xe6, 0xd3,
+  0xa1, 0x42, 0xcd, 0x55, 0x98, 0x06, 0xe5, 0xfa, 0x5a, 0x78, 0x34, 0xda, 0x94, 0x4b, 0x6c, 0xb5,
+  0x1a, 0xc1, 0xd1, 0xdf, 0x1e, 0x85, 0x97, 0xf1, 0xe4, 0xa6, 0x2f, 0x1e, 0x1d, 0x47, 0x17, 0x49,
+  0x24, 0x7e, 0xd9, 0x7f, 0xd4, 0x12, 0x27, 0xe1, 0x38, 0xb9, 0x0c, 0x5b, 0xe2, 0x75, 0x34, 0x8d,
+  0xae, 0xe0, 0xef, 0xaf, 0x51, 0x3a, 0x0c, 0xa7, 0xf0, 0x21, 0x0b, 0xa7, 0x19, 0x20, 0x36, 0x8d,
+  0x2d, 0x5c, 0x01, 0x7f, 0x9a, 0x4d, 0x42, 0x80, 0x32, 0x9a, 0x44, 0xd6, 0xc8, 0xf1, 0x97, 0xf6,
+  0x30, 0x4e, 0x99, 0x3f, 0xf7, 0x71, 0x68, 0xf3, 0xcb, 0xa9, 0xd9, 0x26, 0x04, 0xf2, 0x9e, 0xb6,
+  0x81, 0x6d, 0x5e, 0x66, 0xd0, 0x00, 0x96, 0x36, 0x4a, 0xcd, 0x06, 0x70, 0xf0, 0xb5, 0xc7, 0x11,
+  0xd2, 0x79, 0x5f, 0xf4, 0xba, 0xdd, 0xab, 0xb1, 0xf9, 0x38, 0x4f, 0x61, 0x5c, 0x31, 0xc3, 0xb7,
+  0x31, 0x05, 0x54, 0xb6, 0x0e, 0x42, 0x47, 0xf9, 0xd9, 0xb9, 0x48, 0xe3, 0x9e, 0x73, 0x89, 0x60,
+  0xf1, 0xf3, 0x3c, 0xb9, 0xb4, 0x57, 0x44, 0xdf, 0x99, 0x97, 0x21, 0x34, 0x83, 0xb9, 0x27, 0x73,
+  0x9b, 0xb9, 0x2e, 0x42, 0xca, 0x75, 0x1a, 0xce, 0xfa, 0x02, 0xff, 0x35, 0x1f, 0x5e, 0xe0, 0xcf,
+  0x55, 0x12, 0xf8, 0x7d, 0x9e, 0xe5, 0xf1, 0xe8, 0xa6, 0x2d, 0x05, 0x36, 0x37, 0xa2, 0x0c, 0x4c,
+  0xd2, 0x5b, 0xb2, 0x3c, 0x4c, 0x73, 0xf7, 0xd0, 0x69, 0x6f, 0xde, 0x71, 0xd0, 0xdf, 0xba, 0x92,
+  0xe5, 0xf2, 0x28, 0xf2, 0x54, 0x1c, 0xa6, 0xe9, 0xd9, 0x0c, 0xbd, 0xea, 0x66, 0xa0, 0x1d, 0xd9,
+  0x4e, 0xc3, 0x61, 0x3c, 0xcf, 0xfc, 0x0d, 0x00, 0x89, 0xb3, 0xcf, 0x22, 0x4b, 0x26, 0xf1, 0xd0,
+  0x7c, 0x15, 0x3d, 0x6d, 0xda, 0x5d, 0x3e, 0x17, 0x5c, 0xaa, 0x0b, 0xff, 0x43, 0xfc, 0x1b, 0xbd,
+  0xf8, 0x61, 0xf3, 0xce, 0x84, 0x27, 0x07, 0xbb, 0x80, 0xfe, 0xe4, 0x5a, 0x8c, 0xd7, 0x7c, 0x9c,
+  0x02, 0xfe, 0x87, 0xf3, 0xb4, 0x59, 0x06, 0x6d, 0xe1, 0x2c, 0xfe, 0x17, 0x88, 0xcb, 0xbd, 0xa7,
+  0x36, 0x1a, 0x0c, 0x2e, 0x60, 0xb2, 0xc3, 0xa6, 0x7b, 0x14, 0x92, 0x9f, 0x21, 0x4d, 0xce, 0xa2,
+  0xd4, 0x1a, 0xcb, 0x2c, 0x51, 0x53, 0x4d, 0xa3, 0x49, 0x98, 0xc7, 0x57, 0x91, 0xf9, 0x3a, 0xba,
+  0x33, 0xf4, 0xc5, 0xe3, 0xa7, 0x95, 0xf5, 0x80, 0x43, 0xea, 0x18, 0x6f, 0x10, 0x43, 0x90, 0x92,
+  0xae, 0xa7, 0xe2, 0x2a, 0xce, 0xe6, 0xe1, 0x64, 0x72, 0x03, 0x92, 0xba, 0x18, 0xc5, 0x20, 0x22,
+  0xc5, 0xc3, 0xa8, 0x7d, 0x7e, 0xd3, 0xc6, 0xbf, 0xf6, 0x11, 0xa6, 0x76, 0xfd, 0xfa, 0x13, 0xdf,
+  0x0e, 0xe4, 0x31, 0x5b, 0x63, 0x95, 0x63, 0x01, 0x5e, 0xf1, 0xb7, 0x4d, 0x27, 0xbc, 0xea, 0x93,
+  0x2a, 0x65, 0x16, 0xdc, 0xbd, 0x59, 0x4b, 0x7f, 0x8f, 0x3d, 0x03, 0x83, 0x59, 0xbf, 0x86, 0xcb,
+  0x96, 0x38, 0x84, 0x53, 0x0a, 0xb6, 0x54, 0xa6, 0x4f, 0xed, 0xbb, 0x79, 0x8c, 0x4c, 0xa3, 0x06,
+  0xc7, 0xe1, 0x39, 0x50, 0xee, 0x3c, 0xb7, 0x70, 0x9c, 0x27, 0xb3, 0xca, 0xb1, 0x31, 0x89, 0x46,
+  0x79, 0xe5, 0xc7, 0xaf, 0x40, 0xc0, 0x2c, 0x89, 0x71, 0xbf, 0xb6, 0x23, 0x10, 0x89, 0x73, 0x98,
+  0xd7, 0x34, 0x99, 0x46, 0xf7, 0xca, 0xe6, 0x2b, 0x1c, 0x2c, 0x9b, 0xa1, 0x18, 0x7f, 0x1e, 0xe5,
+  0xd7, 0x51, 0x34, 0xbd, 0xc3, 0xf6, 0xff, 0x8c, 0x24, 0x4f, 0x4f, 0xe5, 0x52, 0xc0, 0x4f, 0x6e,
+  0x82, 0x1e, 0xcf, 0x87, 0x6d, 0xc0, 0xd9, 0xf2, 0x4c, 0xee, 0x2e, 0x63, 0xd4, 0x36, 0x5f, 0x95,
+  0x5d, 0xd3, 0xc3, 0x6b, 0x89, 0xec, 0xf3, 0x64, 0x62, 0x49, 0x46, 0x74, 0x28, 0x2b, 0x86, 0x83,
+  0x7c, 0x0a, 0xff, 0xbf, 0x6b, 0x49, 0x80, 0xda, 0x26, 0xae, 0xca, 0x27, 0x40, 0x5e, 0x3b, 0x93,
+  0x6b, 0xa4, 0xab, 0xeb, 0x31, 0x30, 0x5c, 0xbc, 0x11, 0x5f, 0x20, 0xb9, 0xc9, 0xfd, 0xa0, 0x11,
+  0x9b, 0x8d, 0x10, 0x3e, 0xd4, 0x2c, 0x9c, 0xd0, 0x80, 0x88, 0x7d, 0xbb, 0x19, 0xb7, 0xce, 0x69,
+  0x9e, 0xd8, 0x93, 0x35, 0x66, 0xd3, 0x83, 0x99, 0xf4, 0x16, 0xcc, 0x26, 0x0c, 0x43, 0xdf, 0x6c,
+  0x48, 0xd4, 0x5d, 0x6e, 0x36, 0xdf, 0xc1, 0xe1, 0x96, 0xcf, 0xb3, 0xf6, 0x65, 0x76, 0xf1, 0x35,
+  0xfb, 0x68, 0xc3, 0xde, 0x01, 0xbc, 0x93, 0x2a, 0x3f, 0x13, 0x97, 0x1f, 0x25, 0x29, 0xc8, 0x01,
+  0xf4, 0x11, 0x98, 0x5f, 0x14, 0xb4, 0xa1, 0x59, 0x4b, 0xe0, 0xbf, 0x4d, 0x3f, 0x1f, 0xb1, 0xe5,
+  0xdd, 0xa7, 0x1b, 0xcd, 0xe5, 0x45, 0xbe, 0x45, 0xa7, 0xdc, 0xa2, 0x15, 0xb3, 0xf7, 0x73, 0x38,
+  0xcf, 0x13, 0xb3, 0xc5, 0xbf, 0x40, 0xc4, 0x1d, 0x46, 0x9f, 0x11, 0xb8, 0x93, 0x7b, 0x3c, 0xb5,
+  0x31, 0xb1, 0x34, 0x31, 0xe2, 0xd8, 0x44, 0x3c, 0x15, 0x09, 0xf3, 0x3e, 0xcf, 0xfa, 0x9d, 0xcf,
+  0x81, 0x10, 0xa7, 0xd6, 0xd2, 0x55, 0xf9, 0xb0, 0x7e, 0x27, 0x68, 0x2e, 0x39, 0x20, 0x25, 0x02,
+  0x54, 0x99, 0x58, 0x81, 0xf2, 0xa7, 0x48, 0xa7, 0x4f, 0x9c, 0xfb, 0xd6, 0x47, 0xe7, 0x0b, 0x36,
+  0xf5, 0x60, 0x9e, 0x66, 0x38, 0x1c, 0x89, 0xf9, 0xda, 0xf5, 0xdc, 0xb0, 0x61, 0x4b, 0x89, 0x93,
+  0x28, 0xd3, 0xb1, 0xd8, 0x8b, 0x24, 0x8d, 0x4d, 0x3f, 0x82, 0xfb, 0x74, 0x51, 0x5a, 0x16, 0xcd,
+  0xd4, 0xb8, 0x59, 0x07, 0x0e, 0xd8, 0x67, 0x78, 0x8e, 0xa7, 0xb9, 0x1f, 0x62, 0xf5, 0xb2, 0xa5,
+  0x70, 0x33, 0x4d, 0x90, 0x68, 0x27, 0xc9, 0x75, 0x34, 0xf4, 0xc8, 0x20, 0x80, 0xe3, 0x34, 0x99,
+  0x64, 0x6e, 0x81, 0x9c, 0xd0, 0x53, 0xdd, 0x2c, 0x35, 0x1c, 0xdd, 0x23, 0x4e, 0xff, 0x3b, 0x24,
+  0xd5, 0x8d, 0xaf, 0x96, 0x54, 0x7b, 0xcb, 0x4b, 0xaa, 0xb5, 0x77, 0x87, 0x85, 0x97, 0x04, 0x0d,
+  0xd3, 0x93, 0xf0, 0xbc, 0x22, 0xfe, 0xeb, 0xd4, 0xff, 0xf8, 0xeb, 0xe4, 0xc9, 0x05, 0xcb, 0xb1,
+  0x10, 0xef, 0xb4, 0x5e, 0x1b, 0x1e, 0x99, 0x8a, 0xae, 0xe4, 0xa7, 0xf9, 0xcd, 0x2c, 0xda, 0x82,
+  0x0d, 0x71, 0x11, 0x9d, 0x79, 0xe5, 0xbe, 0xc5, 0x00, 0x70, 0xdc, 0x76, 0xff, 0x62, 0x2d, 0x17,
+  0x2d, 0xe5, 0xe3, 0x65, 0x57, 0x52, 0x57, 0x22, 0x34, 0x17, 0x51, 0x98, 0xd2, 0x47, 0xdc, 0xf9,
+  0x3a, 0x7f, 0xab, 0x34, 0x80, 0xac, 0xf3, 0x7b, 0xb6, 0xca, 0x16, 0x81, 0x07, 0xcf, 0x50, 0xfb,
+  0xa0, 0x14, 0x82, 0xe3, 0x9e, 0x43, 0x63, 0x0f, 0x3f, 0xca, 0xc7, 0xc3, 0xf8, 0x4a, 0x0c, 0x26,
+  0x61, 0x96, 0x6d, 0x35, 0xb4, 0x4b, 0x6d, 0x63, 0xbb, 0x44, 0x1e, 0xab, 0xf4, 0xf7, 0x5e, 0x9d,
+  0x88, 0xf7, 0x3b, 0xef, 0xf6, 0x0e, 0xfa, 0x62, 0x77, 0xe7, 0xed, 0xde, 0xd1, 0x8e, 0x78, 0xb5,
+  0xb7, 0xf7, 0xb2, 0xd0, 0xa4, 0xdb, 0xb0, 0x88, 0x94, 0x1b, 0xdb, 0xc6, 0x84, 0x9e, 0x8d, 0xd7,
+  0xb6, 0x77, 0xe1, 0x78, 0x4f, 0x43, 0xf1, 0x2a, 0x02, 0x46, 0xf2, 0x83, 0x38, 0x49, 0x01, 0x19,
+  0x3c, 0xa0, 0x35, 0xab, 0xad, 0x06, 0xcb, 0xbc, 0x9f, 0x58, 0x40, 0xa9, 0xb1, 0x94, 0x17, 0xe2,
+  0x21, 0xda, 0x38, 0x86, 0x51, 0xb2, 0x4b, 0xdf, 0x1b, 0x4c, 0x18, 0x5b, 0x8d, 0x27, 0x8f, 0xbb,
+  0x0d, 0x29, 0x02, 0x6f, 0x35, 0xe0, 0xa6, 0x82, 0xaa, 0x5e, 0xee, 0xe2, 0x80, 0x85, 0x2f, 0x2e,
+  0x00, 0xb5, 0xe5, 0x51, 0xd6, 0xa8, 0xb4, 0xc3, 0xff, 0x08, 0xef, 0x30, 0x57, 0x25, 0x76, 0x14,
+  0x52, 0x87, 0x90, 0x1a, 0x04, 0xda, 0xfa, 0x2c, 0x60, 0x74, 0x37, 0x25, 0x99, 0x92, 0x08, 0xae,
+  0x1f, 0xe3, 0x72, 0x3b, 0xc8, 0xf5, 0xfe, 0xae, 0x3b, 0x82, 0xa6, 0xfa, 0x91, 0x43, 0x27, 0x8e,
+  0x21, 0x6c, 0x59, 0xb2, 0x96, 0x03, 0x23, 0xac, 0x0a, 0x86, 0x45, 0xa0, 0xa9, 0xe4, 0xb0, 0xf4,
+  0x6d, 0xb9, 0x3b, 0x1b, 0xdb, 0x48, 0x08, 0x70, 0x73, 0xf8, 0x61, 0x18, 0x5d, 0x6c, 0x02, 0xed,
+  0x40, 0x23, 0x07, 0x16, 0x56, 0x01, 0x0d, 0xd6, 0x8a, 0x98, 0x3f, 0xc9, 0xaf, 0x26, 0x95, 0x1c,
+  0xed, 0xbf, 0x7e, 0x53, 0x90, 0xc9, 0x6b, 0x20, 0x93, 0x3b, 0xd3, 0x07, 0xdd, 0x9d, 0x7e, 0x8d,
+  0xa3, 0xeb, 0x7b, 0x24, 0x09, 0x14, 0x29, 0xef, 0x40, 0x11, 0x7e, 0x92, 0x50, 0xd7, 0x37, 0x1f,
+  0xc2, 0xb5, 0x01, 0xca, 0x2b, 0x88, 0xa7, 0xa5, 0x01, 0x35, 0x1b, 0x24, 0x69, 0x54, 0x2e, 0xcf,
+  0x31, 0x7e, 0x85, 0xf5, 0x71, 0x2c, 0x81, 0xb3, 0x3b, 0xcc, 0x7f, 0x54, 0xf4, 0x56, 0x24, 0x59,
+  0x72, 0x74, 0x62, 0xe8, 0x38, 0x3d, 0x2f, 0xb4, 0xba, 0x47, 0xd6, 0x8c, 0x98, 0xac, 0x6b, 0x26,
+  0x45, 0x4c, 0x06, 0xd9, 0x8d, 0x38, 0x00, 0xa2, 0x5f, 0x3d, 0x22, 0xa9, 0x1e, 0x2e, 0xfc, 0xc7,
+  0x79, 0x14, 0xa5, 0x77, 0x79, 0xbb, 0x4d, 0x5e, 0x06, 0x99, 0x1d, 0xa3, 0x76, 0x6b, 0xf5, 0x98,
+  0xae, 0x01, 0xea, 0xa2, 0x6d, 0x50, 0x5a, 0x15, 0xc7, 0xc5, 0x95, 0xc1, 0xb7, 0x76, 0xe3, 0x75,
+  0xbd, 0x21, 0x59, 0x34, 0x1b, 0xdb, 0x68, 0xc8, 0x04, 0xf6, 0x24, 0x76, 0xf6, 0x3b, 0x9d, 0x0e,
+  0x50, 0xe4, 0xba, 0xa7, 0xf3, 0xcc, 0xe8, 0x0b, 0x3b, 0xb5, 0xb1, 0xfd, 0x7e, 0x12, 0x85, 0x59,
+  0x24, 0xae, 0xc3, 0x38, 0x87, 0x9e, 0x33, 0x4f, 0x47, 0x29, 0x0b, 0xcb, 0xde, 0x29, 0x9c, 0x02,
+  0xf9, 0xb4, 0x21, 0x0a, 0x51, 0x2b, 0x99, 0x0e, 0x26, 0xf1, 0xe0, 0x0f, 0xf9, 0x10, 0xf7, 0x46,
+  0xd0, 0x04, 0x0a, 0xc1, 0x2f, 0xa4, 0x65, 0x78, 0xb6, 0xca, 0x00, 0xbe, 0x75, 0x03, 0x1b, 0x9f,
+  0x09, 0xc3, 0x3f, 0xef, 0x1d, 0xec, 0x9d, 0x1c, 0xbe, 0x13, 0xbf, 0xee, 0xef, 0x7d, 0xe0, 0x0d,
+  0x2d, 0x82, 0x7d, 0xb6, 0x0b, 0x4f, 0x6e, 0xc4, 0x9b, 0x78, 0x38, 0x8c, 0xa6, 0xcd, 0xd2, 0x8e,
+  0x5a, 0xe0, 0xf9, 0x8f, 0x68, 0x12, 0xc1, 0x80, 0x58, 0x94, 0x69, 0x98, 0xbb, 0x5d, 0x11, 0x67,
+  0x45, 0xa8, 0x2b, 0x24, 0x07, 0x92, 0xdb, 0xb5, 0x15, 0x42, 0x8e, 0x70, 0x2c, 0x41, 0x8a, 0x55,
+  0xb6, 0x21, 0xbf, 0x8d, 0xb2, 0xb1, 0x83, 0x43, 0x2c, 0xcd, 0x1d, 0x74, 0xce, 0xa0, 0x86, 0xfb,
+  0x15, 0xe7, 0x85, 0x86, 0x4d, 0x03, 0x7b, 0xfa, 0x30, 0xa4, 0x4c, 0xab, 0x4f, 0x88, 0xc4, 0x2f,
+  0x73, 0x40, 0xf2, 0x48, 0xdc, 0x7f, 0xdf, 0x17, 0xcf, 0x48, 0x14, 0x10, 0x24, 0xa8, 0x34, 0x88,
+  0x8e, 0x68, 0x98, 0x83, 0xf0, 0xb2, 0x1d, 0xcf, 0x1a, 0x20, 0x0a, 0x4c, 0xe6, 0xf0, 0xa0, 0x21,
+  0x00, 0x59, 0x83, 0x68, 0x0c, 0xe7, 0x42, 0x94, 0x6e, 0x35, 0xa2, 0xce, 0x45, 0x47, 0xf4, 0x7e,
+  0x5a, 0xeb, 0xf4, 0x9e, 0x3c, 0xed, 0xf4, 0x3a, 0x70, 0xbe, 0x14, 0x98, 0x56, 0x82, 0x11, 0x61,
+  0x59, 0x1f, 0xc6, 0xaa, 0x35, 0x0e, 0xd7, 0xb8, 0xde, 0x13, 0xaf, 0x03, 0xa9, 0xe7, 0x59, 0x06,
+  0x58, 0x1a, 0xe4, 0xcc, 0x6d, 0xf8, 0x47, 0x17, 0xc7, 0x4d, 0x66, 0x78, 0x08, 0x6e, 0xf7, 0x9e,
+  0xad, 0xca, 0x4f, 0xde, 0x26, 0x6b, 0x8b, 0x9b, 0xac, 0x2f, 0x6e, 0xf2, 0xd8, 0xdd, 0x04, 0x8e,
+  0x34, 0x1a, 0xee, 0x1d, 0x67, 0xfb, 0x16, 0xb8, 0xae, 0x5c, 0x8a, 0xcc, 0xbb, 0x10, 0x33, 0xd8,
+  0x78, 0x37, 0xb0, 0x14, 0x59, 0xb9, 0x16, 0x95, 0xe1, 0x19, 0x6b, 0x23, 0xd1, 0x25, 0xd6, 0xda,
+  0x8f, 0x5b, 0xa2, 0xb2, 0x50, 0xbd, 0x96, 0xf1, 0x75, 0xcd, 0x5e, 0xb7, 0xb5, 0xc5, 0xeb, 0xa6,
+  0x31, 0x90, 0xeb, 0xe8, 0x1c, 0x09, 0x85, 0x38, 0x48, 0xc1, 0x38, 0xf2, 0xe4, 0xe2, 0x62, 0x12,
+  0x7d, 0xa0, 0x47, 0xc8, 0x3b, 0x7e, 0x01, 0x9e, 0xc4, 0xdf, 0xaa, 0xbc, 0x43, 0x07, 0x16, 0x4f,
+  0x81, 0xad, 0xe6, 0x4e, 0x60, 0xfb, 0xf4, 0x08, 0x80, 0xa9, 0xd1, 0x6a, 0x12, 0x2d, 0x5c, 0xc9,
+  0x37, 0x36, 0x48, 0x24, 0xe1, 0x56, 0xcc, 0xf8, 0x49, 0xb6, 0x3e, 0x7c, 0xf5, 0xaa, 0xfe, 0x95,
+  0x05, 0xef, 0x70, 0xbd, 0x54, 0x71, 0x01, 0xe2, 0x7f, 0xe3, 0xe4, 0x5a, 0xa8, 0x1f, 0xea, 0x61,
+  0xe6, 0x28, 0x60, 0x3a, 0x01, 0x2a, 0xd1, 0x13, 0x01, 0xaa, 0xcf, 0x7d, 0xf1, 0x22, 0x4d, 0xae,
+  0xb3, 0x28, 0xad, 0x07, 0x9a, 0x26, 0xb1, 0x13, 0xe4, 0x51, 0x12, 0x23, 0xb4, 0xdd, 0x34, 0x99,
+  0xe1, 0x99, 0xc7, 0xfe, 0x2c, 0x0b, 0xa7, 0x4d, 0xc6, 0x7f, 0x27, 0xbc, 0xbd, 0x1b, 0x63, 0x94,
+  0x68, 0xeb, 0x9d, 0xf4, 0x4b, 0x26, 0x58, 0x0f, 0x76, 0x90, 0x5c, 0x02, 0xb5, 0x46, 0x4e, 0xc0,
+  0xbb, 0xfc, 0x8c, 0x00, 0x66, 0x34, 0x64, 0xfe, 0x41, 0xf0, 0x2f, 0x4b, 0x0c, 0x3a, 0x85, 0x7b,
+  0x60, 0x3a, 0x74, 0x63, 0x81, 0x1e, 0xc9, 0x31, 0xf3, 0x97, 0x25, 0x00, 0xe6, 0xe3, 0xe8, 0xd2,
+  0x3d, 0xd8, 0x13, 0x7c, 0x42, 0xab, 0x84, 0x1f, 0xfa, 0xe4, 0xba, 0xe0, 0x80, 0xe5, 0xd8, 0xd2,
+  0xc7, 0x11, 0x29, 0x4f, 0xae, 0xe2, 0xfc, 0xc6, 0xda, 0xd1, 0x74, 0x8b, 0xe4, 0x2d, 0x9d, 0x95,
+  0x8d, 0x1a, 0x68, 0x71, 0xdc, 0x6a, 0xc0, 0x36, 0xbc, 0x0c, 0x3f, 0xc3, 0xdf, 0x6e, 0xb1, 0xcb,
+  0x9f, 0x36, 0xb6, 0x59, 0x9c, 0xae, 0xec, 0x76, 0x05, 0xa2, 0x0d, 0x2d, 0x1b, 0xdb, 0x4f, 0x9d,
+  0x42, 0xf5, 0x52, 0xfc, 0xe7, 0x78, 0x06, 0x57, 0xa2, 0x9a, 0x61, 0xe2, 0x63, 0x39, 0xc0, 0x9e,
+  0x1c, 0x60, 0xaf, 0x1c, 0xe0, 0x86, 0x8f, 0x49, 0x54, 0x4e, 0x76, 0x22, 0x1f, 0xa2, 0x39, 0x71,
+  0x9d, 0xa4, 0x7f, 0xe0, 0xe5, 0x95, 0x84, 0x0b, 0xa2, 0xb4, 0x28, 0x0d, 0x9a, 0x22, 0x9d, 0x4f,
+  0x33, 0x91, 0x8f, 0xe3, 0x4c, 0x24, 0xa3, 0x11, 0xb9, 0x4c, 0xe1, 0xc5, 0x10, 0x3e, 0xa4, 0x28,
+  0xd7, 0xd9, 0xae, 0x53, 0x25, 0x8b, 0x5c, 0xfd, 0x1d, 0x8e, 0x5c, 0x02, 0xd9, 0x28, 0xf7, 0x1e,
+  0x5c, 0x9e, 0xe5, 0x6f, 0xe5, 0x00, 0xe1, 0x5c, 0xcc, 0x72, 0x1e, 0x43, 0x26, 0xb6, 0xc4, 0x97,
+  0xdb, 0x4d, 0xb1, 0xba, 0x2a, 0x1a, 0x97, 0x40, 0xd3, 0xb4, 0xfa, 0x91, 0x98, 0x80, 0xdc, 0x15,
+  0x0d, 0x5b, 0xa2, 0x11, 0xdd, 0x44, 0x99, 0xfc, 0x6d, 0x14, 0xa7, 0xd0, 0x6b, 0x9e, 0x45, 0xc3,
+  0x52, 0x97, 0x11, 0xe5, 0x02, 0x5a, 0x1c, 0xc4, 0xe7, 0x08, 0x67, 0x3a, 0x9f, 0x4c, 0x36, 0x8d,
+  0x67, 0xf2, 0xa4, 0x77, 0x3e, 0xca, 0x3f, 0x17, 0xbf, 0x97, 0xb6, 0x9b, 0x55, 0xb1, 0x17, 0x0e,
+  0xc6, 0x62, 0x12, 0x9f, 0xa7, 0x61, 0x7a, 0x23, 0x46, 0x69, 0x72, 0x49, 0x08, 0xe0, 0x77, 0x67,
+  0xc9, 0x3c, 0x1d, 0xa0, 0x13, 0x59, 0x98, 0xd3, 0x08, 0x33, 0xcd, 0x05, 0x0d, 0x5a, 0x4d, 0xd1,
+  0xb5, 0xac, 0x59, 0x00, 0x1b, 0xcd, 0xa7, 0xec, 0x29, 0x15, 0x5f, 0xa2, 0xcf, 0xdd, 0x2b, 0x04,
+  0x11, 0xcc, 0xd3, 0x49, 0xd6, 0xac, 0x68, 0x5f, 0x52, 0x11, 0x30, 0x4e, 0xe0, 0x31, 0x20, 0x5d,
+  0xb8, 0x5a, 0xb1, 0x3a, 0xf0, 0xc6, 0xf1, 0x2b, 0x91, 0x21, 0xbd, 0xe3, 0x98, 0x96, 0x24, 0xc3,
+  0xb7, 0x58, 0xba, 0x04, 0xf5, 0x5f, 0x1a, 0xe5, 0xf3, 0x74, 0x5a, 0x7d, 0x76, 0x0b, 0xb8, 0xca,
+  0x61, 0xe6, 0x41, 0xd4, 0xf4, 0xbc, 0x01, 0x70, 0x83, 0xaf, 0x47, 0x6c, 0x4c, 0x51, 0xcd, 0xcb,
+  0xc8, 0xa8, 0x02, 0x7a, 0xe0, 0xff, 0x06, 0x14, 0x04, 0x8c, 0x7b, 0x1a, 0x5d, 0x8b, 0xbd, 0x34,
+  0x4d, 0xd2, 0xa0, 0x01, 0x62, 0xd7, 0x34, 0x61, 0x5c, 0x8a, 0x86, 0x58, 0xa1, 0x79, 0x9f, 0xe2,
+  0x3f, 0x9d, 0x49, 0x34, 0xbd, 0xc8, 0xc7, 0xa2, 0x2d, 0x7a, 0x67, 0x6e, 0xa5, 0x64, 0x98, 0xdd,
+  0x4c, 0x07, 0x25, 0x8e, 0x11, 0x44, 0x00, 0xd2, 0xbd, 0x3d, 0x7a, 0xf8, 0xa9, 0x03, 0xab, 0x99,
+  0x75, 0x00, 0xc9, 0xb8, 0xb4, 0x81, 0xb6, 0x18, 0x16, 0x8a, 0x4a, 0x42, 0xc2, 0x4e, 0xf2, 0x9b,
+  0xa5, 0xac, 0x25, 0x92, 0xed, 0x20, 0xa1, 0x42, 0xb3, 0x10, 0x65, 0x7b, 0xe1, 0x76, 0x8f, 0xeb,
+  0xd0, 0x80, 0x2a, 0xd8, 0xf1, 0x34, 0x3e, 0x9e, 0xcf, 0x70, 0x54, 0xd1, 0xf0, 0x3d, 0xec, 0x98,
+  0xf0, 0x22, 0xc2, 0x57, 0x0c, 0xe3, 0x70, 0x16, 0xcf, 0xc8, 0x29, 0x12, 0xdf, 0xd7, 0x12, 0x5f,
+  0x70, 0xd3, 0xe3, 0x57, 0xe0, 0xcf, 0x38, 0x42, 0xf5, 0xcd, 0x42, 0xb2, 0x35, 0x2b, 0x5e, 0x70,
+  0x91, 0x8f, 0x3a, 0x17, 0x51, 0xfe, 0x02, 0x37, 0xe4, 0x74, 0x18, 0x2c, 0x85, 0x52, 0xc0, 0x00,
+  0x1d, 0x07, 0x81, 0x8d, 0xd3, 0x78, 0x24, 0x82, 0x87, 0x12, 0x15, 0xb8, 0x3f, 0x5d, 0x14, 0x23,
+  0xd1, 0xb7, 0x04, 0xda, 0x35, 0xbc, 0x22, 0xb0, 0x02, 0xaf, 0xa5, 0xdf, 0x1b, 0xa1, 0xd2, 0xea,
+  0x75, 0xeb, 0x9a, 0xa4, 0x06, 0xc6, 0x6d, 0x9a, 0x5d, 0x15, 0x27, 0xb8, 0x99, 0x53, 0xd4, 0x31,
+  0x84, 0x69, 0x1a, 0x5f, 0xc1, 0xfb, 0x80, 0x3f, 0x84, 0xd2, 0xd6, 0x13, 0xa5, 0x29, 0xdc, 0xb9,
+  0xf6, 0x2f, 0x61, 0x05, 0x5e, 0xc4, 0xf9, 0x65, 0x38, 0xdb, 0x04, 0xce, 0x33, 0x61, 0x9a, 0x47,
+  0xa0, 0xb4, 0xcb, 0x75, 0x68, 0xe4, 0x05, 0x78, 0x9e, 0x7c, 0x26, 0x1f, 0xd6, 0xe0, 0x1a, 0x59,
+  0x40, 0x08, 0x52, 0xcc, 0x10, 0xb7, 0x74, 0x93, 0xba, 0x5d, 0x83, 0x20, 0x08, 0xfc, 0x13, 0x09,
+  0xe6, 0x22, 0x21, 0xd5, 0x9f, 0x0f, 0xdd, 0xc4, 0x2d, 0x5d, 0x24, 0xcc, 0x9c, 0xe1, 0x9c, 0x06,
+  0x24, 0x89, 0x93, 0xbf, 0x6c, 0x56, 0x57, 0x45, 0x32, 0xbc, 0xbf, 0xfe, 0x92, 0xac, 0xaf, 0x43,
+  0x82, 0xa4, 0x78, 0xb8, 0xb5, 0x25, 0x01, 0xc8, 0x1f, 0xca, 0x06, 0x7c, 0xcb, 0xd1, 0x5b, 0xf0,
+  0x2f, 0xae, 0x45, 0x2d, 0xd9, 0x29, 0x6c, 0xe1, 0xc3, 0xd1, 0x08, 0x4e, 0x80, 0x28, 0x92, 0x77,
+  0xa7, 0x40, 0x87, 0xdf, 0xb2, 0x60, 0x55, 0x57, 0x9c, 0xd9, 0xaf, 0x1c, 0x03, 0x50, 0xe6, 0x2e,
+  0x6a, 0xae, 0x3f, 0xe7, 0x41, 0x63, 0x6d, 0xd8, 0x40, 0x52, 0xbf, 0x8e, 0x27, 0x93, 0x23, 0x38,
+  0x6e, 0x5e, 0xa5, 0xd1, 0x9f, 0xf3, 0x68, 0x9a, 0xa3, 0xaf, 0x52, 0x9e, 0xce, 0x23, 0x71, 0x5b,
+  0x4b, 0x08, 0x00, 0xb6, 0x33, 0x4c, 0xc3, 0x6b, 0x5a, 0x43, 0x39, 0x24, 0x36, 0xc2, 0xd9, 0x4a,
+  0x58, 0x1e, 0xdf, 0x60, 0x92, 0x64, 0x11, 0xd2, 0x96, 0x03, 0xe3, 0x7c, 0x46, 0x32, 0xc2, 0x41,
+  0x04, 0x1b, 0x8a, 0x2d, 0xc0, 0x91, 0x3c, 0x90, 0x9e, 0x4b, 0x22, 0xd5, 0xf6, 0x48, 0x5f, 0xe7,
+  0x0e, 0x9b, 0x0e, 0x78, 0x74, 0xca, 0x02, 0x3c, 0xd4, 0xd7, 0x24, 0xe9, 0x65, 0x08, 0x67, 0x5a,
+  0x67, 0x9a, 0x5c, 0x07, 0x4d, 0x57, 0xe3, 0x59, 0xfc, 0x99, 0x0f, 0x47, 0x9c, 0x11, 0xe0, 0x87,
+  0x26, 0xf4, 0x32, 0xcc, 0x95, 0x5d, 0x51, 0x5f, 0xde, 0x96, 0xb9, 0x96, 0x4d, 0xdb, 0xba, 0xc9,
+  0x3c, 0x2a, 0xab, 0x92, 0x8b, 0x63, 0x66, 0xae, 0x65, 0x07, 0x42, 0x2f, 0xfc, 0xb3, 0x45, 0xe1,
+  0x7d, 0x2b, 0xe7, 0x73, 0x1d, 0x03, 0x39, 0x21, 0xa5, 0xa7, 0xac, 0xea, 0xc1, 0x3d, 0x80, 0x5f,
+  0x51, 0xe7, 0xe9, 0x82, 0x04, 0x6f, 0xa1, 0x6d, 0x24, 0x32, 0xdc, 0x84, 0xe8, 0xfb, 0x41, 0x5b,
+  0x90, 0x76, 0x08, 0x19, 0xd0, 0x32, 0xd1, 0x5b, 0x5f, 0xa7, 0x0d, 0xb5, 0xf6, 0x64, 0xdd, 0xc9,
+  0x40, 0x11, 0x2d, 0x01, 0xe3, 0x9f, 0x50, 0xde, 0x89, 0xb2, 0x3c, 0xbe, 0x0c, 0x73, 0x1a, 0x60,
+  0x16, 0x30, 0xea, 0x5a, 0xd0, 0x74, 0x92, 0x45, 0xcd, 0x26, 0xf0, 0xc9, 0x59, 0x40, 0x1b, 0x75,
+  0x6b, 0x5b, 0x04, 0xee, 0xb3, 0x0d, 0xa7, 0xde, 0x17, 0xa7, 0xcc, 0x6d, 0xd4, 0x04, 0x4f, 0xbb,
+  0x67, 0x2d, 0x61, 0xfd, 0xd4, 0x3b, 0x3b, 0x6b, 0x39, 0x21, 0x9c, 0xe3, 0xed, 0x07, 0x64, 0xde,
+  0x17, 0xc9, 0xe7, 0x3e, 0x90, 0x6f, 0x9e, 0xcc, 0x0e, 0xc8, 0xaa, 0x4c, 0xfd, 0xe5, 0xb7, 0x96,
+  0xd4, 0x0a, 0x1f, 0xb1, 0x21, 0x91, 0x1e, 0x69, 0xbf, 0x88, 0x5b, 0x37, 0x68, 0x44, 0x4d, 0x9f,
+  0x24, 0x95, 0xea, 0x61, 0xdb, 0xb4, 0x77, 0x03, 0xbb, 0xb9, 0x7f, 0xf9, 0x1a, 0xbc, 0x7d, 0x61,
+  0x2b, 0x49, 0x5f, 0xd1, 0xde, 0xad, 0xc4, 0xdd, 0x0c, 0x98, 0x62, 0xcc, 0x3c, 0x6a, 0x21, 0x06,
+  0xcb, 0xb6, 0x1d, 0x0a, 0x1e, 0x18, 0xe2, 0x3d, 0xe5, 0x14, 0x16, 0x14, 0x50, 0xe9, 0x7e, 0x06,
+  0x8b, 0xbc, 0x14, 0x4e, 0xb5, 0xde, 0xda, 0xef, 0x75, 0x18, 0x43, 0xea, 0xbe, 0x0e, 0xa7, 0x39,
+  0xe9, 0x8b, 0x9e, 0xbb, 0x5f, 0x2f, 0x96, 0x46, 0xec, 0x03, 0x8b, 0x8e, 0xdf, 0xa3, 0x26, 0x80,
+  0xf0, 0x08, 0x1b, 0x21, 0xc2, 0x2b, 0x7e, 0x32, 0x45, 0xbf, 0x85, 0x14, 0xf7, 0x37, 0xa1, 0xdb,
+  0xf6, 0x4c, 0xc0, 0x81, 0x64, 0xc8, 0x96, 0x1c, 0x72, 0x1d, 0xc8, 0xd0, 0x7d, 0xd1, 0xa0, 0x45,
+  0x02, 0xf6, 0x17, 0x0f, 0x79, 0xf4, 0xf1, 0x10, 0x63, 0x31, 0xe0, 0x58, 0x7a, 0x0b, 0xb8, 0xad,
+  0xb0, 0x0d, 0x10, 0x8e, 0x68, 0x0b, 0xb6, 0xdc, 0x8b, 0xcd, 0x04, 0x96, 0x75, 0x32, 0xb8, 0x4b,
+  0x45, 0xc8, 0x35, 0x74, 0x99, 0xa1, 0x69, 0x4e, 0xce, 0x2d, 0x0f, 0x24, 0xd3, 0x4b, 0x1e, 0x31,
+  0x9e, 0xc9, 0x74, 0x58, 0xa1, 0x74, 0x08, 0x34, 0xe0, 0x3a, 0x9f, 0xd0, 0x19, 0x63, 0x4b, 0x44,
+  0x9d, 0x21, 0xf0, 0x28, 0xdb, 0x86, 0xed, 0x12, 0x5a, 0x15, 0xff, 0xc1, 0xa9, 0x33, 0xff, 0xc1,
+  0x63, 0xbe, 0xe1, 0x93, 0x3e, 0x0d, 0xfc, 0x29, 0x7c, 0xe1, 0x7d, 0xe4, 0x06, 0xf0, 0x75, 0xce,
+  0x62, 0x4d, 0x5f, 0x32, 0xe5, 0x52, 0x16, 0xbc, 0x6d, 0xba, 0x24, 0x5d, 0xda, 0x22, 0xd5, 0xf7,
+  0xd3, 0x01, 0xec, 0x1d, 0x00, 0x83, 0x2e, 0x0f, 0xe9, 0x3b, 0x00, 0xc6, 0xf1, 0xec, 0xf9, 0x98,
+  0x6b, 0x09, 0xbb, 0x3c, 0x4b, 0x36, 0x97, 0x47, 0x01, 0x5f, 0x94, 0x0c, 0x9a, 0x71, 0xcf, 0xfa,
+  0x81, 0x5b, 0xda, 0x4f, 0x53, 0xd7, 0xa0, 0x9c, 0xaf, 0x8a, 0x50, 0x66, 0xb7, 0xa8, 0x53, 0x12,
+  0x48, 0x5f, 0x1c, 0xe7, 0xa8, 0xe4, 0x61, 0x78, 0xfe, 0x23, 0xfa, 0xd6, 0x13, 0xb2, 0x60, 0x05,
+  0x5a, 0xc0, 0xf6, 0xda, 0x5a, 0xfa, 0x3f, 0xbd, 0xd7, 0xee, 0xe1, 0xbb, 0x57, 0xfb, 0xaf, 0x7f,
+  0x39, 0xda, 0x39, 0xd9, 0x3f, 0x7c, 0x27, 0x7e, 0x10, 0xc7, 0x27, 0x3b, 0x27, 0x7b, 0x5f, 0x09,
+  0xd6, 0xb8, 0x2d, 0xee, 0x1d, 0xbf, 0xff, 0xb8, 0xff, 0x1e, 0x08, 0x5c, 0xc6, 0x80, 0x4c, 0x12,
+  0x40, 0x20, 0xb2, 0x92, 0x31, 0x60, 0x0a, 0x63, 0xab, 0x80, 0xc1, 0x78, 0x1f, 0x01, 0xee, 0x94,
+  0x96, 0xef, 0x71, 0xa7, 0xd7, 0x30, 0xef, 0x9b, 0x64, 0xef, 0xda, 0xc5, 0x2d, 0x04, 0xac, 0x2a,
+  0xb3, 0xae, 0xc8, 0xbb, 0x3b, 0xef, 0x7e, 0xdd, 0x39, 0xfe, 0xf8, 0x01, 0x5e, 0xfc, 0xe4, 0xb1,
+  0xe6, 0xac, 0x63, 0x3c, 0x7d, 0x03, 0x4f, 0x1f, 0x3f, 0xad, 0x3c, 0x3d, 0xd8, 0x79, 0xb7, 0xf7,
+  0xf1, 0xc3, 0xfe, 0xcb, 0x13, 0x7c, 0x5e, 0x00, 0x5a, 0x15, 0xeb, 0x55, 0x30, 0x47, 0x1f, 0x8f,
+  0xf7, 0xff, 0xb9, 0x87, 0x2f, 0xe9, 0x9a, 0x83, 0x43, 0x0b, 0x4b, 0x64, 0x20, 0x42, 0x09, 0x45,
+  0xd5, 0x0b, 0xb5, 0x22, 0x5f, 0xf5, 0xd0, 0x10, 0x1b, 0x5a, 0x74, 0xc9, 0x6d, 0x48, 0x0d, 0x16,
+  0x6d, 0x06, 0x11, 0x60, 0xd4, 0x16, 0x87, 0xf0, 0x58, 0x3c, 0x09, 0xc1, 0xc5, 0x19, 0x62, 0xe6,
+  0x68, 0x3e, 0x9d, 0xa2, 0xfd, 0x65, 0x8b, 0x4f, 0x73, 0xf3, 0x8d, 0x64, 0x37, 0x83, 0x47, 0x5d,
+  0xf3, 0x67, 0xd6, 0x5c, 0x2a, 0xbd, 0xa3, 0xa7, 0xeb, 0x38, 0xb9, 0x2e, 0xec, 0x0a, 0xce, 0x16,
+  0xb4, 0xd3, 0x0f, 0xa7, 0x2f, 0x29, 0x30, 0xae, 0x68, 0x82, 0x93, 0xfa, 0x45, 0xc6, 0x91, 0x51,
+  0x10, 0xda, 0xa3, 0x4c, 0xac, 0xa2, 0x75, 0x15, 0xde, 0x0a, 0xc7, 0x00, 0x5c, 0x63, 0x13, 0xd6,
+  0x98, 0x9c, 0xb3, 0x1e, 0x91, 0xf1, 0x65, 0x00, 0x4e, 0x93, 0x98, 0x82, 0x36, 0x74, 0x90, 0xaf,
+  0x22, 0xdc, 0x8d, 0x24, 0xa4, 0x0c, 0xd2, 0x64, 0x96, 0xb1, 0xe2, 0x61, 0x15, 0x9a, 0xda, 0x70,
+  0x47, 0x80, 0x5a, 0x60, 0xfb, 0xc0, 0xf9, 0x2e, 0x6d, 0xec, 0x2b, 0x55, 0xa1, 0x01, 0x99, 0xd0,
+  0x50, 0xea, 0x31, 0xf0, 0x98, 0x6e, 0xd3, 0x9d, 0x86, 0x17, 0x52, 0x83, 0x5e, 0xa8, 0x15, 0x4d,
+  0x35, 0x09, 0x29, 0x06, 0x01, 0xea, 0x5b, 0xa5, 0xad, 0x29, 0x61, 0xef, 0x4c, 0xb2, 0x04, 0x95,
+  0x45, 0x04, 0x39, 0x81, 0x7f, 0xe4, 0x74, 0xd1, 0x8b, 0x2f, 0x42, 0x35, 0x0a, 0x5d, 0xb4, 0x5a,
+  0xa8, 0x0a, 0x95, 0xca, 0x48, 0x6b, 0x85, 0x51, 0x93, 0x27, 0x71, 0x81, 0xb2, 0xbd, 0x49, 0x7b,
+  0xac, 0xa4, 0x76, 0x90, 0xe0, 0x3c, 0x93, 0xea, 0xec, 0xea, 0xc2, 0x31, 0x41, 0x93, 0xe1, 0x7e,
+  0x6f, 0x12, 0x61, 0x5c, 0x16, 0xb4, 0x29, 0x42, 0xb4, 0xe0, 0xb6, 0x02, 0xb0, 0xe4, 0x83, 0xe0,
+  0x11, 0x35, 0x7b, 0xa4, 0xf1, 0x2a, 0xbd, 0x5f, 0x07, 0xdd, 0xe6, 0x50, 0x79, 0x5f, 0x8c, 0xcd,
+  0xd9, 0x0a, 0x5b, 0x64, 0xfb, 0xd3, 0x49, 0x3c, 0x75, 0x4f, 0xa2, 0x30, 0xa1, 0x80, 0x70, 0xd0,
+  0x12, 0xb0, 0x05, 0xd6, 0xda, 0x8f, 0xd1, 0x41, 0x6e, 0x56, 0x4a, 0x0f, 0xb4, 0x0d, 0xde, 0xef,
+  0x1c, 0x9d, 0xfc, 0x26, 0xde, 0x1e, 0xbe, 0xdc, 0x6b, 0x5a, 0x93, 0x79, 0xbb, 0xf3, 0x8f, 0x8f,
+  0xef, 0x0f, 0x76, 0x7e, 0xdb, 0x3b, 0x3a, 0xc6, 0x7d, 0x6e, 0xcf, 0x95, 0x1f, 0x7d, 0xdc, 0x3d,
+  0x3c, 0x38, 0xa4, 0x06, 0xa7, 0x0d, 0x19, 0xf8, 0x04, 0x8c, 0xba, 0xf1, 0xdd, 0x68, 0x34, 0x18,
+  0x74, 0xbb, 0xf4, 0xf1, 0xc9, 0x93, 0xd1, 0xe8, 0xc9, 0x13, 0xfa, 0x38, 0x18, 0xe0, 0x97, 0xc6,
+  0x99, 0x49, 0xf0, 0x6c, 0xa9, 0xf8, 0xad, 0x64, 0x16, 0x6f, 0x50, 0xfb, 0xd2, 0xed, 0xba, 0x5a,
+  0xed, 0x82, 0x04, 0x86, 0xa8, 0xed, 0x39, 0x78, 0x59, 0x3a, 0x9f, 0x80, 0xa4, 0x89, 0x64, 0x01,
+  0xf3, 0xc4, 0x5f, 0x8e, 0xe3, 0x4b, 0x11, 0xe6, 0x70, 0xc9, 0x1e, 0x81, 0x5c, 0x39, 0x24, 0xaf,
+  0x80, 0x8f, 0x27, 0xfb, 0xbb, 0x3f, 0x7f, 0x7c, 0xf3, 0xcf, 0x96, 0x80, 0x7d, 0x18, 0x5d, 0x91,
+  0xc0, 0x94, 0xe5, 0xc6, 0xcd, 0x1a, 0x49, 0x07, 0x6e, 0x06, 0xb0, 0xc1, 0xf1, 0x3e, 0x37, 0x45,
+  0xdc, 0xb1, 0x0c, 0x3b, 0x42, 0xe9, 0xcf, 0x18, 0x13, 0x79, 0x8c, 0xba, 0x58, 0x12, 0x3e, 0xd8,
+  0x47, 0x99, 0x16, 0xe9, 0xf6, 0xf4, 0x8c, 0x88, 0x16, 0xc4, 0xa8, 0x76, 0x1e, 0x0f, 0xfe, 0x60,
+  0x61, 0x17, 0x43, 0x66, 0xa7, 0x17, 0x51, 0xc6, 0xdb, 0x2b, 0xce, 0xa8, 0x0b, 0x33, 0xab, 0x34,
+  0xc2, 0xb9, 0xb2, 0xc9, 0xd5, 0x80, 0x3a, 0x81, 0xa1, 0xda, 0x50, 0xe9, 0xc6, 0x03, 0xc4, 0x05,
+  0x2b, 0x02, 0x90, 0xb4, 0xf7, 0x22, 0x24, 0xda, 0x0b, 0x8c, 0xb8, 0x0a, 0xa0, 0x23, 0x90, 0x5b,
+  0xa2, 0xf4, 0x24, 0xd6, 0x66, 0xa0, 0xa3, 0xe1, 0xe5, 0xe1, 0x5b, 0x21, 0x69, 0x2d, 0x73, 0x51,
+  0xf9, 0xae, 0xba, 0x91, 0x17, 0x44, 0x0e, 0x77, 0x45, 0xd9, 0xe1, 0xc5, 0xcd, 0xfe, 0x50, 0x52,
+  0x39, 0x37, 0xd3, 0x69, 0x5d, 0x87, 0x41, 0x57, 0x71, 0xad, 0x9d, 0x7e, 0x1f, 0x7f, 0xb4, 0x36,
+  0x7c, 0xa4, 0x5f, 0x8f, 0xb9, 0x5f, 0xe9, 0x50, 0x51, 0xf7, 0xea, 0xb2, 0x55, 0xf5, 0xcd, 0xf4,
+  0x8c, 0x5e, 0x5c, 0xb6, 0x5a, 0xfc, 0x5e, 0x65, 0x21, 0x7a, 0x4f, 0x61, 0x13, 0x35, 0xaf, 0x36,
+  0xcd, 0xd0, 0xd5, 0xd7, 0x9b, 0x76, 0xdf, 0x65, 0x20, 0xf9, 0x26, 0x52, 0x3c, 0xa7, 0xc9, 0x98,
+  0xad, 0x1d, 0x13, 0x72, 0x77, 0x7e, 0x91, 0x4f, 0x97, 0x9a, 0xcd, 0x79, 0x3e, 0xad, 0x02, 0x21,
+  0xcb, 0xc9, 0x02, 0x08, 0x85, 0x75, 0xc5, 0x85, 0x54, 0xf2, 0x5a, 0x38, 0x41, 0x87, 0x87, 0xda,
+  0x41, 0x68, 0x8e, 0x11, 0x8e, 0x99, 0x30, 0x10, 0x54, 0x0c, 0x2f, 0x01, 0x03, 0x9a, 0x39, 0x41,
+  0xa4, 0xf9, 0x22, 0x4c, 0x28, 0x1f, 0x09, 0x47, 0x77, 0x94, 0x06, 0x5e, 0xb2, 0x1f, 0x41, 0x2d,
+  0x08, 0xdd, 0xdb, 0xc6, 0x81, 0x4d, 0x38, 0xcc, 0x97, 0x80, 0xa2, 0x7b, 0x54, 0x55, 0x81, 0xe0,
+  0x5d, 0x6d, 0x09, 0x20, 0xba, 0xe7, 0x4e, 0x15, 0x48, 0x3c, 0x23, 0x1e, 0x52, 0x07, 0x80, 0xfd,
+  0x02, 0x1c, 0xb8, 0x88, 0xa6, 0xd9, 0xc2, 0xce, 0x9a, 0xe1, 0xcb, 0x0d, 0xe1, 0xd7, 0x70, 0xb2,
+  0xa8, 0x3f, 0x5a, 0xbd, 0x1c, 0x9d, 0xd1, 0x56, 0xb5, 0xf8, 0xfd, 0xd8, 0xaa, 0xda, 0x99, 0xad,
+  0xd8, 0x0b, 0xe8, 0xa0, 0x34, 0x75, 0x3b, 0xf0, 0x46, 0xf2, 0xdf, 0x02, 0x00, 0xa5, 0x79, 0xdb,
+  0x41, 0x02, 0x28, 0x48, 0x2d, 0xda, 0x50, 0xca, 0xae, 0x5c, 0xed, 0x0e, 0x52, 0xdb, 0x82, 0xce,
+  0xd2, 0x7e, 0x5c, 0xed, 0x4a, 0xe2, 0xd3, 0x82, 0xce, 0x85, 0xb9, 0xb8, 0xda, 0x5d, 0x4a, 0x59,
+  0x0b, 0x00, 0x68, 0x86, 0x61, 0xc7, 0xe0, 0xc9, 0x5e, 0xbb, 0x68, 0xfc, 0x85, 0xf1, 0xd7, 0x41,
+  0xfa, 0x2c, 0xf1, 0x2c, 0x5c, 0x7d, 0xd9, 0xce, 0x01, 0x00, 0x45, 0xa3, 0xfd, 0xd9, 0x12, 0x10,
+  0x94, 0x2f, 0x86, 0xc1, 0xd3, 0xe0, 0xd0, 0x94, 0x6e, 0x4a, 0xf1, 0xbf, 0x22, 0xc1, 0xa7, 0x70,
+  0xe9, 0x06, 0xcc, 0x5b, 0xaa, 0x43, 0x46, 0x53, 0x80, 0xcd, 0xd7, 0xba, 0x72, 0x04, 0xc5, 0xbe,
+  0xe9, 0x24, 0xd3, 0x58, 0xbe, 0x3f, 0x70, 0xa8, 0x3c, 0xe4, 0xee, 0xe8, 0xc4, 0xd3, 0x29, 0x1c,
+  0xde, 0xcc, 0xf4, 0xca, 0xbe, 0x0c, 0x7d, 0x45, 0x34, 0xfe, 0xcf, 0xff, 0x6e, 0x6c, 0xda, 0xfd,
+  0x86, 0xbb, 0xec, 0x14, 0x04, 0x7f, 0x46, 0xf1, 0x85, 0x61, 0x89, 0x29, 0x3f, 0xea, 0x48, 0x84,
+  0xa1, 0xb0, 0x90, 0xe2, 0x19, 0x0b, 0x1a, 0x35, 0xc2, 0x3f, 0x40, 0x84, 0x89, 0x46, 0x23, 0x74,
+  0xd2, 0x41, 0x89, 0x83, 0x72, 0x68, 0x84, 0x69, 0x56, 0x0a, 0xfe, 0x64, 0xb2, 0x23, 0x41, 0x29,
+  0x31, 0x6d, 0xd8, 0xa6, 0x40, 0x37, 0xc3, 0x04, 0x22, 0xfb, 0x20, 0x1d, 0x1b, 0x23, 0xa0, 0x09,
+  0xd9, 0xee, 0xef, 0xdc, 0xa0, 0x30, 0xf0, 0xf0, 0x77, 0x1c, 0x1e, 0x7f, 0xa2, 0xb4, 0x11, 0xff,
+  0x90, 0x42, 0x8d, 0x39, 0x4b, 0x63, 0xad, 0x50, 0xaf, 0x2d, 0x8e, 0x4d, 0x5b, 0xa2, 0xdc, 0xc7,
+  0x97, 0x17, 0xd2, 0xd4, 0xc0, 0xda, 0x7c, 0x0d, 0x08, 0x3c, 0x02, 0x69, 0x3e, 0xc9, 0xb2, 0xc3,
+  0x34, 0xbe, 0x88, 0x91, 0x56, 0x1b, 0x3b, 0xd3, 0x64, 0x7a, 0x73, 0x99, 0xcc, 0x33, 0xeb, 0x7e,
+  0xfd, 0x75, 0x8a, 0x84, 0xfd, 0x77, 0xfb, 0x27, 0xfb, 0x3b, 0x07, 0xfb, 0xff, 0x24, 0x4d, 0xc2,
+  0xb7, 0x6a, 0x10, 0x2c, 0x4b, 0x0f, 0xa6, 0x57, 0xa9, 0x18, 0xd5, 0xdc, 0x5a, 0xb2, 0xf2, 0x58,
+  0x35, 0x68, 0xad, 0xa1, 0xfc, 0x12, 0x8b, 0x4b, 0x5b, 0xa7, 0xd3, 0x69, 0x6c, 0x3a, 0x95, 0x6c,
+  0x0f, 0x59, 0xbb, 0x64, 0xda, 0xf8, 0x7d, 0x9a, 0x28, 0x75, 0xbd, 0xff, 0x0a, 0xd3, 0xe6, 0x7d,
+  0x9b, 0x38, 0xf5, 0x8b, 0xcf, 0xad, 0xf3, 0x6d, 0x4e, 0x35, 0x97, 0x0f, 0x85, 0x28, 0xb6, 0x98,
+  0x38, 0x44, 0xf3, 0xd2, 0xcd, 0x43, 0x07, 0xd6, 0x7c, 0x48, 0x87, 0x2d, 0x3b, 0xc5, 0x1d, 0x26,
+  0xfd, 0xf5, 0x60, 0x9f, 0xcd, 0x0b, 0x67, 0xaa, 0x8e, 0x1b, 0x0e, 0x9d, 0x43, 0x9d, 0xc2, 0x9d,
+  0xb3, 0x72, 0x61, 0xad, 0x34, 0x35, 0x5e, 0x58, 0xfa, 0x79, 0x36, 0x36, 0xab, 0x13, 0x23, 0xcb,
+  0x58, 0x96, 0xef, 0x4c, 0x51, 0x87, 0x0f, 0x28, 0x7e, 0x85, 0x57, 0xa6, 0x80, 0x0e, 0xa6, 0x83,
+  0x24, 0x99, 0x39, 0xb0, 0xe3, 0xee, 0x91, 0xd2, 0x15, 0x44, 0x76, 0x79, 0xb0, 0xbc, 0x53, 0x00,
+  0x6c, 0x86, 0x77, 0x89, 0xa4, 0x98, 0x80, 0x5c, 0xdb, 0x92, 0xd1, 0x08, 0x6f, 0xc2, 0xcd, 0xbe,
+  0x96, 0xa4, 0x67, 0x10, 0x4e, 0x61, 0x76, 0xf1, 0x64, 0xc2, 0xc7, 0x2a, 0xea, 0x06, 0x62, 0xb8,
+  0x17, 0x25, 0xd7, 0x55, 0x57, 0x1a, 0xdc, 0xf6, 0x09, 0xac, 0x12, 0x29, 0x1a, 0x83, 0xa8, 0xb9,
+  0xf9, 0x6f, 0x5d, 0xcb, 0xf9, 0x64, 0x28, 0x0a, 0xe7, 0x83, 0x9d, 0x7d, 0x69, 0x12, 0x11, 0xbf,
+  0x64, 0xb8, 0xaf, 0x40, 0xd6, 0xe6, 0x94, 0x48, 0x3c, 0x6a, 0xf8, 0xc9, 0xb5, 0xc0, 0xb6, 0x8e,
+  0xc8, 0x54, 0x14, 0x18, 0xad, 0x2a, 0x6b, 0x5b, 0xba, 0x9c, 0x11, 0x9e, 0x1a, 0x35, 0xfd, 0x34,
+  0xf2, 0x71, 0xbf, 0xe1, 0xff, 0x8f, 0x84, 0xe6, 0x51, 0x10, 0x3f, 0xb8, 0x17, 0x25, 0xf0, 0xc9,
+  0xd1, 0xe1, 0xc1, 0xf1, 0x3d, 0x73, 0x6d, 0xd3, 0x91, 0xd2, 0xda, 0x0f, 0xba, 0x4e, 0xea, 0x61,
+  0xf1, 0xa5, 0x6a, 0x71, 0x2d, 0x1e, 0xdd, 0xcd, 0xbb, 0x47, 0x5d, 0x90, 0x50, 0xed, 0x57, 0x70,
+  0xe7, 0x69, 0x78, 0x15, 0x5f, 0x84, 0x79, 0x92, 0x32, 0x27, 0x65, 0x2a, 0xa4, 0x3b, 0xe7, 0x2f,
+  0x59, 0x94, 0xbe, 0xc5, 0xdf, 0x82, 0x2f, 0x7c, 0xaf, 0xef, 0x93, 0x45, 0x9d, 0x5c, 0x4a, 0x9f,
+  0x3c, 0xee, 0xb6, 0x8a, 0x68, 0xf0, 0xc7, 0x4f, 0xbb, 0xb0, 0xc9, 0x6f, 0x3d, 0x06, 0x07, 0x43,
+  0xd3, 0x95, 0xa5, 0x83, 0xc3, 0xf3, 0xdf, 0x91, 0xfd, 0x6d, 0xc9, 0x81, 0x6c, 0xd6, 0xd8, 0x32,
+  0xf0, 0xd4, 0x7e, 0x0f, 0xb2, 0x47, 0x9c, 0xe1, 0xb2, 0xc3, 0xae, 0xbe, 0x22, 0xf3, 0xab, 0x01,
+  0x31, 0x99, 0xb2, 0xf1, 0x02, 0xf3, 0x93, 0xa1, 0xd5, 0x08, 0x00, 0xcb, 0xa6, 0x9e, 0xf1, 0x64,
+  0x79, 0x32, 0x3b, 0xa6, 0x57, 0xfb, 0x4c, 0x24, 0x64, 0xce, 0x97, 0x02, 0x96, 0xaf, 0x4d, 0x71,
+  0xbf, 0x30, 0xb7, 0x00, 0x6a, 0x75, 0x7d, 0x3b, 0xd1, 0xec, 0x46, 0x4e, 0xaf, 0x9d, 0xd2, 0xe7,
+  0x15, 0x7b, 0x7f, 0x37, 0x1a, 0xfd, 0xf4, 0x53, 0xb7, 0xeb, 0xe9, 0xab, 0xc4, 0xce, 0x85, 0x1b,
+  0x79, 0x91, 0x5d, 0xa6, 0xca, 0x25, 0x1b, 0x92, 0xec, 0xe8, 0x5b, 0xbf, 0xd1, 0xc2, 0x0f, 0x9e,
+  0x89, 0x87, 0x13, 0xf4, 0xda, 0x6d, 0xc8, 0xd3, 0x0b, 0xc3, 0x3e, 0xb3, 0x4c, 0x0c, 0xa3, 0x69,
+  0x1c, 0x0d, 0x3b, 0x0d, 0x4f, 0x9f, 0x1a, 0x5d, 0xab, 0xcf, 0xb2, 0xe4, 0x31, 0x40, 0x23, 0xf5,
+  0xbb, 0x09, 0xca, 0x37, 0x51, 0x77, 0x6b, 0xa4, 0x6f, 0xe2, 0x9d, 0x59, 0xd0, 0x2c, 0x84, 0x4f,
+  0x3e, 0x5a, 0x80, 0xc0, 0xe8, 0x43, 0x07, 0x09, 0x25, 0x68, 0xde, 0x95, 0xaa, 0x4d, 0xfd, 0xa1,
+  0x7b, 0x7a, 0x0b, 0x08, 0x88, 0x71, 0xe5, 0xa0, 0x82, 0x05, 0xd4, 0x23, 0x55, 0xb6, 0x0e, 0x01,
+  0xae, 0x4a, 0x39, 0x8e, 0x65, 0x70, 0xf2, 0x4f, 0x8b, 0x71, 0x29, 0xa7, 0x6d, 0xdb, 0x97, 0xcb,
+  0x36, 0x96, 0x3c, 0x34, 0x7f, 0xd9, 0x74, 0xb4, 0xb6, 0xa7, 0x6e, 0xc1, 0x78, 0x2e, 0x1a, 0x55,
+  0xdf, 0xef, 0x77, 0x0d, 0x34, 0x83, 0xb9, 0x7c, 0xc2, 0x1b, 0xbe, 0x57, 0x38, 0x30, 0x55, 0x7d,
+  0x13, 0xa0, 0x6e, 0x34, 0xc2, 0x80, 0x87, 0x3e, 0x6d, 0x42, 0xf4, 0x3d, 0x5f, 0x00, 0x90, 0x63,
+  0xa7, 0x3d, 0xb0, 0x0a, 0x40, 0xa3, 0x3b, 0xdd, 0xdc, 0xbc, 0x58, 0x2f, 0xbd, 0xd6, 0xed, 0x1b,
+  0xa4, 0x69, 0x80, 0x7a, 0xa8, 0x7f, 0xb7, 0xde, 0xac, 0xeb, 0x3c, 0xe5, 0x1c, 0x86, 0x85, 0x6e,
+  0xc9, 0x80, 0x03, 0x73, 0xc0, 0xc8, 0x5b, 0x9a, 0x03, 0x46, 0xd2, 0x34, 0xdc, 0x90, 0xec, 0xf5,
+  0xb3, 0x61, 0xbc, 0xc1, 0x84, 0x2c, 0xea, 0x07, 0x02, 0x66, 0x38, 0xdc, 0x37, 0x96, 0x99, 0x78,
+  0xe9, 0xb7, 0x5e, 0xb9, 0xe7, 0x98, 0x32, 0xd3, 0x43, 0xe3, 0x87, 0xcd, 0x07, 0x0b, 0x25, 0x27,
+  0x13, 0xc0, 0xf3, 0xaa, 0x24, 0x85, 0x03, 0xae, 0x38, 0xf4, 0x2f, 0x35, 0x68, 0xf2, 0xdf, 0xb7,
+  0xc6, 0x5b, 0x9a, 0xeb, 0x1e, 0xca, 0x8f, 0x9b, 0xf6, 0x73, 0x7b, 0x84, 0xaa, 0x0b, 0x8c, 0xcd,
+  0x0a, 0x05, 0xe0, 0x5d, 0x50, 0x89, 0x0f, 0x68, 0x54, 0x40, 0x92, 0xc0, 0x54, 0xe1, 0x49, 0xb7,
+  0x0b, 0x84, 0x13, 0x23, 0x5e, 0xc0, 0xe5, 0xb4, 0xa9, 0x5b, 0x09, 0x7f, 0xf8, 0x41, 0x3c, 0x2c,
+  0xfd, 0x25, 0xf6, 0x0a, 0xe7, 0x83, 0xa6, 0xd3, 0x47, 0xd8, 0xb4, 0x2f, 0xea, 0x80, 0x1c, 0x1e,
+  0xb2, 0x36, 0x42, 0xf4, 0xce, 0xcf, 0x0d, 0x2b, 0xb0, 0x38, 0x9c, 0x4e, 0x6e, 0x08, 0x29, 0x76,
+  0x70, 0x43, 0x63, 0xf9, 0x69, 0x5b, 0xd1, 0x0c, 0xae, 0x89, 0xdb, 0x66, 0xcc, 0xbb, 0x4d, 0xbe,
+  0x6a, 0x04, 0xb5, 0x01, 0xba, 0xda, 0x47, 0x36, 0x1a, 0x6c, 0x30, 0x48, 0x1f, 0x76, 0xdc, 0x85,
+  0xa4, 0x90, 0x6a, 0x38, 0xc6, 0x72, 0x04, 0x5c, 0x86, 0x5e, 0x38, 0xb0, 0xc0, 0x6a, 0xbb, 0xc8,
+  0x29, 0x59, 0x60, 0x86, 0x26, 0x44, 0xc5, 0x31, 0x08, 0x05, 0x00, 0xaf, 0x6c, 0xeb, 0x12, 0xee,
+  0xf9, 0x91, 0xf3, 0xc8, 0xf4, 0x9e, 0xff, 0x74, 0xf1, 0xd0, 0xc6, 0x57, 0xef, 0xce, 0x2b, 0x95,
+  0x90, 0xe6, 0xb6, 0x52, 0xef, 0x7d, 0x8e, 0xf7, 0x3d, 0x19, 0x56, 0xc2, 0xf8, 0xd2, 0xa2, 0x4c,
+  0x96, 0xe3, 0x4e, 0x1c, 0x52, 0x62, 0xe3, 0x48, 0x37, 0x48, 0x3f, 0x2c, 0xbf, 0x55, 0xc5, 0xf8,
+  0xf2, 0x99, 0x1b, 0x97, 0x52, 0x63, 0x89, 0x51, 0xf8, 0x1d, 0x8a, 0x05, 0x3c, 0x88, 0xb3, 0xbc,
+  0x93, 0x46, 0x97, 0xc9, 0x55, 0x14, 0x3c, 0x2a, 0xb3, 0x3a, 0x3e, 0x72, 0xa0, 0x57, 0x99, 0x73,
+  0xac, 0xeb, 0x62, 0x19, 0xfb, 0xd2, 0xa8, 0xe9, 0xb3, 0xbc, 0x74, 0xe1, 0x5d, 0x28, 0xdf, 0xe8,
+  0xc3, 0xe1, 0xf0, 0x9b, 0x86, 0x4e, 0xf9, 0x2a, 0xbf, 0x62, 0xec, 0x98, 0x09, 0xb2, 0xf1, 0xef,
+  0xbc, 0x2f, 0xbe, 0xda, 0xd9, 0xdd, 0x23, 0xd3, 0xfb, 0x81, 0xf8, 0x70, 0x78, 0xf4, 0xf3, 0xde,
+  0xd1, 0xb7, 0x5e, 0x1c, 0x95, 0x9b, 0x79, 0x19, 0x68, 0x43, 0x11, 0x35, 0xf1, 0x54, 0x84, 0xe2,
+  0x03, 0xc5, 0xc2, 0x88, 0x00, 0x15, 0x24, 0x66, 0x7c, 0x8c, 0x60, 0x2f, 0xa8, 0xa6, 0xc8, 0x12,
+  0x1d, 0x12, 0xf9, 0xff, 0x45, 0x18, 0xff, 0x32, 0x25, 0x43, 0x39, 0x06, 0x16, 0x66, 0x62, 0x3e,
+  0x63, 0x9f, 0x5b, 0xba, 0x51, 0x03, 0x0f, 0x4b, 0x66, 0x1d, 0xf1, 0x8a, 0x4d, 0xe6, 0xa4, 0x17,
+  0x05, 0x46, 0x59, 0xd1, 0xb2, 0xb2, 0x4b, 0x3b, 0x3a, 0xb1, 0x6b, 0xce, 0xee, 0x69, 0x48, 0x7e,
+  0x1b, 0xf9, 0x38, 0x9c, 0x72, 0xd6, 0xe5, 0x61, 0x47, 0x7c, 0x88, 0xf3, 0x31, 0xe6, 0x35, 0x94,
+  0x63, 0x4d, 0x52, 0x1d, 0x94, 0xe5, 0xf6, 0xdd, 0xc2, 0xfd, 0x40, 0x8e, 0xee, 0xdc, 0x78, 0xa0,
+  0x45, 0x74, 0x50, 0xe4, 0x10, 0xce, 0x9f, 0x3c, 0x1f, 0xd0, 0x51, 0x58, 0x07, 0xf4, 0x9c, 0x7b,
+  0x6c, 0x75, 0x45, 0xcc, 0x1e, 0x24, 0xbf, 0x1c, 0x1d, 0x00, 0x5e, 0x0a, 0x5f, 0x91, 0x26, 0xbb,
+  0x09, 0xcf, 0x50, 0x3f, 0xcc, 0xf8, 0xcb, 0x51, 0x73, 0x14, 0x4d, 0x46, 0x1d, 0x4b, 0x51, 0x7c,
+  0x72, 0xb4, 0xb3, 0x0b, 0xcb, 0xf6, 0xf1, 0x60, 0xff, 0x05, 0xb9, 0x40, 0x18, 0xb4, 0x72, 0x5a,
+  0x4d, 0xeb, 0x5c, 0x75, 0x98, 0xbc, 0x97, 0xfc, 0xcc, 0x96, 0x17, 0xeb, 0xe9, 0x32, 0x29, 0x98,
+  0xbf, 0x61, 0x28, 0xf7, 0x95, 0x37, 0xf9, 0xac, 0x18, 0xc2, 0x99, 0x6d, 0x8a, 0xd9, 0xfb, 0x6d,
+  0xef, 0x23, 0x6d, 0x8c, 0x05, 0xa8, 0x35, 0x52, 0x14, 0xdf, 0xc3, 0x94, 0x16, 0xe7, 0x41, 0x76,
+  0x0e, 0xba, 0x70, 0xdb, 0x2a, 0xcf, 0x26, 0x24, 0xb4, 0x2f, 0x92, 0x36, 0x0b, 0x3f, 0x51, 0xe0,
+  0x7d, 0x14, 0x50, 0x86, 0x7a, 0x48, 0xe9, 0x06, 0x95, 0xc9, 0x88, 0x33, 0x97, 0x25, 0x30, 0x4a,
+  0xdf, 0x47, 0xe4, 0x6f, 0x2c, 0xad, 0x11, 0x6f, 0x43, 0xb8, 0x5c, 0x12, 0x64, 0xa9, 0xe6, 0x12,
+  0xf1, 0x50, 0xb4, 0xb7, 0xe1, 0x3d, 0x52, 0x7d, 0xd1, 0x82, 0x0f, 0x74, 0xa7, 0xbc, 0x75, 0x0d,
+  0xed, 0x1d, 0xb0, 0xc5, 0xfd, 0xa1, 0xe5, 0x3c, 0x53, 0x9c, 0x4f, 0x56, 0x28, 0x5e, 0xf5, 0x10,
+  0xc7, 0x11, 0xc0, 0x4e, 0x39, 0x8e, 0xc2, 0x74, 0x30, 0x7e, 0x1f, 0xc2, 0x9e, 0xcf, 0x82, 0xc2,
+  0xe5, 0x30, 0xa3, 0x5f, 0x9b, 0x78, 0x47, 0x0e, 0x1a, 0x32, 0xec, 0xae, 0xc9, 0x4e, 0xa8, 0x70,
+  0xb3, 0xf9, 0xeb, 0x2f, 0xa7, 0xe3, 0x71, 0x32, 0x52, 0x3b, 0x9d, 0x1a, 0x02, 0xe7, 0x8d, 0x46,
+  0xf1, 0x14, 0x83, 0x0d, 0xff, 0xfa, 0x4b, 0x35, 0xb0, 0x76, 0xbd, 0xa3, 0xa5, 0x0f, 0x34, 0x3b,
+  0x5d, 0x69, 0x0c, 0xc8, 0xee, 0xeb, 0x3a, 0x41, 0x65, 0x3c, 0x8f, 0xd4, 0x20, 0x75, 0x24, 0x5e,
+  0x03, 0xf6, 0xe8, 0x5f, 0x22, 0x10, 0xc8, 0xa3, 0x7e, 0xaa, 0xbe, 0x08, 0xd7, 0x85, 0xf1, 0xb4,
+  0x79, 0x77, 0x75, 0x1c, 0x47, 0x03, 0xfa, 0x2d, 0x94, 0x76, 0x00, 0x64, 0xb3, 0x83, 0x8e, 0x0f,
+  0xbb, 0x9c, 0xa3, 0xc9, 0xa3, 0x65, 0x92, 0x0b, 0x41, 0x33, 0xe0, 0x55, 0x09, 0x60, 0xb5, 0xa5,
+  0xeb, 0x1a, 0xab, 0x2a, 0xe0, 0x3b, 0x51, 0xc1, 0x8b, 0x49, 0x72, 0x1e, 0x9c, 0xf2, 0x28, 0xce,
+  0xd0, 0x76, 0x22, 0xfd, 0x74, 0x39, 0x14, 0x33, 0x84, 0x65, 0xa2, 0x03, 0xa5, 0x81, 0xce, 0xec,
+  0xcd, 0xaf, 0x89, 0xf8, 0x5b, 0xac, 0x8f, 0x67, 0x94, 0xfb, 0x17, 0x67, 0x61, 0xd4, 0xe1, 0x03,
+  0x37, 0x6a, 0x47, 0x61, 0x8c, 0x56, 0xa8, 0x40, 0xba, 0x17, 0x37, 0xdd, 0x8b, 0xe7, 0xd0, 0x86,
+  0x55, 0x83, 0x5b, 0x1b, 0x85, 0x93, 0x72, 0xb3, 0x0e, 0xe5, 0xb0, 0x34, 0x29, 0xf0, 0x71, 0x4c,
+  0xf1, 0xf7, 0x95, 0xf3, 0xbc, 0x75, 0x68, 0x7d, 0x18, 0x34, 0xdc, 0xc4, 0x71, 0x74, 0x38, 0xa1,
+  0xba, 0xa9, 0xd0, 0x45, 0x45, 0x92, 0x4c, 0x93, 0x50, 0x10, 0x44, 0x1d, 0xff, 0xd8, 0xeb, 0xde,
+  0x57, 0xfa, 0xed, 0x07, 0x8b, 0x90, 0x57, 0xe7, 0xb9, 0x6f, 0x3b, 0xb5, 0x28, 0x2e, 0x68, 0xb2,
+  0x45, 0xe2, 0x36, 0xec, 0x10, 0xee, 0x41, 0x5d, 0xd5, 0x25, 0x9e, 0x3d, 0xf7, 0x7d, 0x84, 0x57,
+  0xdc, 0xfd, 0x69, 0x2b, 0x54, 0xf8, 0x37, 0xbb, 0x9f, 0x17, 0xcc, 0x7c, 0xd3, 0x0b, 0x43, 0x2d,
+  0x19, 0x2a, 0x5b, 0x3d, 0x43, 0xd3, 0x9c, 0xf6, 0x4b, 0xdc, 0x7f, 0xa9, 0x31, 0x6e, 0xc2, 0xaa,
+  0x50, 0x20, 0x45, 0x2d, 0x4d, 0x69, 0x50, 0x25, 0xd6, 0x96, 0x98, 0xaa, 0x42, 0xe7, 0x10, 0xd5,
+  0x2c, 0x51, 0x3d, 0x46, 0xdd, 0x58, 0x65, 0x0f, 0xfd, 0xa6, 0x5a, 0xa9, 0x0e, 0x1f, 0x43, 0x41,
+  0x19, 0x70, 0xab, 0x8f, 0xbc, 0x06, 0x32, 0x0d, 0xbe, 0x04, 0xc2, 0x48, 0x74, 0x07, 0x3d, 0xb8,
+  0x77, 0xb1, 0x63, 0x4d, 0x98, 0x86, 0x54, 0x82, 0x2c, 0x58, 0xd6, 0x09, 0xc5, 0xda, 0x6e, 0xd3,
+  0x5f, 0x8a, 0x33, 0xc2, 0xb8, 0x5f, 0xfc, 0x81, 0xe2, 0x7f, 0xe5, 0x0f, 0xf8, 0x5d, 0x9e, 0x78,
+  0xf8, 0xb5, 0x25, 0x4a, 0xef, 0xfa, 0x34, 0x1a, 0x35, 0xf9, 0xdf, 0xa6, 0x77, 0x27, 0xd4, 0x47,
+  0xdd, 0x68, 0x91, 0x37, 0x14, 0x7b, 0xd2, 0xa2, 0xb1, 0x94, 0xb9, 0x43, 0x03, 0x5d, 0xb0, 0x04,
+  0x71, 0x54, 0xc6, 0xb4, 0x6a, 0x0d, 0x4c, 0x01, 0xa9, 0xe9, 0x89, 0x46, 0x72, 0x99, 0xb4, 0x1d,
+  0x11, 0x47, 0x9b, 0xcb, 0xc4, 0xe4, 0xa0, 0x4b, 0x37, 0x2c, 0x4c, 0x46, 0xbb, 0x16, 0x84, 0xe5,
+  0x52, 0xf4, 0xde, 0x54, 0xe4, 0x9e, 0x71, 0x4c, 0x1e, 0x4a, 0x37, 0xe8, 0xc3, 0x7a, 0xe3, 0xb8,
+  0x04, 0x33, 0xc1, 0x1d, 0xb1, 0xf8, 0x82, 0x2b, 0x5b, 0x5e, 0x0a, 0xc8, 0xa7, 0xd5, 0x1d, 0x82,
+  0x1a, 0x0f, 0xcb, 0xbd, 0xcf, 0x52, 0xcc, 0xca, 0xca, 0xe6, 0xa2, 0xe3, 0x37, 0xb0, 0x84, 0x22,
+  0x0f, 0x3b, 0xb2, 0xf6, 0x40, 0x06, 0x2c, 0x05, 0xe3, 0x4b, 0x1c, 0x32, 0x55, 0x73, 0xd3, 0xd7,
+  0xb9, 0xe3, 0x5a, 0x75, 0xd1, 0xe9, 0x74, 0x68, 0x82, 0x18, 0x18, 0x53, 0x4e, 0x73, 0x69, 0x6c,
+  0x97, 0x91, 0x8f, 0x98, 0x0f, 0x01, 0x3d, 0xe7, 0x59, 0x52, 0x64, 0x11, 0xd2, 0xa1, 0xcb, 0xc2,
+  0x38, 0x87, 0x5d, 0xcb, 0xdd, 0x1d, 0xe0, 0xb0, 0x2a, 0xa7, 0x21, 0x33, 0x09, 0x4c, 0xa3, 0x68,
+  0x88, 0x37, 0x9a, 0xba, 0x70, 0xf6, 0x3d, 0x5f, 0xfc, 0xb5, 0x3f, 0xa0, 0xaa, 0xe0, 0x60, 0x5a,
+  0xb4, 0x52, 0xb9, 0xce, 0x46, 0xd0, 0x10, 0xc7, 0x60, 0xb8, 0xb0, 0x59, 0x32, 0x44, 0x15, 0xd2,
+  0xd1, 0xd4, 0x83, 0x3b, 0x96, 0x89, 0xce, 0xd6, 0x03, 0xcf, 0x2b, 0x86, 0xae, 0x7a, 0xc1, 0xc3,
+  0x3a, 0xd0, 0xf7, 0xcc, 0x80, 0x05, 0xb2, 0x70, 0x39, 0x5e, 0xa6, 0x6c, 0x5b, 0xa6, 0x55, 0xdf,
+  0x11, 0xf1, 0xe0, 0xb4, 0x74, 0xc9, 0xa1, 0x2e, 0x6b, 0x59, 0x59, 0xe5, 0x44, 0x54, 0x99, 0xba,
+  0xb8, 0x66, 0xe3, 0x70, 0x16, 0x39, 0x43, 0x2a, 0x9b, 0xe2, 0x02, 0x63, 0xcc, 0x5b, 0x18, 0xe1,
+  0x3a, 0x0a, 0x53, 0xfc, 0xa3, 0xee, 0xb4, 0x3a, 0xb4, 0x79, 0x86, 0xc0, 0xf2, 0x8e, 0xa0, 0x60,
+  0x5c, 0xa0, 0x33, 0x99, 0x0a, 0x23, 0x28, 0xb4, 0xa1, 0x2d, 0xf1, 0xf8, 0xc9, 0x53, 0x19, 0x1f,
+  0xdb, 0x24, 0x12, 0xa3, 0x68, 0x5d, 0x1d, 0x48, 0xa0, 0x05, 0xdb, 0x60, 0x48, 0x81, 0x4e, 0x42,
+  0xcd, 0x8e, 0xd0, 0x62, 0x1e, 0x09, 0x1b, 0x63, 0x39, 0x16, 0x84, 0x63, 0x80, 0xe9, 0xad, 0xaf,
+  0xb7, 0x30, 0xf4, 0xb6, 0x29, 0xe6, 0xd3, 0x09, 0x9a, 0x08, 0xf1, 0xde, 0xcd, 0x6d, 0x29, 0x48,
+  0x17, 0x23, 0x73, 0x8b, 0xb0, 0x4a, 0xd2, 0x63, 0x28, 0xbb, 0x82, 0xc0, 0xf2, 0x52, 0xcd, 0x8e,
+  0x8f, 0xa6, 0xb5, 0x50, 0x9f, 0x20, 0xc6, 0xfb, 0x40, 0x8b, 0xe6, 0xdb, 0x2a, 0xa0, 0x39, 0x35,
+  0xb7, 0x05, 0x49, 0xcb, 0x45, 0xd2, 0xa0, 0xbc, 0x89, 0xd2, 0x48, 0x87, 0xe4, 0x0e, 0xe3, 0xae,
+  0x09, 0xbb, 0xae, 0xc4, 0x49, 0x13, 0xbf, 0x5c, 0x26, 0x7a, 0xd1, 0x8a, 0xc9, 0xe7, 0x3d, 0x51,
+  0xb9, 0xea, 0xf0, 0xe0, 0x9c, 0x04, 0x07, 0xef, 0x29, 0xfa, 0xf9, 0xb6, 0x29, 0x07, 0x24, 0xaa,
+  0x58, 0x7a, 0x1b, 0x5b, 0x2d, 0xed, 0x60, 0xd1, 0x9d, 0xf8, 0x80, 0xc9, 0x9d, 0x72, 0x8f, 0xb3,
+  0xe6, 0xe6, 0xdd, 0xdc, 0x79, 0x76, 0x64, 0x6a, 0x04, 0x4a, 0x70, 0x22, 0x35, 0x39, 0xe7, 0x18,
+  0xa3, 0x35, 0x48, 0x88, 0xe3, 0xa5, 0x72, 0xa8, 0x43, 0x98, 0xff, 0x1c, 0x23, 0xb5, 0x81, 0x86,
+  0xa6, 0x49, 0x35, 0xd8, 0x75, 0xb9, 0xcb, 0x83, 0x5c, 0xd0, 0x2f, 0x5a, 0x64, 0x2e, 0x86, 0x10,
+  0x9f, 0x2d, 0x13, 0xf3, 0x6a, 0x4b, 0x18, 0xb7, 0xae, 0x10, 0xfa, 0x12, 0x2c, 0x69, 0x8f, 0x01,
+  0xe5, 0x1d, 0x0e, 0x89, 0x5d, 0x10, 0x11, 0x5e, 0x6e, 0x15, 0x19, 0xa4, 0x4d, 0x74, 0x0f, 0x97,
+  0x61, 0xe4, 0x82, 0xf0, 0x91, 0xfa, 0x52, 0x96, 0x89, 0x32, 0x44, 0x9c, 0xbe, 0xf5, 0xce, 0x1c,
+  0x22, 0x80, 0x11, 0xc5, 0x2c, 0x63, 0xbe, 0x8b, 0x5f, 0x1e, 0xd4, 0x06, 0x1d, 0xbb, 0x30, 0xa4,
+  0x61, 0x87, 0xa7, 0x24, 0xbf, 0xea, 0x18, 0xa9, 0xa6, 0xbc, 0xa0, 0x60, 0xfb, 0x6b, 0xa9, 0xd7,
+  0x2b, 0x65, 0x86, 0x25, 0xb6, 0x6a, 0x65, 0x93, 0x39, 0x36, 0x69, 0x99, 0x43, 0x80, 0xf8, 0x56,
+  0xd3, 0xbb, 0x61, 0x96, 0x4c, 0x81, 0xe0, 0x5b, 0xc3, 0x65, 0x82, 0xd7, 0x69, 0xa8, 0x14, 0xbb,
+  0x5e, 0x04, 0x3e, 0x6b, 0xbb, 0x63, 0x49, 0x32, 0xfc, 0x3a, 0x12, 0xfc, 0xd6, 0x9c, 0x0f, 0x2a,
+  0x46, 0xdf, 0x0c, 0x07, 0xb6, 0x26, 0x2a, 0x97, 0xc2, 0x75, 0x0b, 0x85, 0xb5, 0x3e, 0x2a, 0x93,
+  0x30, 0x60, 0x02, 0x86, 0x6f, 0xc9, 0xb6, 0xe0, 0x5a, 0x00, 0x2b, 0xa2, 0x5c, 0x47, 0xec, 0x5d,
+  0x36, 0x95, 0xb1, 0x8f, 0x16, 0xe4, 0x5b, 0x58, 0xb4, 0xa3, 0xbe, 0x36, 0xd7, 0xc2, 0x37, 0xed,
+  0xbc, 0xa5, 0x88, 0xc2, 0x65, 0x7e, 0x52, 0x33, 0x9f, 0xd1, 0x29, 0x3b, 0xa3, 0x63, 0xd6, 0x19,
+  0x4d, 0xcf, 0x19, 0x86, 0x4e, 0xcf, 0x2c, 0xeb, 0xaa, 0xca, 0xa6, 0x80, 0x24, 0xd5, 0xb3, 0xcb,
+  0x8e, 0x5d, 0xaa, 0x7c, 0x0a, 0xf8, 0x14, 0xfe, 0x3a, 0xa7, 0x64, 0x66, 0x27, 0xb1, 0xa4, 0x1a,
+  0xb6, 0x20, 0x50, 0xc0, 0x5d, 0x4b, 0x92, 0xa3, 0xe2, 0xf8, 0x48, 0x22, 0xac, 0x58, 0x01, 0x6a,
+  0x44, 0x11, 0x63, 0x8c, 0x35, 0x5d, 0x48, 0x08, 0x0e, 0x05, 0x67, 0x05, 0x77, 0x04, 0xc1, 0x60,
+  0xf4, 0x26, 0xa5, 0xf8, 0x02, 0xda, 0x9b, 0xa2, 0xb5, 0xbb, 0xdb, 0x92, 0x46, 0x0b, 0x7e, 0x17,
+  0xfd, 0x40, 0xaf, 0xd0, 0xbe, 0x17, 0x68, 0xee, 0x1a, 0xde, 0xe2, 0x05, 0x12, 0xe1, 0x58, 0x62,
+  0x7b, 0xf2, 0x7b, 0x78, 0x43, 0x20, 0x5b, 0xdb, 0x78, 0x2c, 0xde, 0xde, 0xd1, 0xc0, 0xdb, 0xf7,
+  0x95, 0xb2, 0x91, 0xe2, 0xa2, 0x2b, 0x5b, 0xea, 0xf5, 0xf5, 0x0b, 0x89, 0x63, 0xe0, 0xd8, 0x3d,
+  0x1a, 0x04, 0x10, 0x81, 0x7f, 0x00, 0xfa, 0x84, 0xed, 0x11, 0xb0, 0x8a, 0x40, 0xb5, 0x24, 0x24,
+  0x11, 0x27, 0xed, 0x36, 0x45, 0xe5, 0x67, 0x78, 0xe9, 0xb5, 0x33, 0xb1, 0x0c, 0x61, 0x9f, 0x18,
+  0x24, 0xb4, 0x00, 0x52, 0xb4, 0x7a, 0x36, 0xc5, 0x2a, 0x06, 0x72, 0x76, 0xab, 0x6f, 0x56, 0x3d,
+  0x9f, 0x89, 0x5e, 0x69, 0xf9, 0xae, 0x48, 0x45, 0x39, 0x1b, 0xf2, 0x3e, 0x7d, 0xff, 0x25, 0x70,
+  0x4f, 0x0a, 0xe0, 0x4b, 0x48, 0x4d, 0xd8, 0x7f, 0xaf, 0x30, 0xcc, 0x33, 0xe8, 0x36, 0x6f, 0xc5,
+  0x68, 0x96, 0x7d, 0xaa, 0xbe, 0xd4, 0x74, 0xe0, 0x40, 0x4b, 0x7c, 0xbd, 0x57, 0x24, 0xbe, 0x1d,
+  0x96, 0xa5, 0x21, 0xfe, 0x2a, 0x9c, 0x71, 0xd1, 0x8b, 0xd8, 0xe5, 0xac, 0x67, 0xe8, 0x5d, 0x1c,
+  0xeb, 0x2f, 0xb6, 0x11, 0xb1, 0xfe, 0x77, 0x7c, 0xd2, 0xdf, 0x61, 0x4c, 0x57, 0x07, 0xe2, 0x98,
+  0x6d, 0x4f, 0xce, 0x56, 0xac, 0x38, 0x55, 0x00, 0x08, 0xf7, 0xfb, 0x2f, 0xb6, 0xf7, 0x85, 0xed,
+  0x77, 0xc3, 0xa9, 0x85, 0xfa, 0xf2, 0x14, 0xbd, 0x35, 0x07, 0xa0, 0x08, 0x74, 0xd5, 0x4d, 0xd9,
+  0x26, 0xe2, 0x2f, 0xbd, 0x23, 0x51, 0x57, 0x44, 0x78, 0xdf, 0x27, 0x11, 0x28, 0xc5, 0xda, 0xf7,
+  0x5f, 0xd4, 0x15, 0x5a, 0x6a, 0xd5, 0x6e, 0x9b, 0x9f, 0x70, 0x20, 0x22, 0xd0, 0x32, 0xff, 0x35,
+  0x1b, 0xb5, 0xaa, 0x77, 0x2d, 0xe6, 0xcd, 0xf4, 0xd7, 0x81, 0x3f, 0xbe, 0x5d, 0xe7, 0x25, 0x6c,
+  0x0f, 0x9d, 0x6d, 0x55, 0x6a, 0xe7, 0x39, 0x17, 0xa8, 0xa6, 0x99, 0x42, 0xa3, 0xd1, 0xe4, 0x3e,
+  0xac, 0xc8, 0x94, 0xec, 0xfc, 0xe0, 0xf0, 0xf0, 0xfd, 0x7d, 0x58, 0x8f, 0xaf, 0x13, 0x81, 0x25,
+  0x5a, 0x50, 0x05, 0x87, 0x31, 0xec, 0x68, 0xdf, 0x25, 0x79, 0x4f, 0xf9, 0x4f, 0xcb, 0x94, 0x33,
+  0x70, 0xaf, 0x1c, 0x5e, 0xe1, 0x21, 0xc4, 0xd7, 0x33, 0x0a, 0xef, 0x09, 0x35, 0x3e, 0x0c, 0xa0,
+  0x90, 0x97, 0xd3, 0x15, 0x0e, 0x8d, 0xc7, 0x37, 0x2a, 0xcf, 0xb2, 0x4a, 0x81, 0x06, 0x3c, 0x9d,
+  0xad, 0xca, 0x28, 0x71, 0x64, 0x9b, 0xa2, 0xf0, 0xe9, 0x16, 0x17, 0x51, 0x9e, 0xb9, 0xe2, 0xb1,
+  0xa1, 0x87, 0x4c, 0x0f, 0x69, 0x18, 0xb8, 0xe9, 0x7e, 0x8b, 0xfa, 0x3d, 0x7a, 0x17, 0x5c, 0x1d,
+  0x3a, 0x24, 0x76, 0xca, 0x80, 0x23, 0x4d, 0x07, 0xb5, 0x8a, 0x9b, 0x47, 0x1d, 0x2b, 0xb8, 0x11,
+  0x30, 0x27, 0xe0, 0xfc, 0x62, 0x2c, 0xb3, 0x2c, 0x4e, 0xf2, 0x08, 0xad, 0xd2, 0x94, 0x51, 0x21,
+  0xa0, 0x49, 0x06, 0x4d, 0xed, 0x46, 0x59, 0xb0, 0xdf, 0x12, 0x15, 0x2e, 0xd6, 0x2b, 0xc5, 0x29,
+  0x1c, 0x32, 0x2d, 0xb5, 0x1d, 0x68, 0xbd, 0xc5, 0xd6, 0x41, 0xd8, 0x03, 0x5d, 0x4c, 0x00, 0x44,
+  0x3c, 0xd3, 0x6c, 0x63, 0xa5, 0xd0, 0xaa, 0x04, 0x6a, 0xdb, 0xf4, 0xea, 0x38, 0x0e, 0x2c, 0xdf,
+  0x3b, 0x9e, 0x4b, 0x95, 0x1b, 0x9e, 0x47, 0xd3, 0xc1, 0xd8, 0xc5, 0x93, 0xe8, 0x01, 0x4a, 0x41,
+  0xec, 0x3c, 0x2f, 0x67, 0xb3, 0x6c, 0xbe, 0x27, 0x49, 0x18, 0xaf, 0xfd, 0x5d, 0x59, 0x26, 0xc0,
+  0x21, 0x73, 0x8c, 0x7b, 0xbd, 0x59, 0x6d, 0x69, 0x7f, 0xfe, 0x1a, 0x67, 0x2d, 0x45, 0x5c, 0x01,
+  0x4a, 0x10, 0x20, 0x2e, 0x5d, 0xce, 0xec, 0x79, 0x73, 0xfa, 0x0e, 0x90, 0xe3, 0x39, 0x2c, 0xcc,
+  0xe5, 0x60, 0xa4, 0x05, 0x09, 0xa2, 0x98, 0xa3, 0x5d, 0x7c, 0xb7, 0x0d, 0x8b, 0xaa, 0x24, 0xb6,
+  0x6e, 0x07, 0x6e, 0xb5, 0x03, 0x76, 0x79, 0xc6, 0xc4, 0x4c, 0x32, 0x4c, 0xcd, 0x9b, 0x74, 0xa1,
+  0x38, 0x93, 0xe9, 0x05, 0xc6, 0xe1, 0x84, 0xdf, 0x54, 0x70, 0x62, 0xd0, 0x54, 0x19, 0x2a, 0x3d,
+  0x27, 0x4a, 0xbd, 0xaf, 0xba, 0x76, 0xef, 0xa7, 0x3c, 0x52, 0xfc, 0x3a, 0x99, 0x7c, 0xda, 0xe9,
+  0xb9, 0xfc, 0x35, 0x31, 0x18, 0x55, 0x9b, 0x9b, 0x75, 0x4d, 0x46, 0x6f, 0x79, 0x7e, 0x7f, 0xb3,
+  0x8a, 0xb9, 0xc3, 0x4a, 0x08, 0x4c, 0xbf, 0xcc, 0x86, 0x48, 0x1b, 0x34, 0x8d, 0xb2, 0xf9, 0x24,
+  0x67, 0x87, 0x13, 0xc9, 0x82, 0xa6, 0x51, 0x8e, 0x67, 0xca, 0x5d, 0xce, 0x7c, 0xfa, 0x46, 0xf3,
+  0xbf, 0x3b, 0x1e, 0x07, 0x1c, 0x91, 0x55, 0xe3, 0xf1, 0x8f, 0x24, 0xb8, 0x3b, 0x49, 0x06, 0x7f,
+  0xb8, 0x1e, 0x62, 0x82, 0x8e, 0x04, 0xf8, 0x00, 0x67, 0x70, 0xa1, 0xc9, 0x01, 0x21, 0xc5, 0x13,
+  0x56, 0xd2, 0xcd, 0x41, 0x04, 0xc7, 0xc8, 0xcb, 0x29, 0x3b, 0x08, 0xcc, 0x67, 0xee, 0xf0, 0x3a,
+  0x99, 0xe4, 0xfd, 0x10, 0x98, 0x35, 0xfa, 0x0f, 0xca, 0xc8, 0x39, 0x4c, 0xe8, 0x82, 0xb5, 0x10,
+  0x5c, 0xaf, 0x45, 0x9e, 0xcc, 0x98, 0x28, 0xbc, 0x35, 0x55, 0x22, 0x06, 0x4f, 0xeb, 0x03, 0xb8,
+  0xfe, 0x4d, 0x07, 0x37, 0x45, 0xb3, 0x96, 0x68, 0xf0, 0xda, 0x34, 0xfe, 0x8d, 0xa4, 0x62, 0x13,
+  0x44, 0xaf, 0x23, 0x5e, 0xc3, 0xfe, 0xa4, 0xad, 0x79, 0xb7, 0xc0, 0x96, 0x8a, 0xef, 0x3f, 0x99,
+  0xff, 0x28, 0xb3, 0x0b, 0x31, 0xe3, 0xc7, 0x4d, 0x73, 0xd7, 0xeb, 0x6d, 0xbd, 0x02, 0x9e, 0xf2,
+  0xb2, 0xfd, 0x7f, 0x47, 0x3e, 0xb4, 0xc8, 0x47, 0xd2, 0x59, 0xd7, 0xd5, 0x40, 0x0e, 0x93, 0x9e,
+  0x5b, 0x53, 0x54, 0x3f, 0x3b, 0x53, 0x79, 0xd6, 0x3b, 0x51, 0x7e, 0xcb, 0x7c, 0x48, 0xe8, 0xa7,
+  0xfe, 0xbf, 0xa4, 0x13, 0x44, 0x1d, 0x46, 0xd2, 0x4e, 0x43, 0x58, 0xfe, 0x70, 0xf2, 0x81, 0x32,
+  0x83, 0x12, 0x3f, 0x33, 0x86, 0x0a, 0x4d, 0x16, 0x91, 0xc6, 0x5a, 0x47, 0xf0, 0xe9, 0x27, 0x7e,
+  0xc5, 0xa5, 0xd3, 0x0a, 0xfb, 0x88, 0x00, 0x6f, 0xe3, 0x82, 0x9c, 0xd7, 0x4d, 0x2e, 0xab, 0x68,
+  0xb9, 0x33, 0x98, 0x44, 0x61, 0x7a, 0x84, 0x86, 0x4a, 0x4e, 0x6d, 0xa9, 0x72, 0x55, 0x15, 0x9f,
+  0xde, 0xd8, 0xdc, 0x89, 0x5c, 0x30, 0x8b, 0x21, 0xba, 0xd6, 0xbd, 0x00, 0x9e, 0x85, 0x57, 0xde,
+  0xa5, 0xa9, 0xa5, 0x59, 0x03, 0x4a, 0x59, 0xff, 0xaf, 0x1c, 0x5c, 0xb7, 0x2e, 0xbe, 0x84, 0x5e,
+  0x8d, 0x1a, 0x8f, 0xa0, 0x8d, 0x39, 0xfe, 0x9b, 0xcb, 0xbb, 0x3e, 0x60, 0xce, 0xa7, 0xd2, 0x85,
+  0xdc, 0xc3, 0x29, 0x41, 0x72, 0x29, 0x9c, 0xc4, 0xfb, 0x9e, 0xc0, 0x15, 0x49, 0x7c, 0xbe, 0xb9,
+  0x21, 0x5b, 0x29, 0x68, 0xb7, 0xe4, 0x2b, 0xd8, 0xc3, 0x9b, 0xda, 0x6e, 0x01, 0x96, 0xca, 0xc4,
+  0xab, 0xe5, 0xe2, 0xa8, 0x22, 0x88, 0xce, 0x45, 0x5d, 0x22, 0x7a, 0x57, 0xda, 0x5a, 0x44, 0x11,
+  0x48, 0xec, 0x41, 0x1b, 0xc9, 0xf5, 0xc7, 0xcb, 0xab, 0x17, 0x95, 0x5e, 0x54, 0x37, 0x5d, 0x48,
+  0xab, 0x9c, 0x99, 0xb6, 0xb7, 0x85, 0xa5, 0x0d, 0x07, 0x63, 0x92, 0x92, 0x59, 0xd6, 0x65, 0xd9,
+  0xdb, 0x33, 0x0e, 0x56, 0x85, 0x8a, 0xbb, 0x5d, 0xf5, 0x7c, 0xda, 0x4f, 0xb7, 0xfa, 0x09, 0x56,
+  0x43, 0xe9, 0x08, 0x0d, 0x93, 0x8a, 0x86, 0x73, 0xb6, 0x14, 0xe8, 0x2f, 0x6d, 0xd6, 0x10, 0x08,
+  0x09, 0xaf, 0x49, 0xbc, 0xaf, 0x3c, 0x4d, 0xf1, 0xd7, 0xe2, 0x6d, 0x7a, 0xde, 0xce, 0xcc, 0x03,
+  0x45, 0xbf, 0xc0, 0xa7, 0x11, 0x86, 0x79, 0xef, 0x4e, 0x62, 0xe0, 0xdd, 0xaf, 0x50, 0x50, 0xaa,
+  0x76, 0x71, 0xeb, 0x6f, 0xdc, 0xa0, 0x2d, 0x9f, 0x79, 0x75, 0xbe, 0x0e, 0x0c, 0x97, 0xff, 0xea,
+  0xd4, 0x5d, 0x78, 0x6b, 0x6e, 0xba, 0xc9, 0x8b, 0x2e, 0x1d, 0xa8, 0x51, 0x18, 0x84, 0x33, 0x60,
+  0x84, 0x11, 0x29, 0xb8, 0xc4, 0xb5, 0x4a, 0x64, 0xcb, 0x57, 0xa5, 0x8c, 0x8b, 0x5c, 0xd2, 0x6f,
+  0x61, 0x0e, 0xf7, 0x25, 0x1f, 0x01, 0x50, 0x73, 0x79, 0x4d, 0xc0, 0xbd, 0x0c, 0xab, 0x3f, 0xc0,
+  0x03, 0x04, 0x3d, 0xe8, 0x22, 0xce, 0xb3, 0x4c, 0x77, 0x0f, 0xf8, 0x1d, 0x1e, 0x77, 0xe4, 0x3b,
+  0xdf, 0x92, 0x6a, 0xc2, 0xb9, 0xbd, 0x9e, 0x5b, 0xed, 0xda, 0x06, 0xbc, 0xbe, 0x46, 0xf9, 0x9e,
+  0x25, 0x56, 0x6e, 0xf3, 0xda, 0x41, 0xc9, 0xbf, 0xb1, 0x9b, 0xe1, 0x90, 0x97, 0xdb, 0xc0, 0x58,
+  0x31, 0x09, 0x17, 0xce, 0x0c, 0xf1, 0x58, 0xeb, 0xb6, 0x40, 0x22, 0x2e, 0xbc, 0x17, 0x60, 0x27,
+  0x85, 0x13, 0xa9, 0x5d, 0x94, 0x16, 0x54, 0x4e, 0x9d, 0x8a, 0xd2, 0x2f, 0x5c, 0x69, 0x29, 0x89,
+  0x2a, 0xe6, 0xcc, 0x72, 0x47, 0x31, 0x66, 0x59, 0x7c, 0x31, 0x95, 0x99, 0x7e, 0x7d, 0x63, 0xf6,
+  0xb9, 0xcb, 0x18, 0x3b, 0x82, 0x58, 0x60, 0x11, 0xa0, 0xa5, 0xc1, 0x3a, 0xed, 0x9e, 0x69, 0x29,
+  0x62, 0xeb, 0x33, 0x7d, 0xde, 0x79, 0xfe, 0x14, 0xfc, 0x33, 0x48, 0x28, 0x0c, 0x02, 0x13, 0x86,
+  0xa1, 0xe7, 0xe8, 0x40, 0xba, 0x52, 0x67, 0xec, 0xcf, 0xa1, 0xaa, 0xa7, 0x62, 0x2c, 0xbd, 0x53,
+  0xee, 0xd4, 0xd8, 0x4d, 0x74, 0x23, 0xd5, 0xf8, 0x4c, 0x6d, 0x44, 0x2c, 0x27, 0x32, 0x8f, 0x57,
+  0x65, 0x61, 0xad, 0x89, 0x79, 0xfd, 0x7f, 0xfa, 0xfe, 0x4e, 0x9e, 0xd4, 0xa4, 0x69, 0x82, 0xd1,
+  0xa4, 0x58, 0xf7, 0x8b, 0x84, 0xde, 0x62, 0x58, 0x8b, 0x97, 0x05, 0x17, 0x01, 0x57, 0x93, 0xd4,
+  0xe2, 0xe5, 0x39, 0x54, 0x40, 0x70, 0x51, 0xa0, 0x44, 0xe5, 0x4b, 0xe8, 0x5a, 0x44, 0xa5, 0xe1,
+  0x6a, 0x44, 0x53, 0x0a, 0x92, 0x5c, 0x72, 0xf9, 0xfd, 0x0e, 0x59, 0x06, 0x61, 0xe8, 0x23, 0x59,
+  0xd2, 0xfb, 0xa9, 0xee, 0xb4, 0xe4, 0xac, 0x09, 0xda, 0x99, 0x16, 0x0d, 0xc5, 0x87, 0x30, 0xc5,
+  0x2c, 0x97, 0xf5, 0xa7, 0x2b, 0xdc, 0xb6, 0xf2, 0x24, 0x8d, 0xa4, 0xeb, 0xf1, 0x11, 0x7f, 0x93,
+  0xee, 0x24, 0x79, 0x42, 0x63, 0x66, 0x3d, 0xe6, 0x14, 0x8f, 0xbe, 0x89, 0xa6, 0x73, 0xa9, 0x13,
+  0x8c, 0x68, 0x4b, 0xc2, 0x47, 0x11, 0x5e, 0xa0, 0xa6, 0x0f, 0xb0, 0x84, 0x87, 0x20, 0x96, 0xde,
+  0x48, 0x52, 0x2a, 0x2b, 0x4a, 0x80, 0x1f, 0xd4, 0xc3, 0x1a, 0xc5, 0x93, 0xc9, 0x31, 0x46, 0x6f,
+  0x08, 0x72, 0xed, 0x1b, 0x36, 0x16, 0x48, 0x46, 0x58, 0x9c, 0x0e, 0x9b, 0x62, 0x61, 0x43, 0xb1,
+  0xf6, 0x78, 0xf6, 0x59, 0xec, 0xa4, 0x71, 0x38, 0x59, 0xd8, 0x0d, 0x5e, 0x73, 0x42, 0x49, 0xe2,
+  0xdf, 0x1d, 0x72, 0xd4, 0xc6, 0xcb, 0xbd, 0x93, 0xbd, 0xdd, 0x93, 0xbd, 0x97, 0x8d, 0x96, 0x58,
+  0x03, 0x21, 0xe3, 0x49, 0xb7, 0x86, 0x5a, 0x76, 0x51, 0xcc, 0x2c, 0x0f, 0x7c, 0x9c, 0xa9, 0xc7,
+  0x74, 0x7d, 0x57, 0x72, 0xd1, 0x52, 0xc0, 0x2d, 0x27, 0xcc, 0x2e, 0x03, 0xc8, 0xc0, 0xe9, 0x77,
+  0xbd, 0x5e, 0xaf, 0xb1, 0x7c, 0xbf, 0xfb, 0x7f, 0xff, 0xc6, 0xc6, 0xc6, 0x1d, 0xde, 0x2f, 0x17,
+  0xc9, 0x22, 0x73, 0xb9, 0x48, 0x8f, 0xbb, 0xcb, 0x6f, 0x24, 0xe7, 0x81, 0xad, 0x48, 0x7f, 0xc0,
+  0x99, 0xf5, 0x70, 0xa9, 0xae, 0x23, 0x31, 0x8c, 0x87, 0xd3, 0x47, 0xb9, 0x08, 0x27, 0x74, 0xb7,
+  0x74, 0x1f, 0x5a, 0x77, 0xe2, 0xd5, 0x8e, 0x8d, 0xf7, 0x95, 0x72, 0x71, 0x1d, 0x80, 0xaf, 0x14,
+  0xdb, 0x49, 0x99, 0x5d, 0xa7, 0x35, 0xa8, 0xd1, 0x1c, 0x00, 0xf4, 0xc6, 0xd2, 0x43, 0xa9, 0xc8,
+  0x5f, 0x08, 0x94, 0x3e, 0xb3, 0x8f, 0x5b, 0x9c, 0x01, 0x8b, 0xd4, 0xc6, 0xb1, 0xdc, 0x3d, 0xd6,
+  0xcd, 0x39, 0xbe, 0x5b, 0x5b, 0x73, 0x65, 0x5f, 0x30, 0x1a, 0xdf, 0x95, 0xb4, 0x3d, 0x6f, 0x72,
+  0xd3, 0x73, 0x85, 0x41, 0x61, 0xf9, 0x35, 0x2f, 0x6f, 0x72, 0xf1, 0xa5, 0x44, 0x1c, 0x83, 0x74,
+  0x02, 0xcd, 0x5b, 0x7a, 0xca, 0xe5, 0x35, 0x10, 0xda, 0x1e, 0x97, 0x23, 0x7e, 0x83, 0x3f, 0x35,
+  0x6b, 0xef, 0xd4, 0xcb, 0xeb, 0x70, 0x5c, 0xc6, 0x49, 0x5d, 0xad, 0x5b, 0xcd, 0x16, 0xb6, 0x5e,
+  0x5c, 0xd6, 0x29, 0x5f, 0x6b, 0xc0, 0x06, 0x71, 0xc7, 0x0d, 0x1d, 0x97, 0x1a, 0x9b, 0x7c, 0x48,
+  0xd2, 0xc9, 0x30, 0x90, 0x19, 0x3b, 0x5b, 0x56, 0x66, 0xe6, 0xe7, 0xac, 0xe4, 0xe7, 0x5b, 0x68,
+  0xab, 0x4c, 0x20, 0x56, 0xe6, 0x00, 0x94, 0xe9, 0xc3, 0x9a, 0xf7, 0x6b, 0x6f, 0xf9, 0x75, 0xff,
+  0xe5, 0x1e, 0x9c, 0x02, 0x7b, 0x27, 0xbb, 0x6f, 0xf6, 0xdf, 0xbd, 0xbe, 0x07, 0xa3, 0xcb, 0xe1,
+  0x14, 0x7d, 0xe6, 0xa6, 0x17, 0xed, 0x49, 0x7c, 0x05, 0x67, 0xf2, 0xe5, 0x7c, 0x92, 0xc7, 0x28,
+  0xe6, 0xae, 0x7e, 0x6e, 0x5f, 0xa2, 0x61, 0xad, 0x4d, 0x09, 0x61, 0x07, 0x91, 0xd2, 0xb2, 0x00,
+  0xa2, 0x37, 0xf5, 0x54, 0xcf, 0x86, 0xd5, 0x85, 0x3c, 0xa6, 0x32, 0x99, 0xf9, 0x15, 0x2f, 0xa5,
+  0x20, 0x40, 0x24, 0xa5, 0x23, 0xc6, 0xb3, 0xf8, 0xf2, 0x62, 0x5b, 0x1a, 0x4b, 0x64, 0x1d, 0x9a,
+  0x8e, 0x99, 0x9f, 0xba, 0xd0, 0xd1, 0x00, 0x15, 0x36, 0x36, 0x1d, 0xcf, 0x8e, 0xa2, 0x3c, 0xbd,
+  0x41, 0xb9, 0x2a, 0xad, 0x26, 0x8e, 0x45, 0xa5, 0x8e, 0x16, 0x74, 0xe0, 0x4e, 0x1a, 0xb7, 0x5b,
+  0x4c, 0x03, 0x16, 0x3a, 0x99, 0xcd, 0xd8, 0xc1, 0xeb, 0x3c, 0x1c, 0x52, 0x21, 0xca, 0x14, 0xc1,
+  0xe3, 0x0d, 0x32, 0xcd, 0x2d, 0x49, 0x82, 0x2e, 0x7c, 0xf6, 0x18, 0xdc, 0xba, 0xb7, 0xca, 0x38,
+  0xe1, 0xc6, 0x82, 0x1f, 0x93, 0x79, 0x1e, 0xc8, 0x51, 0x79, 0x67, 0x63, 0xa3, 0x00, 0xfd, 0xda,
+  0xd0, 0x88, 0x5d, 0x97, 0x5b, 0xde, 0x13, 0x4e, 0xa5, 0x14, 0x66, 0x4e, 0x2b, 0x11, 0x39, 0x99,
+  0x8b, 0x4f, 0x18, 0xa2, 0xd6, 0x5f, 0x5d, 0xfd, 0xfe, 0x8b, 0x91, 0x22, 0xf0, 0x76, 0x95, 0x47,
+  0xe1, 0xb0, 0x62, 0x53, 0xbf, 0xad, 0xad, 0x72, 0x98, 0xee, 0xd0, 0x71, 0x7d, 0x16, 0xd0, 0xc5,
+  0x82, 0x03, 0xeb, 0x94, 0xa5, 0x03, 0xfb, 0xd1, 0xad, 0x73, 0x22, 0xa5, 0x22, 0xd3, 0x4e, 0x25,
+  0xe1, 0xa1, 0x15, 0xf5, 0x06, 0x0e, 0x3b, 0xde, 0xc9, 0xf3, 0x34, 0x3e, 0x47, 0xa7, 0xf5, 0x47,
+  0xf0, 0xca, 0x47, 0xf7, 0xbc, 0x1b, 0x49, 0x1a, 0xdb, 0x3d, 0x3a, 0x7c, 0x7f, 0x2c, 0x02, 0x4c,
+  0x5b, 0xde, 0xbc, 0xa7, 0x18, 0x5a, 0x99, 0x43, 0x8c, 0x72, 0xa2, 0x97, 0x29, 0xc5, 0x95, 0xe3,
+  0x3b, 0x19, 0x20, 0x03, 0x4a, 0x08, 0x2d, 0xce, 0x6f, 0x64, 0x74, 0x28, 0x49, 0xae, 0x56, 0x9d,
+  0x26, 0x2c, 0xd1, 0x04, 0x32, 0x02, 0x26, 0xf1, 0xa0, 0x20, 0x92, 0x26, 0x19, 0x32, 0x33, 0x72,
+  0xa4, 0x0f, 0x39, 0xa7, 0x3a, 0x03, 0x66, 0x2b, 0xe9, 0x20, 0x99, 0xcf, 0xe0, 0xa0, 0x48, 0x46,
+  0xca, 0xd0, 0xaf, 0xc3, 0x82, 0x77, 0xa7, 0x51, 0x3b, 0x1c, 0xfc, 0x39, 0x8f, 0xd3, 0x88, 0xbc,
+  0x76, 0xff, 0xd1, 0x3e, 0x3a, 0xdc, 0x2f, 0x34, 0x04, 0x29, 0x67, 0x87, 0xc7, 0x31, 0x8b, 0x0c,
+  0x9d, 0xf0, 0x63, 0x4d, 0x8f, 0xd0, 0xb1, 0x53, 0xc1, 0xbb, 0x13, 0x3d, 0x70, 0x7a, 0x74, 0xca,
+  0x0a, 0x0f, 0x3c, 0xf6, 0x88, 0x54, 0x82, 0xd2, 0x3b, 0xd9, 0xf0, 0x4d, 0xbf, 0xc9, 0xa5, 0x4d,
+  0xb6, 0xf4, 0xcc, 0xe1, 0xf2, 0x23, 0x9c, 0x78, 0xbd, 0x9c, 0x58, 0x26, 0xae, 0x32, 0x46, 0x63,
+  0x35, 0x59, 0x69, 0xe1, 0xa3, 0x63, 0x16, 0xa5, 0x83, 0xbe, 0xe8, 0x5d, 0x35, 0x2a, 0xfd, 0x72,
+  0xce, 0xf1, 0x75, 0xf4, 0xe9, 0x92, 0x9d, 0x73, 0x4c, 0xd7, 0x2c, 0x04, 0xbf, 0x7c, 0x0f, 0x7d,
+  0xbb, 0x5a, 0x86, 0x42, 0x4b, 0xaf, 0xee, 0x70, 0x38, 0x34, 0x70, 0xe3, 0xde, 0x78, 0x36, 0xfa,
+  0xaa, 0x7e, 0xe8, 0x75, 0x9e, 0xbd, 0xa9, 0xe6, 0x88, 0x47, 0xc3, 0x09, 0xbc, 0x1c, 0x02, 0x30,
+  0xf8, 0x09, 0x03, 0x15, 0x06, 0x40, 0x9e, 0x11, 0x25, 0x5e, 0x69, 0x93, 0xb8, 0xe7, 0x76, 0xae,
+  0x97, 0x8e, 0xc3, 0x93, 0xe4, 0xbc, 0x80, 0x0f, 0xef, 0xea, 0xe0, 0x0f, 0x7e, 0x2f, 0xc8, 0x34,
+  0x1a, 0x44, 0x78, 0x28, 0xed, 0xdc, 0xc9, 0x77, 0x72, 0xa1, 0x77, 0x32, 0xbe, 0xd4, 0xff, 0x4e,
+  0xc2, 0x1a, 0x46, 0x6f, 0x74, 0xc6, 0x20, 0x51, 0x63, 0xaa, 0x4f, 0x8a, 0x2a, 0x25, 0x62, 0x6f,
+  0x34, 0xd1, 0x1d, 0xb6, 0xd1, 0x68, 0x76, 0xb2, 0xd9, 0x24, 0x86, 0x5f, 0x5b, 0x0d, 0x76, 0x00,
+  0x7c, 0x37, 0xbf, 0x3c, 0x77, 0x26, 0x8d, 0x90, 0x9e, 0x4a, 0x98, 0x93, 0xd5, 0x0d, 0x95, 0x16,
+  0xbb, 0x7d, 0x0c, 0x0d, 0xbe, 0x16, 0xf8, 0x48, 0x6e, 0x25, 0xb7, 0xe0, 0x2c, 0x9d, 0xa8, 0x9d,
+  0xcf, 0x3e, 0xf7, 0x71, 0xba, 0xa7, 0xdd, 0x33, 0x7c, 0x71, 0xd7, 0xdd, 0xe6, 0x86, 0xdb, 0xf4,
+  0xea, 0xda, 0x5c, 0x73, 0x9b, 0x35, 0x6a, 0x63, 0xd4, 0x43, 0x73, 0x36, 0x1f, 0x73, 0xf3, 0x75,
+  0xbd, 0x39, 0x67, 0x66, 0x73, 0xb7, 0xa7, 0x09, 0x7e, 0xe8, 0x13, 0x16, 0xe5, 0x60, 0x17, 0xbf,
+  0x84, 0x3a, 0xbd, 0x91, 0x9d, 0x7a, 0xcb, 0xbe, 0x4a, 0x6e, 0x5c, 0xa4, 0x90, 0x0e, 0xf6, 0x74,
+  0xb7, 0xfa, 0x7d, 0x16, 0x5d, 0x70, 0xa3, 0x16, 0xb2, 0xa3, 0x3f, 0xa2, 0x19, 0xa7, 0x9f, 0xcd,
+  0x38, 0x89, 0x88, 0x54, 0x33, 0xfa, 0x34, 0x1b, 0x85, 0x4a, 0xb3, 0x2f, 0x78, 0x65, 0x5d, 0x64,
+  0xb1, 0xcb, 0x8d, 0xda, 0x6f, 0xb3, 0x46, 0xd3, 0x13, 0x5f, 0x55, 0xee, 0x0e, 0x5f, 0x35, 0xa8,
+  0x30, 0x03, 0x10, 0xc3, 0x3e, 0xb3, 0xd0, 0xd6, 0x32, 0xd1, 0x6a, 0xcc, 0xac, 0x89, 0x7f, 0x6e,
+  0xc9, 0x2f, 0xd7, 0x74, 0xdc, 0xcb, 0x07, 0xb4, 0x12, 0xa8, 0xff, 0xe4, 0xef, 0x63, 0xfb, 0xd9,
+  0x1b, 0xaf, 0xba, 0x9d, 0x93, 0x86, 0x68, 0x9c, 0x9f, 0xda, 0xdf, 0xc5, 0x51, 0xdf, 0x7b, 0x6a,
+  0x54, 0x6f, 0x71, 0x9e, 0x33, 0xa4, 0x4e, 0xd0, 0x30, 0xec, 0x42, 0x03, 0x65, 0x12, 0x72, 0x8a,
+  0x4e, 0xd9, 0x67, 0xb3, 0xb2, 0x0c, 0xea, 0xa9, 0x19, 0x33, 0x4e, 0x2f, 0xc5, 0x1b, 0xbd, 0xb4,
+  0x84, 0xd6, 0xda, 0xc2, 0xd5, 0x60, 0x09, 0xe5, 0xc7, 0xe0, 0x2b, 0x6e, 0x83, 0x66, 0x69, 0x40,
+  0x7c, 0xbb, 0x8a, 0xab, 0xc0, 0xcf, 0x9f, 0xc5, 0x8f, 0x30, 0x1f, 0xfe, 0x7c, 0x83, 0x9f, 0x6f,
+  0xf8, 0xf3, 0xb5, 0xf6, 0xfb, 0x98, 0x7e, 0x77, 0xf8, 0xf0, 0x3c, 0xa4, 0xb9, 0x60, 0x9e, 0x63,
+  0xd7, 0x81, 0x82, 0xca, 0xb6, 0x3c, 0x4d, 0xfe, 0x88, 0xca, 0x19, 0x79, 0xf3, 0xbd, 0x61, 0x63,
+  0x54, 0xfb, 0xb2, 0x2d, 0x76, 0x4b, 0xac, 0x6d, 0xd6, 0xc0, 0xa3, 0xd9, 0x7f, 0xd3, 0xe0, 0xeb,
+  0x13, 0xc7, 0x55, 0x54, 0xc9, 0xa5, 0x2a, 0xf4, 0x3f, 0x48, 0x0f, 0xd2, 0x6f, 0xb9, 0x78, 0x37,
+  0xd7, 0xa4, 0xc3, 0xcb, 0xc3, 0x69, 0x30, 0x43, 0x36, 0xb8, 0xc2, 0x0b, 0xd8, 0x94, 0x93, 0x85,
+  0x1f, 0x7b, 0xea, 0xc7, 0x9b, 0xa6, 0xc4, 0xc6, 0x0c, 0x98, 0xf2, 0x99, 0x57, 0xe6, 0xdd, 0xe5,
+  0x68, 0x16, 0x16, 0x30, 0x71, 0xc3, 0x60, 0x05, 0xcf, 0x94, 0x7d, 0xd7, 0x30, 0x9c, 0x0a, 0x25,
+  0xac, 0x3c, 0x9a, 0x4c, 0x32, 0x2d, 0xaf, 0x6d, 0x29, 0xe9, 0x19, 0x3a, 0x44, 0xcc, 0xd8, 0x92,
+  0x29, 0x45, 0x3e, 0x25, 0xdd, 0x26, 0x41, 0x70, 0x94, 0x4c, 0x26, 0xc9, 0xb5, 0x11, 0xf1, 0x67,
+  0xba, 0x12, 0x57, 0xcc, 0x6f, 0x97, 0x96, 0xe5, 0xcd, 0x95, 0xcf, 0x09, 0x66, 0xa8, 0x98, 0x9b,
+  0x5b, 0x08, 0xd2, 0x5b, 0x38, 0x65, 0xa0, 0xb2, 0x78, 0x83, 0xb4, 0x20, 0x30, 0xcf, 0x7b, 0x5e,
+  0xc8, 0x85, 0xfc, 0xbd, 0x5f, 0x7e, 0xc7, 0xe9, 0xd8, 0x57, 0x1c, 0x6a, 0xe7, 0x74, 0x6f, 0xe6,
+  0x67, 0x74, 0x9a, 0xa0, 0x7f, 0x2d, 0xed, 0x3a, 0xfc, 0xe2, 0x6a, 0x75, 0x49, 0x4d, 0x2e, 0x1d,
+  0x75, 0x2a, 0x7d, 0x8a, 0x3b, 0xc4, 0x9c, 0x52, 0x70, 0x91, 0x5a, 0xab, 0x65, 0xda, 0xca, 0xf8,
+  0xab, 0x76, 0x3e, 0x54, 0x85, 0x27, 0x97, 0x6b, 0x81, 0xe3, 0x75, 0xe4, 0x92, 0x8d, 0x67, 0xa7,
+  0xed, 0xee, 0xe3, 0x4e, 0x17, 0x46, 0xe2, 0x57, 0x82, 0xdb, 0xc1, 0x32, 0xa4, 0x68, 0xa1, 0x0b,
+  0xae, 0x3e, 0xd8, 0xe3, 0x6d, 0x98, 0x8f, 0xb1, 0x4e, 0x1f, 0xf2, 0x35, 0xfa, 0x4c, 0xc9, 0x90,
+  0xe4, 0x3e, 0x5f, 0x41, 0xb0, 0x2a, 0xc6, 0x01, 0x00, 0x36, 0x9d, 0x81, 0x24, 0x37, 0xf5, 0x60,
+  0x6e, 0x2c, 0x30, 0x3d, 0x0f, 0x98, 0x6b, 0x05, 0x86, 0xbb, 0x62, 0x17, 0x2d, 0x84, 0x02, 0xb7,
+  0x5e, 0xdb, 0x1e, 0x8e, 0x0b, 0xcc, 0xb8, 0x1e, 0x4c, 0xcf, 0x06, 0xd3, 0x73, 0x83, 0xe1, 0x34,
+  0x05, 0x18, 0x5a, 0x8c, 0x65, 0x50, 0x7f, 0x8d, 0xa3, 0x6b, 0x0a, 0x6c, 0xdf, 0x49, 0xd3, 0xf0,
+  0xe6, 0xc5, 0x7c, 0x04, 0x9b, 0x27, 0xe8, 0xad, 0xdb, 0x13, 0xc1, 0x80, 0xf7, 0x2c, 0xca, 0x7f,
+  0x01, 0xc6, 0xf1, 0x14, 0x31, 0x71, 0xb2, 0x7f, 0x70, 0xf2, 0xf1, 0xed, 0xf1, 0xeb, 0x8f, 0x78,
+  0x61, 0xfd, 0xf8, 0xe2, 0xf0, 0x1f, 0x56, 0xfb, 0x53, 0x60, 0x20, 0xc0, 0x2e, 0xae, 0x5b, 0x62,
+  0xdc, 0xd2, 0xf8, 0x97, 0xf6, 0xf9, 0xcd, 0x59, 0x91, 0x75, 0x34, 0xb8, 0x6a, 0x89, 0x98, 0xd4,
+  0x18, 0xda, 0x6b, 0x7a, 0x4f, 0x82, 0x1e, 0xe0, 0x77, 0x0d, 0x18, 0x0f, 0xec, 0xe2, 0xab, 0x16,
+  0x6d, 0x3a, 0x07, 0x7e, 0x91, 0x88, 0x8e, 0x93, 0xc1, 0x1f, 0x51, 0xde, 0xc1, 0x7b, 0x28, 0x85,
+  0xe6, 0x9f, 0xd3, 0x34, 0x9a, 0x4b, 0x1d, 0xd0, 0xac, 0x01, 0x86, 0xc3, 0xc0, 0xcd, 0x8b, 0x65,
+  0x45, 0xaa, 0x60, 0x4a, 0x17, 0xc1, 0x8c, 0x46, 0xa9, 0x36, 0xa9, 0xa4, 0xe6, 0xe7, 0xe8, 0xd1,
+  0x8f, 0xcf, 0x6f, 0xfb, 0xa2, 0xfd, 0x49, 0xf4, 0x2b, 0x27, 0x4d, 0xf9, 0xf8, 0xfb, 0x2f, 0x81,
+  0xda, 0xc5, 0xab, 0x25, 0x18, 0x8c, 0x2a, 0x58, 0x7b, 0x6c, 0x3a, 0xc1, 0xff, 0xfc, 0xa2, 0xc5,
+  0xad, 0x2f, 0xf5, 0xa6, 0x15, 0xef, 0xf4, 0x45, 0x47, 0xbe, 0xf3, 0x80, 0x1c, 0x68, 0x9a, 0xd9,
+  0xde, 0x13, 0x8f, 0x66, 0x76, 0xa0, 0x2b, 0x64, 0x61, 0x06, 0x88, 0x88, 0xa0, 0xf1, 0x0a, 0xb8,
+  0x18, 0x73, 0x87, 0x92, 0xab, 0xc1, 0x48, 0xd0, 0x2b, 0x9f, 0x1b, 0xa0, 0x59, 0x56, 0x6f, 0x80,
+  0x6c, 0xae, 0x79, 0xfb, 0x89, 0x4d, 0x16, 0x5a, 0x41, 0xac, 0x8d, 0xee, 0x3d, 0x6b, 0x4e, 0x4a,
+  0x27, 0x54, 0x11, 0x60, 0x71, 0x30, 0x59, 0x57, 0xe1, 0x3e, 0x14, 0x28, 0xb2, 0xf8, 0x18, 0xd5,
+  0x1c, 0x8b, 0x62, 0xca, 0xf3, 0x95, 0x8d, 0x43, 0x79, 0x6a, 0x91, 0x63, 0xbf, 0x74, 0x8c, 0x0d,
+  0xd0, 0xfe, 0x4e, 0xca, 0x14, 0x3c, 0x02, 0x31, 0xb0, 0x94, 0xce, 0x40, 0x4b, 0xeb, 0x41, 0x4e,
+  0x91, 0xec, 0x3e, 0x7b, 0x3d, 0x4e, 0x32, 0xd9, 0xe3, 0x1a, 0x63, 0x40, 0xa3, 0x10, 0x6d, 0x1c,
+  0xe4, 0x27, 0x4d, 0x4a, 0x08, 0x0a, 0x51, 0x3e, 0x4f, 0xd9, 0xbf, 0x3b, 0x8a, 0x0d, 0xdd, 0x28,
+  0x86, 0x0d, 0xd1, 0x11, 0xda, 0xde, 0xdd, 0x79, 0x9b, 0x89, 0xa0, 0xf1, 0x16, 0x8d, 0x39, 0xd2,
+  0xf7, 0x15, 0x6e, 0x7a, 0x62, 0x8f, 0x75, 0x30, 0x3c, 0x34, 0xf4, 0x43, 0x27, 0xf7, 0x80, 0x55,
+  0xc9, 0xd5, 0xcd, 0xdc, 0x68, 0x62, 0x44, 0x19, 0xe9, 0xb8, 0xbe, 0x18, 0x07, 0x26, 0xd1, 0x61,
+  0x5d, 0x66, 0x1e, 0x23, 0xef, 0x1d, 0xf6, 0xed, 0x24, 0xc7, 0x75, 0x9a, 0x2a, 0x7b, 0xbf, 0x1b,
+  0x05, 0xc7, 0x54, 0xf7, 0x9c, 0x6a, 0x69, 0x90, 0x0f, 0x10, 0xdc, 0x9a, 0x71, 0x06, 0x52, 0x12,
+  0x18, 0x69, 0x8e, 0x40, 0x72, 0x70, 0x58, 0x56, 0x21, 0x4a, 0xaf, 0x4c, 0x4c, 0xa1, 0x0e, 0x19,
+  0x91, 0x11, 0x5e, 0x24, 0x7d, 0x54, 0x2e, 0x21, 0x4e, 0x64, 0x7b, 0x19, 0x52, 0x8b, 0x4a, 0xc9,
+  0x2b, 0x0a, 0x9b, 0x02, 0x99, 0x80, 0x2b, 0xc3, 0xe1, 0xa0, 0x43, 0x7e, 0x93, 0x25, 0x4a, 0x4c,
+  0xa5, 0xe7, 0x11, 0x2d, 0x5b, 0x38, 0xa5, 0xf1, 0x17, 0x49, 0xe5, 0x44, 0x32, 0x19, 0x6a, 0x9e,
+  0xf6, 0xac, 0x00, 0x13, 0x68, 0x01, 0xcb, 0x58, 0x95, 0xa5, 0x03, 0xe3, 0xb5, 0x7b, 0x94, 0x61,
+  0x09, 0x67, 0x94, 0x6c, 0x4a, 0x75, 0x34, 0x17, 0x66, 0xc3, 0xaa, 0x68, 0xb0, 0x1e, 0x9a, 0xe7,
+  0x78, 0x93, 0x5c, 0x12, 0x30, 0xf7, 0x6b, 0x32, 0x82, 0x53, 0x56, 0x07, 0x46, 0xb2, 0x92, 0xbe,
+  0x46, 0xca, 0x8f, 0x9f, 0x30, 0xad, 0xaa, 0xaa, 0x61, 0xd7, 0x51, 0x8a, 0xb1, 0x6c, 0xe4, 0x35,
+  0x43, 0x2f, 0x8e, 0x35, 0x55, 0x37, 0x1a, 0xf1, 0x4d, 0x1f, 0x63, 0xc2, 0x84, 0x91, 0x21, 0xb5,
+  0x21, 0x85, 0x27, 0xa1, 0x88, 0x94, 0x06, 0x55, 0x16, 0xd0, 0xd3, 0x81, 0xd1, 0x0a, 0x6b, 0x61,
+  0xae, 0x97, 0x76, 0xaa, 0x38, 0xda, 0x6d, 0x1f, 0x8f, 0xf6, 0x4e, 0x8e, 0x7e, 0x83, 0x63, 0x00,
+  0x23, 0xec, 0xd6, 0x36, 0x60, 0x83, 0x6f, 0x74, 0xbb, 0xac, 0x5d, 0xc6, 0xfd, 0xde, 0xed, 0x72,
+  0x4d, 0x37, 0x54, 0x14, 0xb6, 0x93, 0xd1, 0x48, 0x84, 0xa3, 0x9c, 0x2a, 0xd4, 0xc5, 0x98, 0x80,
+  0x99, 0xe5, 0x43, 0x5b, 0x8d, 0x46, 0xc7, 0xc9, 0xdb, 0x9d, 0x93, 0xdd, 0x37, 0x1f, 0xdf, 0x63,
+  0xd1, 0x93, 0xde, 0x5a, 0x97, 0x60, 0x30, 0x7a, 0x29, 0x7b, 0xc4, 0x88, 0x32, 0x72, 0x50, 0x89,
+  0x7b, 0xd4, 0xc7, 0x0e, 0x05, 0x05, 0xd7, 0xd3, 0x9a, 0x62, 0xe5, 0x39, 0x17, 0xc0, 0x57, 0x87,
+  0x47, 0xaf, 0xf7, 0x4e, 0x78, 0xa0, 0x14, 0xc0, 0xc5, 0x84, 0x2a, 0x37, 0x21, 0xcc, 0x35, 0x8a,
+  0xb8, 0x33, 0x11, 0x9d, 0x24, 0xdd, 0x70, 0x7a, 0xc3, 0x22, 0x69, 0x09, 0x11, 0x73, 0x38, 0xca,
+  0x1d, 0xc6, 0x95, 0x56, 0x5c, 0x47, 0x46, 0x3a, 0x1f, 0xe4, 0x49, 0x1a, 0xc4, 0x33, 0x15, 0xd7,
+  0xe9, 0x0c, 0x94, 0x82, 0x97, 0x75, 0x62, 0x54, 0x2a, 0xc5, 0xb3, 0x4d, 0xf7, 0x53, 0x55, 0x08,
+  0x46, 0x42, 0xf1, 0xb5, 0x2a, 0x53, 0xaa, 0xa9, 0x3c, 0x6d, 0x2a, 0xcc, 0x9c, 0xf7, 0x5b, 0xb1,
+  0xfb, 0x64, 0x39, 0x1b, 0xb3, 0x90, 0xa6, 0x01, 0x6b, 0x24, 0xef, 0xb8, 0xfe, 0x1c, 0xe5, 0xdc,
+  0x0c, 0x16, 0x70, 0x9e, 0xba, 0xc2, 0x83, 0x8a, 0x26, 0x64, 0xf5, 0x20, 0x2d, 0x9b, 0xaf, 0x05,
+  0xef, 0x77, 0xd9, 0x04, 0x47, 0x5d, 0xf8, 0x89, 0xf1, 0xa6, 0x64, 0x16, 0x98, 0x24, 0x7f, 0x10,
+  0xb9, 0x26, 0xbc, 0xe8, 0x7c, 0x08, 0x7a, 0x90, 0x39, 0x05, 0xe2, 0xba, 0x0a, 0x27, 0x32, 0x26,
+  0x89, 0x88, 0xe6, 0x32, 0xc1, 0x6a, 0x9a, 0x43, 0xd6, 0xe7, 0x9e, 0x47, 0xf9, 0x35, 0xaf, 0x33,
+  0xf0, 0xdc, 0x56, 0x81, 0x8f, 0xd1, 0xcc, 0x03, 0x90, 0xbc, 0xfa, 0xbd, 0x89, 0xc2, 0x6d, 0x2b,
+  0x10, 0x39, 0x8e, 0x65, 0xe5, 0x6d, 0x85, 0x70, 0xa9, 0x32, 0x3f, 0x24, 0xb4, 0x5d, 0x35, 0x36,
+  0x0b, 0xef, 0x0e, 0xb5, 0xf5, 0xc9, 0xac, 0x12, 0xd7, 0x93, 0x6a, 0xae, 0x92, 0x22, 0x00, 0x40,
+  0x1b, 0x1a, 0xa6, 0x95, 0x33, 0xd6, 0x4d, 0xfd, 0x50, 0xe4, 0x4a, 0xf2, 0xe5, 0x0b, 0x53, 0x81,
+  0x7d, 0x66, 0xec, 0xed, 0x33, 0x63, 0xf1, 0xfc, 0xbd, 0x6d, 0x62, 0xf1, 0x94, 0xeb, 0x28, 0x5a,
+  0x61, 0x82, 0xf9, 0x78, 0x8a, 0xae, 0x34, 0xd2, 0x5a, 0xe5, 0xa4, 0xb6, 0x7a, 0x43, 0xae, 0x54,
+  0x6d, 0x33, 0x38, 0x7f, 0x5c, 0x7c, 0x34, 0xcd, 0x97, 0x55, 0xee, 0x2e, 0x4a, 0x4b, 0x57, 0xa7,
+  0xba, 0x96, 0xdb, 0xf7, 0x56, 0x1d, 0xa6, 0x77, 0x50, 0x5c, 0x97, 0xba, 0x8e, 0x28, 0xeb, 0x24,
+  0x7f, 0x34, 0x89, 0xe1, 0x5f, 0x8b, 0x32, 0xb7, 0xd4, 0xa7, 0x37, 0x27, 0x27, 0xef, 0x41, 0x9e,
+  0xc2, 0xe7, 0x5c, 0x75, 0xe5, 0xf6, 0x53, 0xb3, 0x2e, 0x9f, 0xd8, 0x42, 0xfd, 0xb4, 0xad, 0x1e,
+  0xf7, 0x40, 0x03, 0x2a, 0xde, 0xd3, 0x4e, 0xa3, 0x31, 0x99, 0x55, 0xa9, 0xc2, 0x0c, 0x7b, 0x4a,
+  0xf6, 0x89, 0x31, 0xf2, 0x1e, 0x8d, 0x87, 0x43, 0x36, 0xec, 0x70, 0xf6, 0x54, 0x32, 0xb2, 0xd7,
+  0x0c, 0x51, 0x77, 0xe6, 0x0c, 0xe4, 0x22, 0xad, 0x38, 0x2e, 0x91, 0x68, 0xd0, 0xf7, 0xa3, 0x4c,
+  0xa3, 0xfd, 0x3a, 0x37, 0x22, 0xa9, 0x96, 0xa5, 0x86, 0x41, 0xb3, 0x2e, 0xab, 0x99, 0x9b, 0xbc,
+  0xdd, 0x4e, 0x1c, 0x0e, 0x8e, 0xfb, 0xa5, 0xc8, 0x28, 0x52, 0xce, 0xcf, 0x93, 0x45, 0x6d, 0x09,
+  0xc6, 0xb9, 0x38, 0x8f, 0xa0, 0xc5, 0x5a, 0xab, 0x1b, 0x78, 0xc5, 0x3b, 0x57, 0xf3, 0xbc, 0x3e,
+  0xe5, 0x4b, 0x6d, 0x3c, 0x0d, 0x8c, 0x71, 0xad, 0xac, 0xb4, 0xac, 0x86, 0xea, 0xda, 0xde, 0x16,
+  0xbd, 0xe6, 0xd9, 0xc2, 0x92, 0x15, 0xe6, 0x8e, 0x45, 0x62, 0xa9, 0xd9, 0xaa, 0xca, 0xca, 0xa0,
+  0xe3, 0x74, 0xb9, 0x33, 0xce, 0x03, 0x10, 0xc3, 0x0f, 0x97, 0xda, 0xf8, 0x05, 0x29, 0xa9, 0x33,
+  0xa8, 0x59, 0x39, 0x41, 0x56, 0x80, 0x4c, 0x65, 0x0c, 0xb8, 0xd5, 0xb2, 0x6d, 0xb7, 0x45, 0xcd,
+  0x58, 0xb7, 0xb3, 0xb6, 0xf8, 0x98, 0xab, 0xc4, 0x3a, 0x6a, 0x4a, 0x39, 0x97, 0xee, 0xfa, 0x41,
+  0x35, 0xc6, 0x2c, 0xf0, 0x8a, 0x12, 0xc5, 0x61, 0xe5, 0xe6, 0xc5, 0xc5, 0x94, 0x8b, 0x93, 0x41,
+  0xff, 0xd6, 0x59, 0xb4, 0x63, 0x16, 0xae, 0x82, 0x53, 0xff, 0x49, 0x65, 0x8e, 0x51, 0xbc, 0x64,
+  0x59, 0x29, 0xb3, 0xf2, 0x30, 0x14, 0x8f, 0x7f, 0x8e, 0x6e, 0xa4, 0xc5, 0xbd, 0x7a, 0x49, 0x2f,
+  0xe3, 0x04, 0xed, 0x72, 0x02, 0x8c, 0x38, 0xa3, 0xc8, 0x21, 0x5b, 0x12, 0xa5, 0xb5, 0x6b, 0xf5,
+  0xf4, 0xbf, 0xb3, 0xd6, 0xd9, 0xca, 0x2a, 0x9e, 0x3d, 0xe8, 0x98, 0x1e, 0xc4, 0xa4, 0xeb, 0x8c,
+  0x67, 0xba, 0xe6, 0xcb, 0x77, 0x05, 0xe5, 0x1b, 0x9f, 0xe8, 0x29, 0xe9, 0x5e, 0xbb, 0xe4, 0xb5,
+  0x38, 0x2b, 0x08, 0x1e, 0xe9, 0x52, 0x42, 0x43, 0x43, 0x31, 0x1c, 0xf9, 0x74, 0x2f, 0xc1, 0x16,
+  0x9e, 0x59, 0x14, 0x51, 0x89, 0xee, 0x9c, 0x70, 0x33, 0xc2, 0x8f, 0x61, 0x13, 0x6d, 0x61, 0xce,
+  0xb5, 0x12, 0x03, 0x67, 0xcb, 0x64, 0x62, 0x29, 0xdc, 0x99, 0x49, 0xb4, 0xcc, 0x3a, 0xbf, 0x27,
+  0xb0, 0xcb, 0xd1, 0xf2, 0x57, 0xd5, 0x06, 0x62, 0x23, 0x74, 0xa3, 0x57, 0x8b, 0xe0, 0x22, 0x2e,
+  0x7d, 0xfd, 0x0a, 0x7d, 0x8d, 0x4a, 0xd8, 0xba, 0x2d, 0x53, 0xb7, 0x2a, 0xc2, 0x71, 0x50, 0x8e,
+  0xb5, 0xfe, 0x38, 0x22, 0x3c, 0x91, 0x48, 0x3a, 0x66, 0x95, 0x0f, 0x1e, 0x7c, 0xba, 0x48, 0xad,
+  0x09, 0xce, 0xd9, 0x69, 0x7c, 0xe6, 0x05, 0xca, 0x54, 0x03, 0x73, 0xd8, 0xfc, 0x7f, 0xe4, 0x15,
+  0x77, 0xeb, 0xa5, 0x47, 0x39, 0xdf, 0x7a, 0xf5, 0x93, 0x1e, 0x34, 0x6a, 0x67, 0xbc, 0xf8, 0x06,
+  0xa4, 0xd7, 0x6c, 0x38, 0x0b, 0x75, 0x8d, 0x86, 0x8f, 0xfa, 0x0f, 0x8b, 0xab, 0xbd, 0x3c, 0xe0,
+  0x27, 0x51, 0x28, 0xad, 0xe7, 0xd3, 0x1c, 0x6e, 0xa5, 0xcc, 0xd4, 0x8a, 0xfd, 0x00, 0xb4, 0x84,
+  0x77, 0x25, 0x94, 0x17, 0x60, 0x57, 0xd4, 0x46, 0x2d, 0xf3, 0x7c, 0x79, 0x02, 0x15, 0x55, 0x7c,
+  0xb6, 0x68, 0xc6, 0x2c, 0x18, 0x5b, 0x13, 0x46, 0x36, 0x32, 0xe5, 0x0c, 0x09, 0x55, 0xbe, 0x84,
+  0x42, 0x7e, 0x60, 0x64, 0x19, 0x46, 0x5f, 0x14, 0xf7, 0xeb, 0x0b, 0x6f, 0x65, 0xf9, 0x32, 0xc9,
+  0xee, 0x7e, 0xf8, 0x01, 0x64, 0x35, 0x7a, 0x01, 0x48, 0xd7, 0xf2, 0x59, 0xc1, 0xd5, 0x9f, 0xd1,
+  0xab, 0xcb, 0xe3, 0xa1, 0xa9, 0x86, 0xc2, 0x0d, 0x6b, 0x4d, 0x8a, 0x23, 0x09, 0xd7, 0x35, 0x8e,
+  0xda, 0xe2, 0x5f, 0x9a, 0xf3, 0x57, 0x91, 0xd4, 0x71, 0xa3, 0xf9, 0x75, 0x91, 0xcb, 0x32, 0x3c,
+  0xca, 0x21, 0xc7, 0x90, 0x8e, 0x18, 0xe6, 0xc6, 0xc7, 0xb8, 0x33, 0x76, 0x5c, 0x5d, 0x50, 0xa9,
+  0x9d, 0xeb, 0x96, 0x7a, 0x6f, 0xa1, 0x5c, 0x5f, 0x11, 0xc6, 0x65, 0x26, 0x7b, 0x73, 0xdd, 0x30,
+  0x96, 0x09, 0x9f, 0x32, 0xcb, 0x7d, 0x98, 0xe1, 0x3e, 0xd2, 0x51, 0xd3, 0x19, 0x3b, 0x53, 0xdc,
+  0xfd, 0x97, 0x37, 0xc2, 0xd8, 0xb1, 0x1f, 0xde, 0xd0, 0x11, 0xf7, 0x6b, 0x1e, 0xd4, 0x88, 0xf2,
+  0x71, 0x51, 0x2b, 0x52, 0xfc, 0x39, 0x87, 0x2d, 0x88, 0x61, 0x5a, 0xbc, 0xb3, 0x89, 0xfb, 0x09,
+  0x2a, 0xee, 0xee, 0x40, 0x78, 0x1e, 0x4f, 0xa2, 0x0f, 0xa6, 0x2d, 0x72, 0x6d, 0xd3, 0xd3, 0xee,
+  0x8d, 0x69, 0x85, 0x5c, 0xf3, 0x99, 0x65, 0x64, 0x81, 0xdb, 0x0e, 0xe6, 0xe5, 0xf8, 0x2c, 0xfe,
+  0x26, 0xd6, 0x50, 0x80, 0xa2, 0x17, 0xd5, 0x5a, 0x60, 0x46, 0x93, 0x04, 0xee, 0x46, 0x46, 0xdf,
+  0xd5, 0xb2, 0xaf, 0x65, 0xea, 0xac, 0x8d, 0x5a, 0x75, 0x04, 0xa3, 0xa2, 0xb1, 0xc2, 0xd7, 0x8a,
+  0xa3, 0x4f, 0x19, 0x13, 0xab, 0xa6, 0x9f, 0x88, 0x9c, 0xf7, 0xaa, 0xe9, 0x08, 0xe2, 0x03, 0x54,
+  0xda, 0xcc, 0x15, 0x69, 0x76, 0xab, 0xc1, 0xaf, 0x75, 0x04, 0x82, 0x00, 0x58, 0x30, 0x41, 0x0a,
+  0xd7, 0x3c, 0xd1, 0x6b, 0x28, 0xc5, 0x49, 0x85, 0x8b, 0x1c, 0xea, 0x6d, 0x71, 0xf0, 0xc1, 0xc2,
+  0xc3, 0x95, 0x93, 0xf1, 0x7e, 0xdc, 0x3d, 0x3c, 0x38, 0x3c, 0x3a, 0x3e, 0xd5, 0x57, 0xe9, 0xcc,
+  0xf3, 0x6a, 0x23, 0x74, 0xa5, 0xf7, 0xd4, 0x67, 0x84, 0xe0, 0xab, 0x02, 0xc9, 0x46, 0x53, 0xae,
+  0x3d, 0x5a, 0xc8, 0xe8, 0xdb, 0xca, 0xf4, 0x12, 0xa0, 0x4a, 0x0f, 0x56, 0xc1, 0x6a, 0xe0, 0x48,
+  0x2a, 0x04, 0xcc, 0xa5, 0xdd, 0xd8, 0x7c, 0x50, 0xef, 0x7c, 0xfe, 0xe9, 0xfd, 0xf7, 0x5f, 0x0c,
+  0x3a, 0x5b, 0x11, 0x3d, 0xcc, 0x21, 0xe4, 0x5e, 0x16, 0x18, 0x02, 0x0e, 0x0f, 0x20, 0xcb, 0x58,
+  0x9a, 0x06, 0x1a, 0x3b, 0xa8, 0x13, 0x2c, 0x2f, 0x5a, 0x08, 0xd7, 0x1e, 0xdb, 0x29, 0x4c, 0xbc,
+  0xe7, 0x5c, 0xed, 0x81, 0x54, 0x1c, 0x3a, 0xe5, 0x39, 0xa4, 0x54, 0x28, 0x7e, 0x55, 0x8d, 0xe6,
+  0x50, 0x50, 0x1c, 0x6c, 0xcb, 0xed, 0x3f, 0xcb, 0xc1, 0x40, 0xdb, 0x84, 0x2e, 0x38, 0xfe, 0xbd,
+  0x78, 0x0f, 0x02, 0x19, 0x7a, 0x23, 0xa0, 0xf3, 0x01, 0x8d, 0x52, 0xee, 0xba, 0xfb, 0x0b, 0x51,
+  0xd0, 0xd7, 0xdd, 0x35, 0x35, 0x5a, 0xfe, 0x22, 0x20, 0x01, 0x16, 0x37, 0x53, 0xab, 0x9b, 0x39,
+  0x97, 0xd7, 0x9f, 0x02, 0xf9, 0x50, 0x8b, 0xce, 0xcc, 0xf4, 0xf0, 0xcd, 0x3e, 0xc8, 0xb1, 0xd1,
+  0x4c, 0x7a, 0xb9, 0xf3, 0xa9, 0x2a, 0x2f, 0x1e, 0xa4, 0xf2, 0x96, 0x66, 0x21, 0x1d, 0x54, 0xe1,
+  0x35, 0x11, 0xa7, 0x19, 0x9a, 0x8e, 0xd8, 0xf2, 0x81, 0x49, 0x72, 0x49, 0x6a, 0x90, 0x29, 0xe7,
+  0x12, 0x34, 0x1a, 0xa8, 0x7b, 0x4a, 0xc6, 0x99, 0x0c, 0x73, 0xa3, 0x2a, 0x4e, 0xca, 0x56, 0x9f,
+  0x4c, 0x90, 0x0a, 0x1c, 0xfd, 0xa3, 0xa9, 0x3a, 0x45, 0x55, 0x5c, 0x5d, 0x22, 0x5c, 0xd4, 0x79,
+  0xaf, 0x59, 0xea, 0x56, 0x2e, 0x73, 0x9a, 0x03, 0x48, 0x94, 0x70, 0x8a, 0x92, 0xe8, 0x4b, 0x5c,
+  0x77, 0xb8, 0x8f, 0xa3, 0x78, 0xba, 0x7b, 0x2b, 0xc9, 0xb4, 0x6e, 0xbc, 0xbc, 0x38, 0xe5, 0x1d,
+  0x4c, 0x77, 0x63, 0xda, 0x08, 0x9a, 0xae, 0xc2, 0xeb, 0xfe, 0x25, 0xd6, 0xd8, 0x94, 0x4c, 0x3b,
+  0xa9, 0x33, 0x0a, 0xf2, 0xb1, 0x29, 0xbe, 0xbb, 0x07, 0x66, 0x64, 0x2a, 0x2c, 0x1b, 0xd7, 0x06,
+  0x8b, 0x6a, 0xe7, 0x69, 0x91, 0xcb, 0x90, 0x7d, 0x78, 0x8a, 0xe4, 0x85, 0xe8, 0x46, 0xe0, 0xd6,
+  0xa7, 0x39, 0x92, 0x32, 0xb6, 0xd0, 0x77, 0xb3, 0x4c, 0x90, 0xf0, 0xbc, 0x3c, 0xf2, 0xdb, 0xf0,
+  0x96, 0xbe, 0xf8, 0xac, 0x16, 0x81, 0xe3, 0x53, 0x2a, 0x39, 0x3b, 0xdd, 0x29, 0x83, 0x67, 0x21,
+  0x92, 0x67, 0xf5, 0x16, 0xc2, 0xe9, 0x2f, 0xd5, 0xa2, 0xa9, 0x64, 0x97, 0x77, 0x58, 0x4b, 0x06,
+  0x8f, 0xe5, 0x6c, 0x42, 0x4e, 0x7c, 0x66, 0x2e, 0x59, 0x99, 0x97, 0x6a, 0x7f, 0x3a, 0xc2, 0x2a,
+  0xf1, 0x37, 0x30, 0x05, 0xe2, 0x60, 0xe1, 0x79, 0xc6, 0xd9, 0x32, 0x3f, 0x97, 0x74, 0x40, 0x9d,
+  0x3c, 0x7a, 0xa2, 0xe2, 0x15, 0xcf, 0x4c, 0xd3, 0x54, 0x93, 0xe7, 0xd6, 0xc1, 0xe4, 0x36, 0xc1,
+  0x17, 0x69, 0x4e, 0x63, 0x78, 0xad, 0x72, 0x5c, 0xd5, 0x5c, 0xf4, 0x95, 0xdb, 0x1a, 0x02, 0xc9,
+  0x92, 0x34, 0x0f, 0x02, 0x60, 0x0a, 0xe7, 0x74, 0x23, 0x0e, 0x3b, 0x05, 0x80, 0xb6, 0x38, 0x2f,
+  0xbe, 0x38, 0x69, 0x0e, 0xa5, 0xf3, 0xa9, 0x74, 0xe7, 0x38, 0x8e, 0x2a, 0x59, 0x72, 0xb4, 0xfb,
+  0x8f, 0x39, 0x48, 0x2c, 0xdd, 0x33, 0xe2, 0xd7, 0xfb, 0xee, 0x41, 0x84, 0x26, 0xd9, 0x1a, 0x0d,
+  0x0b, 0xf8, 0xa6, 0x0e, 0x5c, 0xf2, 0xe4, 0xc2, 0xc0, 0x5d, 0x07, 0xbd, 0x2f, 0xe2, 0xa9, 0x4b,
+  0xdf, 0xa4, 0xf7, 0xad, 0x31, 0x60, 0x11, 0x48, 0xac, 0x87, 0xe6, 0x14, 0x53, 0x6e, 0x9d, 0xb9,
+  0xc8, 0x22, 0x5c, 0x6e, 0x45, 0x2a, 0xac, 0xd9, 0x29, 0x29, 0xe5, 0x61, 0x75, 0x94, 0x4e, 0xca,
+  0xe3, 0x7e, 0x8a, 0xf0, 0x1e, 0x6a, 0xc3, 0x6d, 0x56, 0x57, 0xe3, 0x33, 0x2d, 0xc3, 0xe7, 0x6a,
+  0x98, 0x77, 0x85, 0x82, 0xcd, 0x69, 0xe3, 0x58, 0x3b, 0xd9, 0x38, 0x1e, 0x61, 0xb5, 0x58, 0xc0,
+  0x20, 0x92, 0xa4, 0xbd, 0x4f, 0xb4, 0x05, 0x22, 0x20, 0xb0, 0x28, 0x34, 0x44, 0xdf, 0xa2, 0x18,
+  0x43, 0x5d, 0x6e, 0x01, 0x0a, 0x3e, 0xc6, 0x74, 0x5f, 0x9f, 0xdc, 0xc0, 0x7d, 0xc7, 0x39, 0x65,
+  0x70, 0x05, 0xb7, 0x38, 0x33, 0xae, 0x20, 0xfa, 0x90, 0x1c, 0xca, 0x1a, 0xeb, 0x5a, 0x63, 0x81,
+  0xf2, 0xdd, 0x6b, 0xea, 0x81, 0x7a, 0x45, 0xe1, 0x5a, 0xe8, 0x5e, 0x90, 0xf7, 0x5b, 0x07, 0xef,
+  0xf5, 0xc1, 0xce, 0xf1, 0x71, 0xfb, 0xe4, 0xb0, 0x7d, 0xb0, 0xf3, 0x6e, 0x4f, 0x1c, 0xec, 0x9c,
+  0xec, 0xbd, 0xdb, 0xfd, 0xed, 0x1e, 0xdc, 0x50, 0x54, 0x5d, 0xba, 0x30, 0x4d, 0x6f, 0xf8, 0xe8,
+  0x37, 0x33, 0x6d, 0x48, 0x91, 0x81, 0x7c, 0x42, 0x1e, 0x65, 0x6c, 0xb3, 0x11, 0x81, 0xee, 0xfa,
+  0xdd, 0x32, 0xfc, 0x47, 0x52, 0x15, 0x51, 0x83, 0x4c, 0x4c, 0x25, 0x0b, 0x9c, 0xcf, 0x86, 0x70,
+  0x23, 0x6a, 0x76, 0x30, 0x97, 0xd7, 0x25, 0x9a, 0x76, 0x26, 0x94, 0x5c, 0x81, 0x33, 0x99, 0x13,
+  0x44, 0x90, 0x2a, 0x40, 0x4a, 0xca, 0xfa, 0x86, 0x57, 0xcb, 0x18, 0xb3, 0x9b, 0xb3, 0x03, 0x02,
+  0x76, 0xc3, 0x3c, 0xf7, 0xc4, 0x99, 0xa0, 0xf1, 0x39, 0x7a, 0x88, 0x28, 0xab, 0x11, 0xb9, 0x9e,
+  0xaa, 0xcb, 0x27, 0xba, 0x74, 0xa0, 0x87, 0x47, 0x32, 0x32, 0x1d, 0x48, 0x46, 0xc0, 0xcc, 0xb8,
+  0x72, 0x61, 0x9e, 0xc6, 0xb3, 0x32, 0x9f, 0x03, 0x07, 0xe2, 0x01, 0xec, 0x10, 0x73, 0x57, 0xa3,
+  0x47, 0x5c, 0x38, 0x19, 0xf1, 0xd0, 0xca, 0xe6, 0xb6, 0xa7, 0xc2, 0xee, 0xc1, 0xe1, 0xee, 0xcf,
+  0x1f, 0x8f, 0x7f, 0x7b, 0xb7, 0xfb, 0x71, 0xef, 0xd7, 0x3d, 0xe5, 0xae, 0xb0, 0xde, 0x35, 0xf2,
+  0xb8, 0xa2, 0x12, 0x49, 0xcf, 0x06, 0x62, 0x58, 0xd3, 0x69, 0x5a, 0x97, 0x99, 0xcc, 0x07, 0x6b,
+  0x88, 0x31, 0x55, 0x00, 0x47, 0xb9, 0x65, 0xf5, 0xc6, 0x27, 0xa3, 0x38, 0xbd, 0xbc, 0xc6, 0x42,
+  0xa6, 0xf3, 0x78, 0x32, 0x74, 0x44, 0x22, 0xa2, 0xb1, 0x9b, 0xb2, 0x63, 0x1d, 0xa3, 0xca, 0x6c,
+  0x4b, 0xb4, 0xd5, 0xb1, 0x65, 0x47, 0x32, 0xe1, 0x73, 0x90, 0xf7, 0xa9, 0xad, 0x23, 0x94, 0xc9,
+  0x52, 0xb9, 0x69, 0x49, 0xb7, 0xbe, 0x5e, 0x36, 0xe3, 0x30, 0x21, 0xe3, 0xc5, 0xc8, 0xcb, 0x8a,
+  0x5c, 0x8f, 0xe5, 0xb8, 0x9f, 0xb9, 0x70, 0xed, 0x0b, 0x2a, 0xb2, 0x66, 0x52, 0x35, 0x5b, 0xd8,
+  0x38, 0xa9, 0x98, 0x4f, 0x10, 0x23, 0xe7, 0x48, 0x3e, 0x2e, 0x09, 0xcd, 0x6d, 0xdc, 0x25, 0x6e,
+  0x4b, 0x98, 0x64, 0x1f, 0x81, 0x18, 0xc6, 0xfc, 0x14, 0xfe, 0xac, 0xac, 0x34, 0x6b, 0x4d, 0xc1,
+  0x79, 0x77, 0x39, 0xcb, 0xd2, 0x57, 0xc5, 0x3d, 0xe1, 0x86, 0xb9, 0xa3, 0xfd, 0x58, 0x69, 0x5d,
+  0xc8, 0x80, 0x56, 0x5a, 0x77, 0x7f, 0xc7, 0x18, 0xf2, 0xfa, 0x2e, 0xbd, 0xe5, 0x27, 0x42, 0xc7,
+  0x0d, 0x21, 0x18, 0x4f, 0xff, 0x1e, 0x5a, 0xbe, 0xba, 0x80, 0x2f, 0xfc, 0xa5, 0x93, 0xe6, 0x79,
+  0xad, 0x05, 0x96, 0x97, 0xe5, 0x8b, 0x80, 0x76, 0x7d, 0xd5, 0xb7, 0x05, 0xfb, 0x1c, 0x37, 0x57,
+  0x9f, 0x06, 0xde, 0xa1, 0x0d, 0x15, 0x00, 0xc8, 0x15, 0x68, 0x40, 0x82, 0x2a, 0x9c, 0xb8, 0xb8,
+  0x3f, 0xe4, 0x73, 0xfa, 0xec, 0x33, 0xa7, 0xde, 0x2e, 0x32, 0x45, 0xd6, 0xda, 0x52, 0xfd, 0xdb,
+  0x8d, 0x78, 0x19, 0x90, 0x0e, 0x27, 0xf1, 0x60, 0x47, 0x0e, 0xc3, 0x97, 0xcc, 0xad, 0xc7, 0xc5,
+  0xf9, 0x3a, 0x2d, 0x9d, 0x06, 0x4b, 0x21, 0xcc, 0x31, 0x0e, 0x36, 0xdd, 0x4d, 0x99, 0x79, 0x28,
+  0x0c, 0x3b, 0x4e, 0x75, 0x8b, 0x8f, 0x50, 0x4b, 0x42, 0x54, 0x7d, 0xf0, 0x8a, 0x9b, 0x6d, 0xb8,
+  0xcf, 0xbc, 0x03, 0x54, 0xf5, 0xcb, 0x43, 0xeb, 0xe3, 0xf1, 0xce, 0xdb, 0xf7, 0x07, 0x7b, 0xc7,
+  0x2a, 0xf6, 0x91, 0x12, 0x7f, 0x82, 0x18, 0x2d, 0xd8, 0x4b, 0xbc, 0xaf, 0x7e, 0x57, 0xbe, 0xfe,
+  0x32, 0xab, 0xad, 0x79, 0x32, 0x94, 0x69, 0x69, 0xd9, 0xb3, 0x07, 0x6f, 0xae, 0x65, 0xde, 0xc5,
+  0x3e, 0x39, 0xb3, 0x65, 0xe8, 0xb4, 0x14, 0x73, 0x35, 0xa0, 0xf2, 0x10, 0x6b, 0x76, 0xec, 0x30,
+  0x56, 0x8e, 0xf7, 0xe6, 0x40, 0x5d, 0xad, 0xb0, 0x46, 0x19, 0x99, 0x04, 0x3b, 0x61, 0x4c, 0xc9,
+  0xf9, 0xb9, 0x3c, 0x4c, 0x0a, 0x5f, 0x65, 0x1c, 0x94, 0x75, 0x2c, 0xd8, 0x33, 0xdc, 0x42, 0xdf,
+  0x35, 0xbb, 0x6e, 0xe7, 0x84, 0x7d, 0xe2, 0x8f, 0xc3, 0xcb, 0xd9, 0x24, 0xe2, 0xf4, 0xeb, 0x30,
+  0x6f, 0xae, 0xad, 0xc1, 0xe3, 0xc7, 0xcf, 0x46, 0x08, 0x26, 0x56, 0xff, 0x98, 0x70, 0x04, 0x29,
+  0x39, 0xfc, 0x54, 0x8d, 0xf4, 0x40, 0xf8, 0xd1, 0xe7, 0x01, 0x86, 0x78, 0x95, 0xb9, 0xa8, 0x02,
+  0x79, 0xca, 0x10, 0x15, 0x34, 0xdd, 0xa1, 0x0d, 0xca, 0x41, 0x1f, 0x17, 0xa0, 0x25, 0x74, 0xdf,
+  0x7c, 0xcd, 0x2f, 0x5f, 0xa2, 0x71, 0x27, 0x77, 0xc5, 0x39, 0x18, 0xe4, 0xa8, 0xee, 0x48, 0xe8,
+  0x8b, 0x1f, 0x18, 0xd9, 0xb3, 0x6a, 0xbd, 0xf1, 0x65, 0x4b, 0xa4, 0x3e, 0x4f, 0x2a, 0x2d, 0x67,
+  0x60, 0x44, 0x81, 0x41, 0x13, 0xa5, 0xa7, 0x38, 0x19, 0xeb, 0x72, 0x28, 0xdb, 0xca, 0xab, 0x55,
+  0x35, 0xe9, 0x19, 0x67, 0x46, 0xed, 0xeb, 0xc1, 0x9c, 0xed, 0x62, 0x58, 0x14, 0x3f, 0x27, 0xbf,
+  0xb4, 0xc4, 0x9f, 0xf3, 0x68, 0x1e, 0xc9, 0x34, 0xe7, 0x05, 0x55, 0xb5, 0xc4, 0x87, 0xf8, 0x55,
+  0x5c, 0x15, 0x29, 0x09, 0x73, 0xfd, 0x12, 0x83, 0x00, 0x55, 0xc7, 0x6c, 0xe1, 0x58, 0x47, 0x54,
+  0x5e, 0xa6, 0x6c, 0xae, 0xde, 0x6a, 0x92, 0x3c, 0x9c, 0x98, 0x70, 0x8a, 0xd1, 0xd5, 0x6a, 0x11,
+  0x48, 0xd7, 0x27, 0x27, 0x5f, 0x28, 0x18, 0x2d, 0x3a, 0x6d, 0x16, 0xe8, 0x91, 0x17, 0x8b, 0x7a,
+  0x23, 0x23, 0x50, 0x1f, 0xda, 0xec, 0x62, 0xe8, 0x10, 0xd0, 0x71, 0x93, 0xe1, 0xed, 0xf4, 0x22,
+  0xa6, 0x28, 0x95, 0xae, 0x5b, 0x2a, 0xb8, 0xc2, 0xc4, 0xa1, 0xd4, 0x56, 0x2a, 0x60, 0xaa, 0x57,
+  0x22, 0xbc, 0x10, 0xb9, 0x55, 0x38, 0xe4, 0x97, 0x82, 0x6d, 0xae, 0xd4, 0x14, 0x9e, 0xab, 0xa0,
+  0xc4, 0xab, 0xd2, 0xeb, 0xe4, 0x4a, 0xf3, 0x2b, 0x69, 0x19, 0xfa, 0x7d, 0xf1, 0x63, 0xd1, 0xb3,
+  0xd9, 0x3c, 0x2b, 0x34, 0xb8, 0x3c, 0x66, 0x20, 0xcc, 0xbe, 0xed, 0x39, 0x53, 0xea, 0x32, 0x36,
+  0xba, 0x7d, 0x78, 0x7f, 0xd0, 0xed, 0x6c, 0x34, 0xe1, 0x96, 0xfb, 0x93, 0xfa, 0xf6, 0x13, 0x7d,
+  0xfb, 0x49, 0x7d, 0xc3, 0xaf, 0x97, 0xe1, 0x67, 0xfa, 0x0a, 0xc7, 0xce, 0x82, 0x32, 0x13, 0x92,
+  0x5a, 0xdf, 0x6b, 0x68, 0x94, 0xf8, 0xa7, 0x20, 0x2e, 0x9f, 0x53, 0x42, 0xb5, 0x39, 0x29, 0x82,
+  0xa8, 0x2a, 0x5f, 0x76, 0x0a, 0x1d, 0xcf, 0xfc, 0x59, 0x3c, 0x76, 0x43, 0x8a, 0x35, 0x4f, 0x2e,
+  0x39, 0xfa, 0x9d, 0xab, 0xff, 0xf4, 0xd5, 0x48, 0x8e, 0x28, 0x2b, 0x20, 0x2c, 0x09, 0x27, 0x9b,
+  0xc2, 0x26, 0xff, 0xeb, 0xf8, 0xf0, 0x1d, 0x07, 0xab, 0xcb, 0xd3, 0xc1, 0x08, 0xd8, 0xa7, 0x93,
+  0xa2, 0x2c, 0x06, 0x6d, 0x39, 0xf3, 0xda, 0x13, 0x55, 0xe0, 0x9d, 0x84, 0xc1, 0x19, 0x09, 0xd9,
+  0xef, 0x89, 0x0f, 0x6a, 0xe3, 0x3c, 0x6a, 0x31, 0x13, 0xc0, 0xb3, 0x06, 0xce, 0x31, 0x8c, 0x46,
+  0xd5, 0x82, 0x55, 0xd4, 0xf1, 0x86, 0x8b, 0x01, 0xbf, 0xc2, 0xc3, 0x2f, 0xb7, 0xf6, 0xe1, 0xae,
+  0xdd, 0x85, 0x4f, 0x99, 0xc9, 0x49, 0xe4, 0x9d, 0xe1, 0x85, 0x81, 0x6b, 0xb6, 0x76, 0x00, 0xaf,
+  0x69, 0x0c, 0x78, 0x35, 0xf9, 0x48, 0xd3, 0x6b, 0xcc, 0x35, 0xf7, 0x93, 0xac, 0x08, 0xe1, 0xbf,
+  0x37, 0xf3, 0x1c, 0x3b, 0x34, 0x46, 0x66, 0x4e, 0xde, 0x40, 0x68, 0x15, 0x9e, 0x6f, 0xbe, 0xc2,
+  0x1d, 0x3a, 0x4b, 0x3c, 0x01, 0x51, 0x52, 0x47, 0x50, 0x0d, 0x6a, 0xd5, 0xf0, 0x44, 0xe7, 0x4a,
+  0xbe, 0xb7, 0x10, 0x88, 0x6c, 0xe7, 0x03, 0xc3, 0x6c, 0x69, 0x21, 0x14, 0x6e, 0xe6, 0x02, 0x72,
+  0xbb, 0x84, 0x17, 0x04, 0x63, 0x71, 0x71, 0xf8, 0x8d, 0x3a, 0xd2, 0x28, 0x3c, 0x16, 0xb1, 0xed,
+  0x89, 0x87, 0xbc, 0xc3, 0xe9, 0xe1, 0x5f, 0x74, 0xff, 0x99, 0x96, 0x97, 0x90, 0x6b, 0x17, 0xe6,
+  0x3f, 0x15, 0x6c, 0xf3, 0x9a, 0xfc, 0xcc, 0x61, 0xd3, 0xa2, 0x68, 0xd4, 0x47, 0xce, 0x86, 0x85,
+  0x25, 0x3a, 0xf0, 0xf7, 0x96, 0xc3, 0x19, 0x7f, 0x92, 0x3f, 0xfc, 0x44, 0x3f, 0x88, 0xe0, 0xbf,
+  0xe7, 0xdd, 0xee, 0x79, 0xef, 0xfb, 0x2f, 0x8e, 0x0d, 0x47, 0x96, 0x99, 0xdb, 0xe6, 0xa7, 0xea,
+  0x42, 0x5a, 0x01, 0x39, 0x6b, 0x1b, 0xf7, 0x1c, 0x90, 0x43, 0xf5, 0x3c, 0xc5, 0xee, 0xe1, 0xdb,
+  0xf7, 0x3b, 0x47, 0xfb, 0xc0, 0xa3, 0xee, 0x41, 0x03, 0xf2, 0x01, 0xeb, 0x71, 0xaa, 0xa2, 0x90,
+  0x45, 0x25, 0x48, 0xd4, 0x5e, 0x93, 0xe9, 0x44, 0x95, 0xd8, 0x91, 0x61, 0x29, 0x93, 0x2c, 0x11,
+  0x17, 0x49, 0x94, 0xe9, 0x32, 0xa8, 0xa1, 0x00, 0xa1, 0x48, 0x1e, 0x16, 0x4a, 0x83, 0x22, 0xba,
+  0x13, 0xe3, 0x2e, 0x5a, 0x28, 0x47, 0x0e, 0xb1, 0x2b, 0x87, 0x99, 0x44, 0x51, 0xda, 0xec, 0x5b,
+  0x59, 0x41, 0x90, 0x5d, 0xd9, 0x95, 0x0c, 0xa9, 0xc4, 0x20, 0xcb, 0x07, 0xd2, 0xbb, 0xdc, 0xaa,
+  0x9a, 0xd8, 0xe2, 0x48, 0x0e, 0xac, 0x60, 0x48, 0xc2, 0x29, 0x6b, 0x71, 0x50, 0xf1, 0x62, 0x68,
+  0x40, 0xa6, 0x17, 0x48, 0xee, 0x61, 0x2a, 0x03, 0x5a, 0x8a, 0xc0, 0x11, 0x15, 0x3a, 0x24, 0x4b,
+  0x89, 0x64, 0x63, 0x34, 0x9e, 0xa6, 0xf3, 0x09, 0x96, 0x21, 0xc3, 0x82, 0x8d, 0xb3, 0x18, 0xf5,
+  0x33, 0xe6, 0x2c, 0x29, 0x72, 0x82, 0x02, 0x46, 0xe8, 0x50, 0x39, 0x87, 0x59, 0x77, 0xf8, 0x90,
+  0xa1, 0x11, 0x15, 0x1c, 0x5f, 0x8d, 0x78, 0x4a, 0xa7, 0x35, 0x55, 0xb7, 0xc2, 0x93, 0xc5, 0x96,
+  0x9b, 0xb9, 0x4a, 0x2b, 0xaf, 0xea, 0x9e, 0x26, 0x3d, 0xaf, 0x57, 0xa5, 0x67, 0x82, 0xaf, 0xcb,
+  0xce, 0x97, 0x54, 0xb4, 0x0a, 0x85, 0x67, 0x44, 0x8b, 0x14, 0xa3, 0xe3, 0xd1, 0x88, 0x3f, 0xe1,
+  0x40, 0x0f, 0x88, 0xe0, 0x2d, 0x91, 0xba, 0x60, 0x19, 0x68, 0x24, 0x63, 0x78, 0xc1, 0x24, 0xce,
+  0x40, 0x26, 0xe3, 0x84, 0x58, 0x76, 0xed, 0x03, 0x78, 0xc4, 0xc2, 0x23, 0x3f, 0xae, 0xf2, 0x07,
+  0x6a, 0x51, 0x48, 0x58, 0xce, 0x19, 0x35, 0x19, 0x4c, 0x9d, 0x90, 0x65, 0x29, 0x5b, 0xac, 0x4c,
+  0xba, 0x0b, 0x93, 0xe8, 0x3a, 0x39, 0x1d, 0x93, 0xe4, 0x96, 0xb0, 0x0a, 0xc1, 0x2d, 0xe7, 0x1e,
+  0x23, 0xcb, 0x08, 0x38, 0x73, 0x1a, 0xf3, 0x70, 0x08, 0xbc, 0xdb, 0x19, 0x46, 0xc3, 0xad, 0xbe,
+  0x6e, 0xa7, 0x38, 0x92, 0x33, 0x3d, 0xf5, 0xef, 0x32, 0x9d, 0xe8, 0x3d, 0x67, 0x2d, 0x39, 0xa2,
+  0x8e, 0xdf, 0xb5, 0xa6, 0x2e, 0x42, 0x58, 0x76, 0xf6, 0x35, 0xf1, 0xd4, 0x59, 0xa2, 0x34, 0x9c,
+  0xa8, 0x81, 0xe4, 0x19, 0x4b, 0xcd, 0xa1, 0x9e, 0x27, 0x16, 0xf3, 0x72, 0x62, 0xca, 0x4a, 0x90,
+  0xc8, 0x66, 0x76, 0x4a, 0x0d, 0x29, 0xc5, 0xa2, 0x42, 0x0a, 0xf6, 0xe4, 0x0e, 0xee, 0xc3, 0xa5,
+  0x13, 0xda, 0x4a, 0x67, 0x7c, 0xa3, 0x6f, 0x75, 0x0e, 0x4b, 0x80, 0x28, 0xb7, 0xf6, 0x96, 0x96,
+  0x06, 0x2e, 0x9a, 0xea, 0x4e, 0xae, 0xce, 0x8e, 0xb4, 0xcb, 0xb7, 0x98, 0x7d, 0x90, 0x9c, 0x4e,
+  0x1f, 0xb6, 0x35, 0x80, 0xcf, 0xc5, 0x1a, 0x90, 0x50, 0xc0, 0x0f, 0x9e, 0x89, 0xb6, 0xfe, 0x04,
+  0x4b, 0xb8, 0xf4, 0x96, 0x5b, 0xe0, 0x0e, 0xee, 0xda, 0x56, 0x69, 0x51, 0xe3, 0x0b, 0xc1, 0x92,
+  0x7d, 0xd5, 0x3e, 0x6f, 0xd1, 0x78, 0x83, 0xb0, 0x49, 0xeb, 0x49, 0x9f, 0xe1, 0x7a, 0xf1, 0x5c,
+  0xf4, 0x50, 0xc8, 0x5f, 0x70, 0xaf, 0x31, 0x59, 0x97, 0x53, 0x66, 0x00, 0x44, 0xe8, 0xaf, 0x75,
+  0xdf, 0x1a, 0xaa, 0xc5, 0x62, 0x54, 0x65, 0x74, 0xad, 0xbc, 0x93, 0xbf, 0xb8, 0x13, 0x79, 0x94,
+  0x68, 0x95, 0x9d, 0x1a, 0xd5, 0x53, 0x16, 0x77, 0xab, 0xac, 0x74, 0x57, 0x0a, 0x16, 0x54, 0x08,
+  0xd3, 0x21, 0x5b, 0xe1, 0x1e, 0xaf, 0x36, 0xc6, 0x5f, 0x1d, 0x8d, 0x0b, 0xf9, 0x93, 0x56, 0xc3,
+  0x2b, 0x7e, 0x22, 0x31, 0xbe, 0x84, 0x06, 0x2f, 0x31, 0xc5, 0x8c, 0x09, 0x98, 0x57, 0xb1, 0xe7,
+  0x80, 0xad, 0xd6, 0x48, 0x8a, 0x43, 0xf8, 0x12, 0xf5, 0x93, 0xb9, 0x4f, 0x89, 0x6c, 0x9c, 0x82,
+  0xa6, 0xbc, 0xf5, 0xa1, 0x73, 0x0e, 0xe6, 0x8e, 0x28, 0xfb, 0xc3, 0x5e, 0x98, 0xc3, 0xad, 0x52,
+  0xbf, 0x4e, 0xae, 0x88, 0x73, 0x74, 0x85, 0xa2, 0x40, 0x67, 0xeb, 0x3d, 0xba, 0x17, 0x8f, 0x35,
+  0xd0, 0xdb, 0xc5, 0x02, 0xa6, 0x9d, 0x60, 0xd3, 0x1b, 0xe6, 0x9d, 0x2a, 0x72, 0x51, 0x44, 0xb5,
+  0x48, 0xd6, 0x1b, 0x8d, 0x06, 0x83, 0x6e, 0xf7, 0xdb, 0x65, 0x3d, 0x92, 0x18, 0xbe, 0xff, 0x92,
+  0x76, 0x98, 0x50, 0x4a, 0x21, 0x8f, 0x02, 0x1c, 0xf1, 0x01, 0x13, 0x85, 0x7a, 0x00, 0x3c, 0x73,
+  0xa3, 0xdb, 0x94, 0xf1, 0xd4, 0x4f, 0x37, 0x5c, 0xee, 0x8a, 0x2a, 0xac, 0xdc, 0x93, 0x93, 0xd5,
+  0x7c, 0x3f, 0xda, 0xe4, 0xa4, 0x30, 0xc2, 0x72, 0x66, 0xda, 0xd1, 0x28, 0x86, 0xde, 0x4a, 0xd2,
+  0x65, 0x57, 0x89, 0x9d, 0xd6, 0xf3, 0x9f, 0xca, 0xe7, 0xa5, 0xa4, 0x81, 0xad, 0x2c, 0x12, 0xba,
+  0xfd, 0xdb, 0x27, 0xf7, 0x85, 0x64, 0x8d, 0x22, 0x46, 0x37, 0xfe, 0xad, 0x16, 0xb9, 0xe3, 0xbd,
+  0xe3, 0xe3, 0x7d, 0xb8, 0x25, 0x1f, 0xed, 0xed, 0x1e, 0x1e, 0xbd, 0xbc, 0x9f, 0x34, 0x97, 0x8d,
+  0x23, 0x32, 0x94, 0xf6, 0xc5, 0xe1, 0xbb, 0x06, 0xf1, 0x3a, 0xd6, 0x39, 0x62, 0x30, 0x71, 0x8c,
+  0xd5, 0x21, 0x2f, 0x93, 0xf4, 0xa6, 0x28, 0x6c, 0xcd, 0x79, 0x9c, 0x3e, 0x4e, 0x92, 0x8b, 0xce,
+  0x58, 0x90, 0x3e, 0x30, 0xaf, 0xd8, 0xcf, 0xc8, 0xfc, 0xa6, 0x89, 0xa1, 0x32, 0x87, 0x9e, 0x25,
+  0xd4, 0xca, 0xa0, 0x6c, 0x42, 0xb3, 0x34, 0xab, 0x51, 0xbc, 0xb5, 0x0d, 0xed, 0x7f, 0xbd, 0xdf,
+  0x7b, 0x2d, 0xf3, 0xfd, 0xc1, 0x20, 0xac, 0x40, 0x60, 0xa4, 0x74, 0x16, 0x2d, 0x49, 0x6e, 0xc6,
+  0x98, 0xe7, 0x47, 0xe4, 0x02, 0x34, 0x6c, 0x71, 0xc9, 0x92, 0xcc, 0x14, 0x47, 0x87, 0xea, 0x30,
+  0xd6, 0x66, 0xfd, 0xea, 0x55, 0x03, 0x44, 0xe4, 0xeb, 0x29, 0x96, 0xc7, 0xc6, 0x40, 0xb1, 0x4d,
+  0x8c, 0xd6, 0x9c, 0x64, 0xab, 0x6a, 0xae, 0x94, 0xe5, 0xf3, 0xa6, 0x33, 0x98, 0xcd, 0x0c, 0x7f,
+  0x23, 0xfa, 0x95, 0x8b, 0x74, 0x9f, 0x90, 0x8e, 0x94, 0x95, 0x12, 0x71, 0x46, 0xc5, 0xbc, 0x1f,
+  0x65, 0x4e, 0x85, 0xa9, 0x2d, 0x84, 0xca, 0xf5, 0xfc, 0xf8, 0xeb, 0xde, 0x11, 0xad, 0xeb, 0x16,
+  0x56, 0xac, 0x72, 0x37, 0xd9, 0x3d, 0x7c, 0xf7, 0x6a, 0xff, 0x75, 0x5d, 0x8b, 0x57, 0x47, 0x58,
+  0x71, 0xce, 0x48, 0x11, 0x64, 0x36, 0xc0, 0x5c, 0x17, 0x28, 0xe1, 0xfa, 0x9e, 0x63, 0xc5, 0xba,
+  0x8f, 0xc7, 0x27, 0x3b, 0x47, 0xd8, 0xea, 0x71, 0x6d, 0xab, 0xfd, 0x77, 0xef, 0x7f, 0xc1, 0x56,
+  0x1b, 0xb5, 0xad, 0xf6, 0xde, 0xbd, 0x84, 0x36, 0x4f, 0x7c, 0x6d, 0x8e, 0x0f, 0x7f, 0x39, 0xda,
+  0xdd, 0xfb, 0xf8, 0x7e, 0xe7, 0xf5, 0x5e, 0xed, 0xbc, 0x0e, 0x8f, 0xde, 0xee, 0x9c, 0x7c, 0x24,
+  0x42, 0xa8, 0x58, 0x24, 0x8b, 0x62, 0x06, 0xae, 0x8c, 0x89, 0xfc, 0xf0, 0x38, 0xfa, 0xb3, 0x88,
+  0xa4, 0x65, 0xe2, 0x93, 0x57, 0x03, 0x19, 0x3b, 0xcb, 0x95, 0xab, 0xb0, 0x65, 0xc6, 0xb9, 0x1c,
+  0x41, 0xc8, 0x43, 0xef, 0x32, 0x2b, 0x5c, 0xfa, 0x98, 0xe9, 0xe1, 0x48, 0xbd, 0xd0, 0x1f, 0x31,
+  0xed, 0x8f, 0x15, 0x63, 0x1d, 0xfe, 0xa2, 0xac, 0x25, 0x4f, 0x5d, 0x3e, 0xf0, 0xa7, 0x9d, 0x4e,
+  0xa7, 0xf1, 0xe6, 0xe4, 0xe8, 0xb8, 0xa1, 0xe5, 0x1b, 0x19, 0xa8, 0xe0, 0x13, 0x06, 0x5c, 0x66,
+  0x36, 0x89, 0x5b, 0x62, 0xd0, 0x19, 0x8c, 0xc3, 0x74, 0x17, 0x76, 0xc8, 0x4e, 0x1e, 0x74, 0x9b,
+  0x2e, 0x98, 0x66, 0xaf, 0xde, 0x93, 0xe0, 0x71, 0xcb, 0x26, 0x49, 0x99, 0xae, 0xc4, 0x17, 0x4a,
+  0x45, 0xb1, 0xc2, 0x5b, 0xe2, 0x54, 0x42, 0xe2, 0x7c, 0x25, 0x1c, 0x2d, 0x8f, 0x01, 0x3b, 0xb0,
+  0xdd, 0x29, 0xcf, 0x6d, 0x28, 0x5e, 0x60, 0x82, 0x43, 0xb9, 0xcf, 0xa3, 0xe9, 0xd0, 0x0d, 0x8e,
+  0x13, 0x8a, 0x6c, 0x89, 0xa7, 0x8b, 0x82, 0x94, 0xf1, 0x75, 0x7d, 0x19, 0xb2, 0x89, 0xcb, 0x01,
+  0xdb, 0x8d, 0x53, 0x16, 0x8c, 0xe2, 0x68, 0x32, 0xcc, 0x36, 0xe1, 0x76, 0x38, 0xbc, 0xe9, 0x73,
+  0xd2, 0x3a, 0xb6, 0xab, 0xcb, 0x94, 0x01, 0x01, 0x8f, 0xc4, 0x74, 0x81, 0x01, 0xf9, 0x19, 0x13,
+  0xae, 0x60, 0x91, 0xf5, 0x16, 0x31, 0x21, 0x34, 0x46, 0xe0, 0x2b, 0x5a, 0x04, 0x47, 0x92, 0x96,
+  0x7f, 0x55, 0x95, 0x20, 0x41, 0x7d, 0x68, 0x12, 0x07, 0xfc, 0xcb, 0x8a, 0x08, 0x08, 0xc0, 0x73,
+  0x82, 0x43, 0x79, 0xf3, 0x2c, 0x99, 0xd0, 0x76, 0x33, 0x43, 0x51, 0x39, 0x78, 0x8c, 0x16, 0x69,
+  0x86, 0xf0, 0x37, 0x2c, 0x85, 0xf5, 0x37, 0x7d, 0x33, 0xda, 0x57, 0x25, 0x9c, 0xfe, 0xc2, 0x34,
+  0x38, 0x6b, 0xee, 0xa8, 0x0a, 0xec, 0x6b, 0x64, 0xc3, 0x41, 0x14, 0x2c, 0x6c, 0xb9, 0xbe, 0x86,
+  0x74, 0x22, 0xc5, 0x34, 0x1f, 0x79, 0x54, 0xba, 0x3c, 0x35, 0xb2, 0x0e, 0x31, 0x96, 0x9b, 0x62,
+  0x7b, 0x7b, 0x9b, 0x0b, 0xfe, 0x2e, 0xa0, 0x31, 0xbe, 0x07, 0x4b, 0xa0, 0x4c, 0x65, 0x2d, 0x89,
+  0x6e, 0x3b, 0x45, 0x8e, 0x61, 0xcf, 0x04, 0xb4, 0x37, 0x2b, 0x60, 0xe8, 0x57, 0x4f, 0x2c, 0x79,
+  0x38, 0xac, 0xb6, 0xb7, 0xd1, 0x89, 0x8d, 0x7c, 0xa3, 0x2d, 0x32, 0x5b, 0xf5, 0xd6, 0x60, 0xf9,
+  0x27, 0x8a, 0x0e, 0xa0, 0xcb, 0xa2, 0xe2, 0xe0, 0xa3, 0xf8, 0x22, 0x50, 0xc4, 0x57, 0x5c, 0x67,
+  0xf0, 0x18, 0x83, 0xd3, 0x33, 0x47, 0x7c, 0x87, 0x43, 0x7a, 0xe4, 0x89, 0xb4, 0x29, 0x19, 0xcc,
+  0x22, 0x6a, 0x78, 0xec, 0x64, 0x2f, 0x0e, 0xa6, 0xec, 0x18, 0x87, 0xba, 0xd6, 0xa8, 0xf1, 0xb8,
+  0x72, 0x1f, 0xd1, 0xb2, 0xe8, 0x9c, 0xe8, 0xca, 0x8b, 0x2d, 0xb9, 0xf3, 0xcc, 0x33, 0xce, 0xde,
+  0x83, 0x38, 0x7e, 0xdc, 0xb4, 0xc1, 0x29, 0xce, 0xbd, 0x12, 0x48, 0x67, 0x61, 0x72, 0xc4, 0x89,
+  0xd1, 0x25, 0x84, 0x2c, 0xfa, 0xb3, 0x25, 0x64, 0x90, 0x83, 0x4c, 0x6f, 0x49, 0x49, 0x2a, 0xbf,
+  0x0d, 0x83, 0xee, 0xfd, 0xa4, 0xcf, 0x1b, 0x08, 0xbe, 0x2b, 0xdf, 0xee, 0xa1, 0x6d, 0xbd, 0x35,
+  0x73, 0x5e, 0x15, 0x8b, 0xb1, 0x54, 0xfb, 0x27, 0xe5, 0x7c, 0x96, 0xe8, 0xf0, 0x14, 0xb7, 0x9f,
+  0xe3, 0x3c, 0x5d, 0x72, 0x5d, 0x48, 0xb2, 0xb0, 0x97, 0x85, 0xd0, 0x58, 0xbb, 0x14, 0x78, 0xb2,
+  0x9a, 0x2b, 0x41, 0xf7, 0x75, 0x3c, 0x76, 0xe7, 0xa8, 0x4e, 0x9a, 0xd0, 0xe5, 0xb9, 0x70, 0x33,
+  0xec, 0x7e, 0xe3, 0xa2, 0x3c, 0xb9, 0xbf, 0x45, 0x79, 0x05, 0xc2, 0xa0, 0xe4, 0x73, 0x72, 0xc8,
+  0x4b, 0x76, 0x78, 0x2a, 0x27, 0x57, 0xee, 0x93, 0xa5, 0x56, 0xa7, 0xb7, 0x66, 0xf5, 0x5b, 0xdc,
+  0x63, 0x9d, 0xf1, 0xb7, 0xb8, 0xe1, 0x63, 0x4f, 0xf0, 0x8c, 0x6f, 0xb1, 0x51, 0x4a, 0x34, 0xd7,
+  0xba, 0x7e, 0x95, 0x51, 0xe8, 0xa6, 0xa4, 0x21, 0xda, 0x52, 0xa3, 0xfc, 0xad, 0x9c, 0xf5, 0xb7,
+  0xb0, 0x94, 0xf8, 0xb7, 0x2c, 0xec, 0xd3, 0x65, 0xd7, 0x15, 0xdf, 0xba, 0x14, 0xba, 0x0b, 0x94,
+  0x64, 0x4b, 0xe2, 0xa4, 0x94, 0x8c, 0xef, 0x8a, 0x19, 0x52, 0x75, 0x15, 0x98, 0xa1, 0x3b, 0xc9,
+  0x7f, 0x04, 0x1b, 0xf4, 0xa6, 0x0e, 0x66, 0x70, 0x5a, 0x1e, 0x27, 0xdc, 0x67, 0x29, 0xaa, 0xda,
+  0x50, 0xad, 0xa9, 0xaa, 0xc3, 0xc2, 0xe6, 0x4f, 0x54, 0xf3, 0xd2, 0x0d, 0xbb, 0x7b, 0x17, 0xd4,
+  0xd3, 0x75, 0xe3, 0xae, 0xa8, 0xdf, 0x2b, 0xe4, 0x0c, 0x20, 0x8e, 0xf8, 0xf2, 0x3f, 0xc4, 0x5d,
+  0xe2, 0xcb, 0xe5, 0xb1, 0xce, 0x1c, 0x06, 0xbb, 0x64, 0x20, 0xd8, 0x44, 0xcb, 0xf6, 0x79, 0xca,
+  0x7d, 0xc6, 0x21, 0xc8, 0x26, 0xcd, 0x3b, 0x70, 0x18, 0xec, 0x34, 0x48, 0x43, 0xf2, 0x91, 0xf5,
+  0xf3, 0x19, 0xef, 0x22, 0xc0, 0x6d, 0x6e, 0xc1, 0x12, 0xd4, 0x69, 0xb1, 0xa8, 0xf0, 0xc2, 0x91,
+  0xca, 0xff, 0xfc, 0x2d, 0x8e, 0x9c, 0xfa, 0x95, 0x8f, 0xa2, 0x05, 0x8c, 0x7b, 0x99, 0xaf, 0x75,
+  0x47, 0x8a, 0x58, 0x00, 0xb0, 0xe5, 0xd7, 0x46, 0x2b, 0x39, 0xe7, 0x18, 0x4d, 0x65, 0x30, 0xce,
+  0x96, 0x78, 0xb9, 0x7f, 0x8c, 0x41, 0x81, 0x1f, 0x0f, 0xf6, 0x76, 0x5e, 0x7e, 0x7c, 0x7b, 0x0c,
+  0x5c, 0x37, 0x19, 0x50, 0x05, 0x96, 0x0e, 0xc8, 0x46, 0x23, 0xeb, 0x65, 0xe8, 0x34, 0x25, 0xab,
+  0xae, 0x73, 0xd9, 0x21, 0x31, 0xa7, 0xba, 0x2a, 0xd7, 0xe1, 0x0d, 0xba, 0xfb, 0xca, 0xb1, 0x0c,
+  0xd9, 0x82, 0x85, 0xce, 0x2b, 0x84, 0x15, 0x87, 0x9b, 0xaa, 0x56, 0x50, 0xc5, 0x99, 0xf1, 0x59,
+  0x4d, 0xaa, 0x64, 0xbe, 0x34, 0x2f, 0xfc, 0xda, 0x61, 0x46, 0x48, 0x1f, 0xfd, 0x5c, 0xae, 0xe0,
+  0x4d, 0x65, 0xf8, 0x0a, 0xed, 0x50, 0x14, 0xe0, 0x0c, 0xe8, 0xcc, 0xc0, 0x08, 0x3a, 0x73, 0xaf,
+  0x25, 0x15, 0x5c, 0x7b, 0x15, 0x43, 0x66, 0x9f, 0x66, 0x4c, 0xd9, 0x6f, 0x03, 0x0e, 0xb5, 0x6f,
+  0x51, 0x3a, 0xdd, 0x66, 0xa1, 0x0c, 0xc2, 0x8a, 0x65, 0x74, 0xde, 0xba, 0x2a, 0xd8, 0x2c, 0x59,
+  0xa0, 0x50, 0x13, 0x28, 0x54, 0xf2, 0x05, 0x8c, 0x1f, 0x72, 0x26, 0xcb, 0xa5, 0xf0, 0x6d, 0x99,
+  0x11, 0x96, 0x16, 0xc6, 0x93, 0x5d, 0xbb, 0x78, 0xee, 0xcd, 0x4b, 0x82, 0x8d, 0x32, 0xd2, 0x33,
+  0xac, 0xac, 0x14, 0x5a, 0x87, 0x4d, 0xff, 0xba, 0x8d, 0xca, 0x12, 0xee, 0x3c, 0x68, 0x09, 0x80,
+  0x3f, 0x98, 0xc1, 0xb9, 0xda, 0x2f, 0x4a, 0xe4, 0xc3, 0x9f, 0x9c, 0xf2, 0x97, 0x2b, 0x93, 0xd4,
+  0x9f, 0x7a, 0x29, 0x40, 0x1a, 0x65, 0xdf, 0x3f, 0x4a, 0x19, 0xc2, 0x41, 0xb2, 0xc8, 0x96, 0xa7,
+  0x98, 0xa3, 0xd3, 0x61, 0x8a, 0x6d, 0x35, 0x85, 0x14, 0xb3, 0x8c, 0xd9, 0xc9, 0xe5, 0x04, 0x25,
+  0xf1, 0x43, 0xa2, 0xa3, 0x86, 0x1e, 0x87, 0xf4, 0x28, 0x83, 0x42, 0x26, 0xe8, 0x1f, 0xdb, 0xd1,
+  0x45, 0x49, 0x0e, 0x77, 0x5c, 0x94, 0x34, 0x55, 0x6a, 0xfc, 0x24, 0xf7, 0x08, 0xa4, 0xb6, 0xaf,
+  0xae, 0x24, 0xcc, 0x2f, 0x47, 0x07, 0x1d, 0xce, 0x49, 0xc5, 0x2e, 0x3c, 0xf0, 0x3d, 0x28, 0xee,
+  0x26, 0xb2, 0x3f, 0x5f, 0x1b, 0xd1, 0x09, 0x1a, 0xaf, 0xd2, 0x7d, 0xd1, 0x00, 0x46, 0x3a, 0x89,
+  0x99, 0x61, 0xac, 0x26, 0x83, 0x3c, 0xca, 0xdb, 0xec, 0xf4, 0xd9, 0xa8, 0xc6, 0x50, 0x15, 0x79,
+  0x5a, 0xd1, 0xb5, 0x75, 0x98, 0x0c, 0xe6, 0x54, 0x19, 0x9b, 0xdf, 0x28, 0x6b, 0x5f, 0x07, 0x8f,
+  0xc2, 0x47, 0x76, 0xda, 0x08, 0x68, 0x4f, 0xac, 0xc8, 0x55, 0x4f, 0x86, 0x1e, 0xaa, 0xa9, 0x62,
+  0x55, 0x1b, 0x39, 0xcc, 0xf6, 0xf7, 0x5f, 0xe4, 0x69, 0x87, 0x5e, 0x71, 0x79, 0xb2, 0x7f, 0x7c,
+  0x78, 0x9c, 0xa7, 0xc4, 0x97, 0x3b, 0xb2, 0xaa, 0x51, 0xb0, 0x7a, 0xda, 0xef, 0x9c, 0xad, 0x02,
+  0x07, 0x6c, 0xb4, 0x1b, 0xcd, 0xdb, 0xce, 0x38, 0x4f, 0xed, 0x2c, 0xad, 0x04, 0x7d, 0x00, 0xd3,
+  0xab, 0x14, 0xc3, 0xae, 0x94, 0xf5, 0x41, 0xdc, 0xa5, 0xd1, 0x55, 0xf2, 0x87, 0x86, 0x3b, 0x18,
+  0x6d, 0x93, 0x93, 0x2c, 0xde, 0x77, 0x0a, 0x55, 0xb8, 0x47, 0x9e, 0x1c, 0x1d, 0x1e, 0x88, 0xdd,
+  0x37, 0x3b, 0xef, 0xde, 0xed, 0x1d, 0x88, 0xe0, 0x43, 0x74, 0xce, 0xa9, 0x75, 0x81, 0x46, 0xd0,
+  0xf5, 0xeb, 0x69, 0xef, 0x7e, 0xeb, 0xd1, 0x50, 0xe0, 0x09, 0x56, 0x8e, 0x39, 0x8f, 0xa7, 0x21,
+  0xea, 0xba, 0xcb, 0x08, 0x14, 0x8a, 0x49, 0x4d, 0x28, 0xf0, 0x54, 0x2f, 0x58, 0x13, 0x9b, 0x25,
+  0x64, 0x98, 0xaf, 0x6d, 0xb2, 0x8b, 0x06, 0x67, 0x39, 0xe4, 0xfc, 0xe0, 0x94, 0xe4, 0x0f, 0x8d,
+  0x6f, 0x59, 0x78, 0x81, 0x2e, 0x3c, 0xe8, 0xc7, 0xc1, 0x7a, 0x2f, 0x3a, 0x58, 0x26, 0x49, 0x32,
+  0xeb, 0x98, 0x5e, 0xcf, 0x37, 0x98, 0xea, 0x92, 0x13, 0xb6, 0x66, 0x34, 0x90, 0x8f, 0xb2, 0x77,
+  0x67, 0x6c, 0xab, 0x9f, 0x8b, 0xe4, 0xc7, 0xbf, 0xbc, 0x7f, 0xb9, 0x73, 0xe2, 0x54, 0xc2, 0x16,
+  0x4d, 0x0a, 0xfd, 0xf3, 0x9a, 0xbf, 0xc9, 0xc1, 0xfe, 0xde, 0xbb, 0x13, 0x94, 0x93, 0x4f, 0x8e,
+  0x5d, 0x7a, 0xe6, 0x4a, 0xae, 0x65, 0x53, 0xcd, 0x4c, 0xa1, 0x27, 0x7a, 0x1e, 0x64, 0xa7, 0x4e,
+  0x57, 0xb6, 0x70, 0x57, 0xc2, 0x92, 0x0f, 0x8f, 0xf4, 0xac, 0x8d, 0x8e, 0x8c, 0x35, 0x7a, 0xc6,
+  0x6e, 0xb7, 0xe7, 0xa3, 0x39, 0x0e, 0xbd, 0x46, 0xaf, 0x99, 0xa9, 0xd9, 0xaa, 0x5b, 0x5f, 0xd0,
+  0x59, 0xe7, 0xf0, 0xfd, 0xde, 0xbb, 0x05, 0x79, 0x73, 0xac, 0xda, 0xec, 0x75, 0xc5, 0xa8, 0xae,
+  0x33, 0x47, 0xc0, 0x45, 0xff, 0x69, 0x6f, 0xd5, 0x51, 0x87, 0xca, 0x1c, 0x3a, 0x8c, 0x58, 0x15,
+  0xa6, 0x2a, 0x31, 0xe7, 0x89, 0x65, 0xf1, 0xe4, 0x52, 0x34, 0x91, 0xea, 0xf1, 0x3f, 0xc3, 0x14,
+  0x0b, 0x5a, 0x99, 0x79, 0x57, 0xf2, 0xf0, 0x4c, 0x0a, 0x6c, 0x05, 0x92, 0x88, 0x03, 0x98, 0x70,
+  0xae, 0xb3, 0x0e, 0x6f, 0xa1, 0x13, 0x60, 0x9f, 0xb8, 0xc0, 0x21, 0xca, 0xe0, 0xac, 0xe3, 0x6b,
+  0x54, 0x9a, 0x26, 0xd3, 0x64, 0x46, 0x51, 0xa3, 0xcc, 0x64, 0x30, 0x6d, 0xb6, 0x1c, 0xc3, 0x2e,
+  0x0b, 0x7b, 0x4d, 0x47, 0x17, 0xb9, 0x1b, 0xb0, 0x57, 0x44, 0xdd, 0x92, 0xa9, 0xec, 0xf4, 0x96,
+  0x9f, 0x04, 0x51, 0x07, 0x36, 0x6e, 0xe8, 0xea, 0x4b, 0xd3, 0xf4, 0x54, 0x50, 0x73, 0xe3, 0x1f,
+  0x49, 0xe7, 0x3a, 0xab, 0xcd, 0x6b, 0x50, 0x43, 0xf0, 0x56, 0xab, 0xa3, 0xba, 0x94, 0x79, 0x9c,
+  0x10, 0xf6, 0x41, 0x8d, 0x8b, 0xa3, 0xfd, 0xae, 0xeb, 0xcc, 0xf9, 0xdc, 0x51, 0x9b, 0xcc, 0x9b,
+  0xf7, 0xc9, 0x47, 0xbd, 0x14, 0x73, 0x63, 0xbc, 0xaf, 0xce, 0x6f, 0x91, 0x48, 0xc3, 0x68, 0x5d,
+  0x3f, 0xf0, 0x2a, 0x92, 0xae, 0xb3, 0x6a, 0xd2, 0x37, 0xe7, 0x2d, 0xa4, 0x4a, 0x22, 0x35, 0x23,
+  0x5f, 0x9c, 0xd3, 0xff, 0xeb, 0x5c, 0x5c, 0xec, 0x54, 0xef, 0xb8, 0x2b, 0xe8, 0x9a, 0x46, 0x37,
+  0xce, 0xe0, 0xd4, 0x62, 0xba, 0x0e, 0x3d, 0xac, 0xba, 0x9f, 0xa8, 0x7b, 0x5c, 0x8d, 0x1f, 0xf6,
+  0x49, 0x84, 0x61, 0x1c, 0xc5, 0x51, 0x85, 0x3e, 0x78, 0x97, 0x98, 0xe6, 0x4a, 0x06, 0x9f, 0x48,
+  0x1b, 0xfb, 0x75, 0x84, 0xb1, 0xc8, 0x73, 0xcc, 0x6d, 0x8a, 0xe9, 0x9b, 0x95, 0xab, 0x21, 0x3a,
+  0x1e, 0x19, 0xf9, 0xa7, 0x41, 0x82, 0xff, 0x13, 0x5a, 0x61, 0x24, 0xba, 0x9c, 0xc8, 0x84, 0xd2,
+  0x5f, 0x53, 0x5e, 0xac, 0x21, 0x9e, 0x4b, 0x59, 0x32, 0x99, 0x73, 0xd5, 0xae, 0x44, 0x79, 0x18,
+  0xa6, 0xc0, 0x1f, 0xed, 0x72, 0x86, 0x61, 0x9e, 0xc9, 0x38, 0xd0, 0x8a, 0x4d, 0x8f, 0x1e, 0x1e,
+  0xc7, 0x1c, 0x10, 0xaf, 0x3d, 0xd3, 0x2e, 0x03, 0x56, 0x49, 0xf9, 0xaf, 0xbf, 0x4c, 0x6a, 0x03,
+  0xb1, 0x4b, 0x55, 0x90, 0x07, 0xae, 0x36, 0x14, 0x76, 0xd6, 0x32, 0x06, 0x57, 0x89, 0xe5, 0x2b,
+  0x73, 0x33, 0x68, 0xed, 0x9e, 0x71, 0x9d, 0x42, 0xb7, 0x9f, 0x57, 0x91, 0x19, 0xa6, 0xd7, 0x2d,
+  0x8a, 0x34, 0xc4, 0xd3, 0xe0, 0xc9, 0xc6, 0xc6, 0xfa, 0x86, 0x61, 0x32, 0xd1, 0x51, 0xf6, 0x23,
+  0x8b, 0x4d, 0x62, 0xb5, 0xfa, 0xb6, 0x8a, 0xa1, 0xcf, 0x8b, 0xea, 0xe2, 0x61, 0xed, 0x6c, 0xac,
+  0xad, 0xf0, 0xa5, 0x9e, 0x83, 0x2d, 0xa2, 0x67, 0x4d, 0x42, 0x68, 0xc9, 0x49, 0xff, 0x20, 0xba,
+  0x9f, 0xd1, 0x7d, 0x87, 0xbf, 0x6d, 0x6f, 0x8b, 0xa7, 0x67, 0xcd, 0x3b, 0x69, 0x16, 0x2a, 0xfc,
+  0x1b, 0x8e, 0x0b, 0xe7, 0xae, 0x26, 0x29, 0xeb, 0x70, 0x2a, 0x13, 0x8c, 0xff, 0xf5, 0x97, 0x96,
+  0x27, 0x02, 0x8b, 0x60, 0xcd, 0x47, 0xba, 0xed, 0x0e, 0x16, 0xed, 0x71, 0xdd, 0xce, 0xbf, 0x8a,
+  0xa3, 0x6b, 0x5b, 0x69, 0x84, 0x2f, 0xae, 0x62, 0x10, 0x5b, 0x62, 0xf5, 0x2a, 0x69, 0x65, 0x6b,
+  0xd2, 0x99, 0x60, 0x89, 0x5e, 0x1e, 0xe2, 0xe0, 0x68, 0x2a, 0x72, 0x6d, 0x71, 0x79, 0xef, 0xc3,
+  0xad, 0xa8, 0x2f, 0x74, 0xf0, 0xeb, 0x6b, 0xa8, 0x6a, 0x23, 0x85, 0x90, 0xc3, 0xcf, 0x0a, 0xc9,
+  0xa8, 0x6f, 0x8f, 0x67, 0xa3, 0x09, 0x2b, 0xd0, 0xe3, 0x41, 0x39, 0xaa, 0x98, 0xd1, 0x9d, 0xab,
+  0x7c, 0xc9, 0x3e, 0x19, 0x1f, 0xd6, 0xe4, 0x3b, 0xa8, 0xe0, 0x43, 0xb7, 0xc5, 0x99, 0xf7, 0x81,
+  0x2d, 0x51, 0x8d, 0x2f, 0xa5, 0xf9, 0xa0, 0x9b, 0x8f, 0xa3, 0xf6, 0x3a, 0xe9, 0x61, 0x86, 0x58,
+  0xd7, 0xc6, 0x1c, 0xfb, 0xd3, 0xe0, 0x31, 0x45, 0x4f, 0x6e, 0x6c, 0x54, 0x47, 0xa1, 0x55, 0x06,
+  0xb3, 0xa6, 0xdb, 0xeb, 0x3a, 0xe7, 0x7b, 0xeb, 0xa8, 0xc9, 0x54, 0x22, 0xb3, 0x43, 0xa8, 0x70,
+  0xaf, 0xae, 0x94, 0xeb, 0xc9, 0x2f, 0x05, 0x4b, 0x19, 0xb8, 0xe2, 0xf9, 0x36, 0xd1, 0xad, 0x9a,
+  0x93, 0xab, 0x47, 0x20, 0x99, 0x0c, 0x88, 0xd7, 0x7c, 0x2d, 0x07, 0x32, 0x6a, 0xd6, 0xc8, 0x60,
+  0xc2, 0x96, 0xb6, 0xf2, 0x7a, 0xf5, 0x1a, 0x52, 0xc3, 0xc0, 0x3f, 0xb6, 0x84, 0x55, 0x6a, 0x3a,
+  0xe8, 0xe6, 0x8c, 0xf7, 0xc7, 0xb2, 0x3f, 0x2d, 0xe1, 0xe6, 0x83, 0xaa, 0x2f, 0x5d, 0x46, 0x8e,
+  0x2d, 0x31, 0x88, 0xa1, 0xe9, 0x9b, 0x93, 0xb7, 0x07, 0x28, 0x68, 0x62, 0x07, 0xac, 0xee, 0x61,
+  0x01, 0xd4, 0x33, 0x50, 0xfd, 0x30, 0x8c, 0x2e, 0x36, 0x2d, 0xb9, 0x53, 0x6b, 0x2e, 0x7d, 0x37,
+  0xcd, 0x95, 0xed, 0xfd, 0x3b, 0xaa, 0x8b, 0x1e, 0x1c, 0xbe, 0xde, 0xdf, 0xbd, 0x87, 0x6b, 0x5c,
+  0xa1, 0x66, 0xe8, 0x3b, 0xc4, 0xaa, 0x22, 0x9b, 0xbb, 0x4a, 0x72, 0x2e, 0x13, 0x02, 0x38, 0x42,
+  0xd4, 0xac, 0xfc, 0x10, 0x45, 0x7d, 0xaa, 0xbb, 0x2a, 0xa7, 0x70, 0xe3, 0xdc, 0x9c, 0xb0, 0xed,
+  0x4c, 0x29, 0x51, 0xca, 0x42, 0x5b, 0xf5, 0xb9, 0xf9, 0x4c, 0xe4, 0xbe, 0x8c, 0x2e, 0xd2, 0x48,
+  0xc6, 0x90, 0x52, 0xfd, 0x97, 0x32, 0x75, 0x3c, 0x7b, 0xf4, 0xa3, 0x52, 0x12, 0x0b, 0x1a, 0x8c,
+  0x93, 0x34, 0xfe, 0x17, 0x30, 0xd1, 0x70, 0x52, 0x9d, 0x97, 0x6b, 0x10, 0xee, 0x0a, 0x33, 0xd1,
+  0x28, 0xdf, 0xbb, 0x89, 0x38, 0x99, 0x29, 0x37, 0xa4, 0x74, 0x3e, 0x4e, 0x17, 0x6f, 0xd4, 0x63,
+  0xd9, 0x8d, 0x31, 0xd9, 0x8f, 0xab, 0xf1, 0x10, 0xd3, 0x03, 0xa9, 0x1e, 0x5c, 0x65, 0x48, 0xbe,
+  0x0b, 0xbe, 0x38, 0x3b, 0xdc, 0xe8, 0x1d, 0x7a, 0x7a, 0x87, 0xde, 0x99, 0xd3, 0x81, 0x96, 0x3d,
+  0x80, 0xf3, 0x70, 0xba, 0x16, 0x0c, 0x6f, 0x60, 0xf7, 0x51, 0xf1, 0xb0, 0xa0, 0xf7, 0x14, 0x8f,
+  0x58, 0x7a, 0xf6, 0x7e, 0x7f, 0x81, 0x64, 0x59, 0xae, 0x9a, 0x52, 0x53, 0x69, 0xa9, 0xc2, 0x2b,
+  0x74, 0xb5, 0x14, 0x21, 0xa0, 0x36, 0x19, 0xa1, 0x8a, 0x7d, 0xc5, 0x5c, 0xab, 0x9a, 0x62, 0x43,
+  0x1a, 0x74, 0x66, 0xe0, 0x94, 0x8a, 0xb9, 0xb6, 0x83, 0x0d, 0xdc, 0x3a, 0x36, 0xb1, 0xcc, 0x29,
+  0xd3, 0x61, 0xed, 0x45, 0x65, 0x32, 0x4d, 0xd7, 0xc6, 0x57, 0x19, 0xa8, 0x6a, 0x79, 0x9d, 0x49,
+  0x9a, 0x47, 0x58, 0x98, 0x83, 0x1d, 0x03, 0x49, 0x5f, 0x2e, 0x35, 0xc4, 0xa4, 0x21, 0xe1, 0x20,
+  0x8f, 0x42, 0x01, 0x12, 0xe6, 0x65, 0xa5, 0x12, 0x1e, 0x9c, 0x55, 0x89, 0x06, 0x7e, 0x6b, 0x71,
+  0xe2, 0xe2, 0x59, 0x82, 0xe1, 0x4f, 0x14, 0x27, 0x28, 0x37, 0x6e, 0x9c, 0x29, 0x19, 0x14, 0x41,
+  0xcb, 0xbd, 0xe0, 0xcb, 0x0d, 0x46, 0xda, 0x97, 0xe0, 0x9b, 0xf3, 0x7f, 0x7d, 0xc5, 0xa5, 0xc0,
+  0x95, 0xd0, 0x41, 0x4b, 0x16, 0xe6, 0x4d, 0xed, 0x60, 0x25, 0x30, 0x2d, 0xd3, 0x0d, 0x7b, 0xdc,
+  0x5b, 0x8c, 0x25, 0x2e, 0x4f, 0x62, 0x94, 0x22, 0x9b, 0x95, 0xa0, 0x42, 0x44, 0xee, 0x34, 0xe1,
+  0x10, 0x61, 0xc4, 0xeb, 0xe4, 0xa6, 0x2f, 0x68, 0x5a, 0xca, 0x71, 0xb3, 0x9a, 0x23, 0x87, 0xe1,
+  0xcb, 0x33, 0xc8, 0x7c, 0x9b, 0xd4, 0x03, 0x93, 0xc0, 0xba, 0x62, 0x9b, 0x55, 0x5c, 0xf9, 0x76,
+  0x94, 0x7e, 0x77, 0xaa, 0xe5, 0xc5, 0x62, 0x6d, 0xaf, 0xa4, 0x4d, 0xed, 0x6d, 0xda, 0x15, 0xa9,
+  0x56, 0x27, 0xee, 0x3b, 0xf8, 0x34, 0x5c, 0x13, 0x1a, 0x7a, 0xe8, 0x2f, 0xbf, 0xf4, 0x61, 0x58,
+  0x19, 0x7b, 0x5f, 0x34, 0xb8, 0x73, 0x03, 0x7d, 0x7f, 0xea, 0xb2, 0xc0, 0x95, 0xc5, 0x0b, 0x3f,
+  0xc1, 0x8b, 0x4c, 0xf8, 0x5d, 0x05, 0xbf, 0x29, 0xb3, 0x5f, 0x03, 0x33, 0x6a, 0xdc, 0xf3, 0x49,
+  0x4a, 0x3e, 0xa1, 0xaf, 0xe0, 0x9f, 0xbd, 0x23, 0x8a, 0x37, 0x24, 0x7d, 0x25, 0x69, 0x0d, 0xe5,
+  0xb2, 0x8d, 0x57, 0xd1, 0xf5, 0xf5, 0x3e, 0xd4, 0xa5, 0x87, 0xd3, 0xa8, 0xbd, 0x37, 0x4f, 0x13,
+  0x59, 0xce, 0x04, 0x6f, 0xaf, 0xb3, 0xc9, 0x3c, 0x13, 0x57, 0xd1, 0x24, 0x19, 0xe0, 0x85, 0x12,
+  0x37, 0x41, 0xb9, 0x8d, 0x61, 0x43, 0x6e, 0xa2, 0x51, 0xdf, 0xde, 0xea, 0xc5, 0xc0, 0xa8, 0xfd,
+  0xf5, 0x58, 0x3a, 0x15, 0x66, 0x51, 0x8e, 0xe5, 0x61, 0x32, 0xf4, 0x3c, 0x9e, 0x5a, 0x8a, 0x47,
+  0x8b, 0xd8, 0x50, 0xcf, 0xf9, 0x84, 0x4b, 0xe7, 0x9c, 0xa3, 0xb2, 0xb4, 0xac, 0x00, 0x35, 0xc7,
+  0x90, 0x02, 0x14, 0xee, 0xf0, 0x5c, 0x2c, 0x72, 0x08, 0x5a, 0x8e, 0xa0, 0xb8, 0xb2, 0xaf, 0x68,
+  0x0c, 0x77, 0xf4, 0x01, 0x25, 0xcb, 0x2a, 0x5c, 0xee, 0x76, 0xe7, 0x39, 0x1e, 0xba, 0x5b, 0xe2,
+  0x71, 0xc7, 0x57, 0x55, 0x06, 0x0e, 0x6a, 0x0c, 0xde, 0xe9, 0x76, 0x36, 0x3c, 0x0d, 0x86, 0xc0,
+  0xf0, 0xaf, 0x0a, 0x40, 0x3d, 0x6f, 0xbb, 0xcb, 0xf0, 0xf3, 0x01, 0x79, 0x6a, 0xa1, 0x5b, 0xa5,
+  0xef, 0x6d, 0xd3, 0x24, 0xce, 0xa2, 0x63, 0xb4, 0xe4, 0x53, 0x5d, 0x21, 0x4f, 0x2b, 0xdc, 0x5c,
+  0x04, 0x67, 0xa3, 0xeb, 0x6b, 0xf2, 0x7b, 0x9c, 0x03, 0x5a, 0x8e, 0xd1, 0xc4, 0x63, 0x3a, 0xfe,
+  0x1a, 0xad, 0x80, 0x01, 0xc6, 0xcb, 0xd5, 0xa3, 0xc1, 0xeb, 0x69, 0x3c, 0x80, 0x2b, 0xc5, 0x6c,
+  0x1c, 0x06, 0x03, 0x9a, 0xed, 0x9b, 0x7f, 0xc1, 0xf1, 0x5c, 0xe3, 0x43, 0x91, 0x87, 0x73, 0x9c,
+  0x04, 0x5e, 0x8d, 0xb1, 0xe4, 0x9e, 0x3c, 0xbc, 0xe1, 0x93, 0xea, 0xee, 0xcd, 0x2f, 0xcd, 0x9d,
+  0xb0, 0x56, 0x1f, 0xc2, 0x58, 0xc5, 0xb7, 0xd4, 0x0e, 0xce, 0x3c, 0x21, 0x95, 0x47, 0xa3, 0x27,
+  0xdd, 0x99, 0x36, 0x71, 0xcc, 0x42, 0x43, 0x8d, 0x55, 0x0d, 0x06, 0x4c, 0xe3, 0x42, 0x19, 0x2b,
+  0x34, 0x34, 0xd7, 0x96, 0xce, 0x50, 0x08, 0x74, 0xdb, 0x22, 0x4b, 0x23, 0xbe, 0x3c, 0xfa, 0x1d,
+  0x27, 0xbf, 0x09, 0x4e, 0x6d, 0x40, 0x67, 0x39, 0x0f, 0x6b, 0x71, 0x17, 0x34, 0x92, 0x73, 0xd9,
+  0x92, 0x53, 0xdc, 0xf4, 0x14, 0x68, 0x76, 0x2b, 0x43, 0x6f, 0x7d, 0xf9, 0x11, 0x73, 0xbd, 0x7e,
+  0x65, 0xe0, 0xc2, 0x9e, 0xbc, 0x8b, 0x62, 0x26, 0xe2, 0x4e, 0xb7, 0xdb, 0xf3, 0xba, 0xd8, 0x72,
+  0xea, 0x2d, 0x15, 0x5b, 0xd6, 0x96, 0xd5, 0x24, 0xf8, 0xdb, 0x8a, 0x85, 0x8e, 0x1f, 0xab, 0x24,
+  0x60, 0x23, 0x03, 0xeb, 0x6b, 0x30, 0xc8, 0x1f, 0x25, 0xe8, 0xb6, 0xfe, 0xbc, 0xa8, 0xa9, 0xe1,
+  0x73, 0xdf, 0x0d, 0xaf, 0x7f, 0x2d, 0x91, 0x1f, 0xa8, 0x41, 0x95, 0x63, 0x6a, 0x12, 0x1d, 0xfa,
+  0xf6, 0x91, 0xea, 0x0a, 0xa3, 0x28, 0x99, 0x52, 0x87, 0x77, 0x8b, 0xcd, 0x25, 0x78, 0xd7, 0x80,
+  0x50, 0xab, 0xbf, 0xb3, 0x6d, 0x02, 0xf2, 0x62, 0x6d, 0xa0, 0x18, 0x8d, 0xc5, 0xc2, 0x56, 0x34,
+  0x6e, 0xf5, 0x63, 0x19, 0x46, 0xb7, 0x08, 0xa8, 0x8e, 0x73, 0xc7, 0xd0, 0x07, 0xe6, 0x80, 0x1d,
+  0x58, 0xf1, 0x80, 0xac, 0x25, 0x3e, 0x6b, 0xf7, 0x2a, 0x71, 0x64, 0xe9, 0x7d, 0xab, 0xd4, 0x05,
+  0x2e, 0xf2, 0x57, 0x17, 0x20, 0x32, 0xb2, 0x16, 0x3a, 0xbc, 0x82, 0x62, 0x5d, 0x04, 0x8b, 0x71,
+  0x62, 0x2d, 0x8b, 0x47, 0x7b, 0xf1, 0x9f, 0x49, 0xde, 0xec, 0xc1, 0xb0, 0x82, 0x5c, 0xf2, 0x71,
+  0xb7, 0xf8, 0xc7, 0x60, 0x9e, 0x69, 0x41, 0xa7, 0x1a, 0x52, 0xbd, 0x6c, 0xd1, 0xd8, 0x21, 0x34,
+  0x02, 0xcc, 0xa0, 0x6b, 0x0f, 0xe1, 0x47, 0x39, 0xc8, 0x1f, 0x19, 0x0d, 0xab, 0x2e, 0x73, 0x84,
+  0xc3, 0xe7, 0x99, 0xc5, 0xcf, 0x7b, 0x5c, 0x04, 0xae, 0x2e, 0x88, 0x27, 0x40, 0x5b, 0x2c, 0x5c,
+  0x00, 0xb1, 0xaa, 0xf3, 0x5c, 0x1f, 0xc8, 0xf0, 0x82, 0x93, 0x75, 0x16, 0x20, 0xb3, 0x3f, 0xd1,
+  0xdb, 0x51, 0xdf, 0xe6, 0xab, 0x95, 0xf3, 0xaf, 0xa6, 0x44, 0x0e, 0x0e, 0xf0, 0x99, 0x0c, 0x0e,
+  0x66, 0xd8, 0xcf, 0x8a, 0x10, 0x44, 0xf9, 0xf8, 0x47, 0x7e, 0xb0, 0xa4, 0xab, 0x0d, 0xa6, 0x0a,
+  0xc7, 0xea, 0x91, 0x80, 0x4d, 0xbe, 0x3c, 0x9d, 0x47, 0x37, 0x89, 0xf4, 0xa9, 0xd1, 0x4c, 0x07,
+  0xb0, 0x30, 0x57, 0x58, 0x13, 0x92, 0x4b, 0x32, 0xa2, 0xeb, 0x0d, 0x85, 0x89, 0x9a, 0x05, 0x34,
+  0x09, 0x48, 0x79, 0x83, 0x69, 0x8b, 0xf1, 0x4d, 0x86, 0x57, 0xae, 0x4c, 0xaf, 0x48, 0x58, 0xc8,
+  0x41, 0x18, 0x18, 0x77, 0x40, 0x19, 0xca, 0xfc, 0xa2, 0x50, 0x09, 0x80, 0x24, 0x9a, 0x75, 0xaf,
+  0x68, 0x64, 0x34, 0x2c, 0xbf, 0x78, 0x37, 0x3b, 0x5d, 0x0c, 0x7a, 0x77, 0x39, 0xa3, 0x8b, 0x3b,
+  0x42, 0x4d, 0x2c, 0x47, 0x48, 0xa9, 0x9b, 0x4b, 0xd2, 0xd1, 0x50, 0x61, 0x8d, 0xb2, 0xe5, 0xf4,
+  0x9f, 0x43, 0x8a, 0xad, 0x04, 0x2c, 0x37, 0x8d, 0x31, 0x3b, 0x52, 0x19, 0x47, 0x20, 0x0a, 0x69,
+  0x5d, 0xf5, 0x90, 0x66, 0xb3, 0x6f, 0xb7, 0xa6, 0x6f, 0xa0, 0x35, 0x84, 0x4b, 0xcc, 0x1a, 0x5a,
+  0x7f, 0x15, 0x3c, 0x9a, 0x18, 0xa5, 0x6f, 0xb5, 0x5a, 0x75, 0xcb, 0x56, 0xdb, 0xa2, 0xcd, 0xcd,
+  0x9a, 0x75, 0x28, 0xb6, 0x59, 0x03, 0xb6, 0x5a, 0x92, 0x50, 0xf1, 0xbe, 0xcf, 0x92, 0x3f, 0x5d,
+  0xeb, 0xe9, 0xbe, 0xcd, 0x55, 0x05, 0x07, 0x61, 0x6a, 0x91, 0x17, 0xa7, 0x45, 0x25, 0x8f, 0xaf,
+  0xba, 0xea, 0x94, 0xe4, 0xeb, 0xe3, 0x2d, 0x4c, 0x49, 0x89, 0xcf, 0xb7, 0x04, 0xfd, 0xf5, 0x55,
+  0xf6, 0x63, 0x51, 0x9e, 0x55, 0xf9, 0xe5, 0x59, 0x14, 0xf8, 0x0f, 0x19, 0x24, 0xf7, 0xb2, 0x79,
+  0xb1, 0x05, 0x6a, 0x7a, 0x48, 0x34, 0x22, 0x0e, 0xba, 0x7d, 0x81, 0x45, 0xad, 0x5b, 0xa2, 0xd7,
+  0x17, 0xbb, 0x11, 0xee, 0xdc, 0x96, 0x58, 0xeb, 0x0b, 0x2a, 0x7d, 0xed, 0xee, 0x2e, 0x6f, 0xd3,
+  0x5d, 0x6f, 0x15, 0x4b, 0x2d, 0xbb, 0x37, 0xa5, 0x03, 0x81, 0x7b, 0x96, 0xac, 0x97, 0x41, 0x55,
+  0x72, 0xfa, 0x45, 0x92, 0x75, 0x54, 0x86, 0xa8, 0x12, 0xbd, 0xc8, 0x04, 0x7d, 0xa5, 0xbe, 0xa4,
+  0x32, 0xa7, 0xbb, 0xc4, 0xaa, 0xea, 0x0a, 0x08, 0xdc, 0xb6, 0x64, 0xf1, 0xe9, 0xa0, 0x7f, 0x63,
+  0xf0, 0x45, 0x86, 0xbf, 0xf4, 0xc5, 0xdb, 0x9d, 0x7f, 0x7c, 0xe4, 0xca, 0x0a, 0xc7, 0xe2, 0xb6,
+  0x25, 0x82, 0x8f, 0x7a, 0xcd, 0x24, 0x6d, 0x9d, 0x83, 0xd8, 0x28, 0xbf, 0x4e, 0xee, 0x2c, 0x94,
+  0x58, 0x75, 0x55, 0x06, 0xe9, 0x91, 0xf3, 0x4e, 0x91, 0x53, 0x8a, 0x74, 0xf1, 0x86, 0xe5, 0xd0,
+  0xb0, 0x97, 0x54, 0x7d, 0x47, 0xe2, 0xec, 0x95, 0x2c, 0x34, 0x20, 0x9b, 0x58, 0x37, 0x10, 0x2b,
+  0x13, 0x06, 0x65, 0x03, 0x24, 0x95, 0x9e, 0xcb, 0x9c, 0x64, 0x02, 0xf3, 0xa5, 0x07, 0xb5, 0x5e,
+  0x58, 0x95, 0xd8, 0xdd, 0x09, 0x3e, 0xbf, 0x22, 0xf9, 0xe6, 0x24, 0xbf, 0x43, 0xf2, 0x4d, 0x03,
+  0x51, 0x8b, 0x13, 0x6f, 0x52, 0x06, 0xf1, 0x8a, 0xf9, 0xc4, 0x7d, 0x43, 0x29, 0x15, 0xa1, 0xb6,
+  0x0d, 0xa2, 0x36, 0xa3, 0xe7, 0xd2, 0x55, 0xef, 0xbe, 0xc1, 0x66, 0x52, 0x7f, 0xdf, 0xa8, 0xcf,
+  0xb5, 0x59, 0x43, 0x5a, 0x55, 0x50, 0x8b, 0x08, 0xed, 0x3e, 0x34, 0x37, 0x2f, 0x8f, 0x76, 0x3e,
+  0xec, 0xbf, 0x7b, 0x2d, 0xde, 0xec, 0x1d, 0xbc, 0x87, 0x8d, 0xf5, 0xad, 0x0a, 0x1a, 0x23, 0xdd,
+  0x00, 0x46, 0x57, 0xa3, 0x8b, 0x26, 0x27, 0xb4, 0xf2, 0xea, 0xfd, 0x71, 0x14, 0xe8, 0xb3, 0x7b,
+  0xce, 0xd5, 0x17, 0x30, 0xdc, 0x7b, 0x98, 0x60, 0x79, 0x5b, 0xb8, 0x07, 0x8d, 0xe1, 0x27, 0x71,
+  0x15, 0x67, 0xf1, 0x79, 0x8c, 0xde, 0x02, 0xb5, 0x59, 0x08, 0x1e, 0x7d, 0x37, 0x1a, 0xa1, 0x3d,
+  0xfb, 0x51, 0x35, 0xc1, 0x00, 0x30, 0xfa, 0xe4, 0x8f, 0x48, 0x6f, 0x88, 0x4d, 0x1d, 0x0d, 0xd1,
+  0xbe, 0xf1, 0x01, 0x1d, 0x66, 0xd9, 0xf3, 0xcc, 0x39, 0xce, 0xbd, 0x1b, 0xab, 0xe8, 0x2e, 0xda,
+  0x27, 0x80, 0xfd, 0x3e, 0x59, 0x2f, 0xe3, 0xd8, 0xf0, 0x62, 0xed, 0xcf, 0xd4, 0x3f, 0x33, 0x0c,
+  0x16, 0xf1, 0xd0, 0xa1, 0x67, 0xc5, 0xc1, 0x9c, 0x47, 0x17, 0xf1, 0xf4, 0x3d, 0x88, 0x10, 0x2e,
+  0x02, 0xc6, 0x06, 0x61, 0x3a, 0x08, 0x66, 0xa7, 0xdd, 0xb3, 0x96, 0x98, 0x9d, 0xf6, 0xe0, 0xdf,
+  0xa7, 0x54, 0x44, 0x47, 0x53, 0x58, 0x34, 0x89, 0x95, 0xef, 0x4f, 0xd1, 0xfd, 0x13, 0x0b, 0x22,
+  0x52, 0xec, 0x68, 0x9e, 0x88, 0xa7, 0xde, 0x34, 0x08, 0xbe, 0x57, 0x31, 0x06, 0x83, 0xe6, 0x82,
+  0x42, 0x07, 0x0a, 0x47, 0x07, 0xba, 0x9d, 0x28, 0xb2, 0x11, 0x26, 0xb1, 0xd0, 0x5b, 0xca, 0xc8,
+  0x33, 0x5b, 0x5b, 0x64, 0xde, 0xa9, 0x43, 0x15, 0x3e, 0xc4, 0xba, 0xd8, 0x27, 0x49, 0x30, 0xeb,
+  0x31, 0xaa, 0x7a, 0x80, 0xab, 0xa6, 0x7b, 0xe9, 0xb1, 0xd5, 0x1a, 0xb7, 0x5a, 0x73, 0xb7, 0x2a,
+  0xf1, 0x50, 0x99, 0x77, 0x74, 0x3e, 0xbf, 0x10, 0x98, 0x46, 0xa2, 0xda, 0xc9, 0x51, 0x77, 0x09,
+  0x99, 0x61, 0xe1, 0x39, 0xe0, 0x62, 0x15, 0x00, 0xf2, 0x97, 0x69, 0xfb, 0x32, 0x26, 0x7d, 0x00,
+  0xc6, 0x2c, 0x62, 0xf6, 0x9e, 0x38, 0x7f, 0x94, 0x51, 0x21, 0xf6, 0xf0, 0x7c, 0x12, 0x39, 0x17,
+  0xaa, 0x2c, 0xe3, 0x54, 0x96, 0xec, 0xeb, 0xfa, 0x16, 0x95, 0x8a, 0x39, 0xb5, 0x7b, 0x2d, 0xd1,
+  0xf3, 0xb4, 0xb0, 0x33, 0xba, 0xe1, 0xb6, 0x69, 0x78, 0x9a, 0xca, 0x4c, 0x1f, 0x6b, 0x5d, 0x4f,
+  0xa6, 0x8f, 0x4a, 0xb6, 0x8d, 0xc6, 0xc9, 0xd1, 0xce, 0xee, 0xcf, 0xc8, 0x7d, 0x76, 0x76, 0x4f,
+  0xf6, 0x7f, 0xdd, 0x6b, 0x70, 0x1a, 0x8f, 0x75, 0x7b, 0xb8, 0xb7, 0x2c, 0x9b, 0x7e, 0xf9, 0x1f,
+  0x3c, 0xc2, 0xca, 0x92, 0x3b, 0x6a, 0x49, 0x59, 0x35, 0x35, 0x8b, 0x4a, 0xf3, 0x7d, 0xcd, 0x90,
+  0x5a, 0xe4, 0x34, 0x63, 0x43, 0xd5, 0x20, 0x99, 0x24, 0xf3, 0x94, 0x73, 0x53, 0x5c, 0x8f, 0xe3,
+  0xa2, 0x1e, 0x8e, 0x9b, 0xdf, 0x6a, 0x25, 0x00, 0x4c, 0x8e, 0xeb, 0x2b, 0xbd, 0x7e, 0xff, 0xfb,
+  0xf0, 0xab, 0xaa, 0x60, 0x55, 0x39, 0xf4, 0x9d, 0xba, 0x5a, 0x3c, 0xfb, 0x4e, 0xac, 0x81, 0x38,
+  0xa8, 0xc6, 0x17, 0x9c, 0x3c, 0xd4, 0xdd, 0x4b, 0xe3, 0x13, 0xcb, 0xf5, 0x72, 0xb1, 0xd7, 0xff,
+  0x21, 0xbc, 0xeb, 0x20, 0x3c, 0x8f, 0x26, 0x68, 0xc7, 0x90, 0x49, 0x54, 0x91, 0x18, 0x5b, 0x62,
+  0xae, 0xd8, 0x4f, 0x54, 0x66, 0xf0, 0xbb, 0x26, 0x7e, 0xb5, 0x14, 0x87, 0x33, 0xb9, 0x11, 0x4f,
+  0x01, 0x0d, 0x59, 0x6b, 0xaa, 0x14, 0x4f, 0xab, 0x54, 0x72, 0x49, 0xe4, 0xf3, 0xc8, 0xe1, 0x8e,
+  0xbc, 0xde, 0xad, 0x67, 0x97, 0xf5, 0xdc, 0x6b, 0x60, 0x57, 0x54, 0x5b, 0x7b, 0x5c, 0x93, 0x7d,
+  0x08, 0x79, 0xeb, 0xce, 0x24, 0xbe, 0x40, 0x17, 0xe0, 0xc6, 0x80, 0x2e, 0x53, 0xb5, 0x39, 0x8a,
+  0x5c, 0x05, 0xd1, 0x3e, 0x39, 0xcb, 0xd7, 0x2d, 0x66, 0x04, 0xc6, 0xfe, 0x65, 0x97, 0x32, 0x55,
+  0x15, 0xd2, 0x99, 0x9d, 0x69, 0x89, 0xa2, 0x61, 0x83, 0xaf, 0x28, 0xde, 0xea, 0xe5, 0x8e, 0x75,
+  0xfe, 0x4f, 0xcd, 0xa5, 0x38, 0xb2, 0xbb, 0xde, 0x98, 0xc9, 0x65, 0x8b, 0x72, 0x62, 0x8d, 0x96,
+  0x51, 0x5c, 0x11, 0x08, 0xe1, 0xb1, 0x9e, 0x96, 0x13, 0x93, 0x77, 0x7e, 0x4d, 0x5d, 0x4f, 0x8f,
+  0xe3, 0xd6, 0x12, 0xc3, 0x07, 0xd2, 0x5f, 0x70, 0x98, 0xd4, 0xd3, 0x97, 0x63, 0xae, 0x5c, 0x17,
+  0x4f, 0xbc, 0xdc, 0x3b, 0xd9, 0xdb, 0x3d, 0xd9, 0x7b, 0x29, 0x8f, 0x94, 0x27, 0xdd, 0xa5, 0x67,
+  0x56, 0x29, 0xfb, 0x30, 0xeb, 0xe1, 0xce, 0xa9, 0xee, 0x17, 0x6d, 0xc6, 0xe8, 0xb8, 0xe2, 0x11,
+  0x32, 0xf8, 0x56, 0x0c, 0x3b, 0x5e, 0xcc, 0x92, 0x2c, 0xa6, 0x08, 0x2b, 0xcc, 0xde, 0x18, 0xd1,
+  0x61, 0x24, 0x69, 0xb1, 0xcd, 0x86, 0xcd, 0x59, 0xfc, 0x19, 0x4e, 0xe2, 0xba, 0xaa, 0x7a, 0xda,
+  0xea, 0x69, 0x6f, 0xa7, 0x10, 0xb4, 0xda, 0x7a, 0x7a, 0xda, 0x12, 0x6b, 0xfd, 0x38, 0x50, 0xcd,
+  0x61, 0xd4, 0xc7, 0x13, 0xeb, 0xd4, 0x9a, 0x1e, 0x72, 0x97, 0x1f, 0x05, 0x16, 0xc7, 0xb3, 0x1f,
+  0xf4, 0xe8, 0xc1, 0x8d, 0x43, 0xca, 0xa6, 0x33, 0x4d, 0x07, 0x44, 0x57, 0x10, 0x27, 0x24, 0x7e,
+  0xe2, 0x06, 0xe5, 0x15, 0x50, 0xf0, 0x9c, 0xe7, 0x6a, 0x32, 0xac, 0x42, 0x54, 0xe5, 0x6a, 0x48,
+  0x75, 0x8a, 0xec, 0x54, 0x3a, 0x46, 0xe2, 0xee, 0x27, 0x6f, 0x40, 0xad, 0x3c, 0x00, 0x72, 0xa2,
+  0x34, 0xf2, 0x29, 0x93, 0x1d, 0xce, 0x79, 0x9a, 0x9d, 0x72, 0x55, 0xf4, 0x9e, 0x7a, 0x75, 0xdb,
+  0xe4, 0x08, 0x45, 0x2d, 0x07, 0x49, 0x86, 0x09, 0x07, 0x7f, 0x14, 0x35, 0x8d, 0x8b, 0x6a, 0x87,
+  0x19, 0xb0, 0x69, 0x6f, 0x63, 0x5e, 0x11, 0x6b, 0xef, 0x0e, 0x3f, 0x9b, 0x7b, 0x17, 0x7f, 0xf2,
+  0xaf, 0x82, 0xd1, 0x79, 0xa5, 0xda, 0x79, 0xa5, 0xda, 0xf9, 0xf6, 0x3f, 0x7d, 0x1f, 0x34, 0x6e,
+  0x7d, 0xbc, 0xed, 0xca, 0x3b, 0xdf, 0xcc, 0x73, 0xe5, 0xbb, 0xa7, 0x9b, 0xdc, 0x3d, 0x5e, 0xd9,
+  0xfe, 0xa7, 0x49, 0x20, 0x4b, 0xca, 0xf1, 0x46, 0xe5, 0x6a, 0x83, 0xfe, 0x2f, 0x33, 0x52, 0x42,
+  0x63, 0x98, 0xf4, 0x88, 0xf2, 0x45, 0x3d, 0x17, 0x0d, 0x8c, 0xa6, 0xc3, 0x0c, 0xb1, 0x9f, 0xbe,
+  0xff, 0x62, 0xb4, 0xd4, 0x1d, 0x63, 0xc4, 0xa5, 0x1d, 0x8d, 0x68, 0x1e, 0xf5, 0x1c, 0xec, 0x50,
+  0x5c, 0x02, 0x02, 0x55, 0x12, 0xf3, 0xb6, 0x45, 0x76, 0x27, 0x61, 0x80, 0x2e, 0x2d, 0x51, 0xc5,
+  0x2b, 0x38, 0xd7, 0x74, 0xf5, 0xce, 0xe0, 0x93, 0x00, 0x54, 0x01, 0x68, 0xbf, 0x93, 0x64, 0x26,
+  0x5b, 0x60, 0xad, 0xce, 0xc1, 0x24, 0x0a, 0xd3, 0xbb, 0x1c, 0xf3, 0x7a, 0x67, 0x1b, 0xdf, 0x36,
+  0xb2, 0xed, 0xb6, 0x8b, 0xde, 0xe3, 0xed, 0xfc, 0x55, 0x97, 0x5f, 0x1d, 0xc0, 0xb2, 0x37, 0x5a,
+  0xe3, 0xa5, 0x5e, 0xd9, 0xf0, 0xd6, 0xad, 0xb0, 0xc0, 0x0c, 0xd0, 0x8c, 0x71, 0x74, 0x5d, 0x0a,
+  0xf9, 0x33, 0x46, 0x27, 0xcd, 0x29, 0x5a, 0x86, 0xac, 0x0b, 0x54, 0xeb, 0x05, 0xaf, 0x62, 0xe4,
+  0xea, 0x03, 0x38, 0x59, 0x1a, 0xb9, 0x98, 0x1e, 0xb3, 0x06, 0xbf, 0xde, 0xfd, 0xa7, 0xd5, 0x00,
+  0x98, 0x61, 0xd6, 0x7f, 0x2f, 0x59, 0xd8, 0x10, 0xd5, 0xa6, 0x65, 0x91, 0x7b, 0x8d, 0xd9, 0xca,
+  0x02, 0x9c, 0xd9, 0x3c, 0x68, 0x6d, 0x01, 0x0f, 0xba, 0xad, 0x9d, 0xbe, 0xeb, 0x9a, 0xf1, 0x06,
+  0xce, 0xd0, 0x09, 0x29, 0xf9, 0x2a, 0x3a, 0x34, 0x3f, 0xf6, 0x98, 0x89, 0x5b, 0xd8, 0xfb, 0x77,
+  0xa8, 0xdc, 0x96, 0x5a, 0x91, 0x45, 0x48, 0x7b, 0xb2, 0x04, 0xe3, 0x76, 0xa1, 0xaa, 0x56, 0xab,
+  0xa6, 0x77, 0x58, 0xa8, 0x58, 0xc0, 0xb8, 0x83, 0x14, 0x03, 0xb5, 0x55, 0x3e, 0x84, 0x8b, 0x49,
+  0x72, 0x8d, 0xc6, 0x32, 0x10, 0x3d, 0x38, 0xbf, 0x24, 0x72, 0x9a, 0x29, 0x5b, 0x6e, 0x29, 0xaf,
+  0x1e, 0x16, 0x61, 0x32, 0x7d, 0x59, 0xa9, 0x6a, 0xcc, 0xf4, 0x2a, 0xcc, 0xa2, 0x6c, 0xd3, 0x8c,
+  0x37, 0x46, 0x88, 0x53, 0xf1, 0xfb, 0x1c, 0x45, 0x03, 0x55, 0xc1, 0x1b, 0xda, 0x4e, 0x26, 0x19,
+  0xa6, 0x9e, 0x82, 0xfd, 0x31, 0x35, 0x22, 0xbd, 0xb2, 0x71, 0x38, 0xc4, 0x74, 0xed, 0x29, 0xed,
+  0x17, 0x91, 0xd1, 0xaa, 0x0e, 0xc6, 0x20, 0xaf, 0xb0, 0xb6, 0x43, 0xaa, 0x08, 0xed, 0x9c, 0x8d,
+  0xef, 0x8f, 0xf6, 0x4f, 0x30, 0x7b, 0x18, 0x26, 0x7e, 0x5c, 0xe3, 0x9c, 0x8b, 0x69, 0x92, 0x5c,
+  0x16, 0xb7, 0x50, 0x9c, 0x12, 0x4c, 0x85, 0xb2, 0x04, 0x84, 0x64, 0xf5, 0x73, 0x24, 0x45, 0x0e,
+  0xe1, 0x84, 0x9f, 0xa5, 0x31, 0xf0, 0x0d, 0x2b, 0x75, 0xd7, 0x0c, 0x13, 0x4f, 0xe1, 0xe8, 0xdd,
+  0xfa, 0x10, 0x9e, 0x79, 0x4d, 0xf4, 0x3c, 0x37, 0xb0, 0x43, 0xe8, 0xf9, 0x57, 0x96, 0x75, 0x31,
+  0x2c, 0x92, 0xfe, 0xae, 0x10, 0x29, 0x54, 0xf2, 0xb6, 0xc9, 0xb6, 0x3c, 0x20, 0x4a, 0xf9, 0x47,
+  0x1f, 0x7c, 0xad, 0x79, 0x58, 0xf9, 0x67, 0xaa, 0x32, 0x44, 0x3d, 0x2f, 0x22, 0x0a, 0xf9, 0xc5,
+  0x43, 0xea, 0xd1, 0xda, 0xf0, 0x51, 0xed, 0xcd, 0x9b, 0xa6, 0x3b, 0xab, 0x24, 0x5a, 0x41, 0x04,
+  0xd0, 0x1d, 0xd3, 0xe9, 0xca, 0xce, 0xef, 0x59, 0x7c, 0x62, 0xbd, 0x66, 0xe2, 0xda, 0x0d, 0x53,
+  0xd6, 0x39, 0xa1, 0xc6, 0x2a, 0x6d, 0x61, 0x58, 0x60, 0x3c, 0x8b, 0x76, 0xf5, 0x2f, 0x6f, 0xb8,
+  0x1c, 0xfc, 0x82, 0x1b, 0x2d, 0xf5, 0x77, 0x08, 0x0e, 0x44, 0x47, 0x2f, 0x26, 0x73, 0x34, 0xb1,
+  0xf6, 0x36, 0x7c, 0x0d, 0xe8, 0x85, 0x7e, 0x28, 0x95, 0x73, 0xec, 0xe8, 0xe3, 0xf1, 0xfe, 0x3f,
+  0xf7, 0xca, 0x4f, 0xcd, 0x05, 0x6f, 0xee, 0xd6, 0x6b, 0xbc, 0xb4, 0x59, 0xd7, 0xbc, 0xbc, 0x47,
+  0x29, 0x7e, 0xcb, 0x97, 0x62, 0xb5, 0x89, 0xae, 0x85, 0xa5, 0x4d, 0xbf, 0x95, 0x34, 0x23, 0x9a,
+  0xce, 0x2a, 0xa1, 0x5c, 0xb8, 0xe7, 0xfb, 0x3a, 0xd5, 0x57, 0x8f, 0x69, 0x9a, 0x35, 0xd1, 0xd1,
+  0xf6, 0x52, 0x77, 0xf7, 0xf5, 0xf5, 0xf5, 0x9a, 0xfb, 0xec, 0x5d, 0x24, 0x0f, 0xe5, 0xaf, 0x8f,
+  0x7c, 0xe9, 0x6d, 0x98, 0xe2, 0x9d, 0x32, 0xab, 0x11, 0x5a, 0xcb, 0xfb, 0xf7, 0xc5, 0x79, 0x18,
+  0x60, 0x30, 0x97, 0x28, 0xff, 0xc1, 0x92, 0x46, 0x9e, 0x61, 0xe9, 0xe2, 0xfa, 0x63, 0x8f, 0x54,
+  0x1c, 0xe5, 0x68, 0x9c, 0x78, 0x89, 0x69, 0x8f, 0x4e, 0x11, 0xef, 0x6b, 0xdd, 0x33, 0x36, 0x93,
+  0xbc, 0xe4, 0x9c, 0x46, 0x08, 0x23, 0xfb, 0x3a, 0x29, 0x5e, 0x9e, 0xba, 0x58, 0xe8, 0xf4, 0xe3,
+  0x87, 0xfd, 0x97, 0x27, 0x6f, 0xfc, 0xaa, 0x77, 0x29, 0x2f, 0xeb, 0x4d, 0x6b, 0x50, 0xe7, 0x04,
+  0x0e, 0xac, 0x62, 0xed, 0x0e, 0x2f, 0xe0, 0xe6, 0x0b, 0x5e, 0xe2, 0xbb, 0x33, 0xb4, 0x2c, 0xf6,
+  0x95, 0x66, 0x7d, 0x53, 0x49, 0x4b, 0x1e, 0xe8, 0x03, 0xde, 0x7e, 0xdb, 0xd5, 0xb4, 0xef, 0x3a,
+  0x55, 0xda, 0x9b, 0xae, 0xa5, 0xf1, 0xfb, 0x82, 0x3c, 0x6b, 0x78, 0x0b, 0x4b, 0xab, 0xb0, 0x87,
+  0x36, 0x9a, 0x76, 0x0e, 0xf4, 0xe4, 0x3c, 0xcb, 0xc3, 0x01, 0xde, 0xa8, 0xef, 0xe7, 0x8d, 0x2c,
+  0x7d, 0x6c, 0x6c, 0x34, 0xf8, 0xe3, 0x08, 0xfe, 0x6e, 0xe8, 0xef, 0xb4, 0x4a, 0xdd, 0xa1, 0x4b,
+  0x86, 0x88, 0x86, 0x17, 0x54, 0xb8, 0x98, 0xce, 0x25, 0xcc, 0x23, 0x4d, 0xa3, 0xc0, 0xc3, 0xae,
+  0x08, 0x4b, 0xa9, 0x14, 0xdf, 0x83, 0x35, 0x92, 0x23, 0x42, 0x1f, 0x8c, 0x53, 0x64, 0x10, 0x40,
+  0x98, 0x67, 0x84, 0x54, 0xf6, 0xfb, 0xd8, 0x66, 0x97, 0xac, 0x1f, 0x85, 0xb6, 0xa0, 0x2b, 0xfa,
+  0x17, 0xbe, 0x5f, 0x17, 0x3c, 0x85, 0xbf, 0x96, 0xd3, 0xb4, 0x3c, 0x22, 0xb2, 0xf8, 0x92, 0xcd,
+  0x0e, 0x98, 0x22, 0xea, 0x38, 0xbe, 0x44, 0xa3, 0x20, 0x29, 0x21, 0x14, 0x06, 0x33, 0x72, 0x90,
+  0x68, 0xe1, 0xc9, 0x4d, 0x39, 0x2b, 0xf0, 0xe4, 0x0d, 0x61, 0x0a, 0x97, 0xb3, 0xfc, 0x86, 0x58,
+  0x8d, 0xe7, 0x38, 0x00, 0x70, 0x1f, 0x92, 0x74, 0x32, 0x64, 0xfc, 0xc1, 0x6b, 0x5a, 0xec, 0xd1,
+  0xe7, 0xe2, 0xfb, 0x85, 0x00, 0x11, 0x48, 0x9e, 0xd6, 0x41, 0xc0, 0x6e, 0x4d, 0x2a, 0x1f, 0x81,
+  0x1c, 0x59, 0x81, 0x60, 0xe1, 0x86, 0x87, 0x89, 0xc8, 0x94, 0xcb, 0x48, 0xdf, 0x88, 0x73, 0x59,
+  0x18, 0x14, 0x33, 0xa8, 0x0d, 0x87, 0xa1, 0xb2, 0x63, 0x00, 0x14, 0x58, 0x3f, 0x45, 0xc7, 0x87,
+  0x8c, 0xfb, 0x2c, 0xce, 0xd9, 0x39, 0xee, 0xfc, 0x86, 0xfe, 0x6e, 0x0a, 0x95, 0x06, 0x2d, 0xc1,
+  0x92, 0x8d, 0xa3, 0x70, 0x18, 0xd5, 0x14, 0xa6, 0x37, 0x16, 0xf9, 0xb4, 0x0c, 0xb1, 0x21, 0xbf,
+  0x1e, 0x14, 0xd2, 0x03, 0x9e, 0xdd, 0x36, 0x45, 0x8d, 0x04, 0x31, 0x7a, 0x15, 0xf3, 0x2f, 0x6d,
+  0xc1, 0x05, 0x41, 0x51, 0xf7, 0xd2, 0x5b, 0xf3, 0xe4, 0x5b, 0x23, 0xc7, 0x4c, 0x40, 0xcb, 0x0f,
+  0x3f, 0x68, 0x78, 0xd9, 0xe5, 0xf1, 0xc1, 0x5b, 0x58, 0x63, 0x0e, 0x62, 0xd3, 0x79, 0x38, 0xd9,
+  0x41, 0xf7, 0x58, 0x76, 0xa2, 0x73, 0x33, 0x81, 0xea, 0xba, 0xe0, 0x86, 0x07, 0x28, 0xad, 0xb2,
+  0xf0, 0xfd, 0x6f, 0x36, 0x75, 0xb9, 0x00, 0x99, 0xef, 0xeb, 0x2d, 0x54, 0xd1, 0x52, 0x7e, 0x3d,
+  0x5f, 0x1d, 0x93, 0x43, 0x45, 0x99, 0x2d, 0x81, 0xac, 0x90, 0x62, 0x69, 0xcf, 0x6f, 0xca, 0xca,
+  0x96, 0xb4, 0xe5, 0x30, 0x69, 0x1e, 0x20, 0x00, 0x45, 0x5b, 0x0e, 0x2f, 0xca, 0x28, 0x30, 0xc3,
+  0x95, 0x6a, 0x4a, 0xe6, 0xeb, 0x93, 0xee, 0xac, 0x2b, 0x8c, 0x5f, 0x8c, 0x22, 0xa3, 0xba, 0xa0,
+  0xd2, 0x89, 0xd8, 0x49, 0x86, 0x72, 0x47, 0x6f, 0xa9, 0xa3, 0xb8, 0xa3, 0x36, 0xcd, 0x62, 0xc2,
+  0xa3, 0xe4, 0x79, 0xf5, 0xb1, 0x58, 0x8e, 0x05, 0x68, 0x59, 0xd4, 0x83, 0x50, 0xa8, 0x4e, 0x28,
+  0xac, 0xc9, 0x99, 0x19, 0xde, 0x0f, 0x4f, 0x6e, 0xf0, 0x67, 0x98, 0x10, 0xcd, 0xb0, 0x59, 0xb7,
+  0x4e, 0xf7, 0x5b, 0x56, 0xe0, 0x68, 0xef, 0xdd, 0xcb, 0xbd, 0x23, 0xf1, 0x62, 0xef, 0xdd, 0xee,
+  0x9b, 0xb7, 0x3b, 0x47, 0x3f, 0xdf, 0x4b, 0x8d, 0x6f, 0xbb, 0xf0, 0x1f, 0x7b, 0x19, 0x9d, 0x47,
+  0xd3, 0xc1, 0xf8, 0x12, 0xe4, 0x08, 0xe4, 0x37, 0x41, 0x13, 0xcb, 0x0c, 0xc8, 0x7a, 0x03, 0x74,
+  0xf1, 0xc9, 0x81, 0x9d, 0xcd, 0x98, 0xef, 0xe8, 0xd0, 0xe8, 0x7e, 0x32, 0x06, 0x34, 0xa5, 0xd1,
+  0x10, 0x23, 0x56, 0x75, 0x66, 0x87, 0xec, 0x8d, 0x2a, 0x6d, 0x67, 0x11, 0xbc, 0x0b, 0x1e, 0x73,
+  0x9a, 0x7f, 0x74, 0x15, 0xcb, 0xac, 0xa2, 0xb7, 0x14, 0x41, 0x74, 0x09, 0xcb, 0x2e, 0x1a, 0x54,
+  0x5a, 0x0e, 0x6f, 0x45, 0x14, 0x40, 0xc4, 0xd9, 0x94, 0x0e, 0x12, 0x7e, 0x37, 0x02, 0x29, 0xcb,
+  0x63, 0x05, 0x14, 0x9f, 0x98, 0xe5, 0x58, 0x18, 0x21, 0x9c, 0x1a, 0xc3, 0xc2, 0xd5, 0xc6, 0xb0,
+  0x4b, 0x38, 0x63, 0x62, 0x34, 0x3e, 0x5d, 0x85, 0x93, 0x46, 0x51, 0xc9, 0xa0, 0x70, 0xa2, 0x90,
+  0x19, 0x36, 0xf0, 0xf7, 0xf3, 0x34, 0xb9, 0xce, 0xb0, 0x56, 0x57, 0x38, 0x05, 0x1a, 0x19, 0xda,
+  0xf9, 0x98, 0x68, 0x01, 0x8a, 0xdc, 0xfa, 0x5f, 0x64, 0xd9, 0xb4, 0x75, 0xc9, 0x88, 0xfb, 0x20,
+  0x7b, 0xc2, 0xb9, 0x85, 0x2f, 0x26, 0xae, 0xb6, 0xae, 0xa2, 0x77, 0x15, 0xfa, 0xfa, 0xe8, 0x17,
+  0x45, 0xde, 0x95, 0x63, 0xcc, 0xd3, 0x11, 0xe7, 0x86, 0xf3, 0x1b, 0x61, 0xbe, 0xf0, 0x5d, 0xaa,
+  0x1e, 0x02, 0xe6, 0xca, 0x94, 0x08, 0xa6, 0x92, 0x58, 0xad, 0x02, 0xbb, 0x5b, 0x70, 0x8e, 0x3a,
+  0xbc, 0xe1, 0xa8, 0x77, 0xe1, 0x9d, 0x4d, 0xdf, 0x3a, 0xc3, 0xc4, 0x76, 0x0c, 0x55, 0x63, 0x70,
+  0xb8, 0x6b, 0x86, 0xe9, 0x05, 0x96, 0x54, 0x2e, 0xde, 0x5b, 0x4d, 0x02, 0x40, 0xc1, 0x59, 0x7d,
+  0x67, 0xea, 0x1b, 0x35, 0x38, 0xce, 0x8b, 0xe1, 0x28, 0x03, 0x83, 0x87, 0x26, 0x3a, 0x1b, 0xca,
+  0x43, 0x33, 0x80, 0x43, 0xba, 0x78, 0x93, 0x23, 0x55, 0x02, 0x17, 0x66, 0x3d, 0x3d, 0xab, 0x3e,
+  0x51, 0xeb, 0x5c, 0x7d, 0x7a, 0xeb, 0x98, 0x2a, 0xa1, 0x40, 0xfa, 0x8a, 0xbe, 0x87, 0x1d, 0x11,
+  0x67, 0x54, 0x4a, 0x29, 0x99, 0x5c, 0x91, 0x60, 0xc0, 0x6d, 0x8a, 0x1f, 0x84, 0xfc, 0xe4, 0xbe,
+  0xd7, 0xb9, 0x70, 0x7a, 0x5b, 0xb7, 0x8e, 0xaf, 0xca, 0x1c, 0x83, 0xbe, 0x32, 0x5d, 0x94, 0x7e,
+  0x72, 0xd9, 0xb0, 0x56, 0x3c, 0xa4, 0xb6, 0xe4, 0x30, 0xe0, 0x73, 0x25, 0x6d, 0xc2, 0xcf, 0x51,
+  0x34, 0x2b, 0xb7, 0xf2, 0x08, 0xc8, 0x0c, 0x09, 0x17, 0x5d, 0x5e, 0x04, 0x70, 0xfd, 0x94, 0x72,
+  0xc7, 0x5c, 0x8f, 0x81, 0x17, 0x48, 0xbf, 0x50, 0x33, 0x81, 0xcf, 0x38, 0x86, 0x07, 0x41, 0xc1,
+  0x65, 0xa9, 0x40, 0x37, 0xbe, 0x89, 0x09, 0xc3, 0xa9, 0x35, 0x83, 0xb6, 0xe1, 0x70, 0xa8, 0x4e,
+  0x17, 0xea, 0x0b, 0x57, 0xe7, 0x61, 0x72, 0x19, 0x60, 0xce, 0xfc, 0x75, 0x4e, 0x78, 0xaa, 0xfd,
+  0x12, 0x14, 0x56, 0x89, 0x15, 0xb1, 0xd1, 0x45, 0xfe, 0xba, 0xd1, 0x5d, 0x22, 0x83, 0x22, 0x9e,
+  0x4c, 0x48, 0xf7, 0xda, 0x09, 0x33, 0xbc, 0x42, 0x54, 0x15, 0xb8, 0x5d, 0x7c, 0x7a, 0x10, 0x0c,
+  0x79, 0x72, 0x50, 0xbe, 0x57, 0x60, 0x27, 0x81, 0xb6, 0xdd, 0x1d, 0x37, 0xfc, 0x52, 0x20, 0xa3,
+  0x17, 0x17, 0x42, 0x99, 0xd6, 0xcb, 0x99, 0x7d, 0x97, 0xd1, 0x86, 0x14, 0xcc, 0xd9, 0xeb, 0xab,
+  0xfb, 0xa5, 0xcd, 0xeb, 0xee, 0xd0, 0xec, 0x6a, 0x7d, 0x8b, 0x74, 0x8f, 0x20, 0xc2, 0xf0, 0xcf,
+  0x8a, 0xf4, 0x19, 0x6c, 0x31, 0x77, 0x55, 0xa8, 0x65, 0x14, 0xa7, 0x74, 0xc2, 0x86, 0x92, 0xa1,
+  0x67, 0xc0, 0xb4, 0x07, 0x63, 0x57, 0x46, 0x9d, 0xb4, 0x5c, 0x5d, 0xda, 0xd3, 0xb5, 0x99, 0x71,
+  0xca, 0x62, 0xad, 0x15, 0x02, 0x28, 0x76, 0x70, 0xdf, 0xa0, 0x15, 0x7f, 0x85, 0xa9, 0xca, 0xf4,
+  0xdc, 0x3b, 0xdf, 0xae, 0x5c, 0x55, 0x76, 0x03, 0xd1, 0xbe, 0xe9, 0xe7, 0x09, 0xee, 0x7e, 0xea,
+  0x69, 0xb5, 0x40, 0x95, 0x2b, 0x49, 0xc9, 0xc2, 0xd4, 0xaf, 0x18, 0x12, 0x39, 0xcf, 0x4e, 0xe2,
+  0x7c, 0x12, 0x71, 0x04, 0x33, 0xda, 0x3b, 0xf0, 0xc2, 0xfd, 0x42, 0xed, 0x7b, 0xc7, 0x0d, 0x5b,
+  0x76, 0x82, 0x96, 0x46, 0x9f, 0x4f, 0xdf, 0x7f, 0x91, 0x75, 0x62, 0x0b, 0x54, 0xde, 0x6a, 0x1c,
+  0x58, 0x14, 0x8f, 0x19, 0x81, 0xb7, 0x05, 0x22, 0x3f, 0x89, 0x15, 0xa7, 0x5f, 0x2e, 0x95, 0x18,
+  0x53, 0xf5, 0x97, 0xb8, 0x2b, 0x23, 0x54, 0xaf, 0xf9, 0xf9, 0x53, 0xf5, 0xe1, 0x4f, 0x3f, 0xe1,
+  0xc3, 0x4d, 0x3f, 0x5c, 0xa9, 0xc4, 0x94, 0xa8, 0x34, 0x81, 0x94, 0xe8, 0x57, 0x80, 0x3e, 0x2d,
+  0xde, 0xd4, 0x25, 0xd3, 0x35, 0x98, 0xb0, 0xfb, 0xb8, 0xaa, 0xba, 0xfb, 0xca, 0xe6, 0x01, 0x0f,
+  0xe1, 0x9e, 0x63, 0xb2, 0x31, 0xdb, 0xf2, 0xfd, 0x64, 0x37, 0x31, 0xb3, 0x2f, 0x4b, 0x91, 0xeb,
+  0x4b, 0x25, 0x53, 0xb6, 0x3c, 0xa1, 0xd4, 0xe1, 0xc8, 0x81, 0x6b, 0x05, 0xe3, 0xfc, 0x51, 0x74,
+  0x3f, 0x53, 0xba, 0x29, 0xca, 0xd4, 0xa9, 0x4a, 0x76, 0x50, 0x4a, 0x68, 0x74, 0xec, 0x3f, 0x7c,
+  0x71, 0x7c, 0xb2, 0xb3, 0x7b, 0xb0, 0x77, 0x6c, 0x06, 0xb6, 0x6f, 0xba, 0x53, 0xa1, 0x53, 0xb5,
+  0x18, 0x4b, 0x85, 0x8f, 0xb2, 0xbe, 0xf7, 0x21, 0xa5, 0xea, 0x95, 0x69, 0x61, 0x9b, 0xae, 0xc4,
+  0xc7, 0x8e, 0xdc, 0x1a, 0xcb, 0xa5, 0x41, 0xa6, 0x9c, 0xdb, 0x55, 0xd5, 0xa0, 0xb1, 0x03, 0x9d,
+  0x2e, 0xfb, 0x85, 0x76, 0x19, 0x98, 0x8d, 0x54, 0x2d, 0xbf, 0xb8, 0xd9, 0x1f, 0x06, 0x8f, 0x78,
+  0x9b, 0xb5, 0x2f, 0xb3, 0x8b, 0x47, 0xcd, 0x0e, 0x69, 0xcc, 0x3b, 0x43, 0x4e, 0x36, 0x80, 0xb6,
+  0xea, 0x29, 0x1c, 0xdd, 0x8f, 0x16, 0xa4, 0xa7, 0x03, 0xe9, 0x97, 0x56, 0x09, 0xbd, 0x7e, 0xab,
+  0xd9, 0x68, 0xed, 0xa1, 0x39, 0x02, 0xa8, 0x6b, 0xd0, 0x85, 0xf9, 0xd0, 0x3d, 0xc8, 0x6a, 0xde,
+  0xcb, 0x04, 0xcf, 0xf1, 0x70, 0x7c, 0x54, 0x4d, 0x30, 0xe6, 0x64, 0x57, 0x38, 0x13, 0x71, 0x78,
+  0x55, 0xf1, 0xd8, 0xc2, 0x09, 0xe8, 0x8b, 0xc6, 0xe9, 0x18, 0x6a, 0x38, 0xa1, 0x93, 0xa9, 0x21,
+  0xf6, 0x6e, 0xc5, 0x31, 0xae, 0x30, 0x66, 0x70, 0xa0, 0xa5, 0xbe, 0xfd, 0xb4, 0xbc, 0xef, 0xc7,
+  0x89, 0xba, 0x82, 0xc2, 0xfd, 0x59, 0xa5, 0x7e, 0x22, 0xb1, 0x06, 0xe4, 0x7d, 0xaf, 0x1b, 0x0d,
+  0xbe, 0xc4, 0x8a, 0x81, 0xd1, 0x66, 0x42, 0x83, 0xd1, 0xb2, 0x40, 0x18, 0x94, 0xe9, 0x8d, 0xfc,
+  0x3c, 0xc7, 0xf0, 0x17, 0x2d, 0x1c, 0xad, 0xd3, 0xe1, 0x5c, 0xf1, 0xfe, 0x58, 0xd1, 0x6b, 0x42,
+  0x06, 0x8e, 0x83, 0x1b, 0x92, 0x2a, 0x2a, 0xc8, 0x54, 0xc8, 0x0d, 0x23, 0x94, 0xc0, 0x3e, 0x17,
+  0xe8, 0x11, 0x17, 0xb3, 0x1b, 0x9c, 0xe8, 0x73, 0x95, 0x23, 0x19, 0x0f, 0x15, 0xbc, 0x48, 0x40,
+  0x52, 0x0b, 0xa7, 0xcd, 0xcd, 0xaf, 0xc0, 0xfb, 0xf7, 0x5f, 0xe4, 0x20, 0x54, 0xde, 0x8a, 0x1f,
+  0x44, 0xa3, 0x79, 0x4b, 0xb8, 0x7b, 0xe8, 0xe5, 0xf1, 0xce, 0xd1, 0x96, 0x03, 0xa4, 0x65, 0xbc,
+  0x2d, 0x52, 0x61, 0xb4, 0x44, 0xa3, 0xde, 0xa8, 0x89, 0xbc, 0xe1, 0x45, 0x3e, 0x35, 0x89, 0x0e,
+  0xfd, 0x6c, 0xc5, 0xce, 0x45, 0x18, 0x4f, 0x1b, 0xb5, 0x89, 0x69, 0xf8, 0x0e, 0x87, 0x62, 0x9f,
+  0x96, 0x41, 0x06, 0x3e, 0x0c, 0xe7, 0x51, 0x87, 0xa3, 0xd8, 0xa4, 0xbe, 0x02, 0xb3, 0x2b, 0x91,
+  0x72, 0x50, 0x39, 0xfe, 0xea, 0xa0, 0xb8, 0xb6, 0x9d, 0xb4, 0xe5, 0xb1, 0xb2, 0x22, 0xe1, 0xdb,
+  0xda, 0x65, 0x82, 0x7b, 0xaa, 0x45, 0x49, 0x6a, 0x30, 0x09, 0x8e, 0xac, 0x9f, 0x2c, 0xa3, 0xb6,
+  0x8c, 0xd0, 0x2c, 0xbc, 0x66, 0x46, 0x93, 0xf8, 0x0a, 0xb3, 0xde, 0x6c, 0x16, 0x06, 0x38, 0x34,
+  0x06, 0x4e, 0x92, 0x0b, 0xb8, 0x43, 0xd2, 0x4d, 0x55, 0x26, 0x80, 0x09, 0x71, 0x66, 0x59, 0x5e,
+  0x0c, 0x5f, 0x16, 0x3a, 0xeb, 0x38, 0xb2, 0x15, 0xb1, 0x04, 0xfb, 0x7a, 0xe1, 0x0d, 0xe1, 0xae,
+  0xc2, 0xaf, 0x4b, 0x88, 0xf1, 0x27, 0xd1, 0x93, 0x29, 0xe7, 0xe5, 0x55, 0x37, 0xeb, 0x17, 0xb9,
+  0x52, 0x8a, 0xac, 0x28, 0x33, 0xae, 0x47, 0x51, 0x5c, 0x81, 0xcb, 0x7c, 0x3a, 0xf8, 0x5d, 0x4f,
+  0xa8, 0x63, 0x8b, 0x53, 0x5e, 0x31, 0x9c, 0xb2, 0xbe, 0xd3, 0xee, 0x93, 0x5a, 0x40, 0xaf, 0x46,
+  0xa7, 0x00, 0x31, 0x63, 0x10, 0x33, 0x00, 0xa1, 0x6f, 0x5b, 0xf8, 0xc5, 0xdd, 0x51, 0x8b, 0x27,
+  0x0d, 0x33, 0xae, 0xca, 0xae, 0x8e, 0xb8, 0xd3, 0xd9, 0x99, 0x3b, 0xa6, 0x89, 0x30, 0x47, 0xcd,
+  0xff, 0xfa, 0x8b, 0xda, 0x73, 0xdc, 0x20, 0xe6, 0xe5, 0x2b, 0x0b, 0x73, 0x60, 0xf7, 0xe2, 0x39,
+  0x93, 0x54, 0xd9, 0xc0, 0xa9, 0xae, 0x75, 0x1f, 0xb4, 0x08, 0x06, 0xd1, 0x8e, 0x08, 0xe9, 0xf3,
+  0x9c, 0xb8, 0x6a, 0x05, 0xab, 0x1c, 0xcc, 0x17, 0x16, 0xc8, 0xd7, 0x5e, 0xa3, 0x0e, 0x7b, 0x58,
+  0x11, 0x1b, 0xf1, 0xee, 0x73, 0x9f, 0x6f, 0x0d, 0xc6, 0x08, 0x9a, 0xfe, 0x7e, 0x35, 0xc7, 0x18,
+  0x17, 0x24, 0x70, 0x1c, 0x64, 0xcb, 0xc0, 0xbe, 0x5d, 0x22, 0xe7, 0x04, 0x4b, 0x0f, 0x78, 0x41,
+  0xe3, 0x82, 0x07, 0xb5, 0x6c, 0x46, 0xca, 0x10, 0xdc, 0x07, 0xbf, 0x38, 0x64, 0x0c, 0x23, 0xe1,
+  0x90, 0x64, 0x45, 0xd5, 0x23, 0x0e, 0xd9, 0xb1, 0x7d, 0x60, 0x39, 0x12, 0x0b, 0x7d, 0xc5, 0xe1,
+  0xd2, 0x12, 0x4b, 0x30, 0x54, 0x51, 0x61, 0xa8, 0xc5, 0x49, 0x2c, 0xb7, 0x49, 0xb3, 0x14, 0x4f,
+  0x1a, 0xbb, 0x47, 0x3b, 0xc7, 0x6f, 0xf6, 0x5e, 0x3e, 0xf4, 0xa7, 0x23, 0xaa, 0x2a, 0x00, 0xb9,
+  0x64, 0x26, 0xf5, 0xb7, 0x04, 0x34, 0x5e, 0xb5, 0x66, 0x51, 0x54, 0x53, 0x29, 0x80, 0x75, 0x78,
+  0x17, 0xaa, 0x6a, 0xe8, 0x25, 0x7a, 0x30, 0x44, 0x18, 0x56, 0x81, 0x4a, 0x41, 0x62, 0xad, 0xa4,
+  0xa0, 0xa3, 0x95, 0xa0, 0x2a, 0xf3, 0x30, 0xda, 0x8e, 0x2c, 0xe2, 0x89, 0xbd, 0x3c, 0x15, 0x3c,
+  0x2f, 0x80, 0xa7, 0x66, 0x65, 0x7f, 0xec, 0x55, 0x78, 0x29, 0x30, 0x44, 0xdc, 0x5d, 0x08, 0x90,
+  0x2b, 0x89, 0xb6, 0x38, 0x9a, 0x96, 0x06, 0x92, 0x99, 0x31, 0xf3, 0x83, 0xc9, 0x1c, 0x53, 0x44,
+  0x06, 0xda, 0x3b, 0xb1, 0x50, 0x6f, 0x7e, 0xd3, 0xf9, 0x3d, 0x03, 0x96, 0x1d, 0x21, 0xd3, 0xe9,
+  0xb5, 0x1f, 0x17, 0x45, 0x87, 0x3a, 0xce, 0x94, 0xb6, 0x0a, 0x39, 0x7a, 0xf9, 0xd2, 0x96, 0x80,
+  0x43, 0xff, 0x44, 0xf2, 0x60, 0x12, 0xb9, 0x4f, 0xf6, 0x77, 0x7f, 0xfe, 0xf8, 0xe6, 0x9f, 0x20,
+  0x95, 0xaf, 0x3f, 0xe9, 0x76, 0x3d, 0x7e, 0x10, 0xd2, 0xda, 0xc2, 0x30, 0x8a, 0x42, 0xc5, 0xd3,
+  0xa2, 0x00, 0x11, 0x10, 0x42, 0x21, 0x51, 0xc0, 0xaf, 0x41, 0xb5, 0x38, 0x0f, 0x92, 0x48, 0xd3,
+  0xe1, 0x9f, 0xaf, 0x69, 0x82, 0xf4, 0x2b, 0x03, 0x8f, 0xd9, 0x75, 0x27, 0x18, 0x38, 0x6e, 0x03,
+  0x1e, 0xe6, 0x7f, 0xda, 0x23, 0xeb, 0x19, 0xfe, 0x9f, 0xc5, 0x73, 0x8a, 0xea, 0x13, 0xcf, 0xe5,
+  0x77, 0xaa, 0x24, 0x41, 0xec, 0xaf, 0x0f, 0x3b, 0xc7, 0x62, 0x40, 0xc8, 0xb1, 0xa7, 0xbc, 0xcd,
+  0x2c, 0xd9, 0x5e, 0x6a, 0x99, 0x1e, 0xea, 0x95, 0x70, 0xa4, 0xdd, 0x85, 0xce, 0xcb, 0x67, 0x05,
+  0xba, 0x5d, 0x6c, 0x54, 0xf6, 0x26, 0xd0, 0xcf, 0xac, 0x81, 0x01, 0x14, 0x39, 0x32, 0x7c, 0x7c,
+  0x26, 0xc1, 0x6d, 0x15, 0xa0, 0x7d, 0x6c, 0x59, 0xe7, 0xb4, 0x06, 0x00, 0x6d, 0x31, 0xce, 0x8a,
+  0xa5, 0x94, 0xcf, 0xaa, 0x11, 0xf7, 0x26, 0x38, 0x95, 0x2e, 0x44, 0xeb, 0xb4, 0xb2, 0x22, 0x11,
+  0xb6, 0x4c, 0xd6, 0x9d, 0x42, 0x43, 0xb5, 0x98, 0x01, 0x7a, 0x0b, 0x90, 0xf3, 0xc9, 0x52, 0x96,
+  0x43, 0xca, 0x98, 0xb5, 0x69, 0xc5, 0x8e, 0xe4, 0x02, 0xf4, 0xf5, 0xba, 0x44, 0x2d, 0xda, 0x87,
+  0x7d, 0xad, 0xbe, 0x51, 0x27, 0x4f, 0x64, 0x69, 0x8a, 0xde, 0x13, 0x57, 0x81, 0x6f, 0x62, 0x7c,
+  0x06, 0x5b, 0x2c, 0xad, 0x68, 0x36, 0x57, 0xd4, 0xec, 0x8e, 0xcb, 0xd5, 0xe0, 0xfe, 0xb6, 0x2b,
+  0xfc, 0xf1, 0xfe, 0xdb, 0x5f, 0x0e, 0x76, 0x4e, 0xb0, 0xb0, 0x6f, 0x91, 0x5a, 0x8d, 0x98, 0x03,
+  0xcd, 0xee, 0x7e, 0xf2, 0xaa, 0xf1, 0x56, 0x32, 0x38, 0xc3, 0x96, 0x78, 0xd2, 0xdd, 0x74, 0x35,
+  0x30, 0x76, 0x26, 0x27, 0x41, 0xf3, 0x35, 0xa3, 0x8a, 0x7f, 0x9c, 0x2a, 0x6d, 0x6d, 0xa3, 0x02,
+  0x4d, 0x01, 0xf9, 0xf8, 0x66, 0xff, 0xe4, 0xe3, 0x9b, 0xbd, 0xfd, 0xd7, 0x6f, 0xa8, 0x62, 0x70,
+  0xd7, 0xb4, 0x54, 0x17, 0x66, 0x3f, 0x81, 0xe2, 0x2b, 0x9a, 0xd1, 0x43, 0x59, 0xa5, 0x75, 0x06,
+  0x7c, 0xb2, 0x45, 0xbe, 0x98, 0x58, 0x25, 0x05, 0x98, 0x2c, 0x2e, 0x1e, 0x9b, 0x5c, 0xb0, 0x7e,
+  0x2b, 0x47, 0xcd, 0x85, 0x69, 0x64, 0x16, 0x5c, 0x66, 0xdb, 0x21, 0x9a, 0x70, 0xaf, 0xc3, 0xd9,
+  0x8c, 0x93, 0x48, 0x94, 0x86, 0x42, 0x80, 0x5f, 0xda, 0x3f, 0x40, 0x54, 0x0f, 0x27, 0x54, 0xa8,
+  0x49, 0x0a, 0xc8, 0x48, 0x83, 0x3a, 0xb4, 0x5f, 0xa8, 0x88, 0xb4, 0x9e, 0x97, 0x80, 0x3d, 0x23,
+  0x42, 0xa6, 0x4a, 0x99, 0xdc, 0x57, 0x25, 0x87, 0x83, 0x67, 0xad, 0xd2, 0x29, 0xaf, 0x5a, 0xbe,
+  0x83, 0xd4, 0xdb, 0x41, 0x71, 0x4c, 0x92, 0x7f, 0x1e, 0xe7, 0xb6, 0xc4, 0xeb, 0x63, 0x4c, 0x80,
+  0x36, 0xb5, 0x13, 0x8a, 0x2f, 0x06, 0xa9, 0x0a, 0x17, 0x14, 0xbd, 0x47, 0x76, 0x6e, 0x15, 0x65,
+  0xdc, 0xf7, 0x27, 0xbe, 0x60, 0x8e, 0x3b, 0x08, 0x67, 0xa1, 0xcc, 0x1e, 0xe5, 0x57, 0xc8, 0x78,
+  0x6b, 0xf0, 0xa9, 0x74, 0x0f, 0x6c, 0x4d, 0xc5, 0xbf, 0xa4, 0xdc, 0xa1, 0x2c, 0x21, 0x3d, 0x4f,
+  0xba, 0x89, 0x94, 0x95, 0x22, 0xaa, 0xe7, 0xa6, 0x2f, 0x67, 0xc5, 0xe0, 0x8f, 0x9a, 0x9c, 0x15,
+  0x1e, 0xd5, 0x4b, 0xf9, 0x7c, 0x16, 0x5e, 0x4f, 0x31, 0xdd, 0x68, 0x5a, 0xd3, 0xc8, 0x9f, 0x9d,
+  0x84, 0x1e, 0x2b, 0xfe, 0xee, 0x54, 0x93, 0x14, 0xad, 0x4a, 0x0c, 0x55, 0xd3, 0x36, 0xc9, 0x67,
+  0xa4, 0xb8, 0xd5, 0x69, 0xa5, 0x59, 0x0b, 0x0b, 0xf3, 0x81, 0xa8, 0x52, 0x17, 0x5a, 0x12, 0x74,
+  0xbd, 0x3f, 0xfb, 0x8e, 0xf6, 0xea, 0xe1, 0x1c, 0x2b, 0x75, 0x82, 0x02, 0xb4, 0xbe, 0x56, 0x85,
+  0x54, 0x0b, 0x61, 0xb7, 0xc0, 0x40, 0xcd, 0x58, 0xea, 0xb1, 0x27, 0x33, 0x62, 0x7a, 0xd7, 0x40,
+  0xa3, 0x3f, 0xf5, 0xd1, 0xd7, 0x72, 0x01, 0xa4, 0x89, 0x1b, 0x6d, 0x0a, 0xaa, 0x6f, 0x9c, 0x37,
+  0xaa, 0x0f, 0x65, 0x26, 0xaf, 0xed, 0x53, 0xf5, 0x1f, 0xff, 0x9c, 0xa4, 0xd9, 0x38, 0x1e, 0x01,
+  0x66, 0x5b, 0xe2, 0x1c, 0x73, 0x6c, 0x80, 0xf8, 0x77, 0x1e, 0xe7, 0xa5, 0x08, 0x18, 0xb2, 0x80,
+  0xb8, 0xbb, 0xb2, 0x52, 0xf1, 0x45, 0x28, 0xd4, 0xa3, 0xd5, 0x6d, 0x85, 0xf2, 0xc7, 0x67, 0xb5,
+  0x49, 0x60, 0xbf, 0x54, 0x87, 0xfe, 0x59, 0xfc, 0x7f, 0x5b, 0xf0, 0xcf, 0xb3, 0x67, 0xa2, 0xb7,
+  0xee, 0x7d, 0x8a, 0x7b, 0xb1, 0xf7, 0xf7, 0xba, 0xce, 0x1b, 0xb5, 0x7b, 0x94, 0x21, 0x74, 0xeb,
+  0x93, 0xf7, 0x54, 0x86, 0x67, 0x61, 0x49, 0x37, 0xb0, 0x71, 0x91, 0xad, 0x1b, 0x5f, 0x9a, 0x2e,
+  0x7d, 0x99, 0xb7, 0xb6, 0x4c, 0xfa, 0xf0, 0x17, 0x40, 0x29, 0x17, 0xff, 0xb4, 0x04, 0x70, 0x46,
+  0x57, 0xe6, 0x69, 0xe4, 0x5d, 0x74, 0xab, 0x6d, 0x2d, 0xd1, 0xd9, 0x75, 0x1d, 0xaa, 0x74, 0x40,
+  0x62, 0x4e, 0x5f, 0x0a, 0xa2, 0x52, 0xf2, 0x14, 0xb7, 0x44, 0x0e, 0x14, 0x3d, 0x40, 0xbb, 0xa9,
+  0xa5, 0x04, 0x55, 0xb3, 0x41, 0x86, 0x8c, 0x3e, 0xb4, 0x02, 0x0a, 0x4a, 0xd9, 0xa9, 0x16, 0x57,
+  0xea, 0xc0, 0xa8, 0xc5, 0x0d, 0xb2, 0x52, 0x7b, 0x0a, 0x9a, 0x77, 0xbc, 0xc1, 0x73, 0x6c, 0x36,
+  0xb4, 0xb9, 0x94, 0x4a, 0x43, 0x67, 0x84, 0xb5, 0x2a, 0x8d, 0x62, 0xe4, 0xa6, 0x93, 0xd2, 0xec,
+  0x4c, 0x4b, 0x1a, 0xec, 0x4f, 0x0d, 0xa9, 0xb3, 0x35, 0xe8, 0xe3, 0x9a, 0x13, 0xc5, 0x94, 0x95,
+  0xc3, 0x67, 0x2d, 0x85, 0x26, 0x22, 0x2b, 0xf9, 0xbf, 0xd4, 0x85, 0xf4, 0x05, 0xea, 0x89, 0xb6,
+  0x38, 0x7f, 0x5a, 0xf9, 0x0c, 0xaf, 0x05, 0xcd, 0x65, 0x44, 0x5d, 0xe3, 0x38, 0xaa, 0x0e, 0xb3,
+  0x7b, 0x56, 0x7f, 0xf8, 0xe8, 0x83, 0xc5, 0xb6, 0x8b, 0x8e, 0x33, 0xd7, 0xa4, 0x0b, 0xac, 0x6a,
+  0xa7, 0xde, 0x36, 0xc8, 0x70, 0xa2, 0x6d, 0x88, 0xf3, 0x70, 0xe1, 0xf3, 0xad, 0x0b, 0x3a, 0x30,
+  0xc6, 0x7f, 0x44, 0x3a, 0xaf, 0x42, 0x59, 0x48, 0xf2, 0x28, 0xa9, 0x05, 0x24, 0xfd, 0x25, 0xc5,
+  0x0f, 0x50, 0x6a, 0x6c, 0xb4, 0xcf, 0xd7, 0x2f, 0xb2, 0xb2, 0xc3, 0x5b, 0x1b, 0x99, 0xd3, 0x01,
+  0x6a, 0x6c, 0x81, 0xf9, 0x88, 0x61, 0x78, 0x6f, 0x6f, 0x74, 0x9b, 0x35, 0x94, 0xb0, 0xe8, 0x78,
+  0xbf, 0xf5, 0xe5, 0xcb, 0x9c, 0xe8, 0x74, 0x3e, 0x71, 0x53, 0x38, 0xb7, 0xbc, 0x29, 0x9a, 0xdd,
+  0xd4, 0xed, 0x02, 0x5d, 0x37, 0x58, 0xcc, 0x79, 0xb3, 0x5e, 0xa5, 0x87, 0x87, 0x9d, 0xf2, 0xd4,
+  0xd2, 0x17, 0x68, 0xc5, 0x95, 0xd7, 0x0d, 0xff, 0xe3, 0xc6, 0x4e, 0x2e, 0xa5, 0x10, 0x7e, 0x03,
+  0xbd, 0x5d, 0x52, 0xf5, 0x76, 0xe1, 0xb4, 0x07, 0x17, 0xcc, 0x9b, 0x22, 0x29, 0xf8, 0x6f, 0xd0,
+  0xbc, 0xf0, 0x7c, 0xaf, 0x51, 0xf8, 0x7d, 0xd3, 0x6e, 0x37, 0x14, 0x93, 0xce, 0x6d, 0x8f, 0x83,
+  0xb2, 0xb7, 0xeb, 0x16, 0x73, 0xee, 0x8c, 0x5c, 0x17, 0xeb, 0x01, 0xbb, 0xc5, 0x15, 0xde, 0xf4,
+  0xbd, 0xcd, 0xe5, 0xba, 0xea, 0x72, 0x8a, 0x8f, 0xa3, 0xf8, 0x77, 0x7f, 0xfd, 0x93, 0xdb, 0x9a,
+  0xe5, 0xda, 0x2e, 0xfd, 0xb1, 0x6b, 0x66, 0x59, 0xd2, 0x54, 0xbb, 0xbd, 0x59, 0xa3, 0x96, 0x65,
+  0x7c, 0x09, 0x85, 0x3a, 0xed, 0x70, 0xf3, 0xf7, 0x2a, 0xa8, 0x6a, 0x89, 0xf6, 0x5e, 0x53, 0x57,
+  0x31, 0x29, 0x1f, 0xee, 0x6e, 0x97, 0xe5, 0xa1, 0xa5, 0xb8, 0xed, 0x90, 0x1f, 0xb7, 0xb6, 0x4c,
+  0xb2, 0xab, 0x3b, 0x8f, 0xf9, 0xda, 0xef, 0x11, 0xab, 0xd0, 0x1a, 0xbf, 0xd6, 0x7b, 0xf2, 0xa4,
+  0xb7, 0xfe, 0x64, 0xed, 0x49, 0xcf, 0x9b, 0xb0, 0x73, 0x88, 0xe3, 0xb8, 0x72, 0x07, 0x4b, 0xf8,
+  0xf6, 0xff, 0x63, 0xaf, 0x19, 0xa0, 0x18, 0x19, 0x0a, 0x5e, 0xc1, 0x15, 0x89, 0x55, 0xc1, 0x53,
+  0x60, 0xc8, 0x71, 0xb3, 0x29, 0xcb, 0x17, 0x6d, 0xd6, 0x74, 0x92, 0x57, 0x8b, 0xf8, 0x72, 0x3e,
+  0x09, 0xc6, 0x70, 0x99, 0x78, 0xf2, 0xf7, 0xbf, 0xff, 0xfd, 0x49, 0xef, 0xa7, 0xa6, 0x4f, 0x3c,
+  0xf3, 0xa0, 0xbd, 0xda, 0xf0, 0xb4, 0x90, 0x0f, 0x5a, 0xda, 0x39, 0xd6, 0x2a, 0x04, 0xbb, 0x96,
+  0xcd, 0x6d, 0x5b, 0x25, 0xe3, 0x6c, 0x99, 0xab, 0xa6, 0xca, 0xd5, 0xd7, 0x88, 0x51, 0x65, 0xbc,
+  0x1e, 0xa0, 0xb7, 0x79, 0x67, 0x9e, 0x5a, 0x87, 0x5c, 0x00, 0x18, 0x68, 0x72, 0x60, 0xec, 0xd3,
+  0xde, 0x17, 0xed, 0x98, 0xf6, 0xf9, 0xb2, 0xba, 0xcc, 0x29, 0xaf, 0x72, 0x4f, 0x96, 0xf9, 0x79,
+  0x92, 0x6b, 0x72, 0x8a, 0x40, 0x0f, 0xdd, 0x90, 0xe2, 0xd9, 0x0a, 0xc5, 0x8c, 0xae, 0x26, 0xbe,
+  0x17, 0x3e, 0x7a, 0x6a, 0x4b, 0x65, 0x64, 0x52, 0x71, 0x32, 0xbe, 0x96, 0x53, 0x52, 0x5a, 0x84,
+  0xf9, 0x5b, 0x9f, 0x84, 0x3f, 0x5e, 0x26, 0x81, 0x63, 0xa1, 0x6f, 0x20, 0xf3, 0xde, 0xd7, 0xa4,
+  0xb4, 0x0f, 0x07, 0x83, 0x39, 0x10, 0x77, 0x08, 0x8d, 0xde, 0x66, 0xae, 0xbc, 0x91, 0xd6, 0x8d,
+  0xc2, 0xb4, 0x1f, 0x2e, 0x07, 0x75, 0xc5, 0x75, 0x41, 0x97, 0x20, 0x38, 0x95, 0x72, 0x45, 0x77,
+  0xe5, 0xb5, 0x90, 0xe3, 0x8e, 0xa1, 0x81, 0xf6, 0xb8, 0x86, 0x9a, 0xae, 0x3d, 0xdb, 0x74, 0xb2,
+  0x1d, 0x65, 0x05, 0x75, 0xec, 0x56, 0xa9, 0x14, 0x76, 0x0c, 0x79, 0x7b, 0x4b, 0xbe, 0xa9, 0x36,
+  0x97, 0xbb, 0xd9, 0xa7, 0xad, 0xfa, 0x78, 0xa4, 0x27, 0x1c, 0x87, 0x8b, 0x55, 0x7b, 0x49, 0x80,
+  0x1d, 0x0f, 0x6b, 0xd7, 0x83, 0xdd, 0xe5, 0x9d, 0x55, 0xc6, 0xb5, 0xfc, 0xcf, 0xc6, 0x30, 0x7f,
+  0x34, 0x35, 0x8e, 0xee, 0x64, 0xcf, 0xde, 0x38, 0xb8, 0xc2, 0x96, 0xac, 0x19, 0x11, 0xe8, 0xbb,
+  0x11, 0x79, 0x1c, 0x4f, 0xe3, 0xbc, 0xf8, 0xe1, 0xd9, 0x6a, 0x36, 0x48, 0xe3, 0x59, 0xbe, 0xfd,
+  0xe0, 0xd9, 0xea, 0x79, 0x32, 0xbc, 0xd9, 0x7e, 0x00, 0x1f, 0xc6, 0xf9, 0xe5, 0x64, 0xfb, 0xff,
+  0x02, 0x7b, 0xd9, 0xd3, 0xaf, 0x16, 0x73, 0x01, 0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+  {"/", "text/html", "\"60003eaabe713e52\"", asset_index, sizeof(asset_index), 94998},
+};
+#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))